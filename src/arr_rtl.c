@@ -46,12 +46,14 @@
 #include "stdlib.h"
 #include "stdio.h"
 #include "string.h"
+#include "math.h"
 
 #include "common.h"
 #include "data_rtl.h"
 #include "os_decls.h"
 #include "heaputl.h"
 #include "striutl.h"
+#include "flt_rtl.h"
 #include "str_rtl.h"
 #include "cmd_rtl.h"
 #include "cmd_drv.h"
@@ -62,7 +64,14 @@
 #include "arr_rtl.h"
 
 
-#define QSORT_LIMIT 8
+#define INSERTION_SORT_LIMIT 8
+
+#if WITH_RTL_ARRAY_CAPACITY
+#define GROW_RTL_ARRAY(var,old,len) \
+    ((len) <= (old)->capacity ? ((var) = (old)) != NULL : ((var) = growArray(old, len)) != NULL)
+#else
+#define GROW_RTL_ARRAY(var,old,len) REALLOC_RTL_ARRAY(var, old, len)
+#endif
 
 
 
@@ -98,131 +107,290 @@ static void printArgv (const int argc, const cstriType *const argv)
 
 
 
+typedef void (*mergeSortFuncType) (rtlObjectType *, memSizeType,
+    rtlObjectType *, const compareFuncType, const boolType);
+
+
+
 /**
- *  Sort an array of 'rtlObjectType' elements with the quicksort algorithm.
- *  In contrast to qsort() this function uses a different compare function.
- *  The compare function of qsort() has two void pointers as parameters.
- *  @param begin_sort Pointer to first element to be sorted.
- *  @param end_sort Pointer to the last element to be sorted.
+ *  Sort an array of 'rtlObjectType' elements with a stable merge sort.
+ *  Elements that compare equal keep their relative order.
+ *  Short parts of the array are sorted with insertion sort.
+ *  @param arr Pointer to the first element to be sorted.
+ *  @param length Number of elements to be sorted.
+ *  @param buffer Temporary storage for at least length / 2 elements.
  *  @param cmp_func Pointer to a compare function that gets two values as
  *         'rtlValueUnion' and compares them.
+ *  @param reverse TRUE if the elements should be sorted in descending order.
+ */
+static void rtl_merge_sort (rtlObjectType *arr, memSizeType length,
+    rtlObjectType *buffer, const compareFuncType cmp_func, const boolType reverse)
+
+  {
+    memSizeType middle;
+    memSizeType left;
+    memSizeType right;
+    memSizeType pos;
+    rtlValueUnion element;
+    boolType takeRight;
+
+  /* rtl_merge_sort */
+    if (length <= INSERTION_SORT_LIMIT) {
+      for (pos = 1; pos < length; pos++) {
+        element = arr[pos].value;
+        for (left = pos; left != 0 &&
+             (reverse ? cmp_func(element, arr[left - 1].value) > 0 :
+                        cmp_func(element, arr[left - 1].value) < 0); left--) {
+          arr[left].value = arr[left - 1].value;
+        } /* for */
+        arr[left].value = element;
+      } /* for */
+    } else {
+      middle = length >> 1;
+      rtl_merge_sort(arr, middle, buffer, cmp_func, reverse);
+      rtl_merge_sort(&arr[middle], length - middle, buffer, cmp_func, reverse);
+      if (reverse ? cmp_func(arr[middle].value, arr[middle - 1].value) > 0 :
+                    cmp_func(arr[middle].value, arr[middle - 1].value) < 0) {
+        memcpy(buffer, arr, middle * sizeof(rtlObjectType));
+        left = 0;
+        right = middle;
+        pos = 0;
+        while (left < middle && right < length) {
+          /* The result of the comparison is unpredictable. To avoid */
+          /* mispredicted branches the next element is selected with */
+          /* a conditional move and both indices are advanced with */
+          /* arithmetic. */
+          takeRight = reverse ? cmp_func(arr[right].value, buffer[left].value) > 0 :
+                                cmp_func(arr[right].value, buffer[left].value) < 0;
+          arr[pos] = *(takeRight ? &arr[right] : &buffer[left]);
+          right += (memSizeType) takeRight;
+          left += (memSizeType) !takeRight;
+          pos++;
+        } /* while */
+        memcpy(&arr[pos], &buffer[left], (middle - left) * sizeof(rtlObjectType));
+      } /* if */
+    } /* if */
+  } /* rtl_merge_sort */
+
+
+
+static inline boolType fltLess (const floatType number1, const floatType number2)
+
+  { /* fltLess */
+#if FLOAT_COMPARISON_OKAY
+    /* NaN is greater than all other values, like in fltCmp(). */
+    return number1 < number2 ||
+        (os_isnan(number2) != 0 && os_isnan(number1) == 0);
+#else
+    return fltCmp(number1, number2) < 0;
+#endif
+  } /* fltLess */
+
+
+
+/**
+ *  Stable merge sort for arrays of 'floatType' elements.
+ *  This is rtl_merge_sort() with the comparison of fltCmp() inlined.
+ *  The function is called via mergeSortFuncType, so cmp_func is not used.
+ */
+static void flt_merge_sort (rtlObjectType *arr, memSizeType length,
+    rtlObjectType *buffer, const compareFuncType cmp_func, const boolType reverse)
+
+  {
+    memSizeType middle;
+    memSizeType left;
+    memSizeType right;
+    memSizeType pos;
+    floatType element;
+    boolType takeRight;
+
+  /* flt_merge_sort */
+    if (length <= INSERTION_SORT_LIMIT) {
+      for (pos = 1; pos < length; pos++) {
+        element = arr[pos].value.floatValue;
+        for (left = pos; left != 0 &&
+             (reverse ? fltLess(arr[left - 1].value.floatValue, element) :
+                        fltLess(element, arr[left - 1].value.floatValue)); left--) {
+          arr[left].value = arr[left - 1].value;
+        } /* for */
+        arr[left].value.floatValue = element;
+      } /* for */
+    } else {
+      middle = length >> 1;
+      flt_merge_sort(arr, middle, buffer, cmp_func, reverse);
+      flt_merge_sort(&arr[middle], length - middle, buffer, cmp_func, reverse);
+      if (reverse ? fltLess(arr[middle - 1].value.floatValue, arr[middle].value.floatValue) :
+                    fltLess(arr[middle].value.floatValue, arr[middle - 1].value.floatValue)) {
+        memcpy(buffer, arr, middle * sizeof(rtlObjectType));
+        left = 0;
+        right = middle;
+        pos = 0;
+        while (left < middle && right < length) {
+          takeRight = reverse ?
+              fltLess(buffer[left].value.floatValue, arr[right].value.floatValue) :
+              fltLess(arr[right].value.floatValue, buffer[left].value.floatValue);
+          arr[pos] = *(takeRight ? &arr[right] : &buffer[left]);
+          right += (memSizeType) takeRight;
+          left += (memSizeType) !takeRight;
+          pos++;
+        } /* while */
+        memcpy(&arr[pos], &buffer[left], (middle - left) * sizeof(rtlObjectType));
+      } /* if */
+    } /* if */
+  } /* flt_merge_sort */
+
+
+
+/**
+ *  Stable merge sort for arrays of 'intType' elements.
+ *  This is rtl_merge_sort() with the comparison of intCmp() inlined.
+ *  The function is called via mergeSortFuncType, so cmp_func is not used.
+ */
+static void int_merge_sort (rtlObjectType *arr, memSizeType length,
+    rtlObjectType *buffer, const compareFuncType cmp_func, const boolType reverse)
+
+  {
+    memSizeType middle;
+    memSizeType left;
+    memSizeType right;
+    memSizeType pos;
+    intType element;
+    boolType takeRight;
+
+  /* int_merge_sort */
+    if (length <= INSERTION_SORT_LIMIT) {
+      for (pos = 1; pos < length; pos++) {
+        element = arr[pos].value.intValue;
+        for (left = pos; left != 0 &&
+             (reverse ? arr[left - 1].value.intValue < element :
+                        element < arr[left - 1].value.intValue); left--) {
+          arr[left].value = arr[left - 1].value;
+        } /* for */
+        arr[left].value.intValue = element;
+      } /* for */
+    } else {
+      middle = length >> 1;
+      int_merge_sort(arr, middle, buffer, cmp_func, reverse);
+      int_merge_sort(&arr[middle], length - middle, buffer, cmp_func, reverse);
+      if (reverse ? arr[middle - 1].value.intValue < arr[middle].value.intValue :
+                    arr[middle].value.intValue < arr[middle - 1].value.intValue) {
+        memcpy(buffer, arr, middle * sizeof(rtlObjectType));
+        left = 0;
+        right = middle;
+        pos = 0;
+        while (left < middle && right < length) {
+          takeRight = reverse ?
+              buffer[left].value.intValue < arr[right].value.intValue :
+              arr[right].value.intValue < buffer[left].value.intValue;
+          arr[pos] = *(takeRight ? &arr[right] : &buffer[left]);
+          right += (memSizeType) takeRight;
+          left += (memSizeType) !takeRight;
+          pos++;
+        } /* while */
+        memcpy(&arr[pos], &buffer[left], (middle - left) * sizeof(rtlObjectType));
+      } /* if */
+    } /* if */
+  } /* int_merge_sort */
+
+
+
+static inline boolType strPrecedes (const const_striType stri1,
+    const const_striType stri2, const boolType reverse)
+
+  { /* strPrecedes */
+    return reverse ? strCompare(stri1, stri2) > 0 : strCompare(stri1, stri2) < 0;
+  } /* strPrecedes */
+
+
+
+/**
+ *  Sort an array of 'striType' elements with the quicksort algorithm.
+ *  Strings that compare equal have the same characters, so a stable
+ *  sort would give the same result. Comparing every element against
+ *  the same pivot string is more cache friendly than merging, when
+ *  the strings are spread over the heap.
+ *  @param begin_sort Pointer to first element to be sorted.
+ *  @param end_sort Pointer to the last element to be sorted.
+ *  @param reverse TRUE if the elements should be sorted in descending order.
  */
-static void rtl_qsort_array (rtlObjectType *begin_sort, rtlObjectType *end_sort,
-    const compareFuncType cmp_func)
+static void str_qsort_array (rtlObjectType *begin_sort, rtlObjectType *end_sort,
+    const boolType reverse)
 
   {
-    rtlValueUnion compare_elem;
-    rtlValueUnion help_element;
+    striType compare_elem;
+    striType help_element;
     rtlObjectType *middle_elem;
     rtlObjectType *less_elem;
     rtlObjectType *greater_elem;
-    intType cmp;
 
-  /* rtl_qsort_array */
-    if (end_sort - begin_sort < QSORT_LIMIT) {
-      /* Use insertion sort */
+  /* str_qsort_array */
+    if (end_sort - begin_sort < INSERTION_SORT_LIMIT) {
       for (middle_elem = begin_sort + 1; middle_elem <= end_sort; middle_elem++) {
-        compare_elem = middle_elem->value;
+        compare_elem = middle_elem->value.striValue;
         less_elem = begin_sort - 1;
         do {
           less_elem++;
-          cmp = cmp_func(less_elem->value, compare_elem);
-        } while (cmp < 0);
+        } while (strPrecedes(less_elem->value.striValue, compare_elem, reverse));
         memmove(&less_elem[1], less_elem, (memSizeType)
                 (middle_elem - less_elem) * sizeof(rtlObjectType));
-        less_elem->value = compare_elem;
+        less_elem->value.striValue = compare_elem;
       } /* for */
     } else {
       middle_elem = &begin_sort[((memSizeType)(end_sort - begin_sort)) >> 1];
-      compare_elem = middle_elem->value;
-      middle_elem->value = end_sort->value;
-      end_sort->value = compare_elem;
+      compare_elem = middle_elem->value.striValue;
+      middle_elem->value.striValue = end_sort->value.striValue;
+      end_sort->value.striValue = compare_elem;
       less_elem = begin_sort - 1;
       greater_elem = end_sort;
       do {
         do {
           less_elem++;
-          cmp = cmp_func(less_elem->value, compare_elem);
-        } while (cmp < 0);
+        } while (strPrecedes(less_elem->value.striValue, compare_elem, reverse));
         do {
           greater_elem--;
-          cmp = cmp_func(greater_elem->value, compare_elem);
-        } while (cmp > 0 && greater_elem != begin_sort);
-        help_element = less_elem->value;
-        less_elem->value = greater_elem->value;
-        greater_elem->value = help_element;
+        } while (strPrecedes(compare_elem, greater_elem->value.striValue, reverse) &&
+                 greater_elem != begin_sort);
+        help_element = less_elem->value.striValue;
+        less_elem->value.striValue = greater_elem->value.striValue;
+        greater_elem->value.striValue = help_element;
       } while (greater_elem > less_elem);
-      greater_elem->value = less_elem->value;
-      less_elem->value = compare_elem;
-      end_sort->value = help_element;
-      rtl_qsort_array(begin_sort, less_elem - 1, cmp_func);
-      rtl_qsort_array(less_elem + 1, end_sort, cmp_func);
+      greater_elem->value.striValue = less_elem->value.striValue;
+      less_elem->value.striValue = compare_elem;
+      end_sort->value.striValue = help_element;
+      str_qsort_array(begin_sort, less_elem - 1, reverse);
+      str_qsort_array(less_elem + 1, end_sort, reverse);
     } /* if */
-  } /* rtl_qsort_array */
+  } /* str_qsort_array */
 
 
 
 /**
- *  Reverse sort an array of 'rtlObjectType' elements with the quicksort algorithm.
- *  In contrast to qsort() this function uses a different compare function.
- *  The compare function of qsort() has two void pointers as parameters.
- *  @param begin_sort Pointer to first element to be sorted.
- *  @param end_sort Pointer to the last element to be sorted.
- *  @param cmp_func Pointer to a compare function that gets two values as
- *         'rtlValueUnion' and compares them.
+ *  Sort the elements of arr1 in place with the given merge sort function.
+ *  The temporary buffer of the merge sort is allocated and freed here.
+ *  @exception MEMORY_ERROR Not enough memory for the temporary buffer.
  */
-static void rtl_qsort_array_reverse (rtlObjectType *begin_sort, rtlObjectType *end_sort,
-    const compareFuncType cmp_func)
+static void sortRtlArray (const rtlArrayType arr1, const mergeSortFuncType mergeSort,
+    const compareFuncType cmp_func, const boolType reverse)
 
   {
-    rtlValueUnion compare_elem;
-    rtlValueUnion help_element;
-    rtlObjectType *middle_elem;
-    rtlObjectType *less_elem;
-    rtlObjectType *greater_elem;
-    intType cmp;
-
-  /* rtl_qsort_array_reverse */
-    if (end_sort - begin_sort < QSORT_LIMIT) {
-      /* Use insertion sort */
-      for (middle_elem = begin_sort + 1; middle_elem <= end_sort; middle_elem++) {
-        compare_elem = middle_elem->value;
-        greater_elem = begin_sort - 1;
-        do {
-          greater_elem++;
-          cmp = cmp_func(greater_elem->value, compare_elem);
-        } while (cmp > 0);
-        memmove(&greater_elem[1], greater_elem, (memSizeType)
-                (middle_elem - greater_elem) * sizeof(rtlObjectType));
-        greater_elem->value = compare_elem;
-      } /* for */
+    memSizeType length;
+    memSizeType buffer_size;
+    rtlObjectType *buffer;
+
+  /* sortRtlArray */
+    length = arraySize(arr1);
+    if (length <= INSERTION_SORT_LIMIT) {
+      mergeSort(arr1->arr, length, NULL, cmp_func, reverse);
     } else {
-      middle_elem = &begin_sort[((memSizeType)(end_sort - begin_sort)) >> 1];
-      compare_elem = middle_elem->value;
-      middle_elem->value = end_sort->value;
-      end_sort->value = compare_elem;
-      greater_elem = begin_sort - 1;
-      less_elem = end_sort;
-      do {
-        do {
-          greater_elem++;
-          cmp = cmp_func(greater_elem->value, compare_elem);
-        } while (cmp > 0);
-        do {
-          less_elem--;
-          cmp = cmp_func(less_elem->value, compare_elem);
-        } while (cmp < 0 && less_elem != begin_sort);
-        help_element = greater_elem->value;
-        greater_elem->value = less_elem->value;
-        less_elem->value = help_element;
-      } while (less_elem > greater_elem);
-      less_elem->value = greater_elem->value;
-      greater_elem->value = compare_elem;
-      end_sort->value = help_element;
-      rtl_qsort_array_reverse(begin_sort, greater_elem - 1, cmp_func);
-      rtl_qsort_array_reverse(greater_elem + 1, end_sort, cmp_func);
+      buffer_size = length >> 1;
+      if (unlikely(!ALLOC_TABLE(buffer, rtlObjectType, buffer_size))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        mergeSort(arr1->arr, length, buffer, cmp_func, reverse);
+        FREE_TABLE(buffer, rtlObjectType, buffer_size);
+      } /* if */
     } /* if */
-  } /* rtl_qsort_array_reverse */
+  } /* sortRtlArray */
 
 
 
@@ -644,6 +812,52 @@ void freeRtlStriArray (rtlArrayType work_array, intType used_max_position)
 
 
 
+#if WITH_RTL_ARRAY_CAPACITY
+/**
+ *  Enlarge the capacity of an array.
+ *  This function is called from the macro GROW_RTL_ARRAY, if the
+ *  capacity of an array is not sufficient. It is assumed that the
+ *  array will grow further, therefore the capacity is usually
+ *  doubled. The elements and the indices of the array are kept.
+ *  @param arr Array for which the capacity is enlarged.
+ *  @param len Number of elements that must fit into the array.
+ *  @return the enlarged array, or NULL if the allocation failed.
+ */
+static rtlArrayType growArray (rtlArrayType arr, memSizeType len)
+
+  {
+    memSizeType newCapacity;
+    rtlArrayType result;
+
+  /* growArray */
+    if (arr->capacity > MAX_RTL_ARR_LEN / 2) {
+      newCapacity = MAX_RTL_ARR_LEN;
+    } else {
+      newCapacity = 2 * arr->capacity;
+    } /* if */
+    if (newCapacity < len) {
+      newCapacity = len;
+    } /* if */
+    if (newCapacity < MIN_ARRAY_GROW_CAPACITY) {
+      newCapacity = MIN_ARRAY_GROW_CAPACITY;
+    } /* if */
+    if (unlikely(!REALLOC_RTL_ARRAY(result, arr, newCapacity))) {
+      /* Try again without reserve. */
+      if (newCapacity == len || !REALLOC_RTL_ARRAY(result, arr, len)) {
+        result = NULL;
+      } /* if */
+    } /* if */
+    logFunction(printf("growArray(" FMT_U_MEM ", " FMT_U_MEM ") --> "
+                       FMT_U_MEM " (capacity=" FMT_U_MEM ")\n",
+                       (memSizeType) arr, len, (memSizeType) result,
+                       result != NULL ? result->capacity : (memSizeType) 0););
+    return result;
+  } /* growArray */
+
+#endif
+
+
+
 /**
  *  Fill an array of 'len' objects with the generic value 'element'.
  *  This function uses loop unrolling inspired by Duff's device.
@@ -742,7 +956,7 @@ void arrAppend (rtlArrayType *const arr_variable, const rtlArrayType extension)
         raise_error(MEMORY_ERROR);
       } else {
         new_size = arr_to_size + extension_size;
-        if (unlikely(!REALLOC_RTL_ARRAY(arr_to, arr_to, new_size))) {
+        if (unlikely(!GROW_RTL_ARRAY(arr_to, arr_to, new_size))) {
           raise_error(MEMORY_ERROR);
         } else {
           COUNT3_RTL_ARRAY(arr_to_size, new_size);
@@ -890,7 +1104,7 @@ rtlArrayType arrCat (rtlArrayType arr1, const rtlArrayType arr2)
       result = NULL;
     } else {
       result_size = arr1_size + arr2_size;
-      if (unlikely(!REALLOC_RTL_ARRAY(result, arr1, result_size))) {
+      if (unlikely(!GROW_RTL_ARRAY(result, arr1, result_size))) {
         raise_error(MEMORY_ERROR);
       } else {
         COUNT3_RTL_ARRAY(arr1_size, result_size);
@@ -938,7 +1152,7 @@ rtlArrayType arrExtend (rtlArrayType arr1, const rtlValueUnion element)
       result = NULL;
     } else {
       result_size = arr1_size + 1;
-      if (unlikely(!REALLOC_RTL_ARRAY(result, arr1, result_size))) {
+      if (unlikely(!GROW_RTL_ARRAY(result, arr1, result_size))) {
         raise_error(MEMORY_ERROR);
       } else {
         COUNT3_RTL_ARRAY(arr1_size, result_size);
@@ -968,10 +1182,7 @@ rtlArrayType arrExtend (rtlArrayType arr1, const rtlValueUnion element)
  */
 void arrFree (rtlArrayType oldArray)
 
-  {
-    memSizeType size;
-
-  /* arrFree */
+  { /* arrFree */
     logFunction(printf("arrFree(" FMT_U_MEM " (array[" FMT_D
                                 " .. " FMT_D "])\n",
                        (memSizeType) oldArray,
@@ -979,8 +1190,7 @@ void arrFree (rtlArrayType oldArray)
                            oldArray->min_position : (intType) 1,
                        oldArray != NULL ?
                            oldArray->max_position : (intType) 0););
-    size = arraySize(oldArray);
-    FREE_RTL_ARRAY(oldArray, size);
+    FREE_RTL_ARRAY(oldArray, arraySize(oldArray));
     logFunction(printf("arrFree -->\n"););
   } /* arrFree */
 
@@ -1547,7 +1757,7 @@ void arrPush (rtlArrayType *const arr_variable, const rtlValueUnion element)
       raise_error(MEMORY_ERROR);
     } else {
       new_size = arr_to_size + 1;
-      if (unlikely(!REALLOC_RTL_ARRAY(arr_to, arr_to, new_size))) {
+      if (unlikely(!GROW_RTL_ARRAY(arr_to, arr_to, new_size))) {
         raise_error(MEMORY_ERROR);
       } else {
         COUNT3_RTL_ARRAY(arr_to_size, new_size);
@@ -1973,6 +2183,90 @@ rtlArrayType arrRemoveArray (rtlArrayType *arr_to, intType position, intType len
 
 
 
+/**
+ *  Reserve memory, such that 'arr_variable' can grow to 'capacity'
+ *  elements without reallocation. The elements and the indices of
+ *  the array are not changed. Nothing happens, if the array can
+ *  already hold 'capacity' elements.
+ *  @exception RANGE_ERROR The capacity is negative.
+ *  @exception MEMORY_ERROR Not enough memory to reserve the capacity.
+ */
+void arrReserve (rtlArrayType *const arr_variable, const intType capacity)
+
+  {
+#if WITH_RTL_ARRAY_CAPACITY
+    rtlArrayType resized_arr;
+#endif
+
+  /* arrReserve */
+    logFunction(printf("arrReserve(" FMT_U_MEM " (array[" FMT_D " .. "
+                                   FMT_D "]), " FMT_D ")\n",
+                       (memSizeType) *arr_variable,
+                       (*arr_variable)->min_position,
+                       (*arr_variable)->max_position, capacity););
+    if (unlikely(capacity < 0)) {
+      logError(printf("arrReserve(arr1, " FMT_D "): "
+                      "Capacity is negative.\n", capacity););
+      raise_error(RANGE_ERROR);
+#if WITH_RTL_ARRAY_CAPACITY
+    } else if ((uintType) capacity > (*arr_variable)->capacity) {
+      if (unlikely((uintType) capacity > MAX_RTL_ARR_LEN ||
+                   !REALLOC_RTL_ARRAY(resized_arr, *arr_variable,
+                                      (memSizeType) capacity))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        *arr_variable = resized_arr;
+      } /* if */
+#endif
+    } /* if */
+    logFunction(printf("arrReserve --> " FMT_U_MEM "\n",
+                       (memSizeType) *arr_variable););
+  } /* arrReserve */
+
+
+
+/**
+ *  Reduce the capacity of 'arr_variable' to the number of elements.
+ *  Memory, which was reserved for further elements, is released.
+ *  The elements and the indices of the array are not changed.
+ */
+void arrShrinkToFit (rtlArrayType *const arr_variable)
+
+  {
+#if WITH_RTL_ARRAY_CAPACITY
+    memSizeType size;
+    rtlArrayType resized_arr;
+#endif
+
+  /* arrShrinkToFit */
+    logFunction(printf("arrShrinkToFit(" FMT_U_MEM " (array[" FMT_D " .. "
+                                       FMT_D "]))\n",
+                       (memSizeType) *arr_variable,
+                       (*arr_variable)->min_position,
+                       (*arr_variable)->max_position););
+#if WITH_RTL_ARRAY_CAPACITY
+    size = arraySize(*arr_variable);
+    if (size < (*arr_variable)->capacity) {
+      /* If the realloc fails the array just keeps its capacity. */
+      if (likely(REALLOC_RTL_ARRAY(resized_arr, *arr_variable, size))) {
+        *arr_variable = resized_arr;
+      } /* if */
+    } /* if */
+#endif
+    logFunction(printf("arrShrinkToFit --> " FMT_U_MEM "\n",
+                       (memSizeType) *arr_variable););
+  } /* arrShrinkToFit */
+
+
+
+/**
+ *  Sort an array with the given compare function.
+ *  The sort is stable: Elements that compare equal keep their order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @param cmp_func Compare function of the element type.
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
 rtlArrayType arrSort (rtlArrayType arr1, const compareFuncType cmp_func)
 
   { /* arrSort */
@@ -1982,12 +2276,102 @@ rtlArrayType arrSort (rtlArrayType arr1, const compareFuncType cmp_func)
                        arr1 != NULL ? arr1->min_position : (intType) 1,
                        arr1 != NULL ? arr1->max_position : (intType) 0,
                        (memSizeType) cmp_func););
-    rtl_qsort_array(arr1->arr, &arr1->arr[arr1->max_position - arr1->min_position], cmp_func);
+    sortRtlArray(arr1, rtl_merge_sort, cmp_func, FALSE);
     return arr1;
   } /* arrSort */
 
 
 
+/**
+ *  Sort an array of floats without calling a compare function.
+ *  The order is the order of fltCmp(). NaN is greater than all
+ *  other values and 0.0 and -0.0 keep their relative order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
+rtlArrayType arrSortFlt (rtlArrayType arr1)
+
+  { /* arrSortFlt */
+    logFunction(printf("arrSortFlt(" FMT_U_MEM " (array[" FMT_D " .. "
+                                   FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    sortRtlArray(arr1, flt_merge_sort, NULL, FALSE);
+    return arr1;
+  } /* arrSortFlt */
+
+
+
+/**
+ *  Sort an array of floats in descending order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
+rtlArrayType arrSortFltReverse (rtlArrayType arr1)
+
+  { /* arrSortFltReverse */
+    logFunction(printf("arrSortFltReverse(" FMT_U_MEM " (array[" FMT_D
+                                          " .. " FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    sortRtlArray(arr1, flt_merge_sort, NULL, TRUE);
+    return arr1;
+  } /* arrSortFltReverse */
+
+
+
+/**
+ *  Sort an array of integers without calling a compare function.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
+rtlArrayType arrSortInt (rtlArrayType arr1)
+
+  { /* arrSortInt */
+    logFunction(printf("arrSortInt(" FMT_U_MEM " (array[" FMT_D " .. "
+                                   FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    sortRtlArray(arr1, int_merge_sort, NULL, FALSE);
+    return arr1;
+  } /* arrSortInt */
+
+
+
+/**
+ *  Sort an array of integers in descending order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
+rtlArrayType arrSortIntReverse (rtlArrayType arr1)
+
+  { /* arrSortIntReverse */
+    logFunction(printf("arrSortIntReverse(" FMT_U_MEM " (array[" FMT_D
+                                          " .. " FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    sortRtlArray(arr1, int_merge_sort, NULL, TRUE);
+    return arr1;
+  } /* arrSortIntReverse */
+
+
+
+/**
+ *  Sort an array in descending order with the given compare function.
+ *  The sort is stable: Elements that compare equal keep their order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @param cmp_func Compare function of the element type.
+ *  @return the sorted array arr1.
+ *  @exception MEMORY_ERROR Not enough memory for the sort buffer.
+ */
 rtlArrayType arrSortReverse (rtlArrayType arr1, const compareFuncType cmp_func)
 
   { /* arrSortReverse */
@@ -1997,12 +2381,50 @@ rtlArrayType arrSortReverse (rtlArrayType arr1, const compareFuncType cmp_func)
                        arr1 != NULL ? arr1->min_position : (intType) 1,
                        arr1 != NULL ? arr1->max_position : (intType) 0,
                        (memSizeType) cmp_func););
-    rtl_qsort_array_reverse(arr1->arr, &arr1->arr[arr1->max_position - arr1->min_position], cmp_func);
+    sortRtlArray(arr1, rtl_merge_sort, cmp_func, TRUE);
     return arr1;
   } /* arrSortReverse */
 
 
 
+/**
+ *  Sort an array of strings without calling a compare function.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ */
+rtlArrayType arrSortStri (rtlArrayType arr1)
+
+  { /* arrSortStri */
+    logFunction(printf("arrSortStri(" FMT_U_MEM " (array[" FMT_D " .. "
+                                    FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    str_qsort_array(arr1->arr, &arr1->arr[arr1->max_position - arr1->min_position], FALSE);
+    return arr1;
+  } /* arrSortStri */
+
+
+
+/**
+ *  Sort an array of strings in descending order.
+ *  @param arr1 Array to be sorted (it is sorted in place).
+ *  @return the sorted array arr1.
+ */
+rtlArrayType arrSortStriReverse (rtlArrayType arr1)
+
+  { /* arrSortStriReverse */
+    logFunction(printf("arrSortStriReverse(" FMT_U_MEM " (array[" FMT_D
+                                           " .. " FMT_D "]))\n",
+                       (memSizeType) arr1,
+                       arr1 != NULL ? arr1->min_position : (intType) 1,
+                       arr1 != NULL ? arr1->max_position : (intType) 0););
+    str_qsort_array(arr1->arr, &arr1->arr[arr1->max_position - arr1->min_position], TRUE);
+    return arr1;
+  } /* arrSortStriReverse */
+
+
+
 /**
  *  Get a sub array from the position 'start' with maximum length 'length'.
  *  @return the sub array from position 'start' with maximum length 'length'.
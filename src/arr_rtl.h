@@ -62,8 +62,16 @@ rtlArrayType arrRangeTemp (rtlArrayType *arr_temp, intType start, intType stop);
 rtlArrayType arrRealloc (rtlArrayType arr, memSizeType oldSize, memSizeType newSize);
 rtlValueUnion arrRemove (rtlArrayType *arr_to, intType position);
 rtlArrayType arrRemoveArray (rtlArrayType *arr_to, intType position, intType length);
+void arrReserve (rtlArrayType *const arr_variable, const intType capacity);
+void arrShrinkToFit (rtlArrayType *const arr_variable);
 rtlArrayType arrSort (rtlArrayType arr1, const compareFuncType cmp_func);
+rtlArrayType arrSortFlt (rtlArrayType arr1);
+rtlArrayType arrSortFltReverse (rtlArrayType arr1);
+rtlArrayType arrSortInt (rtlArrayType arr1);
+rtlArrayType arrSortIntReverse (rtlArrayType arr1);
 rtlArrayType arrSortReverse (rtlArrayType arr1, const compareFuncType cmp_func);
+rtlArrayType arrSortStri (rtlArrayType arr1);
+rtlArrayType arrSortStriReverse (rtlArrayType arr1);
 rtlArrayType arrSubarr (const const_rtlArrayType arr1, intType start, intType len);
 rtlArrayType arrSubarrTemp (rtlArrayType *arr_temp, intType start, intType len);
 rtlArrayType arrTail (const const_rtlArrayType arr1, intType start);
@@ -49,153 +49,168 @@
 #include "arrlib.h"
 
 
-#define QSORT_LIMIT 8
+#define INSERTION_SORT_LIMIT 8
+
+#if WITH_ARRAY_CAPACITY
+#define GROW_ARRAY(var,old,len) \
+    ((len) <= (old)->capacity ? ((var) = (old)) != NULL : ((var) = growArray(old, len)) != NULL)
+#else
+#define GROW_ARRAY(var,old,len) REALLOC_ARRAY(var, old, len)
+#endif
 
 
 
 /**
- *  Sort an array of 'objectRecord' elements with the quicksort algorithm.
- *  In contrast to qsort() this function uses a different compare function.
- *  The compare function of qsort() has two void pointers as parameters.
- *  @param begin_sort Pointer to first element to be sorted.
- *  @param end_sort Pointer to the last element to be sorted.
- *  @param cmp_func Object describing the compare function to be used.
+ *  Determine if element1 must be placed before element2.
+ *  @param reverse TRUE if the elements are sorted in descending order.
+ *  @return TRUE if element1 is less than element2 (or greater if
+ *          reverse is TRUE), FALSE otherwise.
  */
-static void qsort_array (objectType begin_sort, objectType end_sort,
-    objectType cmp_func)
+static boolType precedes (objectType cmp_func, objectType element1,
+    objectType element2, const boolType reverse)
 
   {
-    objectRecord compare_elem;
-    objectRecord help_element;
-    objectType middle_elem;
-    objectType less_elem;
-    objectType greater_elem;
     objectType cmp_obj;
     intType cmp;
 
-  /* qsort_array */
-    if (end_sort - begin_sort < QSORT_LIMIT) {
-      /* Use insertion sort */
-      for (middle_elem = begin_sort + 1; middle_elem <= end_sort; middle_elem++) {
-        compare_elem = *middle_elem;
-        less_elem = begin_sort - 1;
-        do {
-          less_elem++;
-          cmp_obj = param3_call(cmp_func, less_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp < 0);
-        memmove(&less_elem[1], less_elem,
-                (memSizeType) (middle_elem - less_elem) * sizeof(objectRecord));
-        *less_elem = compare_elem;
+  /* precedes */
+    cmp_obj = param3_call(cmp_func, element1, element2, cmp_func);
+    isit_int2(cmp_obj);
+    cmp = take_int(cmp_obj);
+    FREE_OBJECT(cmp_obj);
+    return reverse ? cmp > 0 : cmp < 0;
+  } /* precedes */
+
+
+
+/**
+ *  Sort an array of 'objectRecord' elements with a stable merge sort.
+ *  Elements that compare equal keep their relative order.
+ *  Short parts of the array are sorted with insertion sort.
+ *  @param arr Pointer to the first element to be sorted.
+ *  @param length Number of elements to be sorted.
+ *  @param buffer Temporary storage for at least length / 2 elements.
+ *  @param cmp_func Object describing the compare function to be used.
+ *  @param reverse TRUE if the elements should be sorted in descending order.
+ */
+static void merge_sort_array (objectType arr, memSizeType length,
+    objectType buffer, objectType cmp_func, const boolType reverse)
+
+  {
+    memSizeType middle;
+    memSizeType left;
+    memSizeType right;
+    memSizeType pos;
+    objectRecord element;
+
+  /* merge_sort_array */
+    if (length <= INSERTION_SORT_LIMIT) {
+      for (pos = 1; pos < length; pos++) {
+        element = arr[pos];
+        left = pos;
+        while (left != 0 &&
+               precedes(cmp_func, &element, &arr[left - 1], reverse)) {
+          arr[left] = arr[left - 1];
+          left--;
+        } /* while */
+        arr[left] = element;
       } /* for */
     } else {
-      middle_elem = &begin_sort[(memSizeType) (end_sort - begin_sort) >> 1];
-      compare_elem = *middle_elem;
-      *middle_elem = *end_sort;
-      *end_sort = compare_elem;
-      less_elem = begin_sort - 1;
-      greater_elem = end_sort;
-      do {
-        do {
-          less_elem++;
-          cmp_obj = param3_call(cmp_func, less_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp < 0);
-        do {
-          greater_elem--;
-          cmp_obj = param3_call(cmp_func, greater_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp > 0 && greater_elem != begin_sort);
-        help_element = *less_elem;
-        *less_elem = *greater_elem;
-        *greater_elem = help_element;
-      } while (greater_elem > less_elem);
-      *greater_elem = *less_elem;
-      *less_elem = compare_elem;
-      *end_sort = help_element;
-      qsort_array(begin_sort, less_elem - 1, cmp_func);
-      qsort_array(less_elem + 1, end_sort, cmp_func);
+      middle = length >> 1;
+      merge_sort_array(arr, middle, buffer, cmp_func, reverse);
+      merge_sort_array(&arr[middle], length - middle, buffer, cmp_func, reverse);
+      if (precedes(cmp_func, &arr[middle], &arr[middle - 1], reverse)) {
+        memcpy(buffer, arr, middle * sizeof(objectRecord));
+        left = 0;
+        right = middle;
+        pos = 0;
+        while (left < middle && right < length) {
+          if (precedes(cmp_func, &arr[right], &buffer[left], reverse)) {
+            arr[pos] = arr[right];
+            right++;
+          } else {
+            arr[pos] = buffer[left];
+            left++;
+          } /* if */
+          pos++;
+        } /* while */
+        memcpy(&arr[pos], &buffer[left], (middle - left) * sizeof(objectRecord));
+      } /* if */
     } /* if */
-  } /* qsort_array */
+  } /* merge_sort_array */
 
 
 
 /**
- *  Reverse sort an array of 'objectRecord' elements with the quicksort algorithm.
- *  In contrast to qsort() this function uses a different compare function.
- *  The compare function of qsort() has two void pointers as parameters.
- *  @param begin_sort Pointer to first element to be sorted.
- *  @param end_sort Pointer to the last element to be sorted.
- *  @param cmp_func Object describing the compare function to be used.
+ *  Sort the elements of arr1 in place with a stable merge sort.
+ *  @return TRUE if the array has been sorted, or
+ *          FALSE if there is not enough memory for the sort buffer.
  */
-static void qsort_array_reverse (objectType begin_sort, objectType end_sort,
-    objectType cmp_func)
+static boolType sort_array (const arrayType arr1, objectType cmp_func,
+    const boolType reverse)
 
   {
-    objectRecord compare_elem;
-    objectRecord help_element;
-    objectType middle_elem;
-    objectType less_elem;
-    objectType greater_elem;
-    objectType cmp_obj;
-    intType cmp;
+    memSizeType length;
+    memSizeType buffer_size;
+    objectType buffer;
+    boolType okay = TRUE;
+
+  /* sort_array */
+    length = arraySize(arr1);
+    if (length <= INSERTION_SORT_LIMIT) {
+      merge_sort_array(arr1->arr, length, NULL, cmp_func, reverse);
+    } else {
+      buffer_size = length >> 1;
+      if (unlikely(!ALLOC_TABLE(buffer, objectRecord, buffer_size))) {
+        okay = FALSE;
+      } else {
+        merge_sort_array(arr1->arr, length, buffer, cmp_func, reverse);
+        FREE_TABLE(buffer, objectRecord, buffer_size);
+      } /* if */
+    } /* if */
+    return okay;
+  } /* sort_array */
 
-  /* qsort_array_reverse */
-    if (end_sort - begin_sort < QSORT_LIMIT) {
-      /* Use insertion sort */
-      for (middle_elem = begin_sort + 1; middle_elem <= end_sort; middle_elem++) {
-        compare_elem = *middle_elem;
-        greater_elem = begin_sort - 1;
-        do {
-          greater_elem++;
-          cmp_obj = param3_call(cmp_func, greater_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp > 0);
-        memmove(&greater_elem[1], greater_elem,
-                (memSizeType) (middle_elem - greater_elem) * sizeof(objectRecord));
-        *greater_elem = compare_elem;
-      } /* for */
+
+
+#if WITH_ARRAY_CAPACITY
+/**
+ *  Enlarge the capacity of an array.
+ *  This function is called from the macro GROW_ARRAY, if the
+ *  capacity of an array is not sufficient. The capacity is usually
+ *  doubled, such that repeated appending is amortized O(1).
+ *  @param arr Array for which the capacity is enlarged.
+ *  @param len Number of elements that must fit into the array.
+ *  @return the enlarged array, or NULL if the allocation failed.
+ */
+static arrayType growArray (arrayType arr, memSizeType len)
+
+  {
+    memSizeType newCapacity;
+    arrayType result;
+
+  /* growArray */
+    if (arr->capacity > MAX_ARR_LEN / 2) {
+      newCapacity = MAX_ARR_LEN;
     } else {
-      middle_elem = &begin_sort[(memSizeType) (end_sort - begin_sort) >> 1];
-      compare_elem = *middle_elem;
-      *middle_elem = *end_sort;
-      *end_sort = compare_elem;
-      greater_elem = begin_sort - 1;
-      less_elem = end_sort;
-      do {
-        do {
-          greater_elem++;
-          cmp_obj = param3_call(cmp_func, greater_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp > 0);
-        do {
-          less_elem--;
-          cmp_obj = param3_call(cmp_func, less_elem, &compare_elem, cmp_func);
-          isit_int2(cmp_obj);
-          cmp = take_int(cmp_obj);
-          FREE_OBJECT(cmp_obj);
-        } while (cmp < 0 && less_elem != begin_sort);
-        help_element  = *greater_elem;
-        *greater_elem = *less_elem;
-        *less_elem = help_element;
-      } while (less_elem > greater_elem);
-      *less_elem = *greater_elem;
-      *greater_elem = compare_elem;
-      *end_sort = help_element;
-      qsort_array_reverse(begin_sort, greater_elem - 1, cmp_func);
-      qsort_array_reverse(greater_elem + 1, end_sort, cmp_func);
+      newCapacity = 2 * arr->capacity;
+    } /* if */
+    if (newCapacity < len) {
+      newCapacity = len;
     } /* if */
-  } /* qsort_array_reverse */
+    if (newCapacity < MIN_ARRAY_GROW_CAPACITY) {
+      newCapacity = MIN_ARRAY_GROW_CAPACITY;
+    } /* if */
+    if (unlikely(!REALLOC_ARRAY(result, arr, newCapacity))) {
+      /* Try again without reserve. */
+      if (newCapacity == len || !REALLOC_ARRAY(result, arr, len)) {
+        result = NULL;
+      } /* if */
+    } /* if */
+    return result;
+  } /* growArray */
+
+#endif
 
 
 
@@ -239,8 +254,8 @@ objectType arr_append (listType arguments)
         return raise_exception(SYS_MEM_EXCEPTION);
       } else {
         new_size = arr_to_size + extension_size;
-        if (unlikely(!REALLOC_ARRAY(new_arr, arr_to, new_size))) {
-          logError(printf("arr_append: REALLOC_ARRAY() failed.\n"););
+        if (unlikely(!GROW_ARRAY(new_arr, arr_to, new_size))) {
+          logError(printf("arr_append: GROW_ARRAY() failed.\n"););
           return raise_exception(SYS_MEM_EXCEPTION);
         } else {
           COUNT3_ARRAY(arr_to_size, new_size);
@@ -546,8 +561,8 @@ objectType arr_cat (listType arguments)
       array_exec_object = curr_exec_object;
       result_size = arr1_size + arr2_size;
       if (TEMP_OBJECT(arg_1(arguments))) {
-        if (unlikely(!REALLOC_ARRAY(result, arr1, result_size))) {
-          logError(printf("arr_cat: REALLOC_ARRAY() failed.\n"););
+        if (unlikely(!GROW_ARRAY(result, arr1, result_size))) {
+          logError(printf("arr_cat: GROW_ARRAY() failed.\n"););
           return raise_exception(SYS_MEM_EXCEPTION);
         } else {
           COUNT3_ARRAY(arr1_size, result_size);
@@ -832,8 +847,8 @@ objectType arr_extend (listType arguments)
       array_exec_object = curr_exec_object;
       result_size = arr1_size + 1;
       if (TEMP_OBJECT(arg_1(arguments))) {
-        if (unlikely(!REALLOC_ARRAY(result, arr1, result_size))) {
-          logError(printf("arr_extend: REALLOC_ARRAY() failed.\n"););
+        if (unlikely(!GROW_ARRAY(result, arr1, result_size))) {
+          logError(printf("arr_extend: GROW_ARRAY() failed.\n"););
           return raise_exception(SYS_MEM_EXCEPTION);
         } else {
           COUNT3_ARRAY(arr1_size, result_size);
@@ -1403,8 +1418,8 @@ objectType arr_push (listType arguments)
       return raise_exception(SYS_MEM_EXCEPTION);
     } else {
       new_size = dest_size + 1;
-      if (unlikely(!REALLOC_ARRAY(new_arr, dest, new_size))) {
-        logError(printf("arr_push: REALLOC_ARRAY() failed.\n"););
+      if (unlikely(!GROW_ARRAY(new_arr, dest, new_size))) {
+        logError(printf("arr_push: GROW_ARRAY() failed.\n"););
         return raise_exception(SYS_MEM_EXCEPTION);
       } else {
         COUNT3_ARRAY(dest_size, new_size);
@@ -1697,6 +1712,89 @@ objectType arr_remove_array (listType arguments)
 
 
 
+/**
+ *  Reserve memory, such that 'arr_variable' can grow to 'capacity'
+ *  elements without reallocation.
+ *  @exception RANGE_ERROR The capacity is negative.
+ *  @exception MEMORY_ERROR Not enough memory to reserve the capacity.
+ */
+objectType arr_reserve (listType arguments)
+
+  {
+    objectType arr_variable;
+    intType capacity;
+#if WITH_ARRAY_CAPACITY
+    arrayType arr1;
+    arrayType resized_arr;
+#endif
+
+  /* arr_reserve */
+    arr_variable = arg_1(arguments);
+    isit_array(arr_variable);
+    is_variable(arr_variable);
+    isit_int(arg_2(arguments));
+    capacity = take_int(arg_2(arguments));
+    logFunction(printf("arr_reserve(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) arr_variable, capacity););
+    if (unlikely(capacity < 0)) {
+      logError(printf("arr_reserve(arr1, " FMT_D "): "
+                      "Capacity is negative.\n", capacity););
+      return raise_exception(SYS_RNG_EXCEPTION);
+#if WITH_ARRAY_CAPACITY
+    } else {
+      arr1 = take_array(arr_variable);
+      if ((uintType) capacity > arr1->capacity) {
+        if (unlikely((uintType) capacity > MAX_ARR_LEN ||
+                     !REALLOC_ARRAY(resized_arr, arr1,
+                                    (memSizeType) capacity))) {
+          logError(printf("arr_reserve: REALLOC_ARRAY() failed.\n"););
+          return raise_exception(SYS_MEM_EXCEPTION);
+        } else {
+          arr_variable->value.arrayValue = resized_arr;
+        } /* if */
+      } /* if */
+#endif
+    } /* if */
+    return SYS_EMPTY_OBJECT;
+  } /* arr_reserve */
+
+
+
+/**
+ *  Reduce the capacity of 'arr_variable' to the number of elements.
+ *  The elements and the indices of the array are not changed.
+ */
+objectType arr_shrink_to_fit (listType arguments)
+
+  {
+    objectType arr_variable;
+#if WITH_ARRAY_CAPACITY
+    arrayType arr1;
+    arrayType resized_arr;
+    memSizeType size;
+#endif
+
+  /* arr_shrink_to_fit */
+    arr_variable = arg_1(arguments);
+    isit_array(arr_variable);
+    is_variable(arr_variable);
+    logFunction(printf("arr_shrink_to_fit(" FMT_U_MEM ")\n",
+                       (memSizeType) arr_variable););
+#if WITH_ARRAY_CAPACITY
+    arr1 = take_array(arr_variable);
+    size = arraySize(arr1);
+    if (size < arr1->capacity) {
+      /* If the realloc fails the array just keeps its capacity. */
+      if (likely(REALLOC_ARRAY(resized_arr, arr1, size))) {
+        arr_variable->value.arrayValue = resized_arr;
+      } /* if */
+    } /* if */
+#endif
+    return SYS_EMPTY_OBJECT;
+  } /* arr_shrink_to_fit */
+
+
+
 objectType arr_sort (listType arguments)
 
   {
@@ -1733,9 +1831,11 @@ objectType arr_sort (listType arguments)
         } /* if */
       } /* if */
     } /* if */
-    qsort_array(result->arr,
-        &result->arr[result->max_position - result->min_position],
-        data_cmp_func);
+    if (unlikely(!sort_array(result, data_cmp_func, FALSE))) {
+      logError(printf("arr_sort: sort_array() failed.\n"););
+      free_array(result);
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } /* if */
     return bld_array_temp(result);
   } /* arr_sort */
 
@@ -1777,9 +1877,11 @@ objectType arr_sort_reverse (listType arguments)
         } /* if */
       } /* if */
     } /* if */
-    qsort_array_reverse(result->arr,
-        &result->arr[result->max_position - result->min_position],
-        data_cmp_func);
+    if (unlikely(!sort_array(result, data_cmp_func, TRUE))) {
+      logError(printf("arr_sort_reverse: sort_array() failed.\n"););
+      free_array(result);
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } /* if */
     return bld_array_temp(result);
   } /* arr_sort_reverse */
 
@@ -49,6 +49,8 @@ objectType arr_push         (listType arguments);
 objectType arr_range        (listType arguments);
 objectType arr_remove       (listType arguments);
 objectType arr_remove_array (listType arguments);
+objectType arr_reserve      (listType arguments);
+objectType arr_shrink_to_fit (listType arguments);
 objectType arr_sort         (listType arguments);
 objectType arr_sort_reverse (listType arguments);
 objectType arr_subarr       (listType arguments);
@@ -103,6 +103,8 @@ bigIntType bigLShiftOne (const intType lshift);
 bigIntType bigLog2BaseIPow (const intType log2base, const intType exponent);
 bigIntType bigMDiv (const const_bigIntType dividend, const const_bigIntType divisor);
 bigIntType bigMod (const const_bigIntType dividend, const const_bigIntType divisor);
+bigIntType bigModPow (const const_bigIntType base, const const_bigIntType exponent,
+    const const_bigIntType modulus);
 bigIntType bigMult (const_bigIntType factor1, const_bigIntType factor2);
 void bigMultAssign (bigIntType *const big_variable, const_bigIntType factor);
 bigIntType bigMultSignedDigit (const_bigIntType factor1, intType factor2);
@@ -1524,6 +1524,53 @@ bigIntType bigMod (const const_bigIntType dividend, const const_bigIntType divis
 
 
 
+/**
+ *  Compute the modular exponentiation of base ** exponent.
+ *  @return base ** exponent mod modulus. The result is
+ *          nonnegative and less than the modulus. If the exponent
+ *          is zero the result is 1.
+ *  @exception RANGE_ERROR If exponent or modulus are negative.
+ *  @exception NUMERIC_ERROR If the modulus is zero and the
+ *             exponent is positive.
+ */
+bigIntType bigModPow (const const_bigIntType base, const const_bigIntType exponent,
+    const const_bigIntType modulus)
+
+  {
+    bigIntType power;
+
+  /* bigModPow */
+    logFunction(printf("bigModPow(%s, ", bigHexCStri(base));
+                printf("%s, ", bigHexCStri(exponent));
+                printf("%s)\n", bigHexCStri(modulus)););
+    if (unlikely(mpz_sgn(exponent) < 0 || mpz_sgn(modulus) < 0)) {
+      logError(printf("bigModPow(%s, ", bigHexCStri(base));
+               printf("%s, ", bigHexCStri(exponent));
+               printf("%s): Exponent or modulus is negative.\n",
+                      bigHexCStri(modulus)););
+      raise_error(RANGE_ERROR);
+      power = NULL;
+    } else if (mpz_sgn(exponent) == 0) {
+      ALLOC_BIG(power);
+      mpz_init_set_ui(power, 1);
+    } else if (unlikely(mpz_sgn(modulus) == 0)) {
+      logError(printf("bigModPow(%s, ", bigHexCStri(base));
+               printf("%s, ", bigHexCStri(exponent));
+               printf("%s): Division by zero.\n",
+                      bigHexCStri(modulus)););
+      raise_error(NUMERIC_ERROR);
+      power = NULL;
+    } else {
+      ALLOC_BIG(power);
+      mpz_init(power);
+      mpz_powm(power, base, exponent, modulus);
+    } /* if */
+    logFunction(printf("bigModPow --> %s\n", bigHexCStri(power)););
+    return power;
+  } /* bigModPow */
+
+
+
 /**
  *  Multiply two 'bigInteger' numbers.
  *  @return the product of the two numbers.
@@ -54,6 +54,10 @@
 
 #define KARATSUBA_MULT_THRESHOLD 32
 #define KARATSUBA_SQUARE_THRESHOLD 32
+#define TOOM3_MULT_THRESHOLD 192
+#define TOOM3_SQUARE_THRESHOLD 256
+#define BURNIKEL_ZIEGLER_THRESHOLD 64
+#define BINARY_PARSE_THRESHOLD 512
 #define OCTAL_DIGIT_BITS 3
 
 
@@ -928,6 +932,177 @@ static bigIntType bigParseBasedPow2 (const const_striType stri, unsigned int shi
 
 
 
+/**
+ *  Computes base ** (2 ** exponent) to be used as conversion divisor.
+ *  The function uses a cache to avoid a recomputation.
+ *  The result is used by binaryToStri and binaryRadix2To36 as
+ *  divisor. The functions binaryToStri and binaryRadix2To36 use
+ *  the binary algorithm to convert a bigInteger to a string.
+ *  @return base ** (2 ** exponent).
+ */
+static bigIntType getConversionDivisor (unsigned int base, unsigned int exponent)
+
+  {
+    bigIntType *divisorCache;
+    unsigned int size;
+    unsigned int pos;
+    bigIntType divisor;
+
+  /* getConversionDivisor */
+    logFunction(printf("getConversionDivisor(%u, %u)\n", base, exponent););
+    divisorCache = conversionDivisorCache[base];
+    size = conversionDivisorCacheSize[base];
+    if (exponent < size) {
+      divisor = divisorCache[exponent];
+    } else {
+      divisorCache = (bigIntType *) realloc(divisorCache,
+          (exponent + 1) * sizeof(bigIntType));
+      if (unlikely(divisorCache == NULL)) {
+        raise_error(MEMORY_ERROR);
+        divisor = NULL;
+      } else {
+        if (size == 0) {
+          divisorCache[0] = bigFromUInt32(base);
+          size = 1;
+        } /* if */
+        for (pos = size; pos <= exponent; ++pos) {
+          divisorCache[pos] = bigSquare(divisorCache[pos - 1]);
+        } /* for */
+        conversionDivisorCache[base] = divisorCache;
+        conversionDivisorCacheSize[base] = exponent + 1;
+        divisor = divisorCache[exponent];
+      } /* if */
+    } /* if */
+    logFunction(printf("getConversionDivisor --> %s\n", bigHexCStri(divisor)););
+    return divisor;
+  } /* getConversionDivisor */
+
+
+
+/**
+ *  Check that the characters from position to the end of stri are
+ *  digits with the specified base.
+ *  @return TRUE if all characters are digits, FALSE otherwise.
+ */
+static boolType checkDigits (const const_striType stri, memSizeType position,
+    unsigned int base)
+
+  {
+    strElemType digit;
+    boolType okay = TRUE;
+
+  /* checkDigits */
+    for (; position < stri->size && okay; position++) {
+      digit = stri->mem[position];
+      okay = digit >= '0' && digit <= 'z' &&
+          digit_value[digit - (strElemType) '0'] < base;
+    } /* for */
+    return okay;
+  } /* checkDigits */
+
+
+
+/**
+ *  Convert length digits, starting at position, to an unsigned big
+ *  integer. The digits have been checked with checkDigits() before.
+ *  @return the converted value, or NULL if there is not enough memory.
+ */
+static bigIntType basicParse (const const_striType stri, memSizeType position,
+    const memSizeType length, unsigned int base)
+
+  {
+    uint8Type based_digit_size;
+    uint8Type based_digits_in_bigdigit;
+    bigDigitType power_of_base_in_bigdigit;
+    memSizeType stop;
+    memSizeType limit;
+    bigDigitType bigDigit;
+    memSizeType result_size;
+    bigIntType result;
+
+  /* basicParse */
+    based_digit_size = (uint8Type) (uint8MostSignificantBit((uint8Type) (base - 1)) + 1);
+    result_size = length * (memSizeType) based_digit_size / BIGDIGIT_SIZE + 1;
+    if (unlikely(!ALLOC_BIG(result, result_size))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->size = 1;
+      result->bigdigits[0] = 0;
+      based_digits_in_bigdigit = radixDigitsInBigdigit[base - 2];
+      power_of_base_in_bigdigit = powerOfRadixInBigdigit[base - 2];
+      stop = position + length;
+      limit = (length - 1) % based_digits_in_bigdigit + position + 1;
+      do {
+        bigDigit = 0;
+        for (; position < limit; position++) {
+          bigDigit = (bigDigitType) base * bigDigit +
+              digit_value[stri->mem[position] - (strElemType) '0'];
+        } /* for */
+        uBigMultiplyAndAdd(result, power_of_base_in_bigdigit, (doubleBigDigitType) bigDigit);
+        limit += based_digits_in_bigdigit;
+      } while (position < stop);
+      memset(&result->bigdigits[result->size], 0,
+             (size_t) (result_size - result->size) * sizeof(bigDigitType));
+      result->size = result_size;
+      result = normalize(result);
+    } /* if */
+    return result;
+  } /* basicParse */
+
+
+
+/**
+ *  Convert length digits, starting at position, to an unsigned big
+ *  integer with a divide and conquer algorithm. The digits are split
+ *  such that the lower part has 2 ** exponent digits. Both parts are
+ *  converted recursively and the upper part is multiplied with
+ *  base ** (2 ** exponent) from getConversionDivisor(). The digits
+ *  have been checked with checkDigits() before.
+ *  @return the converted value, or NULL if there is not enough memory.
+ */
+static bigIntType binaryParse (const const_striType stri, memSizeType position,
+    const memSizeType length, unsigned int base)
+
+  {
+    unsigned int exponent = 0;
+    memSizeType lowLength = 1;
+    bigIntType factor;
+    bigIntType high;
+    bigIntType low;
+    bigIntType result = NULL;
+
+  /* binaryParse */
+    logFunction(printf("binaryParse(*, " FMT_U_MEM ", " FMT_U_MEM ", %u)\n",
+                       position, length, base););
+    if (length <= BINARY_PARSE_THRESHOLD) {
+      result = basicParse(stri, position, length, base);
+    } else {
+      while (lowLength << 1 < length) {
+        lowLength <<= 1;
+        exponent++;
+      } /* while */
+      factor = getConversionDivisor(base, exponent);
+      if (factor != NULL) {
+        high = binaryParse(stri, position, length - lowLength, base);
+        if (high != NULL) {
+          low = binaryParse(stri, position + length - lowLength, lowLength, base);
+          if (low != NULL) {
+            result = bigMult(high, factor);
+            if (result != NULL) {
+              result = bigAddTemp(result, low);
+            } /* if */
+            FREE_BIG(low);
+          } /* if */
+          FREE_BIG(high);
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("binaryParse --> %s\n", bigHexCStri(result)););
+    return result;
+  } /* binaryParse */
+
+
+
 /**
  *  Convert a numeric string, with a specified radix, to a 'bigInteger'.
  *  The numeric string must contain the representation of an integer
@@ -985,6 +1160,20 @@ static bigIntType bigParseBased2To36 (const const_striType stri, unsigned int ba
     } else if (unlikely(stri->size > MAX_MEMSIZETYPE / 6)) {
       raise_error(MEMORY_ERROR);
       result = NULL;
+    } else if (stri->size - position > BINARY_PARSE_THRESHOLD) {
+      if (unlikely(!checkDigits(stri, position, base))) {
+        logError(printf("bigParseBased2To36(\"%s\", %u): "
+                        "Illegal digit.\n",
+                        striAsUnquotedCStri(stri), base););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = binaryParse(stri, position, stri->size - position, base);
+        if (result != NULL && negative) {
+          negate_positive_big(result);
+          result = normalize(result);
+        } /* if */
+      } /* if */
     } else {
       based_digit_size = (uint8Type) (uint8MostSignificantBit((uint8Type) (base - 1)) + 1);
       /* Estimate the number of bits necessary: */
@@ -1043,53 +1232,6 @@ static bigIntType bigParseBased2To36 (const const_striType stri, unsigned int ba
 
 
 
-/**
- *  Computes base ** (2 ** exponent) to be used as conversion divisor.
- *  The function uses a cache to avoid a recomputation.
- *  The result is used by binaryToStri and binaryRadix2To36 as
- *  divisor. The functions binaryToStri and binaryRadix2To36 use
- *  the binary algorithm to convert a bigInteger to a string.
- *  @return base ** (2 ** exponent).
- */
-static bigIntType getConversionDivisor (unsigned int base, unsigned int exponent)
-
-  {
-    bigIntType *divisorCache;
-    unsigned int size;
-    unsigned int pos;
-    bigIntType divisor;
-
-  /* getConversionDivisor */
-    logFunction(printf("getConversionDivisor(%u, %u)\n", base, exponent););
-    divisorCache = conversionDivisorCache[base];
-    size = conversionDivisorCacheSize[base];
-    if (exponent < size) {
-      divisor = divisorCache[exponent];
-    } else {
-      divisorCache = (bigIntType *) realloc(divisorCache,
-          (exponent + 1) * sizeof(bigIntType));
-      if (unlikely(divisorCache == NULL)) {
-        raise_error(MEMORY_ERROR);
-        divisor = NULL;
-      } else {
-        if (size == 0) {
-          divisorCache[0] = bigFromUInt32(base);
-          size = 1;
-        } /* if */
-        for (pos = size; pos <= exponent; ++pos) {
-          divisorCache[pos] = bigSquare(divisorCache[pos - 1]);
-        } /* for */
-        conversionDivisorCache[base] = divisorCache;
-        conversionDivisorCacheSize[base] = exponent + 1;
-        divisor = divisorCache[exponent];
-      } /* if */
-    } /* if */
-    logFunction(printf("getConversionDivisor --> %s\n", bigHexCStri(divisor)););
-    return divisor;
-  } /* getConversionDivisor */
-
-
-
 static memSizeType basicToStri (const bigIntType unsignedBig,
     striType buffer, memSizeType pos)
 
@@ -1743,128 +1885,6 @@ static bigIntType bigDivSizeLess (const const_bigIntType dividend,
 
 
 
-/**
- *  Multiplies big2 with multiplier and subtracts the product from
- *  big1 at the digit position pos1 of big1. Big1, big2 and
- *  multiplier are nonnegative big integer values.
- *  The algorithm tries to save computations. Therefore
- *  there are checks for mult_carry != 0 and sbtr_carry == 0.
- */
-static bigDigitType uBigMultSub (const bigIntType big1, const const_bigIntType big2,
-    const bigDigitType multiplier, const memSizeType pos1)
-
-  {
-    memSizeType pos = 0;
-    doubleBigDigitType mult_carry = 0;
-    doubleBigDigitType sbtr_carry = 1;
-
-  /* uBigMultSub */
-    do {
-      mult_carry += (doubleBigDigitType) big2->bigdigits[pos] * multiplier;
-      sbtr_carry += big1->bigdigits[pos1 + pos] + (~mult_carry & BIGDIGIT_MASK);
-      big1->bigdigits[pos1 + pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
-      mult_carry >>= BIGDIGIT_SIZE;
-      sbtr_carry >>= BIGDIGIT_SIZE;
-      pos++;
-    } while (pos < big2->size);
-    for (pos += pos1; mult_carry != 0 && pos < big1->size; pos++) {
-      sbtr_carry += big1->bigdigits[pos] + (~mult_carry & BIGDIGIT_MASK);
-      big1->bigdigits[pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
-      mult_carry >>= BIGDIGIT_SIZE;
-      sbtr_carry >>= BIGDIGIT_SIZE;
-    } /* for */
-    for (; sbtr_carry == 0 && pos < big1->size; pos++) {
-      sbtr_carry = (doubleBigDigitType) big1->bigdigits[pos] + BIGDIGIT_MASK;
-      big1->bigdigits[pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
-      sbtr_carry >>= BIGDIGIT_SIZE;
-    } /* for */
-    return (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
-  } /* uBigMultSub */
-
-
-
-/**
- *  Adds big2 to big1 at the digit position pos1. Big1 and big2
- *  are nonnegative big integer values. The size of big1 must be
- *  greater or equal the size of big2. The final carry is ignored.
- */
-static void uBigAddTo (const bigIntType big1, const const_bigIntType big2,
-    const memSizeType pos1)
-
-  {
-    memSizeType pos = 0;
-    doubleBigDigitType carry = 0;
-
-  /* uBigAddTo */
-    do {
-      carry += (doubleBigDigitType) big1->bigdigits[pos1 + pos] + big2->bigdigits[pos];
-      big1->bigdigits[pos1 + pos] = (bigDigitType) (carry & BIGDIGIT_MASK);
-      carry >>= BIGDIGIT_SIZE;
-      pos++;
-    } while (pos < big2->size);
-    for (pos += pos1; pos < big1->size; pos++) {
-      carry += big1->bigdigits[pos];
-      big1->bigdigits[pos] = (bigDigitType) (carry & BIGDIGIT_MASK);
-      carry >>= BIGDIGIT_SIZE;
-    } /* for */
-  } /* uBigAddTo */
-
-
-
-/**
- *  Computes quotient and remainder of an integer division of dividend by
- *  divisor for nonnegative big integers. The remainder is delivered in
- *  dividend. There are several preconditions for this function. Divisor
- *  must have at least 2 digits and dividend must have at least one
- *  digit more than divisor. If dividend and divisor have the same length in
- *  digits nothing is done. The most significant bit of divisor must be
- *  set. The most significant digit of dividend must be less than the
- *  most significant digit of divisor. The computations to meet this
- *  preconditions are done outside this function. The special cases
- *  with a one digit divisor or a dividend with less digits than divisor are
- *  handled in other functions. This algorithm based on the algorithm
- *  from D.E. Knuth described in "The art of computer programming"
- *  volume 2 (Seminumerical algorithms).
- */
-static void uBigDiv (const bigIntType dividend, const const_bigIntType divisor,
-    const bigIntType quotient)
-
-  {
-    memSizeType pos1;
-    doubleBigDigitType twodigits;
-    doubleBigDigitType remainder;
-    bigDigitType quotientdigit;
-    bigDigitType sbtr_carry;
-
-  /* uBigDiv */
-    for (pos1 = dividend->size - 1; pos1 >= divisor->size; pos1--) {
-      twodigits = (((doubleBigDigitType) dividend->bigdigits[pos1]) << BIGDIGIT_SIZE) |
-          dividend->bigdigits[pos1 - 1];
-      if (unlikely(dividend->bigdigits[pos1] == divisor->bigdigits[divisor->size - 1])) {
-        quotientdigit = BIGDIGIT_MASK;
-      } else {
-        quotientdigit = (bigDigitType) (twodigits / divisor->bigdigits[divisor->size - 1]);
-      } /* if */
-      remainder = twodigits - (doubleBigDigitType) quotientdigit *
-          divisor->bigdigits[divisor->size - 1];
-      while (remainder <= BIGDIGIT_MASK &&
-          (doubleBigDigitType) divisor->bigdigits[divisor->size - 2] * quotientdigit >
-          (remainder << BIGDIGIT_SIZE | dividend->bigdigits[pos1 - 2])) {
-        quotientdigit--;
-        remainder = twodigits - (doubleBigDigitType) quotientdigit *
-            divisor->bigdigits[divisor->size - 1];
-      } /* while */
-      sbtr_carry = uBigMultSub(dividend, divisor, quotientdigit, pos1 - divisor->size);
-      if (sbtr_carry == 0) {
-        uBigAddTo(dividend, divisor, pos1 - divisor->size);
-        quotientdigit--;
-      } /* if */
-      quotient->bigdigits[pos1 - divisor->size] = quotientdigit;
-    } /* for */
-  } /* uBigDiv */
-
-
-
 /**
  *  Computes quotient and remainder of an integer division of dividend
  *  by one divisor_digit for nonnegative big integers. The divisor_digit
@@ -2375,57 +2395,6 @@ static bigIntType bigModSizeLess (const const_bigIntType dividend,
 
 
 
-/**
- *  Computes the remainder of an integer division of dividend by divisor
- *  for nonnegative big integers. The remainder is delivered in
- *  dividend. There are several preconditions for this function. Divisor
- *  must have at least 2 digits and dividend must have at least one
- *  digit more than divisor. If dividend and divisor have the same length in
- *  digits nothing is done. The most significant bit of divisor must be
- *  set. The most significant digit of dividend must be less than the
- *  most significant digit of divisor. The computations to meet this
- *  preconditions are done outside this function. The special cases
- *  with a one digit divisor or a dividend with less digits than divisor are
- *  handled in other functions. This algorithm based on the algorithm
- *  from D.E. Knuth described in "The art of computer programming"
- *  volume 2 (Seminumerical algorithms).
- */
-static void uBigRem (const bigIntType dividend, const const_bigIntType divisor)
-
-  {
-    memSizeType pos1;
-    doubleBigDigitType twodigits;
-    doubleBigDigitType remainder;
-    bigDigitType quotientdigit;
-    bigDigitType sbtr_carry;
-
-  /* uBigRem */
-    for (pos1 = dividend->size - 1; pos1 >= divisor->size; pos1--) {
-      twodigits = (((doubleBigDigitType) dividend->bigdigits[pos1]) << BIGDIGIT_SIZE) |
-          dividend->bigdigits[pos1 - 1];
-      if (unlikely(dividend->bigdigits[pos1] == divisor->bigdigits[divisor->size - 1])) {
-        quotientdigit = BIGDIGIT_MASK;
-      } else {
-        quotientdigit = (bigDigitType) (twodigits / divisor->bigdigits[divisor->size - 1]);
-      } /* if */
-      remainder = twodigits - (doubleBigDigitType) quotientdigit *
-          divisor->bigdigits[divisor->size - 1];
-      while (remainder <= BIGDIGIT_MASK &&
-          (doubleBigDigitType) divisor->bigdigits[divisor->size - 2] * quotientdigit >
-          (remainder << BIGDIGIT_SIZE | dividend->bigdigits[pos1 - 2])) {
-        quotientdigit--;
-        remainder = twodigits - (doubleBigDigitType) quotientdigit *
-            divisor->bigdigits[divisor->size - 1];
-      } /* while */
-      sbtr_carry = uBigMultSub(dividend, divisor, quotientdigit, pos1 - divisor->size);
-      if (sbtr_carry == 0) {
-        uBigAddTo(dividend, divisor, pos1 - divisor->size);
-      } /* if */
-    } /* for */
-  } /* uBigRem */
-
-
-
 static void uBigDigitAdd (const bigDigitType *const big1, const memSizeType size1,
     const bigDigitType *const big2, const memSizeType size2, bigDigitType *const result)
 
@@ -2450,7 +2419,13 @@ static void uBigDigitAdd (const bigDigitType *const big1, const memSizeType size
 
 
 
-static void uBigDigitSbtrFrom (bigDigitType *const big1, const memSizeType size1,
+/**
+ *  Subtracts big2 from big1. The size of big1 must be greater or
+ *  equal the size of big2.
+ *  @return 0 if the difference is negative (a borrow is left over),
+ *          and 1 otherwise.
+ */
+static bigDigitType uBigDigitSbtrFrom (bigDigitType *const big1, const memSizeType size1,
     const bigDigitType *const big2, const memSizeType size2)
 
   {
@@ -2470,11 +2445,17 @@ static void uBigDigitSbtrFrom (bigDigitType *const big1, const memSizeType size1
       big1[pos] = (bigDigitType) (carry & BIGDIGIT_MASK);
       carry >>= BIGDIGIT_SIZE;
     } /* for */
+    return (bigDigitType) carry;
   } /* uBigDigitSbtrFrom */
 
 
 
-static void uBigDigitAddTo (bigDigitType *const big1,  const memSizeType size1,
+/**
+ *  Adds big2 to big1. The size of big1 must be greater or
+ *  equal the size of big2.
+ *  @return the carry that does not fit into big1.
+ */
+static bigDigitType uBigDigitAddTo (bigDigitType *const big1,  const memSizeType size1,
     const bigDigitType *const big2, const memSizeType size2)
 
   {
@@ -2493,6 +2474,7 @@ static void uBigDigitAddTo (bigDigitType *const big1,  const memSizeType size1,
       big1[pos] = (bigDigitType) (carry & BIGDIGIT_MASK);
       carry >>= BIGDIGIT_SIZE;
     } /* for */
+    return (bigDigitType) carry;
   } /* uBigDigitAddTo */
 
 
@@ -2530,110 +2512,597 @@ static void uBigDigitMult (const bigDigitType *const factor1,
 
 
 
-static void uBigKaratsubaMult (const bigDigitType *const factor1,
-    const bigDigitType *const factor2, const memSizeType size,
-    bigDigitType *const product, bigDigitType *const temp)
+static void uBigKaratsubaMult (const bigDigitType *const factor1,
+    const bigDigitType *const factor2, const memSizeType size,
+    bigDigitType *const product, bigDigitType *const temp)
+
+  {
+    memSizeType sizeLo;
+    memSizeType sizeHi;
+
+  /* uBigKaratsubaMult */
+    logMessage(printf("uBigKaratsubaMult: size=" FMT_U_MEM "\n", size););
+    if (size < KARATSUBA_MULT_THRESHOLD) {
+      uBigDigitMult(factor1, factor2, size, product);
+    } else {
+      sizeHi = size >> 1;
+      sizeLo = size - sizeHi;
+      uBigDigitAdd(factor1, sizeLo, &factor1[sizeLo], sizeHi, product);
+      uBigDigitAdd(factor2, sizeLo, &factor2[sizeLo], sizeHi, &product[size]);
+      uBigKaratsubaMult(product, &product[size], sizeLo + 1, temp, &temp[(sizeLo + 1) << 1]);
+      uBigKaratsubaMult(factor1, factor2, sizeLo, product, &temp[(sizeLo + 1) << 1]);
+      uBigKaratsubaMult(&factor1[sizeLo], &factor2[sizeLo], sizeHi, &product[sizeLo << 1],
+                        &temp[(sizeLo + 1) << 1]);
+      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, product, sizeLo << 1);
+      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, &product[sizeLo << 1], sizeHi << 1);
+      uBigDigitAddTo(&product[sizeLo], sizeLo + (sizeHi << 1), temp, (sizeLo + 1) << 1);
+    } /* if */
+  } /* uBigKaratsubaMult */
+
+
+
+static void uBigDigitSquare (const bigDigitType *const big1,
+    const memSizeType size, bigDigitType *const square)
+
+  {
+    memSizeType pos1;
+    memSizeType pos2;
+    doubleBigDigitType carry;
+    doubleBigDigitType product;
+    bigDigitType digit;
+
+  /* uBigDigitSquare */
+    digit = big1[0];
+    carry = (doubleBigDigitType) digit * digit;
+    square[0] = (bigDigitType) (carry & BIGDIGIT_MASK);
+    carry >>= BIGDIGIT_SIZE;
+    if (size == 1) {
+      square[1] = (bigDigitType) (carry);
+    } else {
+      for (pos2 = 1; pos2 < size; pos2++) {
+        product = (doubleBigDigitType) digit * big1[pos2];
+        carry += (product << 1) & BIGDIGIT_MASK;
+        square[pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        carry >>= BIGDIGIT_SIZE;
+        carry += product >> (BIGDIGIT_SIZE - 1);
+      } /* for */
+      square[pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+      square[pos2 + 1] = (bigDigitType) (carry >> BIGDIGIT_SIZE);
+      for (pos1 = 1; pos1 < size; pos1++) {
+        digit = big1[pos1];
+        carry = (doubleBigDigitType) square[pos1 << 1] +
+            (doubleBigDigitType) digit * digit;
+        square[pos1 << 1] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        carry >>= BIGDIGIT_SIZE;
+        for (pos2 = pos1 + 1; pos2 < size; pos2++) {
+          product = (doubleBigDigitType) digit * big1[pos2];
+          carry += (doubleBigDigitType) square[pos1 + pos2] +
+              ((product << 1) & BIGDIGIT_MASK);
+          square[pos1 + pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+          carry >>= BIGDIGIT_SIZE;
+          carry += product >> (BIGDIGIT_SIZE - 1);
+        } /* for */
+        carry += (doubleBigDigitType) square[pos1 + pos2];
+        square[pos1 + pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        if (pos1 < size - 1) {
+          square[pos1 + pos2 + 1] = (bigDigitType) (carry >> BIGDIGIT_SIZE);
+        } /* if */
+      } /* for */
+    } /* if */
+  } /* uBigDigitSquare */
+
+
+
+static void uBigKaratsubaSquare (const bigDigitType *const big1,
+    const memSizeType size, bigDigitType *const square, bigDigitType *const temp)
+
+  {
+    memSizeType sizeLo;
+    memSizeType sizeHi;
+
+  /* uBigKaratsubaSquare */
+    logMessage(printf("uBigKaratsubaSquare: size=" FMT_U_MEM "\n", size););
+    if (size < KARATSUBA_SQUARE_THRESHOLD) {
+      uBigDigitSquare(big1, size, square);
+    } else {
+      sizeHi = size >> 1;
+      sizeLo = size - sizeHi;
+      uBigDigitAdd(big1, sizeLo, &big1[sizeLo], sizeHi, square);
+      uBigKaratsubaSquare(square, sizeLo + 1, temp, &temp[(sizeLo + 1) << 1]);
+      uBigKaratsubaSquare(big1, sizeLo, square, &temp[(sizeLo + 1) << 1]);
+      uBigKaratsubaSquare(&big1[sizeLo], sizeHi, &square[sizeLo << 1], &temp[(sizeLo + 1) << 1]);
+      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, square, sizeLo << 1);
+      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, &square[sizeLo << 1], sizeHi << 1);
+      uBigDigitAddTo(&square[sizeLo], sizeLo + (sizeHi << 1), temp, (sizeLo + 1) << 1);
+    } /* if */
+  } /* uBigKaratsubaSquare */
+
+
+
+/**
+ *  Compares two unsigned big integers with the same number of digits.
+ *  @return -1, 0 or 1 if big1 is less than, equal to or greater
+ *          than big2.
+ */
+static int uBigDigitCmp (const bigDigitType *const big1,
+    const bigDigitType *const big2, memSizeType size)
+
+  { /* uBigDigitCmp */
+    while (size > 0) {
+      size--;
+      if (big1[size] != big2[size]) {
+        return big1[size] < big2[size] ? -1 : 1;
+      } /* if */
+    } /* while */
+    return 0;
+  } /* uBigDigitCmp */
+
+
+
+/**
+ *  Multiplies big2 with multiplier and subtracts the product from big1.
+ *  The size of big1 must be greater or equal the size of big2.
+ *  @return 0 if the difference is negative (a borrow is left over),
+ *          and 1 otherwise.
+ */
+static bigDigitType uBigDigitMultSub (bigDigitType *const big1, const memSizeType size1,
+    const bigDigitType *const big2, const memSizeType size2,
+    const bigDigitType multiplier)
+
+  {
+    memSizeType pos = 0;
+    doubleBigDigitType mult_carry = 0;
+    doubleBigDigitType sbtr_carry = 1;
+
+  /* uBigDigitMultSub */
+    do {
+      mult_carry += (doubleBigDigitType) big2[pos] * multiplier;
+      sbtr_carry += big1[pos] + (~mult_carry & BIGDIGIT_MASK);
+      big1[pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
+      mult_carry >>= BIGDIGIT_SIZE;
+      sbtr_carry >>= BIGDIGIT_SIZE;
+      pos++;
+    } while (pos < size2);
+    for (; mult_carry != 0 && pos < size1; pos++) {
+      sbtr_carry += big1[pos] + (~mult_carry & BIGDIGIT_MASK);
+      big1[pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
+      mult_carry >>= BIGDIGIT_SIZE;
+      sbtr_carry >>= BIGDIGIT_SIZE;
+    } /* for */
+    for (; sbtr_carry == 0 && pos < size1; pos++) {
+      sbtr_carry = (doubleBigDigitType) big1[pos] + BIGDIGIT_MASK;
+      big1[pos] = (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
+      sbtr_carry >>= BIGDIGIT_SIZE;
+    } /* for */
+    return (bigDigitType) (sbtr_carry & BIGDIGIT_MASK);
+  } /* uBigDigitMultSub */
+
+
+
+/**
+ *  Shifts the unsigned big integer big1 one bit to the right.
+ */
+static void uBigDigitRShift1 (bigDigitType *const big1, const memSizeType size)
+
+  {
+    memSizeType pos;
+
+  /* uBigDigitRShift1 */
+    for (pos = 0; pos < size - 1; pos++) {
+      big1[pos] = (bigDigitType) ((big1[pos] >> 1) |
+          (big1[pos + 1] << (BIGDIGIT_SIZE - 1)));
+    } /* for */
+    big1[pos] >>= 1;
+  } /* uBigDigitRShift1 */
+
+
+
+/**
+ *  Divides the unsigned big integer big1 by divisor_digit. The
+ *  quotient is assigned to big1 and the remainder is discarded.
+ *  This is used for exact divisions by small constants.
+ */
+static void uBigDigitDivideByDigit (bigDigitType *const big1, memSizeType size,
+    const bigDigitType divisor_digit)
+
+  {
+    doubleBigDigitType carry = 0;
+
+  /* uBigDigitDivideByDigit */
+    while (size > 0) {
+      size--;
+      carry <<= BIGDIGIT_SIZE;
+      carry |= big1[size];
+      big1[size] = (bigDigitType) (carry / divisor_digit);
+      carry %= divisor_digit;
+    } /* while */
+  } /* uBigDigitDivideByDigit */
+
+
+
+/**
+ *  Evaluates the polynomial p(x) = big1[0 .. sizeLo - 1] +
+ *  big1[sizeLo .. 2 * sizeLo - 1] * x + big1[2 * sizeLo .. ] * x ** 2
+ *  at the points 1, -1 and 2. Each result has sizeLo + 1 digits.
+ *  The results are stored one after another in eval. Since p(-1)
+ *  can be negative its absolute value is stored.
+ *  @return TRUE if p(-1) is negative, FALSE otherwise.
+ */
+static boolType uBigToom3Eval (const bigDigitType *const big1,
+    const memSizeType sizeLo, const memSizeType sizeHi, bigDigitType *const eval)
+
+  {
+    const bigDigitType *part1 = &big1[sizeLo];
+    const bigDigitType *part2 = &big1[sizeLo << 1];
+    bigDigitType *atOne = eval;
+    bigDigitType *atMinusOne = &eval[sizeLo + 1];
+    bigDigitType *atTwo = &eval[(sizeLo + 1) << 1];
+    memSizeType pos;
+    doubleBigDigitType digit2;
+    doubleBigDigitType carryOne = 0;
+    doubleBigDigitType carryEven = 0;
+    doubleBigDigitType carryTwo = 0;
+    doubleBigDigitType carry = 1;
+    boolType negative;
+
+  /* uBigToom3Eval */
+    for (pos = 0; pos < sizeLo; pos++) {
+      digit2 = pos < sizeHi ? part2[pos] : 0;
+      carryEven += (doubleBigDigitType) big1[pos] + digit2;
+      carryOne += (doubleBigDigitType) big1[pos] + part1[pos] + digit2;
+      carryTwo += (doubleBigDigitType) big1[pos] +
+          ((doubleBigDigitType) part1[pos] << 1) + (digit2 << 2);
+      atMinusOne[pos] = (bigDigitType) (carryEven & BIGDIGIT_MASK);
+      atOne[pos] = (bigDigitType) (carryOne & BIGDIGIT_MASK);
+      atTwo[pos] = (bigDigitType) (carryTwo & BIGDIGIT_MASK);
+      carryEven >>= BIGDIGIT_SIZE;
+      carryOne >>= BIGDIGIT_SIZE;
+      carryTwo >>= BIGDIGIT_SIZE;
+    } /* for */
+    atMinusOne[sizeLo] = (bigDigitType) carryEven;
+    atOne[sizeLo] = (bigDigitType) carryOne;
+    atTwo[sizeLo] = (bigDigitType) carryTwo;
+    /* atMinusOne contains p(0) + p(2). Now p(1) is subtracted. */
+    if (carryEven != 0 || uBigDigitCmp(atMinusOne, part1, sizeLo) >= 0) {
+      uBigDigitSbtrFrom(atMinusOne, sizeLo + 1, part1, sizeLo);
+      negative = FALSE;
+    } else {
+      for (pos = 0; pos < sizeLo; pos++) {
+        carry += (doubleBigDigitType) part1[pos] + (~atMinusOne[pos] & BIGDIGIT_MASK);
+        atMinusOne[pos] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        carry >>= BIGDIGIT_SIZE;
+      } /* for */
+      negative = TRUE;
+    } /* if */
+    return negative;
+  } /* uBigToom3Eval */
+
+
+
+/**
+ *  Multiplies factor1 and factor2 with the Toom-Cook 3-way algorithm.
+ *  Both factors have size digits and the product has 2 * size digits.
+ *  The factors are split into three parts, which are evaluated at the
+ *  points 0, 1, -1, 2 and infinity. The five products of the values
+ *  are interpolated in an order that keeps all intermediate results
+ *  nonnegative. If factor1 and factor2 are the same the products are
+ *  computed as squares. Small factors are multiplied with the
+ *  Karatsuba algorithm. The temp area must have space for 8 * size
+ *  digits.
+ */
+static void uBigToom3Mult (const bigDigitType *const factor1,
+    const bigDigitType *const factor2, const memSizeType size,
+    bigDigitType *const product, bigDigitType *const temp)
+
+  {
+    boolType square;
+    memSizeType sizeLo;
+    memSizeType sizeHi;
+    memSizeType sizeEval;
+    memSizeType sizeProd;
+    bigDigitType *eval1;
+    bigDigitType *eval2;
+    bigDigitType *prodOne;
+    bigDigitType *prodMinusOne;
+    bigDigitType *prodTwo;
+    bigDigitType *subTemp;
+    bigDigitType *evenSum;
+    bigDigitType *oddSum;
+    boolType negative;
+
+  /* uBigToom3Mult */
+    logMessage(printf("uBigToom3Mult: size=" FMT_U_MEM "\n", size););
+    square = factor1 == factor2;
+    if (square && size < TOOM3_SQUARE_THRESHOLD) {
+      uBigKaratsubaSquare(factor1, size, product, temp);
+    } else if (!square && size < TOOM3_MULT_THRESHOLD) {
+      uBigKaratsubaMult(factor1, factor2, size, product, temp);
+    } else {
+      sizeLo = (size + 2) / 3;
+      sizeHi = size - (sizeLo << 1);
+      sizeEval = sizeLo + 1;
+      sizeProd = sizeEval << 1;
+      eval1 = temp;
+      eval2 = &temp[3 * sizeEval];
+      prodOne = &temp[6 * sizeEval];
+      prodMinusOne = &prodOne[sizeProd];
+      prodTwo = &prodMinusOne[sizeProd];
+      subTemp = &prodTwo[sizeProd];
+      negative = uBigToom3Eval(factor1, sizeLo, sizeHi, eval1);
+      if (square) {
+        eval2 = eval1;
+        negative = FALSE;
+      } else if (uBigToom3Eval(factor2, sizeLo, sizeHi, eval2)) {
+        negative = !negative;
+      } /* if */
+      uBigToom3Mult(factor1, square ? factor1 : factor2, sizeLo, product, subTemp);
+      uBigToom3Mult(&factor1[sizeLo << 1], square ? &factor1[sizeLo << 1] : &factor2[sizeLo << 1],
+                    sizeHi, &product[sizeLo << 2], subTemp);
+      uBigToom3Mult(eval1, eval2, sizeEval, prodOne, subTemp);
+      uBigToom3Mult(&eval1[sizeEval], &eval2[sizeEval], sizeEval, prodMinusOne, subTemp);
+      uBigToom3Mult(&eval1[sizeEval << 1], &eval2[sizeEval << 1], sizeEval, prodTwo, subTemp);
+      /* The evaluations are not needed any more. Their space is reused. */
+      /* evenSum = r(1) + r(-1) = 2 * (c0 + c2 + c4)                    */
+      /* oddSum  = r(1) - r(-1) = 2 * (c1 + c3)                         */
+      uBigDigitAdd(prodOne, sizeProd, prodMinusOne, sizeProd, eval1);
+      uBigDigitSbtrFrom(prodOne, sizeProd, prodMinusOne, sizeProd);
+      if (negative) {
+        evenSum = prodOne;
+        oddSum = eval1;
+      } else {
+        evenSum = eval1;
+        oddSum = prodOne;
+      } /* if */
+      uBigDigitRShift1(evenSum, sizeProd);
+      uBigDigitRShift1(oddSum, sizeProd);
+      /* c2 = (c0 + c2 + c4) - c0 - c4 */
+      uBigDigitSbtrFrom(evenSum, sizeProd, product, sizeLo << 1);
+      uBigDigitSbtrFrom(evenSum, sizeProd, &product[sizeLo << 2], sizeHi << 1);
+      /* c3 = (r(2) - c0 - 4 * c2 - 16 * c4 - 2 * (c1 + c3)) / 6 */
+      uBigDigitSbtrFrom(prodTwo, sizeProd, product, sizeLo << 1);
+      uBigDigitMultSub(prodTwo, sizeProd, evenSum, sizeProd, 4);
+      uBigDigitMultSub(prodTwo, sizeProd, &product[sizeLo << 2], sizeHi << 1, 16);
+      uBigDigitMultSub(prodTwo, sizeProd, oddSum, sizeProd, 2);
+      uBigDigitDivideByDigit(prodTwo, sizeProd, 6);
+      /* c1 = (c1 + c3) - c3 */
+      uBigDigitSbtrFrom(oddSum, sizeProd, prodTwo, sizeProd);
+      memset(&product[sizeLo << 1], 0, (size_t) (sizeLo << 1) * sizeof(bigDigitType));
+      uBigDigitAddTo(&product[sizeLo], (size << 1) - sizeLo, oddSum, sizeProd);
+      uBigDigitAddTo(&product[sizeLo << 1], (size << 1) - (sizeLo << 1), evenSum, sizeProd);
+      uBigDigitAddTo(&product[3 * sizeLo], (size << 1) - 3 * sizeLo, prodTwo, sizeProd);
+    } /* if */
+  } /* uBigToom3Mult */
+
+
+
+/**
+ *  Divides the dividendSize digits of dividend by the divisorSize digits
+ *  of divisor with the schoolbook algorithm. This is the same algorithm
+ *  as in uBigRem(), but it works on digit arrays. The quotient gets
+ *  dividendSize - divisorSize digits and the remainder is left in the
+ *  lower divisorSize digits of dividend. The most significant bit of
+ *  divisor must be set and the upper divisorSize digits of dividend
+ *  must be less than divisor.
+ */
+static void uBigDigitDiv (bigDigitType *const dividend, const memSizeType dividendSize,
+    const bigDigitType *const divisor, const memSizeType divisorSize,
+    bigDigitType *const quotient)
+
+  {
+    memSizeType pos1;
+    doubleBigDigitType twodigits;
+    doubleBigDigitType remainder;
+    bigDigitType quotientdigit;
+
+  /* uBigDigitDiv */
+    for (pos1 = dividendSize - 1; pos1 >= divisorSize; pos1--) {
+      twodigits = (((doubleBigDigitType) dividend[pos1]) << BIGDIGIT_SIZE) |
+          dividend[pos1 - 1];
+      if (unlikely(dividend[pos1] == divisor[divisorSize - 1])) {
+        quotientdigit = BIGDIGIT_MASK;
+      } else {
+        quotientdigit = (bigDigitType) (twodigits / divisor[divisorSize - 1]);
+      } /* if */
+      remainder = twodigits - (doubleBigDigitType) quotientdigit *
+          divisor[divisorSize - 1];
+      while (remainder <= BIGDIGIT_MASK &&
+          (doubleBigDigitType) divisor[divisorSize - 2] * quotientdigit >
+          (remainder << BIGDIGIT_SIZE | dividend[pos1 - 2])) {
+        quotientdigit--;
+        remainder = twodigits - (doubleBigDigitType) quotientdigit *
+            divisor[divisorSize - 1];
+      } /* while */
+      if (uBigDigitMultSub(&dividend[pos1 - divisorSize], divisorSize + 1,
+                           divisor, divisorSize, quotientdigit) == 0) {
+        uBigDigitAddTo(&dividend[pos1 - divisorSize], divisorSize + 1,
+                       divisor, divisorSize);
+        quotientdigit--;
+      } /* if */
+      quotient[pos1 - divisorSize] = quotientdigit;
+    } /* for */
+  } /* uBigDigitDiv */
+
+
+
+/**
+ *  Divides the divisorSize + quotientSize digits of dividend by the
+ *  divisorSize digits of divisor with the recursive algorithm of
+ *  Burnikel and Ziegler. The preconditions and the placement of quotient
+ *  and remainder are the same as for uBigDigitDiv(). The quotient is
+ *  computed in parts with up to divisorSize / 2 digits. For each part
+ *  the upper part of the dividend is divided by the upper part of the
+ *  divisor with a recursive call. The product of this estimated
+ *  quotient and the lower part of the divisor is subtracted from the
+ *  dividend and a negative remainder is corrected. The temp area must
+ *  have space for 8 * divisorSize digits.
+ */
+static void uBigRecursiveDiv (bigDigitType *const dividend,
+    const bigDigitType *const divisor, const memSizeType divisorSize,
+    const memSizeType quotientSize, bigDigitType *const quotient,
+    bigDigitType *const temp)
 
   {
-    memSizeType sizeLo;
-    memSizeType sizeHi;
-
-  /* uBigKaratsubaMult */
-    logMessage(printf("uBigKaratsubaMult: size=" FMT_U_MEM "\n", size););
-    if (size < KARATSUBA_MULT_THRESHOLD) {
-      uBigDigitMult(factor1, factor2, size, product);
+    memSizeType pos;
+    memSizeType partSize;
+    memSizeType digitPos;
+    bigDigitType *part;
+    bigDigitType *partQuotient;
+
+  /* uBigRecursiveDiv */
+    logMessage(printf("uBigRecursiveDiv: divisorSize=" FMT_U_MEM
+                      ", quotientSize=" FMT_U_MEM "\n",
+                      divisorSize, quotientSize););
+    if (divisorSize < BURNIKEL_ZIEGLER_THRESHOLD ||
+        quotientSize < BURNIKEL_ZIEGLER_THRESHOLD) {
+      uBigDigitDiv(dividend, divisorSize + quotientSize, divisor, divisorSize, quotient);
     } else {
-      sizeHi = size >> 1;
-      sizeLo = size - sizeHi;
-      uBigDigitAdd(factor1, sizeLo, &factor1[sizeLo], sizeHi, product);
-      uBigDigitAdd(factor2, sizeLo, &factor2[sizeLo], sizeHi, &product[size]);
-      uBigKaratsubaMult(product, &product[size], sizeLo + 1, temp, &temp[(sizeLo + 1) << 1]);
-      uBigKaratsubaMult(factor1, factor2, sizeLo, product, &temp[(sizeLo + 1) << 1]);
-      uBigKaratsubaMult(&factor1[sizeLo], &factor2[sizeLo], sizeHi, &product[sizeLo << 1],
-                        &temp[(sizeLo + 1) << 1]);
-      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, product, sizeLo << 1);
-      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, &product[sizeLo << 1], sizeHi << 1);
-      uBigDigitAddTo(&product[sizeLo], sizeLo + (sizeHi << 1), temp, (sizeLo + 1) << 1);
+      /* The quotient is computed in parts with at most divisorSize / 2 */
+      /* digits, starting with the most significant part.               */
+      partSize = quotientSize % (divisorSize >> 1);
+      if (partSize == 0) {
+        partSize = divisorSize >> 1;
+      } /* if */
+      pos = quotientSize;
+      do {
+        pos -= partSize;
+        part = &dividend[pos];
+        partQuotient = &quotient[pos];
+        /* The upper divisorSize digits of part are less than divisor. */
+        if (uBigDigitCmp(&part[partSize << 1], &divisor[partSize],
+                         divisorSize - partSize) < 0) {
+          uBigRecursiveDiv(&part[partSize], &divisor[partSize], divisorSize - partSize,
+                           partSize, partQuotient, temp);
+        } else {
+          /* The upper part of the divisor fits as often as possible. */
+          memset(partQuotient, 0xff, (size_t) partSize * sizeof(bigDigitType));
+          memset(&part[partSize << 1], 0,
+                 (size_t) (divisorSize - partSize) * sizeof(bigDigitType));
+          uBigDigitAddTo(&part[partSize], divisorSize,
+                         &divisor[partSize], divisorSize - partSize);
+        } /* if */
+        /* The estimated quotient is at most 2 too big. */
+        uBigToom3Mult(partQuotient, divisor, partSize, temp, &temp[partSize << 1]);
+        if (uBigDigitSbtrFrom(part, divisorSize + partSize,
+                              temp, partSize << 1) == 0) {
+          do {
+            digitPos = 0;
+            while (partQuotient[digitPos] == 0) {
+              partQuotient[digitPos] = BIGDIGIT_MASK;
+              digitPos++;
+            } /* while */
+            partQuotient[digitPos]--;
+          } while (uBigDigitAddTo(part, divisorSize + partSize,
+                                  divisor, divisorSize) == 0);
+        } /* if */
+        partSize = divisorSize >> 1;
+      } while (pos != 0);
     } /* if */
-  } /* uBigKaratsubaMult */
+  } /* uBigRecursiveDiv */
 
 
 
-static void uBigDigitSquare (const bigDigitType *const big1,
-    const memSizeType size, bigDigitType *const square)
+/**
+ *  Computes quotient and remainder of an integer division of dividend by
+ *  divisor for nonnegative big integers. The remainder is delivered in
+ *  dividend. There are several preconditions for this function. Divisor
+ *  must have at least 2 digits and dividend must have at least one
+ *  digit more than divisor. If dividend and divisor have the same length in
+ *  digits nothing is done. The most significant bit of divisor must be
+ *  set. The most significant digit of dividend must be less than the
+ *  most significant digit of divisor. The computations to meet this
+ *  preconditions are done outside this function. The special cases
+ *  with a one digit divisor or a dividend with less digits than divisor are
+ *  handled in other functions. This algorithm based on the algorithm
+ *  from D.E. Knuth described in "The art of computer programming"
+ *  volume 2 (Seminumerical algorithms). Big divisions are done with
+ *  the recursive algorithm from uBigRecursiveDiv().
+ */
+static void uBigDiv (const bigIntType dividend, const const_bigIntType divisor,
+    const bigIntType quotient)
 
   {
-    memSizeType pos1;
-    memSizeType pos2;
-    doubleBigDigitType carry;
-    doubleBigDigitType product;
-    bigDigitType digit;
+    bigIntType temp;
 
-  /* uBigDigitSquare */
-    digit = big1[0];
-    carry = (doubleBigDigitType) digit * digit;
-    square[0] = (bigDigitType) (carry & BIGDIGIT_MASK);
-    carry >>= BIGDIGIT_SIZE;
-    if (size == 1) {
-      square[1] = (bigDigitType) (carry);
+  /* uBigDiv */
+    if (dividend->size - divisor->size >= BURNIKEL_ZIEGLER_THRESHOLD &&
+        divisor->size >= BURNIKEL_ZIEGLER_THRESHOLD &&
+        ALLOC_BIG(temp, divisor->size << 3)) {
+      uBigRecursiveDiv(dividend->bigdigits, divisor->bigdigits, divisor->size,
+                       dividend->size - divisor->size, quotient->bigdigits,
+                       temp->bigdigits);
+      FREE_BIG2(temp, divisor->size << 3);
     } else {
-      for (pos2 = 1; pos2 < size; pos2++) {
-        product = (doubleBigDigitType) digit * big1[pos2];
-        carry += (product << 1) & BIGDIGIT_MASK;
-        square[pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
-        carry >>= BIGDIGIT_SIZE;
-        carry += product >> (BIGDIGIT_SIZE - 1);
-      } /* for */
-      square[pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
-      square[pos2 + 1] = (bigDigitType) (carry >> BIGDIGIT_SIZE);
-      for (pos1 = 1; pos1 < size; pos1++) {
-        digit = big1[pos1];
-        carry = (doubleBigDigitType) square[pos1 << 1] +
-            (doubleBigDigitType) digit * digit;
-        square[pos1 << 1] = (bigDigitType) (carry & BIGDIGIT_MASK);
-        carry >>= BIGDIGIT_SIZE;
-        for (pos2 = pos1 + 1; pos2 < size; pos2++) {
-          product = (doubleBigDigitType) digit * big1[pos2];
-          carry += (doubleBigDigitType) square[pos1 + pos2] +
-              ((product << 1) & BIGDIGIT_MASK);
-          square[pos1 + pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
-          carry >>= BIGDIGIT_SIZE;
-          carry += product >> (BIGDIGIT_SIZE - 1);
-        } /* for */
-        carry += (doubleBigDigitType) square[pos1 + pos2];
-        square[pos1 + pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
-        if (pos1 < size - 1) {
-          square[pos1 + pos2 + 1] = (bigDigitType) (carry >> BIGDIGIT_SIZE);
-        } /* if */
-      } /* for */
+      /* Small divisions are done with the schoolbook algorithm. If    */
+      /* there is not enough memory for the temp area it is used also. */
+      uBigDigitDiv(dividend->bigdigits, dividend->size, divisor->bigdigits,
+                   divisor->size, quotient->bigdigits);
     } /* if */
-  } /* uBigDigitSquare */
+  } /* uBigDiv */
 
 
 
-static void uBigKaratsubaSquare (const bigDigitType *const big1,
-    const memSizeType size, bigDigitType *const square, bigDigitType *const temp)
+/**
+ *  Computes the remainder of an integer division of dividend by divisor
+ *  for nonnegative big integers. The remainder is delivered in
+ *  dividend. There are several preconditions for this function. Divisor
+ *  must have at least 2 digits and dividend must have at least one
+ *  digit more than divisor. If dividend and divisor have the same length in
+ *  digits nothing is done. The most significant bit of divisor must be
+ *  set. The most significant digit of dividend must be less than the
+ *  most significant digit of divisor. The computations to meet this
+ *  preconditions are done outside this function. The special cases
+ *  with a one digit divisor or a dividend with less digits than divisor are
+ *  handled in other functions. This algorithm based on the algorithm
+ *  from D.E. Knuth described in "The art of computer programming"
+ *  volume 2 (Seminumerical algorithms). Big divisions are done with
+ *  the recursive algorithm from uBigRecursiveDiv().
+ */
+static void uBigRem (const bigIntType dividend, const const_bigIntType divisor)
 
   {
-    memSizeType sizeLo;
-    memSizeType sizeHi;
+    memSizeType quotientSize;
+    memSizeType pos1;
+    doubleBigDigitType twodigits;
+    doubleBigDigitType remainder;
+    bigDigitType quotientdigit;
+    bigIntType temp;
 
-  /* uBigKaratsubaSquare */
-    logMessage(printf("uBigKaratsubaSquare: size=" FMT_U_MEM "\n", size););
-    if (size < KARATSUBA_SQUARE_THRESHOLD) {
-      uBigDigitSquare(big1, size, square);
+  /* uBigRem */
+    quotientSize = dividend->size - divisor->size;
+    if (quotientSize >= BURNIKEL_ZIEGLER_THRESHOLD &&
+        divisor->size >= BURNIKEL_ZIEGLER_THRESHOLD &&
+        ALLOC_BIG(temp, quotientSize + (divisor->size << 3))) {
+      /* The quotient is computed in the temp area and discarded. */
+      uBigRecursiveDiv(dividend->bigdigits, divisor->bigdigits, divisor->size,
+                       quotientSize, temp->bigdigits,
+                       &temp->bigdigits[quotientSize]);
+      FREE_BIG2(temp, quotientSize + (divisor->size << 3));
     } else {
-      sizeHi = size >> 1;
-      sizeLo = size - sizeHi;
-      uBigDigitAdd(big1, sizeLo, &big1[sizeLo], sizeHi, square);
-      uBigKaratsubaSquare(square, sizeLo + 1, temp, &temp[(sizeLo + 1) << 1]);
-      uBigKaratsubaSquare(big1, sizeLo, square, &temp[(sizeLo + 1) << 1]);
-      uBigKaratsubaSquare(&big1[sizeLo], sizeHi, &square[sizeLo << 1], &temp[(sizeLo + 1) << 1]);
-      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, square, sizeLo << 1);
-      uBigDigitSbtrFrom(temp, (sizeLo + 1) << 1, &square[sizeLo << 1], sizeHi << 1);
-      uBigDigitAddTo(&square[sizeLo], sizeLo + (sizeHi << 1), temp, (sizeLo + 1) << 1);
+      for (pos1 = dividend->size - 1; pos1 >= divisor->size; pos1--) {
+        twodigits = (((doubleBigDigitType) dividend->bigdigits[pos1]) << BIGDIGIT_SIZE) |
+            dividend->bigdigits[pos1 - 1];
+        if (unlikely(dividend->bigdigits[pos1] == divisor->bigdigits[divisor->size - 1])) {
+          quotientdigit = BIGDIGIT_MASK;
+        } else {
+          quotientdigit = (bigDigitType) (twodigits / divisor->bigdigits[divisor->size - 1]);
+        } /* if */
+        remainder = twodigits - (doubleBigDigitType) quotientdigit *
+            divisor->bigdigits[divisor->size - 1];
+        while (remainder <= BIGDIGIT_MASK &&
+            (doubleBigDigitType) divisor->bigdigits[divisor->size - 2] * quotientdigit >
+            (remainder << BIGDIGIT_SIZE | dividend->bigdigits[pos1 - 2])) {
+          quotientdigit--;
+          remainder = twodigits - (doubleBigDigitType) quotientdigit *
+              divisor->bigdigits[divisor->size - 1];
+        } /* while */
+        if (uBigDigitMultSub(&dividend->bigdigits[pos1 - divisor->size], divisor->size + 1,
+                             divisor->bigdigits, divisor->size, quotientdigit) == 0) {
+          uBigDigitAddTo(&dividend->bigdigits[pos1 - divisor->size], divisor->size + 1,
+                         divisor->bigdigits, divisor->size);
+        } /* if */
+      } /* for */
     } /* if */
-  } /* uBigKaratsubaSquare */
+  } /* uBigRem */
 
 
 static void uBigMultPositiveWithDigit (const const_bigIntType factor1,
@@ -2826,7 +3295,8 @@ static void bigMultAssign1 (bigIntType *const big_variable, bigDigitType factor_
 
 
 /**
- *  Multiply two unsigned big integers with the Karatsuba multiplication.
+ *  Multiply two unsigned big integers with the Karatsuba or the
+ *  Toom-Cook 3-way multiplication.
  *  @return the product, and NULL if there is not enough memory.
  */
 static bigIntType uBigMultK (const_bigIntType factor1, const_bigIntType factor2,
@@ -2860,13 +3330,13 @@ static bigIntType uBigMultK (const_bigIntType factor1, const_bigIntType factor2,
           factor2 = factor2_help;
           if (likely(ALLOC_BIG(product, (factor1->size >> 1) + (factor2->size << 1)))) {
             product->size = (factor1->size >> 1) + (factor2->size << 1);
-            if (unlikely(!ALLOC_BIG(temp, factor1->size << 2))) {
+            if (unlikely(!ALLOC_BIG(temp, factor1->size << 3))) {
               FREE_BIG2(product, (factor1->size >> 1) + (factor2->size << 1));
               product = NULL;
             } else {
-              uBigKaratsubaMult(factor1->bigdigits, factor2->bigdigits,
+              uBigToom3Mult(factor1->bigdigits, factor2->bigdigits,
                                 factor1->size >> 1, product->bigdigits, temp->bigdigits);
-              uBigKaratsubaMult(&factor1->bigdigits[factor1->size >> 1], factor2->bigdigits,
+              uBigToom3Mult(&factor1->bigdigits[factor1->size >> 1], factor2->bigdigits,
                                 factor2->size, temp->bigdigits,
                                 &temp->bigdigits[factor2->size << 1]);
               memset(&product->bigdigits[(factor1->size >> 1) << 1], 0,
@@ -2878,7 +3348,7 @@ static bigIntType uBigMultK (const_bigIntType factor1, const_bigIntType factor2,
                 negate_positive_big(product);
               } /* if */
               product = normalize(product);
-              FREE_BIG2(temp, factor1->size << 2);
+              FREE_BIG2(temp, factor1->size << 3);
             } /* if */
           } /* if */
           FREE_BIG2(factor2_help, factor1->size - (factor1->size >> 1));
@@ -2894,18 +3364,18 @@ static bigIntType uBigMultK (const_bigIntType factor1, const_bigIntType factor2,
                  (size_t) (factor2_help->size - factor2->size) * sizeof(bigDigitType));
           factor2 = factor2_help;
           if (likely(ALLOC_BIG(product, factor1->size << 1))) {
-            if (unlikely(!ALLOC_BIG(temp, factor1->size << 2))) {
+            if (unlikely(!ALLOC_BIG(temp, factor1->size << 3))) {
               FREE_BIG2(product, factor1->size << 1);
               product = NULL;
             } else {
-              uBigKaratsubaMult(factor1->bigdigits, factor2->bigdigits,
+              uBigToom3Mult(factor1->bigdigits, factor2->bigdigits,
                   factor1->size, product->bigdigits, temp->bigdigits);
               product->size = factor1->size << 1;
               if (negative) {
                 negate_positive_big(product);
               } /* if */
               product = normalize(product);
-              FREE_BIG2(temp, factor1->size << 2);
+              FREE_BIG2(temp, factor1->size << 3);
             } /* if */
           } /* if */
           FREE_BIG2(factor2_help, factor1->size);
@@ -2928,7 +3398,8 @@ static bigIntType uBigMultK (const_bigIntType factor1, const_bigIntType factor2,
 
 
 /**
- *  Square an unsigned big integer with the Karatsuba multiplication.
+ *  Square an unsigned big integer with the Karatsuba or the
+ *  Toom-Cook 3-way multiplication.
  *  @return the square, and NULL if there is not enough memory.
  */
 static bigIntType uBigSquareK (const_bigIntType big1)
@@ -2942,15 +3413,15 @@ static bigIntType uBigSquareK (const_bigIntType big1)
                        big1->size););
     if (big1->size >= KARATSUBA_SQUARE_THRESHOLD) {
       if (likely(ALLOC_BIG(square, big1->size << 1))) {
-        if (unlikely(!ALLOC_BIG(temp, big1->size << 2))) {
+        if (unlikely(!ALLOC_BIG(temp, big1->size << 3))) {
           FREE_BIG2(square, big1->size << 1);
           square = NULL;
         } else {
-          uBigKaratsubaSquare(big1->bigdigits, big1->size,
+          uBigToom3Mult(big1->bigdigits, big1->bigdigits, big1->size,
               square->bigdigits, temp->bigdigits);
           square->size = big1->size << 1;
           square = normalize(square);
-          FREE_BIG2(temp, big1->size << 2);
+          FREE_BIG2(temp, big1->size << 3);
         } /* if */
       } /* if */
     } else {
@@ -3095,6 +3566,281 @@ static bigIntType bigIPow1 (bigDigitType base, intType exponent)
 
 
 
+/**
+ *  Compute the negated inverse of an odd digit modulo 2 ** BIGDIGIT_SIZE.
+ *  This is the factor used by the Montgomery reduction. Every step of
+ *  the Newton iteration doubles the number of correct bits.
+ */
+static bigDigitType montgomeryInverse (const bigDigitType digit)
+
+  {
+    unsigned int correctBits;
+    doubleBigDigitType inverse = 1;
+
+  /* montgomeryInverse */
+    for (correctBits = 1; correctBits < BIGDIGIT_SIZE; correctBits <<= 1) {
+      inverse = (inverse *
+          ((2 - ((digit * inverse) & BIGDIGIT_MASK)) & BIGDIGIT_MASK)) & BIGDIGIT_MASK;
+    } /* for */
+    return (bigDigitType) (BIGDIGIT_MASK - inverse + 1);
+  } /* montgomeryInverse */
+
+
+
+/**
+ *  Montgomery reduction of the 2 * size + 1 digits of product.
+ *  The value of product must be less than modulus * R, where R is
+ *  2 ** (size * BIGDIGIT_SIZE). The size digits of result are
+ *  assigned product / R mod modulus. The product is overwritten.
+ */
+static void uBigMontgomeryReduce (bigDigitType *const product,
+    const bigDigitType *const modulus, const memSizeType size,
+    const bigDigitType inverse, bigDigitType *const result)
+
+  {
+    memSizeType pos1;
+    memSizeType pos2;
+    doubleBigDigitType factor;
+    doubleBigDigitType carry;
+
+  /* uBigMontgomeryReduce */
+    for (pos1 = 0; pos1 < size; pos1++) {
+      factor = ((doubleBigDigitType) product[pos1] * inverse) & BIGDIGIT_MASK;
+      carry = 0;
+      for (pos2 = 0; pos2 < size; pos2++) {
+        carry += (doubleBigDigitType) product[pos1 + pos2] + factor * modulus[pos2];
+        product[pos1 + pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        carry >>= BIGDIGIT_SIZE;
+      } /* for */
+      for (pos2 += pos1; carry != 0; pos2++) {
+        carry += product[pos2];
+        product[pos2] = (bigDigitType) (carry & BIGDIGIT_MASK);
+        carry >>= BIGDIGIT_SIZE;
+      } /* for */
+    } /* for */
+    /* The reduced value is less than 2 * modulus. */
+    if (product[size << 1] != 0 ||
+        uBigDigitCmp(&product[size], modulus, size) >= 0) {
+      uBigDigitSbtrFrom(&product[size], size + 1, modulus, size);
+    } /* if */
+    memcpy(result, &product[size], (size_t) size * sizeof(bigDigitType));
+  } /* uBigMontgomeryReduce */
+
+
+
+/**
+ *  Montgomery multiplication of two numbers with size digits.
+ *  The result gets factor1 * factor2 / R mod modulus. If factor1 and
+ *  factor2 are identical the number is squared. The result may be
+ *  identical to one of the factors. The temp area must have space for
+ *  10 * size + 1 digits.
+ */
+static void uBigMontgomeryMult (const bigDigitType *const factor1,
+    const bigDigitType *const factor2, const bigDigitType *const modulus,
+    const memSizeType size, const bigDigitType inverse,
+    bigDigitType *const result, bigDigitType *const temp)
+
+  { /* uBigMontgomeryMult */
+    uBigToom3Mult(factor1, factor2, size, temp, &temp[(size << 1) + 1]);
+    temp[size << 1] = 0;
+    uBigMontgomeryReduce(temp, modulus, size, inverse, result);
+  } /* uBigMontgomeryMult */
+
+
+
+static inline boolType uBigBitIsSet (const const_bigIntType big1,
+    const memSizeType bitPos)
+
+  { /* uBigBitIsSet */
+    return (boolType) ((big1->bigdigits[bitPos >> BIGDIGIT_LOG2_SIZE] >>
+        (bitPos & BIGDIGIT_SIZE_MASK)) & 1);
+  } /* uBigBitIsSet */
+
+
+
+/**
+ *  Modular exponentiation with an odd modulus.
+ *  All computations are done with Montgomery multiplications in one
+ *  scratch area. The exponent is processed from left to right with a
+ *  sliding window. The odd powers base ** 1, base ** 3, ... up to the
+ *  window size are precomputed.
+ *  @param exponent Exponent that must be positive.
+ *  @param modulus Modulus that must be odd and positive.
+ *  @return the result of the exponentiation, or NULL if an
+ *          exception has been raised.
+ */
+static bigIntType bigModPowMontgomery (const const_bigIntType base,
+    const const_bigIntType exponent, const const_bigIntType modulus)
+
+  {
+    memSizeType size;
+    bigDigitType inverse;
+    memSizeType bitLength;
+    unsigned int windowBits;
+    memSizeType tableSize;
+    memSizeType scratchSize;
+    memSizeType bitPos;
+    memSizeType windowEnd;
+    memSizeType window;
+    memSizeType pos;
+    boolType first = TRUE;
+    bigIntType shiftedBase;
+    bigIntType montgomeryBase;
+    bigIntType scratch;
+    bigDigitType *table;
+    bigDigitType *accu;
+    bigDigitType *temp;
+    bigIntType power;
+
+  /* bigModPowMontgomery */
+    size = modulus->size;
+    if (modulus->bigdigits[size - 1] == 0) {
+      size--;
+    } /* if */
+    inverse = montgomeryInverse(modulus->bigdigits[0]);
+    bitLength = (memSizeType) bigBitLength(exponent);
+    if (bitLength > 671) {
+      windowBits = 6;
+    } else if (bitLength > 239) {
+      windowBits = 5;
+    } else if (bitLength > 79) {
+      windowBits = 4;
+    } else if (bitLength > 23) {
+      windowBits = 3;
+    } else {
+      windowBits = 1;
+    } /* if */
+    tableSize = (memSizeType) 1 << (windowBits - 1);
+    scratchSize = (tableSize + 1) * size + 10 * size + 1;
+    /* The base is converted to the Montgomery form base * R mod modulus. */
+    shiftedBase = bigLShift(base, (intType) (size << BIGDIGIT_LOG2_SIZE));
+    if (unlikely(shiftedBase == NULL)) {
+      power = NULL;
+    } else {
+      montgomeryBase = bigMod(shiftedBase, modulus);
+      FREE_BIG(shiftedBase);
+      if (unlikely(montgomeryBase == NULL)) {
+        power = NULL;
+      } else if (unlikely(!ALLOC_BIG_CHECK_SIZE(scratch, scratchSize))) {
+        FREE_BIG(montgomeryBase);
+        raise_error(MEMORY_ERROR);
+        power = NULL;
+      } else if (unlikely(!ALLOC_BIG_SIZE_OK(power, size + 1))) {
+        FREE_BIG2(scratch, scratchSize);
+        FREE_BIG(montgomeryBase);
+        raise_error(MEMORY_ERROR);
+      } else {
+        table = scratch->bigdigits;
+        accu = &table[tableSize * size];
+        temp = &accu[size];
+        if (montgomeryBase->size >= size) {
+          memcpy(table, montgomeryBase->bigdigits, (size_t) size * sizeof(bigDigitType));
+        } else {
+          memcpy(table, montgomeryBase->bigdigits,
+                 (size_t) montgomeryBase->size * sizeof(bigDigitType));
+          memset(&table[montgomeryBase->size], 0,
+                 (size_t) (size - montgomeryBase->size) * sizeof(bigDigitType));
+        } /* if */
+        FREE_BIG(montgomeryBase);
+        if (tableSize > 1) {
+          uBigMontgomeryMult(table, table, modulus->bigdigits, size, inverse, accu, temp);
+          for (pos = 1; pos < tableSize; pos++) {
+            uBigMontgomeryMult(&table[(pos - 1) * size], accu, modulus->bigdigits,
+                               size, inverse, &table[pos * size], temp);
+          } /* for */
+        } /* if */
+        bitPos = bitLength;
+        while (bitPos > 0) {
+          if (!uBigBitIsSet(exponent, bitPos - 1)) {
+            uBigMontgomeryMult(accu, accu, modulus->bigdigits, size, inverse, accu, temp);
+            bitPos--;
+          } else {
+            windowEnd = bitPos > windowBits ? bitPos - windowBits : 0;
+            while (!uBigBitIsSet(exponent, windowEnd)) {
+              windowEnd++;
+            } /* while */
+            window = 0;
+            for (pos = bitPos; pos > windowEnd; pos--) {
+              window = (window << 1) | (memSizeType) uBigBitIsSet(exponent, pos - 1);
+              if (!first) {
+                uBigMontgomeryMult(accu, accu, modulus->bigdigits, size, inverse, accu, temp);
+              } /* if */
+            } /* for */
+            if (first) {
+              memcpy(accu, &table[(window >> 1) * size], (size_t) size * sizeof(bigDigitType));
+              first = FALSE;
+            } else {
+              uBigMontgomeryMult(accu, &table[(window >> 1) * size], modulus->bigdigits,
+                                 size, inverse, accu, temp);
+            } /* if */
+            bitPos = windowEnd;
+          } /* if */
+        } /* while */
+        /* Convert the result back from the Montgomery form. */
+        memcpy(temp, accu, (size_t) size * sizeof(bigDigitType));
+        memset(&temp[size], 0, (size_t) (size + 1) * sizeof(bigDigitType));
+        uBigMontgomeryReduce(temp, modulus->bigdigits, size, inverse, power->bigdigits);
+        power->bigdigits[size] = 0;
+        power->size = size + 1;
+        power = normalize(power);
+        FREE_BIG2(scratch, scratchSize);
+      } /* if */
+    } /* if */
+    return power;
+  } /* bigModPowMontgomery */
+
+
+
+/**
+ *  Modular exponentiation with an even modulus.
+ *  The exponent is processed from left to right. After every square
+ *  and every multiplication the intermediate result is reduced with
+ *  a division.
+ *  @param exponent Exponent that must be positive.
+ *  @param modulus Modulus that must be positive.
+ *  @return the result of the exponentiation, or NULL if an
+ *          exception has been raised.
+ */
+static bigIntType bigModPowDivision (const const_bigIntType base,
+    const const_bigIntType exponent, const const_bigIntType modulus)
+
+  {
+    memSizeType bitPos;
+    bigIntType reducedBase;
+    bigIntType product;
+    bigIntType big_help;
+    bigIntType power;
+
+  /* bigModPowDivision */
+    reducedBase = bigMod(base, modulus);
+    if (unlikely(reducedBase == NULL)) {
+      power = NULL;
+    } else {
+      power = bigCreate(reducedBase);
+      bitPos = (memSizeType) bigBitLength(exponent) - 1;
+      while (bitPos > 0 && power != NULL) {
+        bitPos--;
+        product = bigSquare(power);
+        if (product != NULL && uBigBitIsSet(exponent, bitPos)) {
+          big_help = product;
+          product = bigMult(big_help, reducedBase);
+          FREE_BIG(big_help);
+        } /* if */
+        FREE_BIG(power);
+        if (unlikely(product == NULL)) {
+          power = NULL;
+        } else {
+          power = bigMod(product, modulus);
+          FREE_BIG(product);
+        } /* if */
+      } /* while */
+      FREE_BIG(reducedBase);
+    } /* if */
+    return power;
+  } /* bigModPowDivision */
+
+
+
 static int uBigIsNot0 (const const_bigIntType big)
 
   {
@@ -5968,6 +6714,62 @@ bigIntType bigMod (const const_bigIntType dividend, const const_bigIntType divis
 
 
 
+/**
+ *  Compute the modular exponentiation of base ** exponent.
+ *  For an odd modulus Montgomery multiplication and a sliding window
+ *  are used. An even modulus is handled with a division after every
+ *  step. The result is computed without intermediate results that are
+ *  bigger than the square of the modulus.
+ *  @return base ** exponent mod modulus. The result is
+ *          nonnegative and less than the modulus. If the exponent
+ *          is zero the result is 1.
+ *  @exception RANGE_ERROR If exponent or modulus are negative.
+ *  @exception NUMERIC_ERROR If the modulus is zero and the
+ *             exponent is positive.
+ */
+bigIntType bigModPow (const const_bigIntType base, const const_bigIntType exponent,
+    const const_bigIntType modulus)
+
+  {
+    bigIntType power;
+
+  /* bigModPow */
+    logFunction(printf("bigModPow(%s, ", bigHexCStri(base));
+                printf("%s, ", bigHexCStri(exponent));
+                printf("%s)\n", bigHexCStri(modulus)););
+    if (unlikely(IS_NEGATIVE(exponent->bigdigits[exponent->size - 1]) ||
+                 IS_NEGATIVE(modulus->bigdigits[modulus->size - 1]))) {
+      logError(printf("bigModPow(%s, ", bigHexCStri(base));
+               printf("%s, ", bigHexCStri(exponent));
+               printf("%s): Exponent or modulus is negative.\n",
+                      bigHexCStri(modulus)););
+      raise_error(RANGE_ERROR);
+      power = NULL;
+    } else if (!uBigIsNot0(exponent)) {
+      if (unlikely(!ALLOC_BIG_SIZE_OK(power, 1))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        power->size = 1;
+        power->bigdigits[0] = 1;
+      } /* if */
+    } else if (unlikely(!uBigIsNot0(modulus))) {
+      logError(printf("bigModPow(%s, ", bigHexCStri(base));
+               printf("%s, ", bigHexCStri(exponent));
+               printf("%s): Division by zero.\n",
+                      bigHexCStri(modulus)););
+      raise_error(NUMERIC_ERROR);
+      power = NULL;
+    } else if (modulus->bigdigits[0] & 1) {
+      power = bigModPowMontgomery(base, exponent, modulus);
+    } else {
+      power = bigModPowDivision(base, exponent, modulus);
+    } /* if */
+    logFunction(printf("bigModPow --> %s\n", bigHexCStri(power)););
+    return power;
+  } /* bigModPow */
+
+
+
 /**
  *  Multiply two 'bigInteger' numbers.
  *  @return the product of the two numbers.
@@ -6285,6 +7087,20 @@ bigIntType bigParse (const const_striType stri)
                       striAsUnquotedCStri(stri)););
       raise_error(RANGE_ERROR);
       result = NULL;
+    } else if (stri->size - position > BINARY_PARSE_THRESHOLD) {
+      if (unlikely(!checkDigits(stri, position, 10))) {
+        logError(printf("bigParse(\"%s\"): "
+                        "Illegal digit.\n",
+                        striAsUnquotedCStri(stri)););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = binaryParse(stri, position, stri->size - position, 10);
+        if (result != NULL && negative) {
+          negate_positive_big(result);
+          result = normalize(result);
+        } /* if */
+      } /* if */
     } else {
       result_size = (stri->size - 1) / DECIMAL_DIGITS_IN_BIGDIGIT + 1;
       if (unlikely(!ALLOC_BIG(result, result_size))) {
@@ -657,6 +657,26 @@ objectType big_mod (listType arguments)
 
 
 
+/**
+ *  Compute the modular exponentiation of base ** exponent.
+ *  @return base ** exponent mod modulus.
+ *  @exception RANGE_ERROR If exponent or modulus are negative.
+ *  @exception NUMERIC_ERROR If the modulus is zero and the
+ *             exponent is positive.
+ */
+objectType big_mod_pow (listType arguments)
+
+  { /* big_mod_pow */
+    isit_bigint(arg_1(arguments));
+    isit_bigint(arg_2(arguments));
+    isit_bigint(arg_3(arguments));
+    return bld_bigint_temp(
+        bigModPow(take_bigint(arg_1(arguments)), take_bigint(arg_2(arguments)),
+                  take_bigint(arg_3(arguments))));
+  } /* big_mod_pow */
+
+
+
 /**
  *  Multiply two 'bigInteger' numbers.
  *  @return the product of the two numbers.
@@ -57,6 +57,7 @@ objectType big_lshift_assign  (listType arguments);
 objectType big_lt             (listType arguments);
 objectType big_mdiv           (listType arguments);
 objectType big_mod            (listType arguments);
+objectType big_mod_pow        (listType arguments);
 objectType big_mult           (listType arguments);
 objectType big_mult_assign    (listType arguments);
 objectType big_ne             (listType arguments);
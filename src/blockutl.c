@@ -46,6 +46,7 @@
 #include "traceutl.h"
 #include "objutl.h"
 #include "match.h"
+#include "thrcode.h"
 
 #undef EXTERN
 #define EXTERN
@@ -206,6 +207,9 @@ void free_block (blockType block)
     logFunction(printf("free_block(" FMT_U_MEM ")\n",
                        (memSizeType) block););
     free_expression(block->body);
+    if (block->code != NULL) {
+      free_code(block->code);
+    } /* if */
     free_local_consts(block->local_consts);
     free_loclist(block->params);
     free_locobj(&block->result);
@@ -243,6 +247,7 @@ blockType new_block (locListType block_params, const_locObjType block_result,
       created_block->local_vars = block_local_vars;
       created_block->local_consts = block_local_consts;
       created_block->body = block_body;
+      created_block->code = NULL;
     } /* if */
     logFunction(printf("new_block --> " FMT_U_MEM "\n", (memSizeType) created_block););
     return created_block;
@@ -4509,6 +4509,14 @@ static void determineLanguageProperties (FILE *versionFile)
                              "printf(\"%d\\n\", j == 8);\n"
                              "return 0;}\n") &&
             doTest() == 1);
+    fprintf(versionFile, "#define LABELS_AS_VALUES_OK %d\n",
+            compileAndLinkOk("#include <stdio.h>\n"
+                             "int main (int argc, char *argv[]){\n"
+                             "static const void *const table[] = {&&zero, &&one};\n"
+                             "goto *table[argc > 0];\n"
+                             "zero: printf(\"0\\n\"); return 0;\n"
+                             "one: printf(\"1\\n\"); return 0;}\n") &&
+            doTest() == 1);
   } /* determineLanguageProperties */
 
 
@@ -12060,11 +12068,53 @@ int main (int argc, char **argv)
                          "{struct pollfd pollFd[1];\n"
                          "poll(pollFd, 1, 0);\n"
                          "return 0;}\n"));
+    fprintf(versionFile, "#define HAS_EPOLL %d\n",
+        compileAndLinkOk("#include<sys/epoll.h>\n"
+                         "int main(int argc,char *argv[])\n"
+                         "{struct epoll_event events[1];\n"
+                         "int epollFd = epoll_create1(EPOLL_CLOEXEC);\n"
+                         "epoll_ctl(epollFd, EPOLL_CTL_ADD, 0, &events[0]);\n"
+                         "epoll_wait(epollFd, events, 1, 0);\n"
+                         "return 0;}\n"));
     fprintf(versionFile, "#define HAS_MMAP %d\n",
         compileAndLinkOk("#include<stddef.h>\n#include<sys/mman.h>\n"
                          "int main(int argc,char *argv[])\n"
                          "{mmap(NULL, 12345, PROT_READ, MAP_PRIVATE, 3, 0);\n"
                          "return 0;}\n"));
+    fprintf(versionFile, "#define HAS_OPENAT %d\n",
+        compileAndLinkOk("#include<stddef.h>\n#include<unistd.h>\n#include<fcntl.h>\n"
+                         "#include<dirent.h>\n#include<time.h>\n"
+                         "#include<sys/types.h>\n#include<sys/stat.h>\n"
+                         "int main(int argc,char *argv[])\n"
+                         "{struct stat statData; struct timespec times[2];\n"
+                         "char buffer[10]; int fd;\n"
+                         "fd = openat(AT_FDCWD, \".\", O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);\n"
+                         "closedir(fdopendir(fd));\n"
+                         "fstatat(AT_FDCWD, \"a\", &statData, AT_SYMLINK_NOFOLLOW);\n"
+                         "mkdirat(AT_FDCWD, \"a\", 0777);\n"
+                         "mkfifoat(AT_FDCWD, \"a\", 0777);\n"
+                         "readlinkat(AT_FDCWD, \"a\", buffer, 10);\n"
+                         "symlinkat(\"a\", AT_FDCWD, \"b\");\n"
+                         "utimensat(AT_FDCWD, \"a\", times, 0);\n"
+                         "fchmodat(AT_FDCWD, \"a\", 0777, 0);\n"
+                         "fchownat(AT_FDCWD, \"a\", 0, 0, 0);\n"
+                         "unlinkat(AT_FDCWD, \"a\", AT_REMOVEDIR);\n"
+                         "return 0;}\n"));
+    fprintf(versionFile, "#define HAS_COPY_FILE_RANGE %d\n",
+        compileAndLinkOk("#define _GNU_SOURCE\n#include<stddef.h>\n#include<unistd.h>\n"
+                         "int main(int argc,char *argv[])\n"
+                         "{copy_file_range(3, NULL, 4, NULL, 12345, 0);\n"
+                         "return 0;}\n"));
+    fprintf(versionFile, "#define HAS_SENDFILE %d\n",
+        compileAndLinkOk("#include<stddef.h>\n#include<sys/sendfile.h>\n"
+                         "int main(int argc,char *argv[])\n"
+                         "{sendfile(4, 3, NULL, 12345);\n"
+                         "return 0;}\n"));
+    fprintf(versionFile, "#define HAS_FICLONE %d\n",
+        compileAndLinkOk("#include<sys/ioctl.h>\n#include<linux/fs.h>\n"
+                         "int main(int argc,char *argv[])\n"
+                         "{ioctl(4, FICLONE, 3);\n"
+                         "return 0;}\n"));
     fprintf(logFile, " determined\n");
     determineIncludesAndLibs(versionFile);
     writeReadBufferEmptyMacro(versionFile);
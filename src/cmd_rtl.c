@@ -35,6 +35,11 @@
 
 #include "version.h"
 
+#if HAS_COPY_FILE_RANGE
+/* The prototype of copy_file_range() needs _GNU_SOURCE. */
+#define _GNU_SOURCE
+#endif
+
 #include "stdlib.h"
 #include "stdio.h"
 #include "string.h"
@@ -71,6 +76,17 @@
 #if HAS_MMAP
 #include "sys/mman.h"
 #endif
+#if HAS_OPENAT
+#include "fcntl.h"
+#include "dirent.h"
+#endif
+#if HAS_SENDFILE
+#include "sys/sendfile.h"
+#endif
+#if HAS_FICLONE
+#include "sys/ioctl.h"
+#include "linux/fs.h"
+#endif
 
 #include "common.h"
 #include "data_rtl.h"
@@ -242,6 +258,10 @@
 #define PRESERVE_TIMESTAMPS 0x04
 #define PRESERVE_SYMLINKS   0x08
 #define PRESERVE_ALL        0xFF
+#define CLONE_DATA         0x100
+
+#define USE_KERNEL_COPY (HAS_COPY_FILE_RANGE || HAS_SENDFILE || HAS_FICLONE)
+#define KERNEL_COPY_CHUNK 0x40000000
 
 #define USR_BITS_NORMAL (S_IRUSR == 0400 && S_IWUSR == 0200 && S_IXUSR == 0100)
 #define GRP_BITS_NORMAL (S_IRGRP == 0040 && S_IWGRP == 0020 && S_IXGRP == 0010)
@@ -362,6 +382,486 @@ static void copy_any_file (const const_os_striType from_name,
 
 
 
+#if HAS_OPENAT
+#if USE_KERNEL_COPY
+/**
+ *  Copy the content of 'from_fd' to 'to_fd' without going through user space.
+ *  With CLONE_DATA in 'flags' the file system is asked to share the
+ *  data blocks of the source (reflink). Otherwise or if this fails
+ *  copy_file_range() and sendfile() are tried.
+ *  @return TRUE if the copy was done (or failed with an error in err_info),
+ *          FALSE if no data was copied and read/write must be used.
+ */
+static boolType kernel_copy (int from_fd, int to_fd, int flags,
+    errInfoType *err_info)
+
+  {
+    ssize_t bytes_copied;
+    boolType started = FALSE;
+    boolType done = FALSE;
+
+  /* kernel_copy */
+    logFunction(printf("kernel_copy(%d, %d, 0x%x)\n", from_fd, to_fd, flags););
+#if HAS_FICLONE
+    if ((flags & CLONE_DATA) != 0 && ioctl(to_fd, FICLONE, from_fd) == 0) {
+      done = TRUE;
+    } /* if */
+#endif
+#if HAS_COPY_FILE_RANGE
+    if (!done) {
+      while ((bytes_copied = copy_file_range(from_fd, NULL, to_fd, NULL,
+                                             KERNEL_COPY_CHUNK, 0)) > 0 ||
+             (bytes_copied == -1 && errno == EINTR)) {
+        if (bytes_copied > 0) {
+          started = TRUE;
+        } /* if */
+      } /* while */
+      if (started) {
+        /* A failure after the first chunk cannot fall back. */
+        if (unlikely(bytes_copied != 0)) {
+          logError(printf("kernel_copy: copy_file_range(%d, NULL, %d, NULL, "
+                          FMT_U_MEM ", 0) failed:\n"
+                          "errno=%d\nerror: %s\n",
+                          from_fd, to_fd, (memSizeType) KERNEL_COPY_CHUNK,
+                          errno, strerror(errno)););
+          *err_info = FILE_ERROR;
+        } /* if */
+        done = TRUE;
+      } /* if */
+    } /* if */
+#endif
+#if HAS_SENDFILE
+    if (!done) {
+      while ((bytes_copied = sendfile(to_fd, from_fd, NULL,
+                                      KERNEL_COPY_CHUNK)) > 0 ||
+             (bytes_copied == -1 && errno == EINTR)) {
+        if (bytes_copied > 0) {
+          started = TRUE;
+        } /* if */
+      } /* while */
+      if (started) {
+        if (unlikely(bytes_copied != 0)) {
+          logError(printf("kernel_copy: sendfile(%d, %d, NULL, "
+                          FMT_U_MEM ") failed:\n"
+                          "errno=%d\nerror: %s\n",
+                          to_fd, from_fd, (memSizeType) KERNEL_COPY_CHUNK,
+                          errno, strerror(errno)););
+          *err_info = FILE_ERROR;
+        } /* if */
+        done = TRUE;
+      } /* if */
+    } /* if */
+#endif
+    logFunction(printf("kernel_copy(%d, %d, 0x%x, %d) --> %d\n",
+                       from_fd, to_fd, flags, *err_info, done););
+    return done;
+  } /* kernel_copy */
+#endif
+
+
+
+static void remove_entry_at (int dir_fd, const const_os_striType file_name,
+    boolType is_dir, errInfoType *err_info);
+
+
+
+/**
+ *  Remove the directory 'dir_name' relative to 'dir_fd' with all its content.
+ *  The entries are removed relative to a descriptor of the directory.
+ *  This way no path strings need to be built for the entries.
+ */
+static void remove_dir_at (int dir_fd, const const_os_striType dir_name,
+    errInfoType *err_info)
+
+  {
+    int sub_dir_fd;
+    DIR *directory;
+    struct dirent *current_entry;
+    os_stat_struct file_stat;
+    boolType type_known;
+    boolType is_dir = FALSE;
+
+  /* remove_dir_at */
+    logFunction(printf("remove_dir_at(%d, \"" FMT_S_OS "\")\n", dir_fd, dir_name););
+    if ((sub_dir_fd = openat(dir_fd, dir_name, O_RDONLY | O_DIRECTORY |
+                             O_NOFOLLOW | O_CLOEXEC)) == -1) {
+      logError(printf("remove_dir_at: openat(%d, \"" FMT_S_OS "\", *) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      dir_fd, dir_name, errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } else if ((directory = fdopendir(sub_dir_fd)) == NULL) {
+      logError(printf("remove_dir_at: fdopendir(%d) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      sub_dir_fd, errno, strerror(errno)););
+      close(sub_dir_fd);
+      *err_info = FILE_ERROR;
+    } else {
+      do {
+        current_entry = readdir(directory);
+      } while (current_entry != NULL && current_entry->d_name[0] == '.' &&
+               (current_entry->d_name[1] == '\0' ||
+                (current_entry->d_name[1] == '.' &&
+                 current_entry->d_name[2] == '\0')));
+      while (*err_info == OKAY_NO_ERROR && current_entry != NULL) {
+        type_known = FALSE;
+#ifdef DT_UNKNOWN
+        /* Most file systems deliver the file type without a stat call. */
+        if (current_entry->d_type != DT_UNKNOWN) {
+          is_dir = current_entry->d_type == DT_DIR;
+          type_known = TRUE;
+        } /* if */
+#endif
+        if (!type_known) {
+          if (fstatat(sub_dir_fd, current_entry->d_name, &file_stat,
+                      AT_SYMLINK_NOFOLLOW) != 0) {
+            logError(printf("remove_dir_at: fstatat(%d, \"" FMT_S_OS "\", *, "
+                            "AT_SYMLINK_NOFOLLOW) failed:\n"
+                            "errno=%d\nerror: %s\n",
+                            sub_dir_fd, current_entry->d_name,
+                            errno, strerror(errno)););
+            *err_info = FILE_ERROR;
+          } else {
+            is_dir = S_ISDIR(file_stat.st_mode);
+          } /* if */
+        } /* if */
+        if (*err_info == OKAY_NO_ERROR) {
+          remove_entry_at(sub_dir_fd, current_entry->d_name, is_dir, err_info);
+        } /* if */
+        do {
+          current_entry = readdir(directory);
+        } while (current_entry != NULL && current_entry->d_name[0] == '.' &&
+                 (current_entry->d_name[1] == '\0' ||
+                  (current_entry->d_name[1] == '.' &&
+                   current_entry->d_name[2] == '\0')));
+      } /* while */
+      /* Closes also sub_dir_fd. */
+      closedir(directory);
+      if (*err_info == OKAY_NO_ERROR) {
+        if (unlinkat(dir_fd, dir_name, AT_REMOVEDIR) != 0) {
+          logError(printf("remove_dir_at: unlinkat(%d, \"" FMT_S_OS "\", "
+                          "AT_REMOVEDIR) failed:\n"
+                          "errno=%d\nerror: %s\n",
+                          dir_fd, dir_name, errno, strerror(errno)););
+          *err_info = FILE_ERROR;
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("remove_dir_at(%d, \"" FMT_S_OS "\", %d) -->\n",
+                       dir_fd, dir_name, *err_info););
+  } /* remove_dir_at */
+
+
+
+static void remove_entry_at (int dir_fd, const const_os_striType file_name,
+    boolType is_dir, errInfoType *err_info)
+
+  { /* remove_entry_at */
+    if (is_dir) {
+      remove_dir_at(dir_fd, file_name, err_info);
+    } else if (unlinkat(dir_fd, file_name, 0) != 0) {
+      logError(printf("remove_entry_at: unlinkat(%d, \"" FMT_S_OS "\", 0) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      dir_fd, file_name, errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } /* if */
+  } /* remove_entry_at */
+
+
+
+static void remove_dir (const const_os_striType dir_name, errInfoType *err_info)
+
+  { /* remove_dir */
+    remove_dir_at(AT_FDCWD, dir_name, err_info);
+  } /* remove_dir */
+
+
+
+static void remove_any_file (const const_os_striType file_name, errInfoType *err_info)
+
+  {
+    os_stat_struct file_stat;
+
+  /* remove_any_file */
+    logFunction(printf("remove_any_file(\"" FMT_S_OS "\")\n", file_name););
+    if (os_lstat(file_name, &file_stat) != 0) {
+      logError(printf("remove_any_file: os_lstat(" FMT_S_OS ", *) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      file_name, errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } else {
+      remove_entry_at(AT_FDCWD, file_name, S_ISDIR(file_stat.st_mode), err_info);
+    } /* if */
+    logFunction(printf("remove_any_file(\"" FMT_S_OS "\", %d) -->\n",
+                       file_name, *err_info););
+  } /* remove_any_file */
+
+
+
+static void copy_any_file_at (int from_dir_fd, const const_os_striType from_name,
+    int to_dir_fd, const const_os_striType to_name, int flags,
+    errInfoType *err_info);
+
+
+
+static void copy_file_at (int from_dir_fd, const const_os_striType from_name,
+    int to_dir_fd, const const_os_striType to_name, int flags,
+    errInfoType *err_info)
+
+  {
+    int from_fd;
+    int to_fd;
+#if USE_KERNEL_COPY
+    os_stat_struct file_stat;
+#endif
+    boolType classic_copy = TRUE;
+    char *normal_buffer;
+    char *buffer;
+    size_t buffer_size;
+    char reserve_buffer[SIZE_RESERVE_BUFFER];
+    ssize_t bytes_read;
+    ssize_t bytes_written;
+    size_t write_pos;
+
+  /* copy_file_at */
+    logFunction(printf("copy_file_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\")\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name););
+    if ((from_fd = openat(from_dir_fd, from_name, O_RDONLY | O_CLOEXEC)) == -1) {
+      logError(printf("copy_file_at: openat(%d, \"" FMT_S_OS "\", O_RDONLY) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      from_dir_fd, from_name, errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } else if ((to_fd = openat(to_dir_fd, to_name, O_WRONLY | O_CREAT | O_TRUNC |
+                               O_CLOEXEC, 0666)) == -1) {
+      logError(printf("copy_file_at: openat(%d, \"" FMT_S_OS "\", O_WRONLY) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      to_dir_fd, to_name, errno, strerror(errno)););
+      close(from_fd);
+      *err_info = FILE_ERROR;
+    } else {
+#if USE_KERNEL_COPY
+      /* Files from /proc report a size of 0. They are read classically. */
+      if (fstat(from_fd, &file_stat) == 0 && file_stat.st_size > 0) {
+        classic_copy = !kernel_copy(from_fd, to_fd, flags, err_info);
+      } /* if */
+#endif
+      if (classic_copy) {
+        if (ALLOC_BYTES(normal_buffer, SIZE_NORMAL_BUFFER)) {
+          buffer = normal_buffer;
+          buffer_size = SIZE_NORMAL_BUFFER;
+        } else {
+          buffer = reserve_buffer;
+          buffer_size = SIZE_RESERVE_BUFFER;
+        } /* if */
+        while (*err_info == OKAY_NO_ERROR &&
+               ((bytes_read = read(from_fd, buffer, buffer_size)) > 0 ||
+                (bytes_read == -1 && errno == EINTR))) {
+          write_pos = 0;
+          while (*err_info == OKAY_NO_ERROR && bytes_read > 0 &&
+                 write_pos < (size_t) bytes_read) {
+            bytes_written = write(to_fd, &buffer[write_pos],
+                                  (size_t) bytes_read - write_pos);
+            if (bytes_written > 0) {
+              write_pos += (size_t) bytes_written;
+            } else if (bytes_written == 0 || errno != EINTR) {
+              logError(printf("copy_file_at: write(%d, *, " FMT_U_MEM ") failed:\n"
+                              "errno=%d\nerror: %s\n",
+                              to_fd, (memSizeType) ((size_t) bytes_read - write_pos),
+                              errno, strerror(errno)););
+              *err_info = FILE_ERROR;
+            } /* if */
+          } /* while */
+        } /* while */
+        if (unlikely(bytes_read == -1 && *err_info == OKAY_NO_ERROR)) {
+          logError(printf("copy_file_at: read(%d, *, " FMT_U_MEM ") failed:\n"
+                          "errno=%d\nerror: %s\n",
+                          from_fd, (memSizeType) buffer_size,
+                          errno, strerror(errno)););
+          *err_info = FILE_ERROR;
+        } /* if */
+        if (normal_buffer != NULL) {
+          FREE_BYTES(normal_buffer, SIZE_NORMAL_BUFFER);
+        } /* if */
+      } /* if */
+      close(from_fd);
+      if (close(to_fd) != 0) {
+        logError(printf("copy_file_at: close(%d) failed:\n"
+                        "errno=%d\nerror: %s\n",
+                        to_fd, errno, strerror(errno)););
+        *err_info = FILE_ERROR;
+      } /* if */
+      if (unlikely(*err_info != OKAY_NO_ERROR)) {
+        unlinkat(to_dir_fd, to_name, 0);
+      } /* if */
+    } /* if */
+    logFunction(printf("copy_file_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\", %d) -->\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name, *err_info););
+  } /* copy_file_at */
+
+
+
+/**
+ *  Copy the directory 'from_name' relative to 'from_dir_fd' to 'to_name'
+ *  relative to 'to_dir_fd'. The entries are copied relative to
+ *  descriptors of the source and destination directories.
+ */
+static void copy_dir_at (int from_dir_fd, const const_os_striType from_name,
+    int to_dir_fd, const const_os_striType to_name, int flags,
+    errInfoType *err_info)
+
+  {
+    int from_fd;
+    int to_fd;
+    DIR *directory;
+    struct dirent *current_entry;
+    errInfoType cleanup_info = OKAY_NO_ERROR;
+
+  /* copy_dir_at */
+    logFunction(printf("copy_dir_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\")\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name););
+    if ((from_fd = openat(from_dir_fd, from_name, O_RDONLY | O_DIRECTORY |
+                          O_CLOEXEC)) == -1) {
+      logError(printf("copy_dir_at: openat(%d, \"" FMT_S_OS "\", *) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      from_dir_fd, from_name, errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } else if ((directory = fdopendir(from_fd)) == NULL) {
+      logError(printf("copy_dir_at: fdopendir(%d) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      from_fd, errno, strerror(errno)););
+      close(from_fd);
+      *err_info = FILE_ERROR;
+    } else {
+      if (mkdirat(to_dir_fd, to_name, (S_IRWXU | S_IRWXG | S_IRWXO)) != 0) {
+        logError(printf("copy_dir_at: mkdirat(%d, \"" FMT_S_OS "\", rwxrwxrwx) failed:\n"
+                        "errno=%d\nerror: %s\n",
+                        to_dir_fd, to_name, errno, strerror(errno)););
+        *err_info = FILE_ERROR;
+      } else if ((to_fd = openat(to_dir_fd, to_name, O_RDONLY | O_DIRECTORY |
+                                 O_NOFOLLOW | O_CLOEXEC)) == -1) {
+        logError(printf("copy_dir_at: openat(%d, \"" FMT_S_OS "\", *) failed:\n"
+                        "errno=%d\nerror: %s\n",
+                        to_dir_fd, to_name, errno, strerror(errno)););
+        *err_info = FILE_ERROR;
+        unlinkat(to_dir_fd, to_name, AT_REMOVEDIR);
+      } else {
+        do {
+          current_entry = readdir(directory);
+        } while (current_entry != NULL && current_entry->d_name[0] == '.' &&
+                 (current_entry->d_name[1] == '\0' ||
+                  (current_entry->d_name[1] == '.' &&
+                   current_entry->d_name[2] == '\0')));
+        while (*err_info == OKAY_NO_ERROR && current_entry != NULL) {
+          copy_any_file_at(from_fd, current_entry->d_name,
+                           to_fd, current_entry->d_name, flags, err_info);
+          do {
+            current_entry = readdir(directory);
+          } while (current_entry != NULL && current_entry->d_name[0] == '.' &&
+                   (current_entry->d_name[1] == '\0' ||
+                    (current_entry->d_name[1] == '.' &&
+                     current_entry->d_name[2] == '\0')));
+        } /* while */
+        close(to_fd);
+        if (unlikely(*err_info != OKAY_NO_ERROR)) {
+          remove_dir_at(to_dir_fd, to_name, &cleanup_info);
+        } /* if */
+      } /* if */
+      /* Closes also from_fd. */
+      closedir(directory);
+    } /* if */
+    logFunction(printf("copy_dir_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\", %d) -->\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name, *err_info););
+  } /* copy_dir_at */
+
+
+
+static void copy_any_file_at (int from_dir_fd, const const_os_striType from_name,
+    int to_dir_fd, const const_os_striType to_name, int flags,
+    errInfoType *err_info)
+
+  {
+    os_stat_struct from_stat;
+    os_striType link_destination;
+    ssize_t readlink_result;
+    struct timespec to_times[2];
+
+  /* copy_any_file_at */
+    logFunction(printf("copy_any_file_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\")\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name););
+    if (fstatat(from_dir_fd, from_name, &from_stat,
+                flags & PRESERVE_SYMLINKS ? AT_SYMLINK_NOFOLLOW : 0) != 0) {
+      /* Source file does not exist */
+      logError(printf("copy_any_file_at: fstatat(%d, \"" FMT_S_OS "\", *, %s) failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      from_dir_fd, from_name,
+                      flags & PRESERVE_SYMLINKS ? "AT_SYMLINK_NOFOLLOW" : "0",
+                      errno, strerror(errno)););
+      *err_info = FILE_ERROR;
+    } else {
+      if (S_ISLNK(from_stat.st_mode)) {
+        if (unlikely(from_stat.st_size < 0 ||
+                     (unsigned_os_off_t) from_stat.st_size > MAX_OS_STRI_LEN)) {
+          *err_info = RANGE_ERROR;
+        } else {
+          if (unlikely(!os_stri_alloc(link_destination,
+                                      (memSizeType) from_stat.st_size))) {
+            *err_info = MEMORY_ERROR;
+          } else {
+            readlink_result = readlinkat(from_dir_fd, from_name, link_destination,
+                                         (size_t) from_stat.st_size);
+            if (unlikely(readlink_result != -1)) {
+              link_destination[readlink_result] = '\0';
+              if (symlinkat(link_destination, to_dir_fd, to_name) != 0) {
+                *err_info = FILE_ERROR;
+              } /* if */
+            } else {
+              *err_info = FILE_ERROR;
+            } /* if */
+            os_stri_free(link_destination);
+          } /* if */
+        } /* if */
+      } else if (S_ISREG(from_stat.st_mode)) {
+        copy_file_at(from_dir_fd, from_name, to_dir_fd, to_name, flags, err_info);
+      } else if (S_ISDIR(from_stat.st_mode)) {
+        copy_dir_at(from_dir_fd, from_name, to_dir_fd, to_name, flags, err_info);
+      } else if (S_ISFIFO(from_stat.st_mode)) {
+        if (mkfifoat(to_dir_fd, to_name, (S_IRWXU | S_IRWXG | S_IRWXO)) != 0) {
+          *err_info = FILE_ERROR;
+        } /* if */
+      } else {
+        *err_info = FILE_ERROR;
+      } /* if */
+      if (*err_info == OKAY_NO_ERROR && !S_ISLNK(from_stat.st_mode)) {
+        if (flags & PRESERVE_TIMESTAMPS) {
+          to_times[0].tv_sec = from_stat.st_atime;
+          to_times[0].tv_nsec = 0;
+          to_times[1].tv_sec = from_stat.st_mtime;
+          to_times[1].tv_nsec = 0;
+          utimensat(to_dir_fd, to_name, to_times, 0);
+        } /* if */
+        if (flags & PRESERVE_MODE) {
+          fchmodat(to_dir_fd, to_name, from_stat.st_mode & 07777, 0);
+        } /* if */
+        if (flags & PRESERVE_OWNERSHIP) {
+          fchownat(to_dir_fd, to_name, from_stat.st_uid, from_stat.st_gid, 0);
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("copy_any_file_at(%d, \"" FMT_S_OS "\", %d, \"" FMT_S_OS "\", %d) -->\n",
+                       from_dir_fd, from_name, to_dir_fd, to_name, *err_info););
+  } /* copy_any_file_at */
+
+
+
+static void copy_any_file (const const_os_striType from_name,
+    const const_os_striType to_name, int flags, errInfoType *err_info)
+
+  { /* copy_any_file */
+    copy_any_file_at(AT_FDCWD, from_name, AT_FDCWD, to_name, flags, err_info);
+  } /* copy_any_file */
+
+#else
+
+
 static void remove_dir (const const_os_striType dir_name, errInfoType *err_info)
 
   {
@@ -784,6 +1284,7 @@ static void copy_any_file (const const_os_striType from_name,
     logFunction(printf("copy_any_file(\"" FMT_S_OS "\", \"" FMT_S_OS "\", %d) -->\n",
                        from_name, to_name, *err_info););
   } /* copy_any_file */
+#endif
 
 
 
@@ -2716,7 +3217,8 @@ void cmdCloneFile (const const_striType sourcePath, const const_striType destPat
                           os_destPath););
           err_info = FILE_ERROR;
         } else {
-          copy_any_file(os_sourcePath, os_destPath, PRESERVE_ALL, &err_info);
+          copy_any_file(os_sourcePath, os_destPath, PRESERVE_ALL | CLONE_DATA,
+                        &err_info);
         } /* if */
         os_stri_free(os_destPath);
       } /* if */
@@ -653,6 +653,10 @@ boolType findTermDll (void);
 #define bitsetSize(set) (memSizeType) ((uintType) (set)->max_position - (uintType) (set)->min_position + 1)
 #define bitsetSize2(min_position,max_position) (memSizeType) ((uintType) (max_position) - (uintType) (min_position) + 1)
 #define bitsetIndex(set,pos) (memSizeType) ((uintType) (pos) - (uintType) (set)->min_position)
+/* A set with min_position > max_position uses the chunked  */
+/* representation for sparse sets, which is defined in       */
+/* set_rtl.c. For dense sets min_position <= max_position.   */
+#define isSparseSet(set) ((set)->min_position > (set)->max_position)
 
 
 /* Functions always create non-NULL fileType values. NULL is */
@@ -56,8 +56,8 @@
 #define DIALOG_IN_SIGNAL_HANDLER 1
 #define WITH_STRI_CAPACITY 1
 #define WITH_BIGINT_CAPACITY 1
-#define WITH_ARRAY_CAPACITY 0
-#define WITH_RTL_ARRAY_CAPACITY 0
+#define WITH_ARRAY_CAPACITY 1
+#define WITH_RTL_ARRAY_CAPACITY 1
 #define ALLOW_STRITYPE_SLICES 1
 #define ALLOW_BSTRITYPE_SLICES 1
 #define WITH_STRI_FREELIST 1
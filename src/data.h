@@ -114,6 +114,7 @@ typedef struct listStruct       *listType;
 typedef struct locObjStruct     *locObjType;
 typedef struct locListStruct    *locListType;
 typedef struct blockStruct      *blockType;
+typedef struct codeStruct       *codeType;
 typedef struct arrayStruct      *arrayType;
 typedef struct hashElemStruct   *hashElemType;
 typedef struct hashStruct       *hashType;
@@ -328,6 +329,7 @@ typedef struct blockStruct {
     locListType local_vars;
     listType local_consts;
     objectType body;
+    codeType code;
   } blockRecord;
 
 typedef struct arrayStruct {
@@ -354,6 +356,7 @@ typedef struct hashElemStruct {
     hashElemType next_greater;
     objectRecord key;
     objectRecord data;
+    unsigned int hashcode;
   } hashElemRecord;
 
 typedef struct hashStruct {
@@ -361,7 +364,7 @@ typedef struct hashStruct {
     unsigned int mask;
     unsigned int table_size;
     memSizeType size;
-    hashElemType table[1];
+    hashElemType *table;
   } hashRecord;
 
 typedef struct structStruct {
@@ -78,6 +78,7 @@ typedef struct rtlArrayStruct    *rtlArrayType;
 typedef struct rtlStructStruct   *rtlStructType;
 typedef struct rtlStructStruct   *rtlInterfaceType;
 typedef struct rtlHashElemStruct *rtlHashElemType;
+typedef struct rtlFlatHashElemStruct *rtlFlatHashElemType;
 typedef struct rtlHashStruct     *rtlHashType;
 typedef void *rtlPtrType;
 
@@ -87,6 +88,7 @@ typedef const struct rtlArrayStruct    *const_rtlArrayType;
 typedef const struct rtlStructStruct   *const_rtlStructType;
 typedef const struct rtlStructStruct   *const_rtlInterfaceType;
 typedef const struct rtlHashElemStruct *const_rtlHashElemType;
+typedef const struct rtlFlatHashElemStruct *const_rtlFlatHashElemType;
 typedef const struct rtlHashStruct     *const_rtlHashType;
 typedef const void *const_rtlPtrType;
 
@@ -168,14 +170,25 @@ typedef struct rtlHashElemStruct {
     rtlHashElemType next_greater;
     rtlObjectType key;
     rtlObjectType data;
+    unsigned int hashcode;
   } rtlHashElemRecord;
 
+/* Element of a flat hash map. Flat hash maps are used by compiled  */
+/* programs, if keys and values are simple values. The keys of a    */
+/* flat hash map are compared and hashed with their genericValue.   */
+typedef struct rtlFlatHashElemStruct {
+    rtlObjectType key;
+    rtlObjectType data;
+  } rtlFlatHashElemRecord;
+
 typedef struct rtlHashStruct {
     unsigned int bits;
     unsigned int mask;
     unsigned int table_size;
     memSizeType size;
-    rtlHashElemType table[1];
+    rtlHashElemType *table;
+    rtlFlatHashElemType flat_table;
+    unsigned char *flat_control;
   } rtlHashRecord;
 
 typedef struct rtlTimeStruct {
@@ -183,6 +183,7 @@ int STDCALL mysql_stmt_fetch_column (MYSQL_STMT *stmt,
                                      MYSQL_BIND *bnd,
                                      unsigned int column,
                                      unsigned long offset);
+my_bool STDCALL mysql_stmt_free_result (MYSQL_STMT *stmt);
 MYSQL_STMT *STDCALL mysql_stmt_init (MYSQL *mysql);
 unsigned long STDCALL mysql_stmt_param_count (MYSQL_STMT *stmt);
 int STDCALL mysql_stmt_prepare (MYSQL_STMT *stmt,
@@ -480,38 +480,55 @@ objectType dcl_getobj (listType arguments)
 
 
 
-static listType extractCurrentlyDeclaredObject (void)
+/**
+ *  Get the list element of the currently declared global object.
+ *  The currently declared object is the last element of the
+ *  local_object_list of stack_global. The object_list_insert_place
+ *  refers to the next field of the last list element. Since next
+ *  is the first field of a listRecord the last element can be
+ *  determined without a walk through the whole list.
+ *  @return the last list element, if its object is currently
+ *          declared, or NULL otherwise.
+ */
+static listType getCurrentlyDeclaredElement (void)
 
   {
-    listType lastElement;
-    listType nextToLast = NULL;
-    listType elementWithDeclaredObject = NULL;
-
-  /* extractCurrentlyDeclaredObject */
-    lastElement = prog->stack_global->local_object_list;
-    if (lastElement != NULL) {
-      while (lastElement->next != NULL) {
-        nextToLast = lastElement;
-        lastElement = lastElement->next;
-      } /* while */
-      if (CATEGORY_OF_OBJ(lastElement->obj) == DECLAREDOBJECT) {
-        /* The currently declared object is removed together with  */
-        /* its list element from the local_object_list. It is      */
-        /* added back to the end of the local_object_list after    */
-        /* the declarations from the statement have been inserted. */
-        elementWithDeclaredObject = lastElement;
-        if (nextToLast != NULL) {
-          nextToLast->next = NULL;
-          prog->stack_global->object_list_insert_place = &nextToLast->next;
-        } else {
-          prog->stack_global->local_object_list = NULL;
-          prog->stack_global->object_list_insert_place =
-              &prog->stack_global->local_object_list;
-        } /* if */
+    listType *insertPlace;
+    listType lastElement = NULL;
+
+  /* getCurrentlyDeclaredElement */
+    insertPlace = prog->stack_global->object_list_insert_place;
+    if (insertPlace != &prog->stack_global->local_object_list) {
+      lastElement = (listType) insertPlace;
+      if (CATEGORY_OF_OBJ(lastElement->obj) != DECLAREDOBJECT) {
+        lastElement = NULL;
       } /* if */
     } /* if */
-    return elementWithDeclaredObject;
-  } /* extractCurrentlyDeclaredObject */
+    return lastElement;
+  } /* getCurrentlyDeclaredElement */
+
+
+
+/**
+ *  Move the currently declared object to the end of the local_object_list.
+ *  The search for 'declaredObject' starts at 'listElement'. A nested
+ *  dcl_global might have already moved it further. The objects behind
+ *  'declaredObject' are moved one element forward. This way only the
+ *  list elements added since 'listElement' are touched.
+ */
+static void moveDeclaredObjectToEnd (listType listElement,
+    const objectType declaredObject)
+
+  { /* moveDeclaredObjectToEnd */
+    while (listElement->obj != declaredObject) {
+      listElement = listElement->next;
+    } /* while */
+    while (listElement->next != NULL) {
+      listElement->obj = listElement->next->obj;
+      listElement = listElement->next;
+    } /* while */
+    listElement->obj = declaredObject;
+  } /* moveDeclaredObjectToEnd */
 
 
 
@@ -522,7 +539,8 @@ objectType dcl_global (listType arguments)
     stackType stack_data_backup;
     stackType stack_current_backup;
     stackType stack_upward_backup;
-    listType currentlyDeclaredObject;
+    listType currentlyDeclaredElement;
+    objectType currentlyDeclaredObject = NULL;
 
   /* dcl_global */
     logFunction(printf("dcl_global\n"););
@@ -532,18 +550,22 @@ objectType dcl_global (listType arguments)
     stack_upward_backup = prog->stack_global->upward;
     prog->stack_data = prog->stack_global;
     prog->stack_current = prog->stack_global;
-    currentlyDeclaredObject = extractCurrentlyDeclaredObject();
+    currentlyDeclaredElement = getCurrentlyDeclaredElement();
+    if (currentlyDeclaredElement != NULL) {
+      currentlyDeclaredObject = currentlyDeclaredElement->obj;
+    } /* if */
 
     evaluate(statement);
 
-    if (currentlyDeclaredObject != NULL) {
+    if (currentlyDeclaredElement != NULL) {
       /* If a currently declared object exists it is moved from */
-      /* the old end of the local_object_list to the new end of */
-      /* the local_object_list. This assures that the function  */
-      /* close_current_stack() can use destructor functions     */
-      /* from types introduced in a local variable declaration. */
-      *prog->stack_global->object_list_insert_place = currentlyDeclaredObject;
-      prog->stack_global->object_list_insert_place = &currentlyDeclaredObject->next;
+      /* its old place in the local_object_list to the new end  */
+      /* of the local_object_list. This assures that the        */
+      /* function close_current_stack() can use destructor      */
+      /* functions from types introduced in a local variable    */
+      /* declaration.                                           */
+      moveDeclaredObjectToEnd(currentlyDeclaredElement,
+                              currentlyDeclaredObject);
     } /* if */
     prog->stack_data = stack_data_backup;
     prog->stack_current = stack_current_backup;
@@ -0,0 +1,2199 @@
+/********************************************************************/
+/*                                                                  */
+/*  drw_mem.c     Graphic access to in-memory pixel buffers.        */
+/*  Copyright (C) 1989 - 2026  Thomas Mertes                        */
+/*                                                                  */
+/*  This file is part of the Seed7 Runtime Library.                 */
+/*                                                                  */
+/*  The Seed7 Runtime Library is free software; you can             */
+/*  redistribute it and/or modify it under the terms of the GNU     */
+/*  Lesser General Public License as published by the Free Software */
+/*  Foundation; either version 2.1 of the License, or (at your      */
+/*  option) any later version.                                      */
+/*                                                                  */
+/*  The Seed7 Runtime Library is distributed in the hope that it    */
+/*  will be useful, but WITHOUT ANY WARRANTY; without even the      */
+/*  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR */
+/*  PURPOSE.  See the GNU Lesser General Public License for more    */
+/*  details.                                                        */
+/*                                                                  */
+/*  You should have received a copy of the GNU Lesser General       */
+/*  Public License along with this program; if not, write to the    */
+/*  Free Software Foundation, Inc., 51 Franklin Street,             */
+/*  Fifth Floor, Boston, MA  02110-1301, USA.                       */
+/*                                                                  */
+/*  Module: Seed7 Runtime Library                                   */
+/*  File: seed7/src/drw_mem.c                                       */
+/*  Changes: 2026  Thomas Mertes                                    */
+/*  Content: Graphic access to in-memory pixel buffers.             */
+/*                                                                  */
+/*  This driver does not need a display. Windows and pixmaps are    */
+/*  contiguous buffers with one 32-bit pixel per point. It can be   */
+/*  used instead of drw_x11.c to render images on a server or to    */
+/*  test graphic programs without a screen. Keyboard and mouse      */
+/*  input is not available.                                         */
+/*                                                                  */
+/********************************************************************/
+
+#define LOG_FUNCTIONS 0
+#define VERBOSE_EXCEPTIONS 0
+
+#include "version.h"
+
+#include "stdlib.h"
+#include "stdio.h"
+#include "string.h"
+#include "math.h"
+#include "limits.h"
+
+#include "common.h"
+#include "data_rtl.h"
+#include "striutl.h"
+#include "heaputl.h"
+#include "rtl_err.h"
+
+#undef EXTERN
+#define EXTERN
+#include "drw_drv.h"
+
+
+#define PI 3.141592653589793238462643383279502884197
+
+/* Size of the (virtual) screen. */
+#define SCREEN_WIDTH  1024
+#define SCREEN_HEIGHT  768
+
+/* Lines with coordinates beyond this limit are clipped in */
+/* floating point before they are drawn with integers.     */
+#define LINE_CLIP_LIMIT 0x20000000
+
+#define MIN_ARC_SEGMENTS    8
+#define MAX_ARC_SEGMENTS 4096
+
+#ifndef POINT_LIST_INT_SIZE
+#define POINT_LIST_INT_SIZE 16
+#endif
+#ifndef POINT_LIST_ABSOLUTE
+#define POINT_LIST_ABSOLUTE 0
+#endif
+
+#if POINT_LIST_INT_SIZE == 32
+typedef int32Type pointCoordType;
+#define POINT_COORD_MIN INT32TYPE_MIN
+#define POINT_COORD_MAX INT32TYPE_MAX
+#else
+typedef int16Type pointCoordType;
+#define POINT_COORD_MIN INT16TYPE_MIN
+#define POINT_COORD_MAX INT16TYPE_MAX
+#endif
+
+typedef struct {
+    pointCoordType x;
+    pointCoordType y;
+  } pointRecord;
+
+typedef uint32Type pixelType;
+
+typedef struct {
+    uintType usage_count;
+    /* Up to here the structure is identical to struct winStruct */
+    pixelType *pixels;
+    boolType is_pixmap;
+    boolType hasTransparentColor;
+    pixelType transparentColor;
+    winType parentWindow;
+    intType xPos;
+    intType yPos;
+    unsigned int width;
+    unsigned int height;
+    int close_action;
+  } mem_winRecord, *mem_winType;
+
+typedef const mem_winRecord *const_mem_winType;
+
+#define to_pixels(win)              (((const_mem_winType) (win))->pixels)
+#define is_pixmap(win)              (((const_mem_winType) (win))->is_pixmap)
+#define hasTransparentColor(win)    (((const_mem_winType) (win))->hasTransparentColor)
+#define to_transparentColor(win)    (((const_mem_winType) (win))->transparentColor)
+#define to_parentWindow(win)        (((const_mem_winType) (win))->parentWindow)
+#define to_xPos(win)                (((const_mem_winType) (win))->xPos)
+#define to_yPos(win)                (((const_mem_winType) (win))->yPos)
+#define to_width(win)               (((const_mem_winType) (win))->width)
+#define to_height(win)              (((const_mem_winType) (win))->height)
+
+#define to_var_pixels(win)              (((mem_winType) (win))->pixels)
+#define hasVarTransparentColor(win)     (((mem_winType) (win))->hasTransparentColor)
+#define to_var_transparentColor(win)    (((mem_winType) (win))->transparentColor)
+#define to_var_xPos(win)                (((mem_winType) (win))->xPos)
+#define to_var_yPos(win)                (((mem_winType) (win))->yPos)
+#define to_var_width(win)               (((mem_winType) (win))->width)
+#define to_var_height(win)              (((mem_winType) (win))->height)
+#define to_var_close_action(win)        (((mem_winType) (win))->close_action)
+
+static boolType init_called = FALSE;
+
+static winType emptyWindow = NULL;
+
+
+
+static winType generateEmptyWindow (void)
+
+  {
+    mem_winType newWindow;
+
+  /* generateEmptyWindow */
+    logFunction(printf("generateEmptyWindow()\n"););
+    if (unlikely(!ALLOC_RECORD2(newWindow, mem_winRecord, count.win, count.win_bytes))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      memset(newWindow, 0, sizeof(mem_winRecord));
+      newWindow->usage_count = 0;  /* Do not use reference counting (will not be freed). */
+    } /* if */
+    logFunction(printf("generateEmptyWindow --> " FMT_U_MEM
+                       " (usage=" FMT_U ")\n",
+                       (memSizeType) newWindow,
+                       newWindow != NULL ?
+                           newWindow->usage_count : (uintType) 0););
+    return (winType) newWindow;
+  } /* generateEmptyWindow */
+
+
+
+/**
+ *  Create a window or pixmap with a pixel buffer initialized to black.
+ *  The caller must check that 'width' and 'height' are in the
+ *  range 1 .. UINT_MAX.
+ *  @return the new window or NULL if there is not enough memory.
+ */
+static mem_winType newMemWindow (intType width, intType height,
+    boolType isPixmap)
+
+  {
+    mem_winType newWindow;
+
+  /* newMemWindow */
+    if (unlikely((uintType) width > MAX_MEMSIZETYPE / sizeof(pixelType) /
+                                    (uintType) height)) {
+      newWindow = NULL;
+    } else if (ALLOC_RECORD2(newWindow, mem_winRecord, count.win, count.win_bytes)) {
+      memset(newWindow, 0, sizeof(mem_winRecord));
+      newWindow->pixels = (pixelType *) calloc(
+          (memSizeType) width * (memSizeType) height, sizeof(pixelType));
+      if (unlikely(newWindow->pixels == NULL)) {
+        FREE_RECORD2(newWindow, mem_winRecord, count.win, count.win_bytes);
+        newWindow = NULL;
+      } else {
+        newWindow->usage_count = 1;
+        newWindow->is_pixmap = isPixmap;
+        newWindow->width = (unsigned int) width;
+        newWindow->height = (unsigned int) height;
+      } /* if */
+    } /* if */
+    return newWindow;
+  } /* newMemWindow */
+
+
+
+/**
+ *  Fill the pixels from 'xLeft' to 'xRight' (inclusive) of row 'yPos'.
+ *  The span is clipped at the borders of the pixel buffer.
+ */
+static void fillSpan (const_winType actual_window, int64Type yPos,
+    int64Type xLeft, int64Type xRight, pixelType col)
+
+  {
+    pixelType *pixel;
+    pixelType *beyond;
+
+  /* fillSpan */
+    if (yPos >= 0 && yPos < (int64Type) to_height(actual_window)) {
+      if (xLeft < 0) {
+        xLeft = 0;
+      } /* if */
+      if (xRight >= (int64Type) to_width(actual_window)) {
+        xRight = (int64Type) to_width(actual_window) - 1;
+      } /* if */
+      if (xLeft <= xRight) {
+        pixel = &to_pixels(actual_window)[
+            (memSizeType) yPos * to_width(actual_window) + (memSizeType) xLeft];
+        beyond = pixel + (memSizeType) (xRight - xLeft + 1);
+        /* A plain loop, that the compiler can vectorize. */
+        for (; pixel < beyond; pixel++) {
+          *pixel = col;
+        } /* for */
+      } /* if */
+    } /* if */
+  } /* fillSpan */
+
+
+
+static void fillRectangle (const_winType actual_window, int64Type xPos,
+    int64Type yPos, int64Type width, int64Type height, pixelType col)
+
+  {
+    int64Type yBeyond;
+
+  /* fillRectangle */
+    yBeyond = yPos + height;
+    if (yPos < 0) {
+      yPos = 0;
+    } /* if */
+    if (yBeyond > (int64Type) to_height(actual_window)) {
+      yBeyond = (int64Type) to_height(actual_window);
+    } /* if */
+    for (; yPos < yBeyond; yPos++) {
+      fillSpan(actual_window, yPos, xPos, xPos + width - 1, col);
+    } /* for */
+  } /* fillRectangle */
+
+
+
+/**
+ *  Clip the line from (x1, y1) to (x2, y2) with floating point arithmetic.
+ *  This is used for lines with huge coordinates. The line is clipped
+ *  at a rectangle, that is one pixel larger than the pixel buffer.
+ *  @return TRUE if a part of the line is inside the rectangle,
+ *          FALSE otherwise.
+ */
+static boolType clipLine (const_winType actual_window,
+    int64Type *x1, int64Type *y1, int64Type *x2, int64Type *y2)
+
+  {
+    double limit[4];
+    double delta[4];
+    double tStart = 0.0;
+    double tEnd = 1.0;
+    double dx, dy;
+    double ratio;
+    int side;
+    boolType visible = TRUE;
+
+  /* clipLine */
+    dx = (double) (*x2 - *x1);
+    dy = (double) (*y2 - *y1);
+    delta[0] = -dx;
+    limit[0] = (double) *x1 + 1.0;
+    delta[1] = dx;
+    limit[1] = (double) to_width(actual_window) - (double) *x1;
+    delta[2] = -dy;
+    limit[2] = (double) *y1 + 1.0;
+    delta[3] = dy;
+    limit[3] = (double) to_height(actual_window) - (double) *y1;
+    for (side = 0; visible && side < 4; side++) {
+      if (delta[side] == 0.0) {
+        visible = limit[side] >= 0.0;
+      } else {
+        ratio = limit[side] / delta[side];
+        if (delta[side] < 0.0) {
+          if (ratio > tStart) {
+            tStart = ratio;
+          } /* if */
+        } else if (ratio < tEnd) {
+          tEnd = ratio;
+        } /* if */
+        visible = tStart <= tEnd;
+      } /* if */
+    } /* for */
+    if (visible) {
+      *x2 = (int64Type) floor((double) *x1 + tEnd * dx + 0.5);
+      *y2 = (int64Type) floor((double) *y1 + tEnd * dy + 0.5);
+      *x1 = (int64Type) floor((double) *x1 + tStart * dx + 0.5);
+      *y1 = (int64Type) floor((double) *y1 + tStart * dy + 0.5);
+    } /* if */
+    return visible;
+  } /* clipLine */
+
+
+
+/**
+ *  Draw a line with the Bresenham algorithm.
+ *  Only the part of the major axis, that is inside of the pixel
+ *  buffer, is processed. The error term of the first visible pixel
+ *  is computed directly.
+ */
+static void drawLine (const_winType actual_window, int64Type x1, int64Type y1,
+    int64Type x2, int64Type y2, pixelType col)
+
+  {
+    int64Type width;
+    int64Type height;
+    int64Type major;
+    int64Type minor;
+    int64Type step;
+    int64Type stepBeyond;
+    int64Type position;
+    int64Type minorStep;
+    int64Type error;
+    int64Type swap;
+
+  /* drawLine */
+    width = (int64Type) to_width(actual_window);
+    height = (int64Type) to_height(actual_window);
+    if ((x1 < -LINE_CLIP_LIMIT || x1 > LINE_CLIP_LIMIT ||
+         y1 < -LINE_CLIP_LIMIT || y1 > LINE_CLIP_LIMIT ||
+         x2 < -LINE_CLIP_LIMIT || x2 > LINE_CLIP_LIMIT ||
+         y2 < -LINE_CLIP_LIMIT || y2 > LINE_CLIP_LIMIT) &&
+        !clipLine(actual_window, &x1, &y1, &x2, &y2)) {
+      return;
+    } /* if */
+    if (y1 == y2) {
+      if (x1 <= x2) {
+        fillSpan(actual_window, y1, x1, x2, col);
+      } else {
+        fillSpan(actual_window, y1, x2, x1, col);
+      } /* if */
+    } else if ((x2 >= x1 ? x2 - x1 : x1 - x2) >= (y2 >= y1 ? y2 - y1 : y1 - y2)) {
+      if (x2 < x1) {
+        swap = x1; x1 = x2; x2 = swap;
+        swap = y1; y1 = y2; y2 = swap;
+      } /* if */
+      major = x2 - x1;
+      minor = y2 >= y1 ? y2 - y1 : y1 - y2;
+      minorStep = y2 >= y1 ? 1 : -1;
+      step = x1 < 0 ? -x1 : 0;
+      stepBeyond = x2 < width ? major + 1 : width - x1;
+      if (step < stepBeyond) {
+        error = 2 * step * minor + major;
+        position = y1 + minorStep * (error / (2 * major));
+        error %= 2 * major;
+        for (; step < stepBeyond; step++) {
+          if (position >= 0 && position < height) {
+            to_pixels(actual_window)[(memSizeType) position * (memSizeType) width +
+                                     (memSizeType) (x1 + step)] = col;
+          } else if (minor == 0 || (position < 0) == (minorStep < 0)) {
+            /* The line has left the pixel buffer. */
+            step = stepBeyond;
+          } /* if */
+          error += 2 * minor;
+          if (error >= 2 * major) {
+            error -= 2 * major;
+            position += minorStep;
+          } /* if */
+        } /* for */
+      } /* if */
+    } else {
+      if (y2 < y1) {
+        swap = x1; x1 = x2; x2 = swap;
+        swap = y1; y1 = y2; y2 = swap;
+      } /* if */
+      major = y2 - y1;
+      minor = x2 >= x1 ? x2 - x1 : x1 - x2;
+      minorStep = x2 >= x1 ? 1 : -1;
+      step = y1 < 0 ? -y1 : 0;
+      stepBeyond = y2 < height ? major + 1 : height - y1;
+      if (step < stepBeyond) {
+        error = 2 * step * minor + major;
+        position = x1 + minorStep * (error / (2 * major));
+        error %= 2 * major;
+        for (; step < stepBeyond; step++) {
+          if (position >= 0 && position < width) {
+            to_pixels(actual_window)[(memSizeType) (y1 + step) * (memSizeType) width +
+                                     (memSizeType) position] = col;
+          } else if (minor == 0 || (position < 0) == (minorStep < 0)) {
+            /* The line has left the pixel buffer. */
+            step = stepBeyond;
+          } /* if */
+          error += 2 * minor;
+          if (error >= 2 * major) {
+            error -= 2 * major;
+            position += minorStep;
+          } /* if */
+        } /* for */
+      } /* if */
+    } /* if */
+  } /* drawLine */
+
+
+
+/**
+ *  Half width of the circle row 'dy' rows away from the center.
+ *  This is the largest dx with dx ** 2 + dy ** 2 <= radius ** 2 + radius.
+ *  Using radius + 0.5 as real radius gives round circles, that look
+ *  like the ones of the midpoint circle algorithm.
+ */
+static int64Type circleHalfWidth (int64Type radius, int64Type dy)
+
+  {
+    double square;
+
+  /* circleHalfWidth */
+    square = (double) radius * (double) radius + (double) radius -
+             (double) dy * (double) dy;
+    return square < 0.0 ? -1 : (int64Type) sqrt(square);
+  } /* circleHalfWidth */
+
+
+
+static void drawCircle (const_winType actual_window, int64Type xCenter,
+    int64Type yCenter, int64Type radius, pixelType col, boolType filled)
+
+  {
+    int64Type dy;
+    int64Type dyBeyond;
+    int64Type halfWidth;
+    int64Type innerWidth;
+
+  /* drawCircle */
+    /* Only rows inside of the pixel buffer are processed. */
+    dy = yCenter - radius < 0 ? -yCenter : -radius;
+    dyBeyond = yCenter + radius >= (int64Type) to_height(actual_window) ?
+               (int64Type) to_height(actual_window) - yCenter : radius + 1;
+    for (; dy < dyBeyond; dy++) {
+      halfWidth = circleHalfWidth(radius, dy);
+      if (filled) {
+        fillSpan(actual_window, yCenter + dy,
+                 xCenter - halfWidth, xCenter + halfWidth, col);
+      } else {
+        /* The pixels of the next row, that is more distant from the */
+        /* center, are not part of the outline in this row.          */
+        innerWidth = circleHalfWidth(radius, dy < 0 ? dy - 1 : dy + 1) + 1;
+        if (innerWidth > halfWidth) {
+          innerWidth = halfWidth;
+        } /* if */
+        fillSpan(actual_window, yCenter + dy,
+                 xCenter - halfWidth, xCenter - innerWidth, col);
+        fillSpan(actual_window, yCenter + dy,
+                 xCenter + innerWidth, xCenter + halfWidth, col);
+      } /* if */
+    } /* for */
+  } /* drawCircle */
+
+
+
+/**
+ *  Fill a polygon with the even-odd rule.
+ *  Like lines the coordinates of the polygon refer to pixel centers.
+ *  A pixel is filled if its center is inside of the polygon.
+ *  Every row of the pixel buffer is intersected with all edges.
+ */
+static void fillPolygon (const_winType actual_window, const double *xCoords,
+    const double *yCoords, memSizeType numPoints, pixelType col)
+
+  {
+    double yMin;
+    double yMax;
+    double yCenter;
+    double x1, y1, x2, y2;
+    double crossing;
+    double *crossings;
+    memSizeType numCrossings;
+    memSizeType pos;
+    memSizeType insertPos;
+    int64Type row;
+    int64Type rowBeyond;
+
+  /* fillPolygon */
+    if (numPoints >= 3 &&
+        (crossings = (double *) malloc(numPoints * sizeof(double))) != NULL) {
+      yMin = yCoords[0];
+      yMax = yCoords[0];
+      for (pos = 1; pos < numPoints; pos++) {
+        if (yCoords[pos] < yMin) {
+          yMin = yCoords[pos];
+        } else if (yCoords[pos] > yMax) {
+          yMax = yCoords[pos];
+        } /* if */
+      } /* for */
+      row = yMin < 0.0 ? 0 : (int64Type) ceil(yMin);
+      rowBeyond = yMax >= (double) to_height(actual_window) ?
+                  (int64Type) to_height(actual_window) : (int64Type) ceil(yMax);
+      for (; row < rowBeyond; row++) {
+        yCenter = (double) row;
+        numCrossings = 0;
+        x1 = xCoords[numPoints - 1];
+        y1 = yCoords[numPoints - 1];
+        for (pos = 0; pos < numPoints; pos++) {
+          x2 = xCoords[pos];
+          y2 = yCoords[pos];
+          if ((y1 <= yCenter) != (y2 <= yCenter)) {
+            crossing = x1 + (yCenter - y1) * (x2 - x1) / (y2 - y1);
+            /* Insertion sort: A row crosses only few edges. */
+            insertPos = numCrossings;
+            while (insertPos > 0 && crossings[insertPos - 1] > crossing) {
+              crossings[insertPos] = crossings[insertPos - 1];
+              insertPos--;
+            } /* while */
+            crossings[insertPos] = crossing;
+            numCrossings++;
+          } /* if */
+          x1 = x2;
+          y1 = y2;
+        } /* for */
+        for (pos = 0; pos + 1 < numCrossings; pos += 2) {
+          if (crossings[pos + 1] > 0.0 &&
+              crossings[pos] < (double) to_width(actual_window)) {
+            fillSpan(actual_window, row,
+                     crossings[pos] < 0.0 ? 0 :
+                         (int64Type) ceil(crossings[pos]),
+                     (int64Type) ceil(crossings[pos + 1] >
+                                      (double) to_width(actual_window) ?
+                                      (double) to_width(actual_window) :
+                                      crossings[pos + 1]) - 1,
+                     col);
+          } /* if */
+        } /* for */
+      } /* for */
+      free(crossings);
+    } /* if */
+  } /* fillPolygon */
+
+
+
+/**
+ *  Compute the points of an arc.
+ *  Angles are measured in radians counterclockwise from the 3 o'clock
+ *  position. The 'sweepAngle' must be between -2 * PI and 2 * PI.
+ *  @return the number of points written to 'xCoords' and 'yCoords'.
+ */
+static memSizeType arcPoints (double xCenter, double yCenter, double radius,
+    double startAngle, double sweepAngle, memSizeType maxPoints,
+    double *xCoords, double *yCoords)
+
+  {
+    memSizeType numSegments;
+    memSizeType pos;
+    double angle;
+
+  /* arcPoints */
+    numSegments = maxPoints - 1;
+    if (fabs(sweepAngle) * radius < (double) numSegments) {
+      numSegments = (memSizeType) ceil(fabs(sweepAngle) * radius);
+      if (numSegments < MIN_ARC_SEGMENTS) {
+        numSegments = MIN_ARC_SEGMENTS;
+      } /* if */
+    } /* if */
+    for (pos = 0; pos <= numSegments; pos++) {
+      angle = startAngle + sweepAngle * (double) pos / (double) numSegments;
+      xCoords[pos] = xCenter + radius * cos(angle);
+      yCoords[pos] = yCenter - radius * sin(angle);
+    } /* for */
+    return numSegments + 1;
+  } /* arcPoints */
+
+
+
+static void drawPolyLine (const_winType actual_window, const double *xCoords,
+    const double *yCoords, memSizeType numPoints, pixelType col)
+
+  {
+    memSizeType pos;
+
+  /* drawPolyLine */
+    for (pos = 1; pos < numPoints; pos++) {
+      drawLine(actual_window,
+               (int64Type) floor(xCoords[pos - 1] + 0.5),
+               (int64Type) floor(yCoords[pos - 1] + 0.5),
+               (int64Type) floor(xCoords[pos] + 0.5),
+               (int64Type) floor(yCoords[pos] + 0.5), col);
+    } /* for */
+  } /* drawPolyLine */
+
+
+
+/**
+ *  Draw an arc, a chord, a pie slice or a thick arc.
+ *  Arcs are approximated with polygons.
+ *  @param kind 0 for an arc, 1 for a chord, 2 for a pie slice and
+ *         3 for a thick arc of the given 'width'.
+ */
+static void drawArc (const_winType actual_window, intType x, intType y,
+    intType radius, floatType startAngle, floatType sweepAngle,
+    intType width, int kind, pixelType col)
+
+  {
+    double *xCoords;
+    double *yCoords;
+    memSizeType numPoints;
+    memSizeType innerPoints;
+    memSizeType pos;
+
+  /* drawArc */
+    if (sweepAngle < -2.0 * PI) {
+      sweepAngle = -2.0 * PI;
+    } else if (sweepAngle > 2.0 * PI) {
+      sweepAngle = 2.0 * PI;
+    } /* if */
+    xCoords = (double *) malloc(2 * (MAX_ARC_SEGMENTS + 1) * sizeof(double));
+    yCoords = (double *) malloc(2 * (MAX_ARC_SEGMENTS + 1) * sizeof(double));
+    if (unlikely(xCoords == NULL || yCoords == NULL)) {
+      free(xCoords);
+      free(yCoords);
+      raise_error(MEMORY_ERROR);
+    } else {
+      numPoints = arcPoints((double) x, (double) y, (double) radius,
+                            startAngle, sweepAngle, MAX_ARC_SEGMENTS + 1,
+                            xCoords, yCoords);
+      if (kind == 3) {
+        innerPoints = arcPoints((double) x, (double) y,
+                                (double) (radius - width + 1), startAngle,
+                                sweepAngle, MAX_ARC_SEGMENTS + 1,
+                                &xCoords[numPoints], &yCoords[numPoints]);
+        /* Reverse the inner arc, to get the outline of the thick arc. */
+        for (pos = 0; pos < innerPoints / 2; pos++) {
+          double swap;
+
+          swap = xCoords[numPoints + pos];
+          xCoords[numPoints + pos] = xCoords[numPoints + innerPoints - 1 - pos];
+          xCoords[numPoints + innerPoints - 1 - pos] = swap;
+          swap = yCoords[numPoints + pos];
+          yCoords[numPoints + pos] = yCoords[numPoints + innerPoints - 1 - pos];
+          yCoords[numPoints + innerPoints - 1 - pos] = swap;
+        } /* for */
+        drawPolyLine(actual_window, xCoords, yCoords, numPoints, col);
+        drawPolyLine(actual_window, &xCoords[numPoints], &yCoords[numPoints],
+                     innerPoints, col);
+        fillPolygon(actual_window, xCoords, yCoords,
+                    numPoints + innerPoints, col);
+      } else {
+        if (kind == 2) {
+          xCoords[numPoints] = (double) x;
+          yCoords[numPoints] = (double) y;
+          numPoints++;
+        } /* if */
+        if (kind != 0) {
+          /* Close the outline, that the fill does not miss the last row. */
+          xCoords[numPoints] = xCoords[0];
+          yCoords[numPoints] = yCoords[0];
+          drawPolyLine(actual_window, xCoords, yCoords, numPoints + 1, col);
+          fillPolygon(actual_window, xCoords, yCoords, numPoints, col);
+        } else {
+          drawPolyLine(actual_window, xCoords, yCoords, numPoints, col);
+        } /* if */
+      } /* if */
+      free(xCoords);
+      free(yCoords);
+    } /* if */
+  } /* drawArc */
+
+
+
+/**
+ *  Copy a rectangular area between pixel buffers.
+ *  The area is clipped at the borders of both pixel buffers.
+ *  Source and destination may be the same buffer and the areas
+ *  may overlap.
+ */
+static void copyArea (const_winType sourceWindow, const_winType destWindow,
+    int64Type xSource, int64Type ySource, int64Type width, int64Type height,
+    int64Type xDest, int64Type yDest)
+
+  {
+    const pixelType *source;
+    pixelType *dest;
+    int64Type row;
+
+  /* copyArea */
+    if (xSource < 0) {
+      xDest -= xSource;
+      width += xSource;
+      xSource = 0;
+    } /* if */
+    if (xDest < 0) {
+      xSource -= xDest;
+      width += xDest;
+      xDest = 0;
+    } /* if */
+    if (ySource < 0) {
+      yDest -= ySource;
+      height += ySource;
+      ySource = 0;
+    } /* if */
+    if (yDest < 0) {
+      ySource -= yDest;
+      height += yDest;
+      yDest = 0;
+    } /* if */
+    if (width > (int64Type) to_width(sourceWindow) - xSource) {
+      width = (int64Type) to_width(sourceWindow) - xSource;
+    } /* if */
+    if (width > (int64Type) to_width(destWindow) - xDest) {
+      width = (int64Type) to_width(destWindow) - xDest;
+    } /* if */
+    if (height > (int64Type) to_height(sourceWindow) - ySource) {
+      height = (int64Type) to_height(sourceWindow) - ySource;
+    } /* if */
+    if (height > (int64Type) to_height(destWindow) - yDest) {
+      height = (int64Type) to_height(destWindow) - yDest;
+    } /* if */
+    if (width > 0 && height > 0) {
+      source = &to_pixels(sourceWindow)[
+          (memSizeType) ySource * to_width(sourceWindow) + (memSizeType) xSource];
+      dest = &to_pixels(destWindow)[
+          (memSizeType) yDest * to_width(destWindow) + (memSizeType) xDest];
+      if (to_pixels(sourceWindow) == to_pixels(destWindow) && yDest > ySource) {
+        /* Copy bottom up, to avoid overwriting rows not copied yet. */
+        source += (memSizeType) (height - 1) * to_width(sourceWindow);
+        dest += (memSizeType) (height - 1) * to_width(destWindow);
+        for (row = 0; row < height; row++) {
+          memmove(dest, source, (memSizeType) width * sizeof(pixelType));
+          source -= to_width(sourceWindow);
+          dest -= to_width(destWindow);
+        } /* for */
+      } else {
+        for (row = 0; row < height; row++) {
+          memmove(dest, source, (memSizeType) width * sizeof(pixelType));
+          source += to_width(sourceWindow);
+          dest += to_width(destWindow);
+        } /* for */
+      } /* if */
+    } /* if */
+  } /* copyArea */
+
+
+
+charType gkbGetc (void)
+
+  { /* gkbGetc */
+    return (charType) EOF;
+  } /* gkbGetc */
+
+
+
+boolType gkbInputReady (void)
+
+  { /* gkbInputReady */
+    return FALSE;
+  } /* gkbInputReady */
+
+
+
+boolType gkbButtonPressed (charType button)
+
+  { /* gkbButtonPressed */
+    return FALSE;
+  } /* gkbButtonPressed */
+
+
+
+charType gkbRawGetc (void)
+
+  { /* gkbRawGetc */
+    return gkbGetc();
+  } /* gkbRawGetc */
+
+
+
+void gkbSelectInput (winType aWindow, charType aKey, boolType active)
+
+  { /* gkbSelectInput */
+  } /* gkbSelectInput */
+
+
+
+winType gkbWindow (void)
+
+  { /* gkbWindow */
+    return NULL;
+  } /* gkbWindow */
+
+
+
+intType gkbClickedXpos (void)
+
+  { /* gkbClickedXpos */
+    return 0;
+  } /* gkbClickedXpos */
+
+
+
+intType gkbClickedYpos (void)
+
+  { /* gkbClickedYpos */
+    return 0;
+  } /* gkbClickedYpos */
+
+
+
+void drawClose (void)
+
+  { /* drawClose */
+  } /* drawClose */
+
+
+
+void drawInit (void)
+
+  { /* drawInit */
+    logFunction(printf("drawInit()\n"););
+    if (emptyWindow == NULL) {
+      emptyWindow = generateEmptyWindow();
+    } /* if */
+    if (emptyWindow != NULL) {
+      init_called = TRUE;
+    } /* if */
+    logFunction(printf("drawInit -->\n"););
+  } /* drawInit */
+
+
+
+intType drwPointerXpos (const_winType actual_window)
+
+  { /* drwPointerXpos */
+    return 0;
+  } /* drwPointerXpos */
+
+
+
+intType drwPointerYpos (const_winType actual_window)
+
+  { /* drwPointerYpos */
+    return 0;
+  } /* drwPointerYpos */
+
+
+
+void drwPArc (const_winType actual_window, intType x, intType y,
+    intType radius, floatType startAngle, floatType sweepAngle, intType col)
+
+  { /* drwPArc */
+    logFunction(printf("drwPArc(" FMT_U_MEM ", " FMT_D ", " FMT_D ", " FMT_D
+                       ", %.4f, %.4f, " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius,
+                       startAngle, sweepAngle, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX ||
+                 os_isnan(startAngle) || os_isnan(sweepAngle) ||
+                 startAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 startAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)))) {
+      logError(printf("drwPArc(" FMT_U_MEM ", " FMT_D ", " FMT_D ", " FMT_D
+                      ", %.4f, %.4f, " F_X(08) "): Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius,
+                      startAngle, sweepAngle, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawArc(actual_window, x, y, radius, startAngle, sweepAngle,
+              0, 0, (pixelType) col);
+    } /* if */
+  } /* drwPArc */
+
+
+
+void drwPFArc (const_winType actual_window, intType x, intType y,
+    intType radius, floatType startAngle, floatType sweepAngle,
+    intType width, intType col)
+
+  { /* drwPFArc */
+    logFunction(printf("drwPFArc(" FMT_U_MEM ", " FMT_D ", " FMT_D ", " FMT_D
+                       ", %.4f, %.4f, " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius,
+                       startAngle, sweepAngle, width, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX ||
+                 width < 1 || width > radius ||
+                 os_isnan(startAngle) || os_isnan(sweepAngle) ||
+                 startAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 startAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)))) {
+      logError(printf("drwPFArc(" FMT_U_MEM ", " FMT_D ", " FMT_D ", " FMT_D
+                      ", %.4f, %.4f, " FMT_D ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius,
+                      startAngle, sweepAngle, width, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawArc(actual_window, x, y, radius, startAngle, sweepAngle,
+              width, 3, (pixelType) col);
+    } /* if */
+  } /* drwPFArc */
+
+
+
+void drwPFArcChord (const_winType actual_window, intType x, intType y,
+    intType radius, floatType startAngle, floatType sweepAngle, intType col)
+
+  { /* drwPFArcChord */
+    logFunction(printf("drwPFArcChord(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", %.4f, %.4f, " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius,
+                       startAngle, sweepAngle, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX ||
+                 os_isnan(startAngle) || os_isnan(sweepAngle) ||
+                 startAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 startAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)))) {
+      logError(printf("drwPFArcChord(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", %.4f, %.4f, " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius,
+                      startAngle, sweepAngle, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawArc(actual_window, x, y, radius, startAngle, sweepAngle,
+              0, 1, (pixelType) col);
+    } /* if */
+  } /* drwPFArcChord */
+
+
+
+void drwPFArcPieSlice (const_winType actual_window, intType x, intType y,
+    intType radius, floatType startAngle, floatType sweepAngle, intType col)
+
+  { /* drwPFArcPieSlice */
+    logFunction(printf("drwPFArcPieSlice(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", %.4f, %.4f, " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius,
+                       startAngle, sweepAngle, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX ||
+                 os_isnan(startAngle) || os_isnan(sweepAngle) ||
+                 startAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 startAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle < (floatType) INT_MIN / (23040.0 / (2.0 * PI)) ||
+                 sweepAngle > (floatType) INT_MAX / (23040.0 / (2.0 * PI)))) {
+      logError(printf("drwPFArcPieSlice(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", %.4f, %.4f, " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius,
+                      startAngle, sweepAngle, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawArc(actual_window, x, y, radius, startAngle, sweepAngle,
+              0, 2, (pixelType) col);
+    } /* if */
+  } /* drwPFArcPieSlice */
+
+
+
+/**
+ *  Determine the border widths of a window in pixels.
+ *  Windows in memory have no decorations. Therefore all
+ *  border widths are zero.
+ *  @return an array with border widths (top, right, bottom, left).
+ *  @exception RANGE_ERROR If 'actual_window' is a pixmap.
+ */
+rtlArrayType drwBorder (const_winType actual_window)
+
+  {
+    rtlArrayType border;
+
+  /* drwBorder */
+    logFunction(printf("drwBorder(" FMT_U_MEM ")\n",
+                       (memSizeType) actual_window););
+    if (is_pixmap(actual_window)) {
+      logError(printf("drwBorder(" FMT_U_MEM "): Window is pixmap\n",
+                      (memSizeType) actual_window););
+      raise_error(RANGE_ERROR);
+      border = NULL;
+    } else if (unlikely(!ALLOC_RTL_ARRAY(border, 4))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      border->min_position = 1;
+      border->max_position = 4;
+      border->arr[0].value.intValue = 0;
+      border->arr[1].value.intValue = 0;
+      border->arr[2].value.intValue = 0;
+      border->arr[3].value.intValue = 0;
+    } /* if */
+    return border;
+  } /* drwBorder */
+
+
+
+void drwPCircle (const_winType actual_window,
+    intType x, intType y, intType radius, intType col)
+
+  { /* drwPCircle */
+    logFunction(printf("drwPCircle(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX)) {
+      logError(printf("drwPCircle(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " F_X(08) "): Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawCircle(actual_window, x, y, radius, (pixelType) col, FALSE);
+    } /* if */
+  } /* drwPCircle */
+
+
+
+void drwClear (winType actual_window, intType col)
+
+  { /* drwClear */
+    logFunction(printf("drwClear(" FMT_U_MEM ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, col););
+    fillRectangle(actual_window, 0, 0, (int64Type) to_width(actual_window),
+                  (int64Type) to_height(actual_window), (pixelType) col);
+  } /* drwClear */
+
+
+
+/**
+ *  Copy a rectangular area from 'src_window' to 'dest_window'.
+ *  Coordinates are measured relative to the top left corner of the
+ *  corresponding window drawing area (inside of the window decorations).
+ *  Parts of the area outside of 'src_window' or 'dest_window' are
+ *  not copied.
+ *  @param src_window Source window.
+ *  @param dest_window Destination window.
+ *  @param src_x X-position of the top left corner of the source area.
+ *  @param src_y Y-position of the top left corner of the source area.
+ *  @param width Width of the rectangular area.
+ *  @param height Height of the rectangular area.
+ *  @param dest_x X-position of the top left corner of the destination area.
+ *  @param dest_y Y-position of the top left corner of the destination area.
+ */
+void drwCopyArea (const_winType src_window, const_winType dest_window,
+    intType src_x, intType src_y, intType width, intType height,
+    intType dest_x, intType dest_y)
+
+  { /* drwCopyArea */
+    logFunction(printf("drwCopyArea(" FMT_U_MEM ", " FMT_U_MEM ", "
+                       FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", " FMT_D
+                       ", " FMT_D ")\n",
+                       (memSizeType) src_window, (memSizeType) dest_window,
+                       src_x, src_y, width, height, dest_x, dest_y););
+    if (unlikely(!inIntRange(src_x) || !inIntRange(src_y) ||
+                 width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX ||
+                 !inIntRange(dest_x) || !inIntRange(dest_y))) {
+      logError(printf("drwCopyArea(" FMT_U_MEM ", " FMT_U_MEM ", "
+                      FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", " FMT_D
+                      ", " FMT_D "): Raises RANGE_ERROR\n",
+                      (memSizeType) src_window, (memSizeType) dest_window,
+                      src_x, src_y, width, height, dest_x, dest_y););
+      raise_error(RANGE_ERROR);
+    } else {
+      copyArea(src_window, dest_window, src_x, src_y, width, height,
+               dest_x, dest_y);
+    } /* if */
+  } /* drwCopyArea */
+
+
+
+void drwPFCircle (const_winType actual_window,
+    intType x, intType y, intType radius, intType col)
+
+  { /* drwPFCircle */
+    logFunction(printf("drwPFCircle(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, radius, col););
+    if (unlikely(radius < 0 || radius > UINT_MAX / 2 ||
+                 x < INT_MIN + radius || x > INT_MAX ||
+                 y < INT_MIN + radius || y > INT_MAX)) {
+      logError(printf("drwPFCircle(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " F_X(08) "): Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, radius, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawCircle(actual_window, x, y, radius, (pixelType) col, TRUE);
+    } /* if */
+  } /* drwPFCircle */
+
+
+
+void drwPFEllipse (const_winType actual_window,
+    intType x, intType y, intType width, intType height, intType col)
+
+  {
+    double halfWidth;
+    double halfHeight;
+    double xCenter;
+    double yCenter;
+    double ratio;
+    double spanWidth;
+    int64Type row;
+    int64Type rowBeyond;
+
+  /* drwPFEllipse */
+    logFunction(printf("drwPFEllipse(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y,
+                       width, height, col););
+    if (unlikely(!inIntRange(x) || !inIntRange(y) ||
+                 width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX)) {
+      logError(printf("drwPFEllipse(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y,
+                      width, height, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      halfWidth = (double) width / 2.0;
+      halfHeight = (double) height / 2.0;
+      xCenter = (double) x + halfWidth;
+      yCenter = (double) y + halfHeight;
+      row = y < 0 ? 0 : y;
+      rowBeyond = (int64Type) y + (int64Type) height;
+      if (rowBeyond > (int64Type) to_height(actual_window)) {
+        rowBeyond = (int64Type) to_height(actual_window);
+      } /* if */
+      for (; row < rowBeyond; row++) {
+        ratio = ((double) row + 0.5 - yCenter) / halfHeight;
+        spanWidth = halfWidth * sqrt(1.0 - ratio * ratio);
+        fillSpan(actual_window, row,
+                 (int64Type) ceil(xCenter - spanWidth - 0.5),
+                 (int64Type) floor(xCenter + spanWidth - 0.5),
+                 (pixelType) col);
+      } /* for */
+    } /* if */
+  } /* drwPFEllipse */
+
+
+
+void drwFlush (void)
+
+  { /* drwFlush */
+  } /* drwFlush */
+
+
+
+winType drwEmpty (void)
+
+  { /* drwEmpty */
+    logFunction(printf("drwEmpty()\n"););
+    if (!init_called) {
+      drawInit();
+    } /* if */
+    logFunction(printf("drwEmpty --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) emptyWindow,
+                       emptyWindow != NULL ? emptyWindow->usage_count : (uintType) 0););
+    return emptyWindow;
+  } /* drwEmpty */
+
+
+
+void drwFree (winType old_window)
+
+  { /* drwFree */
+    logFunction(printf("drwFree(" FMT_U_MEM " (usage=" FMT_U "))\n",
+                       (memSizeType) old_window,
+                       old_window != NULL ?
+                           old_window->usage_count : (uintType) 0););
+    free(to_pixels(old_window));
+    if (to_parentWindow(old_window) != NULL &&
+        to_parentWindow(old_window)->usage_count != 0) {
+      to_parentWindow(old_window)->usage_count--;
+      if (to_parentWindow(old_window)->usage_count == 0) {
+        drwFree(to_parentWindow(old_window));
+      } /* if */
+    } /* if */
+    FREE_RECORD2(old_window, mem_winRecord, count.win, count.win_bytes);
+    logFunction(printf("drwFree -->\n"););
+  } /* drwFree */
+
+
+
+/**
+ *  Capture a rectangular area from the screen.
+ *  There is no screen content in memory. The screen is black.
+ *  @return a black pixmap with the size of the capture area.
+ */
+winType drwCapture (intType left, intType upper,
+    intType width, intType height)
+
+  {
+    mem_winType pixmap;
+
+  /* drwCapture */
+    logFunction(printf("drwCapture(" FMT_D ", " FMT_D ", " FMT_D
+                       ", " FMT_D ")\n",
+                       left, upper, width, height););
+    if (unlikely(!inIntRange(left) || !inIntRange(upper) ||
+                 width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX)) {
+      logError(printf("drwCapture(" FMT_D ", " FMT_D ", " FMT_D
+                      ", " FMT_D "): Raises RANGE_ERROR\n",
+                      left, upper, width, height););
+      raise_error(RANGE_ERROR);
+      pixmap = NULL;
+    } else if (unlikely((pixmap = newMemWindow(width, height, TRUE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } /* if */
+    logFunction(printf("drwCapture --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) pixmap,
+                       pixmap != NULL ? pixmap->usage_count : (uintType) 0););
+    return (winType) pixmap;
+  } /* drwCapture */
+
+
+
+/**
+ *  Get the pixel color of the point (x, y) in 'sourceWindow'.
+ *  @return the pixel or 0 (black) if (x, y) is outside of 'sourceWindow'.
+ */
+intType drwGetPixel (const_winType sourceWindow, intType x, intType y)
+
+  {
+    intType pixel;
+
+  /* drwGetPixel */
+    logFunction(printf("drwGetPixel(" FMT_U_MEM ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) sourceWindow, x, y););
+    if (unlikely(!inIntRange(x) || !inIntRange(y))) {
+      logError(printf("drwGetPixel(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) sourceWindow, x, y););
+      raise_error(RANGE_ERROR);
+      pixel = 0;
+    } else if (x >= 0 && (uintType) x < to_width(sourceWindow) &&
+               y >= 0 && (uintType) y < to_height(sourceWindow)) {
+      pixel = (intType) to_pixels(sourceWindow)[
+          (memSizeType) y * to_width(sourceWindow) + (memSizeType) x];
+    } else {
+      pixel = 0;
+    } /* if */
+    logFunction(printf("drwGetPixel --> " F_X(08) "\n", pixel););
+    return pixel;
+  } /* drwGetPixel */
+
+
+
+/**
+ *  Get the pixels of 'sourceWindow' as bstring.
+ *  The pixel buffer has the same layout as the result (one 32-bit
+ *  pixel per point, row by row). Therefore it is copied as a whole.
+ *  @return the pixels of 'sourceWindow' as bstring.
+ */
+bstriType drwGetPixelData (const_winType sourceWindow)
+
+  {
+    memSizeType result_size;
+    bstriType result;
+
+  /* drwGetPixelData */
+    logFunction(printf("drwGetPixelData(" FMT_U_MEM ")\n", (memSizeType) sourceWindow););
+    if (to_pixels(sourceWindow) == NULL) {
+      emptyBStriType emptyBStri;
+
+      if (unlikely(!ALLOC_EMPTY_BSTRI(emptyBStri))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        emptyBStri->size = 0;
+      } /* if */
+      result = (bstriType) emptyBStri;
+    } else {
+      result_size = (memSizeType) to_width(sourceWindow) *
+                    (memSizeType) to_height(sourceWindow) * sizeof(int32Type);
+      if (unlikely(!ALLOC_BSTRI_CHECK_SIZE(result, result_size))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        result->size = result_size;
+        memcpy(result->mem, to_pixels(sourceWindow), result_size);
+      } /* if */
+    } /* if */
+    return result;
+  } /* drwGetPixelData */
+
+
+
+/**
+ *  Create a new pixmap with the given 'width' and 'height' from 'sourceWindow'.
+ *  A rectangle with the upper left corner at ('left', 'upper') and the given
+ *  'width' and 'height' is copied from 'sourceWindow' to the new pixmap.
+ *  The rectangle may extend to areas outside of 'sourceWindow'. The rectangle
+ *  areas outside of 'sourceWindow' are colored with black.
+ *  @return the created pixmap.
+ *  @exception RANGE_ERROR If 'height' or 'width' are negative or zero.
+ */
+winType drwGetPixmap (const_winType sourceWindow, intType left, intType upper,
+    intType width, intType height)
+
+  {
+    mem_winType pixmap;
+
+  /* drwGetPixmap */
+    logFunction(printf("drwGetPixmap(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) sourceWindow, left, upper,
+                       width, height););
+    if (unlikely(width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX ||
+                 left < INT_MIN || left > INT_MAX - width ||
+                 upper < INT_MIN || upper > INT_MAX - height)) {
+      logError(printf("drwGetPixmap(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D "): Raises RANGE_ERROR\n",
+                      (memSizeType) sourceWindow, left, upper,
+                      width, height););
+      raise_error(RANGE_ERROR);
+      pixmap = NULL;
+    } else if (unlikely((pixmap = newMemWindow(width, height, TRUE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      copyArea(sourceWindow, (winType) pixmap, left, upper, width, height, 0, 0);
+    } /* if */
+    logFunction(printf("drwGetPixmap --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) pixmap,
+                       pixmap != NULL ? pixmap->usage_count : (uintType) 0););
+    return (winType) pixmap;
+  } /* drwGetPixmap */
+
+
+
+/**
+ *  Determine the height of the window drawing area in pixels.
+ */
+intType drwHeight (const_winType actual_window)
+
+  { /* drwHeight */
+    logFunction(printf("drwHeight(" FMT_U_MEM ") --> %u\n",
+                       (memSizeType) actual_window,
+                       to_height(actual_window)););
+    return (intType) to_height(actual_window);
+  } /* drwHeight */
+
+
+
+winType drwImage (int32Type *image_data, memSizeType width, memSizeType height,
+    boolType hasAlphaChannel)
+
+  {
+    mem_winType pixmap;
+
+  /* drwImage */
+    logFunction(printf("drwImage(" FMT_U_MEM ", " FMT_U_MEM ", %d)\n",
+                       width, height, hasAlphaChannel););
+    if (unlikely(width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX)) {
+      logError(printf("drwImage(" FMT_U_MEM ", " FMT_U_MEM ", %d): "
+                      "Raises RANGE_ERROR\n",
+                      width, height, hasAlphaChannel););
+      raise_error(RANGE_ERROR);
+      pixmap = NULL;
+    } else if (unlikely((pixmap = newMemWindow((intType) width, (intType) height,
+                                               TRUE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      memcpy(pixmap->pixels, image_data, width * height * sizeof(pixelType));
+    } /* if */
+    logFunction(printf("drwImage --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) pixmap,
+                       pixmap != NULL ? pixmap->usage_count : (uintType) 0););
+    return (winType) pixmap;
+  } /* drwImage */
+
+
+
+void drwPLine (const_winType actual_window,
+    intType x1, intType y1, intType x2, intType y2, intType col)
+
+  { /* drwPLine */
+    logFunction(printf("drwPLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x1, y1,
+                       x2, y2, col););
+    if (unlikely(!(inIntRange(x1) && inIntRange(y1) &&
+                   inIntRange(x2) && inIntRange(y2)))) {
+      logError(printf("drwPLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x1, y1,
+                      x2, y2, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      drawLine(actual_window, x1, y1, x2, y2, (pixelType) col);
+    } /* if */
+  } /* drwPLine */
+
+
+
+/**
+ *  Create a new pixmap with the given 'width' and 'height'.
+ *  The pixmap is initialized with black.
+ *  @return the created pixmap.
+ *  @exception RANGE_ERROR If 'height' or 'width' are negative or zero.
+ */
+winType drwNewPixmap (intType width, intType height)
+
+  {
+    mem_winType pixmap;
+
+  /* drwNewPixmap */
+    logFunction(printf("drwNewPixmap(" FMT_D ", " FMT_D ")\n",
+                       width, height););
+    if (unlikely(width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX)) {
+      logError(printf("drwNewPixmap(" FMT_D ", " FMT_D "): "
+                      "Raises RANGE_ERROR\n",
+                      width, height););
+      raise_error(RANGE_ERROR);
+      pixmap = NULL;
+    } else if (unlikely((pixmap = newMemWindow(width, height, TRUE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } /* if */
+    logFunction(printf("drwNewPixmap --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) pixmap,
+                       pixmap != NULL ? pixmap->usage_count : (uintType) 0););
+    return (winType) pixmap;
+  } /* drwNewPixmap */
+
+
+
+winType drwOpen (intType xPos, intType yPos,
+    intType width, intType height, const const_striType windowName)
+
+  {
+    mem_winType result;
+
+  /* drwOpen */
+    logFunction(printf("drwOpen(" FMT_D ", " FMT_D ", " FMT_D ", " FMT_D
+                       ", \"%s\")\n",
+                       xPos, yPos, width, height,
+                       striAsUnquotedCStri(windowName)););
+    if (unlikely(!inIntRange(xPos) || !inIntRange(yPos) ||
+                 width < 1 || width > INT_MAX ||
+                 height < 1 || height > INT_MAX)) {
+      logError(printf("drwOpen(" FMT_D ", " FMT_D ", " FMT_D ", " FMT_D
+                      ", \"%s\"): Illegal window dimensions\n",
+                      xPos, yPos, width, height,
+                      striAsUnquotedCStri(windowName)););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      if (!init_called) {
+        drawInit();
+      } /* if */
+      if (unlikely((result = newMemWindow(width, height, FALSE)) == NULL)) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        result->xPos = xPos;
+        result->yPos = yPos;
+      } /* if */
+    } /* if */
+    logFunction(printf("drwOpen --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) result,
+                       result != NULL ? result->usage_count : (uintType) 0););
+    return (winType) result;
+  } /* drwOpen */
+
+
+
+winType drwOpenSubWindow (winType parent_window, intType xPos, intType yPos,
+    intType width, intType height)
+
+  {
+    mem_winType result;
+
+  /* drwOpenSubWindow */
+    logFunction(printf("drwOpenSubWindow(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) parent_window,
+                       xPos, yPos, width, height););
+    if (unlikely(!inIntRange(xPos) || !inIntRange(yPos) ||
+                 width < 1 || width > INT_MAX ||
+                 height < 1 || height > INT_MAX)) {
+      logError(printf("drwOpenSubWindow(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D "): Illegal window dimensions\n",
+                      (memSizeType) parent_window,
+                      xPos, yPos, width, height););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else if (unlikely((result = newMemWindow(width, height, FALSE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->xPos = xPos;
+      result->yPos = yPos;
+      if (to_pixels(parent_window) != NULL) {
+        result->parentWindow = parent_window;
+        if (parent_window->usage_count != 0) {
+          parent_window->usage_count++;
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("drwOpenSubWindow --> " FMT_U_MEM " (usage=" FMT_U ")\n",
+                       (memSizeType) result,
+                       result != NULL ? result->usage_count : (uintType) 0););
+    return (winType) result;
+  } /* drwOpenSubWindow */
+
+
+
+void drwSetCloseAction (winType actual_window, intType closeAction)
+
+  { /* drwSetCloseAction */
+    logFunction(printf("drwSetCloseAction(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) actual_window, closeAction););
+    if (closeAction < 0 || closeAction > 2) {
+      logError(printf("drwSetCloseAction(" FMT_U_MEM ", " FMT_D "): "
+                      "Close action not in allowed range\n",
+                      (memSizeType) actual_window, closeAction););
+      raise_error(RANGE_ERROR);
+    } else {
+      to_var_close_action(actual_window) = (int) closeAction;
+    } /* if */
+  } /* drwSetCloseAction */
+
+
+
+void drwSetCursorVisible (winType aWindow, boolType visible)
+
+  { /* drwSetCursorVisible */
+  } /* drwSetCursorVisible */
+
+
+
+void drwSetPointerPos (const_winType aWindow, intType xPos, intType yPos)
+
+  { /* drwSetPointerPos */
+  } /* drwSetPointerPos */
+
+
+
+void drwPPoint (const_winType actual_window, intType x, intType y, intType col)
+
+  { /* drwPPoint */
+    logFunction(printf("drwPPoint(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y, col););
+    if (unlikely(!inIntRange(x) || !inIntRange(y))) {
+      logError(printf("drwPPoint(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " F_X(08) "): Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y, col););
+      raise_error(RANGE_ERROR);
+    } else if (x >= 0 && (uintType) x < to_width(actual_window) &&
+               y >= 0 && (uintType) y < to_height(actual_window)) {
+      to_pixels(actual_window)[(memSizeType) y * to_width(actual_window) +
+                               (memSizeType) x] = (pixelType) col;
+    } /* if */
+  } /* drwPPoint */
+
+
+
+rtlArrayType drwConvPointList (const const_bstriType pointList)
+
+  {
+    memSizeType len;
+    const pointRecord *points;
+    memSizeType pos;
+    rtlArrayType xyArray;
+
+  /* drwConvPointList */
+    logFunction(printf("drwConvPointList(\"%s\")\n",
+                       bstriAsUnquotedCStri(pointList)););
+    len = pointList->size / sizeof(pointRecord);
+    if (unlikely(!ALLOC_RTL_ARRAY(xyArray, len << 1))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      xyArray->min_position = 1;
+      xyArray->max_position = (intType) (len << 1);
+      points = (const pointRecord *) pointList->mem;
+      for (pos = 0; pos < len; pos++) {
+        xyArray->arr[ pos << 1     ].value.intValue = (intType) points[pos].x;
+        xyArray->arr[(pos << 1) + 1].value.intValue = (intType) points[pos].y;
+#if !POINT_LIST_ABSOLUTE
+        if (pos != 0) {
+          xyArray->arr[ pos << 1     ].value.intValue +=
+              xyArray->arr[(pos << 1) - 2].value.intValue;
+          xyArray->arr[(pos << 1) + 1].value.intValue +=
+              xyArray->arr[(pos << 1) - 1].value.intValue;
+        } /* if */
+#endif
+      } /* for */
+    } /* if */
+    logFunction(printf("drwConvPointList --> arr (size=" FMT_U_MEM ")\n",
+                       arraySize(xyArray)););
+    return xyArray;
+  } /* drwConvPointList */
+
+
+
+bstriType drwGenPointList (const const_rtlArrayType xyArray)
+
+  {
+    memSizeType num_elements;
+    memSizeType len;
+    intType x;
+    intType y;
+    pointRecord *points;
+    memSizeType pos;
+    bstriType result;
+
+  /* drwGenPointList */
+    logFunction(printf("drwGenPointList(" FMT_D " .. " FMT_D ")\n",
+                       xyArray->min_position, xyArray->max_position););
+    num_elements = arraySize(xyArray);
+    if (unlikely(num_elements & 1)) {
+      logError(printf("drwGenPointList(" FMT_D " .. " FMT_D "): "
+                      "Number of elements odd\n",
+                      xyArray->min_position, xyArray->max_position););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      len = num_elements >> 1;
+      if (unlikely(len > MAX_BSTRI_LEN / sizeof(pointRecord) || len > MAX_MEM_INDEX)) {
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else if (unlikely(!ALLOC_BSTRI_SIZE_OK(result, len * sizeof(pointRecord)))) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        result->size = len * sizeof(pointRecord);
+        points = (pointRecord *) result->mem;
+        for (pos = 0; pos < len; pos++) {
+          x = xyArray->arr[ pos << 1     ].value.intValue;
+          y = xyArray->arr[(pos << 1) + 1].value.intValue;
+#if !POINT_LIST_ABSOLUTE
+          if (pos != 0) {
+            x -= xyArray->arr[(pos << 1) - 2].value.intValue;
+            y -= xyArray->arr[(pos << 1) - 1].value.intValue;
+          } /* if */
+#endif
+          if (unlikely(x < POINT_COORD_MIN || x > POINT_COORD_MAX ||
+                       y < POINT_COORD_MIN || y > POINT_COORD_MAX)) {
+            FREE_BSTRI(result, result->size);
+            raise_error(RANGE_ERROR);
+            return NULL;
+          } else {
+            points[pos].x = (pointCoordType) x;
+            points[pos].y = (pointCoordType) y;
+          } /* if */
+        } /* for */
+      } /* if */
+    } /* if */
+    return result;
+  } /* drwGenPointList */
+
+
+
+intType drwLngPointList (bstriType point_list)
+
+  { /* drwLngPointList */
+    return (intType) (point_list->size / sizeof(pointRecord));
+  } /* drwLngPointList */
+
+
+
+/**
+ *  Convert a point list to absolute coordinates as double values.
+ *  @return the number of points or 0 if there is not enough memory.
+ */
+static memSizeType pointListToCoords (intType x, intType y,
+    const const_bstriType point_list, double **xCoords, double **yCoords)
+
+  {
+    const pointRecord *points;
+    memSizeType numPoints;
+    memSizeType pos;
+
+  /* pointListToCoords */
+    points = (const pointRecord *) point_list->mem;
+    numPoints = point_list->size / sizeof(pointRecord);
+    *xCoords = (double *) malloc((numPoints + 1) * sizeof(double));
+    *yCoords = (double *) malloc((numPoints + 1) * sizeof(double));
+    if (unlikely(*xCoords == NULL || *yCoords == NULL)) {
+      free(*xCoords);
+      free(*yCoords);
+      numPoints = 0;
+    } else {
+      for (pos = 0; pos < numPoints; pos++) {
+#if POINT_LIST_ABSOLUTE
+        (*xCoords)[pos] = (double) x + (double) points[pos].x;
+        (*yCoords)[pos] = (double) y + (double) points[pos].y;
+#else
+        x += points[pos].x;
+        y += points[pos].y;
+        (*xCoords)[pos] = (double) x;
+        (*yCoords)[pos] = (double) y;
+#endif
+      } /* for */
+    } /* if */
+    return numPoints;
+  } /* pointListToCoords */
+
+
+
+void drwPolyLine (const_winType actual_window,
+    intType x, intType y, bstriType point_list, intType col)
+
+  {
+    double *xCoords;
+    double *yCoords;
+    memSizeType numPoints;
+
+  /* drwPolyLine */
+    logFunction(printf("drwPolyLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_U_MEM ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y,
+                       (memSizeType) point_list, col););
+    if (unlikely(!inIntRange(x) || !inIntRange(y))) {
+      logError(printf("drwPolyLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_U_MEM ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y,
+                      (memSizeType) point_list, col););
+      raise_error(RANGE_ERROR);
+    } else if (point_list->size >= sizeof(pointRecord)) {
+      numPoints = pointListToCoords(x, y, point_list, &xCoords, &yCoords);
+      if (unlikely(numPoints == 0)) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        drawPolyLine(actual_window, xCoords, yCoords, numPoints,
+                     (pixelType) col);
+        free(xCoords);
+        free(yCoords);
+      } /* if */
+    } /* if */
+  } /* drwPolyLine */
+
+
+
+void drwFPolyLine (const_winType actual_window,
+    intType x, intType y, bstriType point_list, intType col)
+
+  {
+    double *xCoords;
+    double *yCoords;
+    memSizeType numPoints;
+
+  /* drwFPolyLine */
+    logFunction(printf("drwFPolyLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_U_MEM ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y,
+                       (memSizeType) point_list, col););
+    if (unlikely(!inIntRange(x) || !inIntRange(y))) {
+      logError(printf("drwFPolyLine(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_U_MEM ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y,
+                      (memSizeType) point_list, col););
+      raise_error(RANGE_ERROR);
+    } else if (point_list->size >= sizeof(pointRecord)) {
+      numPoints = pointListToCoords(x, y, point_list, &xCoords, &yCoords);
+      if (unlikely(numPoints == 0)) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        drawPolyLine(actual_window, xCoords, yCoords, numPoints,
+                     (pixelType) col);
+        fillPolygon(actual_window, xCoords, yCoords, numPoints,
+                    (pixelType) col);
+        free(xCoords);
+        free(yCoords);
+      } /* if */
+    } /* if */
+  } /* drwFPolyLine */
+
+
+
+/**
+ *  Copy 'pixmap' to the position (xDest, yDest) of 'destWindow'.
+ *  Pixels with the transparent color of 'pixmap' are not copied.
+ */
+void drwPut (const_winType destWindow, intType xDest, intType yDest,
+    const_winType pixmap)
+
+  {
+    int64Type xSource;
+    int64Type ySource;
+    int64Type width;
+    int64Type height;
+    const pixelType *source;
+    pixelType *dest;
+    pixelType transparentColor;
+    int64Type row;
+    int64Type column;
+
+  /* drwPut */
+    logFunction(printf("drwPut(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_U_MEM ")\n",
+                       (memSizeType) destWindow, xDest, yDest,
+                       (memSizeType) pixmap););
+    if (unlikely(!inIntRange(xDest) || !inIntRange(yDest))) {
+      logError(printf("drwPut(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_U_MEM "): Raises RANGE_ERROR\n",
+                      (memSizeType) destWindow, xDest, yDest,
+                      (memSizeType) pixmap););
+      raise_error(RANGE_ERROR);
+    } else if (pixmap != NULL && to_pixels(pixmap) != NULL) {
+      /* A pixmap value of NULL or a pixmap without pixels */
+      /* is used to describe an empty pixmap. In this case */
+      /* nothing should be done.                           */
+      if (!hasTransparentColor(pixmap)) {
+        copyArea(pixmap, destWindow, 0, 0, (int64Type) to_width(pixmap),
+                 (int64Type) to_height(pixmap), xDest, yDest);
+      } else {
+        xSource = xDest < 0 ? -xDest : 0;
+        ySource = yDest < 0 ? -yDest : 0;
+        width = (int64Type) to_width(pixmap);
+        if (width > (int64Type) to_width(destWindow) - xDest) {
+          width = (int64Type) to_width(destWindow) - xDest;
+        } /* if */
+        height = (int64Type) to_height(pixmap);
+        if (height > (int64Type) to_height(destWindow) - yDest) {
+          height = (int64Type) to_height(destWindow) - yDest;
+        } /* if */
+        transparentColor = to_transparentColor(pixmap);
+        for (row = ySource; row < height; row++) {
+          source = &to_pixels(pixmap)[(memSizeType) row * to_width(pixmap)];
+          dest = &to_pixels(destWindow)[
+              (memSizeType) (yDest + row) * to_width(destWindow)];
+          for (column = xSource; column < width; column++) {
+            if (source[column] != transparentColor) {
+              dest[xDest + column] = source[column];
+            } /* if */
+          } /* for */
+        } /* for */
+      } /* if */
+    } /* if */
+  } /* drwPut */
+
+
+
+/**
+ *  Copy 'pixmap' scaled to 'width' and 'height' to (xDest, yDest).
+ *  The nearest pixel of 'pixmap' is used for every destination pixel.
+ */
+void drwPutScaled (const_winType destWindow, intType xDest, intType yDest,
+    intType width, intType height, const_winType pixmap)
+
+  {
+    int64Type column;
+    int64Type columnBeyond;
+    int64Type row;
+    int64Type rowBeyond;
+    memSizeType *sourceColumn;
+    const pixelType *source;
+    pixelType *dest;
+    memSizeType pos;
+    memSizeType numColumns;
+
+  /* drwPutScaled */
+    logFunction(printf("drwPutScaled(" FMT_U_MEM  ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ", " FMT_U_MEM")\n",
+                       (memSizeType) destWindow, xDest, yDest,
+                       width, height, (memSizeType) pixmap););
+    if (unlikely(!inIntRange(xDest) || !inIntRange(yDest) ||
+                 width < 0 || width > UINT_MAX ||
+                 height < 0 || height > UINT_MAX)) {
+      logError(printf("drwPutScaled(" FMT_U_MEM  ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D ", " FMT_U_MEM"): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) destWindow, xDest, yDest,
+                      width, height, (memSizeType) pixmap););
+      raise_error(RANGE_ERROR);
+    } else if (pixmap != NULL && to_pixels(pixmap) != NULL) {
+      /* A pixmap value of NULL or a pixmap without pixels */
+      /* is used to describe an empty pixmap. In this case */
+      /* nothing should be done.                           */
+      column = xDest < 0 ? -xDest : 0;
+      columnBeyond = width;
+      if (columnBeyond > (int64Type) to_width(destWindow) - xDest) {
+        columnBeyond = (int64Type) to_width(destWindow) - xDest;
+      } /* if */
+      row = yDest < 0 ? -yDest : 0;
+      rowBeyond = height;
+      if (rowBeyond > (int64Type) to_height(destWindow) - yDest) {
+        rowBeyond = (int64Type) to_height(destWindow) - yDest;
+      } /* if */
+      if (column < columnBeyond && row < rowBeyond) {
+        numColumns = (memSizeType) (columnBeyond - column);
+        /* The source column of every destination column is computed once. */
+        sourceColumn = (memSizeType *) malloc(numColumns * sizeof(memSizeType));
+        if (unlikely(sourceColumn == NULL)) {
+          raise_error(MEMORY_ERROR);
+        } else {
+          for (pos = 0; pos < numColumns; pos++) {
+            sourceColumn[pos] = (memSizeType)
+                ((((double) (column + (int64Type) pos) + 0.5) *
+                  (double) to_width(pixmap)) / (double) width);
+          } /* for */
+          for (; row < rowBeyond; row++) {
+            source = &to_pixels(pixmap)[(memSizeType)
+                ((((double) row + 0.5) * (double) to_height(pixmap)) /
+                 (double) height) * to_width(pixmap)];
+            dest = &to_pixels(destWindow)[
+                (memSizeType) (yDest + row) * to_width(destWindow) +
+                (memSizeType) (xDest + column)];
+            if (hasTransparentColor(pixmap)) {
+              for (pos = 0; pos < numColumns; pos++) {
+                if (source[sourceColumn[pos]] != to_transparentColor(pixmap)) {
+                  dest[pos] = source[sourceColumn[pos]];
+                } /* if */
+              } /* for */
+            } else {
+              for (pos = 0; pos < numColumns; pos++) {
+                dest[pos] = source[sourceColumn[pos]];
+              } /* for */
+            } /* if */
+          } /* for */
+          free(sourceColumn);
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("drwPutScaled -->\n"););
+  } /* drwPutScaled */
+
+
+
+void drwPRect (const_winType actual_window,
+    intType x, intType y, intType width, intType height, intType col)
+
+  { /* drwPRect */
+    logFunction(printf("drwPRect(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", " FMT_D ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y,
+                       width, height, col););
+    if (unlikely(!inIntRange(x) || !inIntRange(y) ||
+                 width < 0 || width > UINT_MAX ||
+                 height < 0 || height > UINT_MAX)) {
+      logError(printf("drwPRect(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", " FMT_D ", " FMT_D ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y,
+                      width, height, col););
+      raise_error(RANGE_ERROR);
+    } else {
+      fillRectangle(actual_window, x, y, width, height, (pixelType) col);
+    } /* if */
+  } /* drwPRect */
+
+
+
+/**
+ *  Convert the RGB values to a pixel.
+ *  The pixels have the same layout as X11 TrueColor pixels
+ *  (8 bits red, green and blue). The alpha byte is zero.
+ */
+intType drwRgbColor (intType redLight, intType greenLight, intType blueLight)
+
+  {
+    intType col;
+
+  /* drwRgbColor */
+    col = (intType) ((((((uintType) redLight)   >> 8) & 255) << 16) |
+                     (((((uintType) greenLight) >> 8) & 255) <<  8) |
+                      ((((uintType) blueLight)  >> 8) & 255));
+    logFunction(printf("drwRgbColor(" FMT_D ", " FMT_D ", " FMT_D ") --> " F_X(08) "\n",
+                       redLight, greenLight, blueLight, col););
+    return col;
+  } /* drwRgbColor */
+
+
+
+void drwPixelToRgb (intType col, intType *redLight, intType *greenLight, intType *blueLight)
+
+  { /* drwPixelToRgb */
+    *redLight   = (intType) (((((uintType) col) >> 16) & 255) << 8);
+    *greenLight = (intType) (((((uintType) col) >>  8) & 255) << 8);
+    *blueLight  = (intType) (( ((uintType) col)        & 255) << 8);
+    logFunction(printf("drwPixelToRgb(" F_X(08) ", " FMT_D ", " FMT_D ", " FMT_D ") -->\n",
+                       col, *redLight, *greenLight, *blueLight););
+  } /* drwPixelToRgb */
+
+
+
+/**
+ *  Determine the height of the screen in pixels.
+ */
+intType drwScreenHeight (void)
+
+  { /* drwScreenHeight */
+    return SCREEN_HEIGHT;
+  } /* drwScreenHeight */
+
+
+
+/**
+ *  Determine the width of the screen in pixels.
+ */
+intType drwScreenWidth (void)
+
+  { /* drwScreenWidth */
+    return SCREEN_WIDTH;
+  } /* drwScreenWidth */
+
+
+
+void drwSetContent (const_winType actual_window, const_winType pixmap)
+
+  { /* drwSetContent */
+    logFunction(printf("drwSetContent(" FMT_U_MEM ", " FMT_U_MEM ")\n",
+                       (memSizeType) actual_window, (memSizeType) pixmap););
+    if (pixmap != NULL && to_pixels(pixmap) != NULL) {
+      copyArea(pixmap, actual_window, 0, 0, (int64Type) to_width(pixmap),
+               (int64Type) to_height(pixmap), 0, 0);
+    } /* if */
+  } /* drwSetContent */
+
+
+
+void drwSetPos (const_winType actual_window, intType xPos, intType yPos)
+
+  { /* drwSetPos */
+    logFunction(printf("drwSetPos(" FMT_U_MEM ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) actual_window, xPos, yPos););
+    if (unlikely(!inIntRange(xPos) || !inIntRange(yPos))) {
+      logError(printf("drwSetPos(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, xPos, yPos););
+      raise_error(RANGE_ERROR);
+    } else if (is_pixmap(actual_window)) {
+      logError(printf("drwSetPos(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "Window is pixmap\n",
+                      (memSizeType) actual_window, xPos, yPos););
+      raise_error(RANGE_ERROR);
+    } else {
+      to_var_xPos(actual_window) = xPos;
+      to_var_yPos(actual_window) = yPos;
+    } /* if */
+  } /* drwSetPos */
+
+
+
+/**
+ *  Change the size of a window.
+ *  The content of the window is kept. New areas are black.
+ */
+void drwSetSize (winType actual_window, intType width, intType height)
+
+  {
+    mem_winType resized;
+
+  /* drwSetSize */
+    logFunction(printf("drwSetSize(" FMT_U_MEM ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) actual_window, width, height););
+    if (unlikely(width < 1 || width > UINT_MAX ||
+                 height < 1 || height > UINT_MAX)) {
+      logError(printf("drwSetSize(" FMT_D ", " FMT_D "): "
+                      "Illegal window dimensions\n",
+                      width, height););
+      raise_error(RANGE_ERROR);
+    } else if (unlikely((resized = newMemWindow(width, height, FALSE)) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      copyArea(actual_window, (winType) resized, 0, 0,
+               (int64Type) to_width(actual_window),
+               (int64Type) to_height(actual_window), 0, 0);
+      free(to_pixels(actual_window));
+      to_var_pixels(actual_window) = resized->pixels;
+      to_var_width(actual_window) = (unsigned int) width;
+      to_var_height(actual_window) = (unsigned int) height;
+      FREE_RECORD2(resized, mem_winRecord, count.win, count.win_bytes);
+    } /* if */
+  } /* drwSetSize */
+
+
+
+void drwSetTransparentColor (winType pixmap, intType col)
+
+  { /* drwSetTransparentColor */
+    logFunction(printf("drwSetTransparentColor(" FMT_U_MEM ", " F_X(08) ")\n",
+                       (memSizeType) pixmap, col););
+    /* A pixmap value of NULL or a pixmap without pixels */
+    /* is used to describe an empty pixmap. In this case */
+    /* nothing should be done.                           */
+    if (pixmap != NULL && to_pixels(pixmap) != NULL) {
+      hasVarTransparentColor(pixmap) = TRUE;
+      to_var_transparentColor(pixmap) = (pixelType) col;
+    } /* if */
+  } /* drwSetTransparentColor */
+
+
+
+void drwSetWindowName (winType aWindow, const const_striType windowName)
+
+  { /* drwSetWindowName */
+  } /* drwSetWindowName */
+
+
+
+/**
+ *  Draw a text. There are no fonts in memory.
+ *  Therefore nothing is drawn.
+ */
+void drwText (const_winType actual_window, intType x, intType y,
+    const const_striType stri, intType col, intType bkcol)
+
+  { /* drwText */
+    logFunction(printf("drwText(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                       ", \"%s\", " F_X(08) ", " F_X(08) ")\n",
+                       (memSizeType) actual_window, x, y,
+                       striAsUnquotedCStri(stri), col, bkcol););
+    if (unlikely(!inIntRange(x) || !inIntRange(y))) {
+      logError(printf("drwText(" FMT_U_MEM ", " FMT_D ", " FMT_D
+                      ", \"%s\", " F_X(08) ", " F_X(08) "): "
+                      "Raises RANGE_ERROR\n",
+                      (memSizeType) actual_window, x, y,
+                      striAsUnquotedCStri(stri), col, bkcol););
+      raise_error(RANGE_ERROR);
+    } /* if */
+  } /* drwText */
+
+
+
+void drwToBottom (const_winType actual_window)
+
+  { /* drwToBottom */
+  } /* drwToBottom */
+
+
+
+void drwToTop (const_winType actual_window)
+
+  { /* drwToTop */
+  } /* drwToTop */
+
+
+
+/**
+ *  Determine the width of the window drawing area in pixels.
+ */
+intType drwWidth (const_winType actual_window)
+
+  { /* drwWidth */
+    logFunction(printf("drwWidth(" FMT_U_MEM ") --> %u\n",
+                       (memSizeType) actual_window,
+                       to_width(actual_window)););
+    return (intType) to_width(actual_window);
+  } /* drwWidth */
+
+
+
+/**
+ *  Determine the X position of the top left corner of a window in pixels.
+ *  @exception RANGE_ERROR If 'actual_window' is a pixmap.
+ */
+intType drwXPos (const_winType actual_window)
+
+  {
+    intType xPos;
+
+  /* drwXPos */
+    logFunction(printf("drwXPos(" FMT_U_MEM ")\n",
+                       (memSizeType) actual_window););
+    if (is_pixmap(actual_window)) {
+      logError(printf("drwXPos(" FMT_U_MEM "): Window is pixmap\n",
+                      (memSizeType) actual_window););
+      raise_error(RANGE_ERROR);
+      xPos = 0;
+    } else {
+      xPos = to_xPos(actual_window);
+    } /* if */
+    return xPos;
+  } /* drwXPos */
+
+
+
+/**
+ *  Determine the Y position of the top left corner of a window in pixels.
+ *  @exception RANGE_ERROR If 'actual_window' is a pixmap.
+ */
+intType drwYPos (const_winType actual_window)
+
+  {
+    intType yPos;
+
+  /* drwYPos */
+    logFunction(printf("drwYPos(" FMT_U_MEM ")\n",
+                       (memSizeType) actual_window););
+    if (is_pixmap(actual_window)) {
+      logError(printf("drwYPos(" FMT_U_MEM "): Window is pixmap\n",
+                      (memSizeType) actual_window););
+      raise_error(RANGE_ERROR);
+      yPos = 0;
+    } else {
+      yPos = to_yPos(actual_window);
+    } /* if */
+    return yPos;
+  } /* drwYPos */
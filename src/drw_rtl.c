@@ -182,6 +182,230 @@ static void memcpy_from_pixel (register intType *const dest,
 
 
 
+#if RSHIFT_DOES_SIGN_EXTEND
+#define ASHR(num, shift) ((num) >> (shift))
+#else
+#define ASHR(num, shift) ((num) < 0 ? ~(~(num) >> (shift)) : (num) >> (shift))
+#endif
+
+#define JPEG_BLOCK_SIZE 64
+#define PNG_COLOR_TYPE_GRAYSCALE       0
+#define PNG_COLOR_TYPE_RGB             2
+#define PNG_COLOR_TYPE_PALETTE         3
+#define PNG_COLOR_TYPE_GRAYSCALE_ALPHA 4
+#define PNG_COLOR_TYPE_RGB_ALPHA       6
+
+static boolType channelTablesInitialized = FALSE;
+static boolType channelTablesLinear = FALSE;
+static int32Type redPixel[256];
+static int32Type greenPixel[256];
+static int32Type bluePixel[256];
+
+
+
+/**
+ *  Initialize the tables to convert 8-bit color channels to pixels.
+ *  The pixel of a color is the bitwise or of the three table
+ *  entries, if the driver packs the channels linear into the pixel.
+ *  This is checked with some sample colors. If drwRgbColor() cannot
+ *  compute colors now (e.g. because no display is open), the tables
+ *  are not marked as initialized and the conversion uses
+ *  drwRgbColor() for every pixel.
+ */
+static void initChannelTables (void)
+
+  {
+    unsigned int value;
+
+  /* initChannelTables */
+    for (value = 0; value <= 255; value++) {
+      redPixel[value]   = (int32Type) drwRgbColor((intType) value << 8, 0, 0);
+      greenPixel[value] = (int32Type) drwRgbColor(0, (intType) value << 8, 0);
+      bluePixel[value]  = (int32Type) drwRgbColor(0, 0, (intType) value << 8);
+    } /* for */
+    if (redPixel[255] != 0 && greenPixel[255] != 0 && bluePixel[255] != 0) {
+      channelTablesLinear =
+          (redPixel[0] | greenPixel[0] | bluePixel[0]) == (int32Type) drwRgbColor(0, 0, 0) &&
+          (redPixel[0x12] | greenPixel[0x9a] | bluePixel[0xf0]) ==
+          (int32Type) drwRgbColor(0x1200, 0x9a00, 0xf000) &&
+          (redPixel[0xff] | greenPixel[0x80] | bluePixel[0x01]) ==
+          (int32Type) drwRgbColor(0xff00, 0x8000, 0x0100);
+      channelTablesInitialized = TRUE;
+    } /* if */
+  } /* initChannelTables */
+
+
+
+static inline int32Type rgbPixel8 (unsigned int red, unsigned int green,
+    unsigned int blue)
+
+  { /* rgbPixel8 */
+    if (likely(channelTablesLinear)) {
+      return redPixel[red] | greenPixel[green] | bluePixel[blue];
+    } else {
+      return (int32Type) drwRgbColor((intType) red << 8,
+                                     (intType) green << 8,
+                                     (intType) blue << 8);
+    } /* if */
+  } /* rgbPixel8 */
+
+
+
+/**
+ *  Check the dimensions of an image and return its pixels.
+ *  @return the pixels of 'image', or NULL if 'width' or 'height'
+ *          are negative or if 'image' is too small for them.
+ */
+static int32Type *imagePixels (const const_bstriType image, intType width,
+    intType height)
+
+  { /* imagePixels */
+    if (unlikely(width < 0 || height < 0 ||
+                 (width != 0 && (uintType) height >
+                  MAX_MEMSIZETYPE / sizeof(int32Type) / (uintType) width) ||
+                 image->size < (memSizeType) width * (memSizeType) height *
+                               sizeof(int32Type))) {
+      return NULL;
+    } else {
+      return (int32Type *) image->mem;
+    } /* if */
+  } /* imagePixels */
+
+
+
+static inline unsigned int clampColor (intType col)
+
+  { /* clampColor */
+    return col < 0 ? 0 : (col > 255 ? 255 : (unsigned int) col);
+  } /* clampColor */
+
+
+
+/**
+ *  Fast inverse discrete cosine transform for a block line or block column.
+ *  For the internal calculation the values are scaled by 2048. At the end
+ *  the scaling is reversed. This way the same function can be used for
+ *  lines and columns. The coefficients are a[0], a[step], .. a[7 * step].
+ */
+static void fastIdct8 (intType *a, unsigned int step)
+
+  {
+    const intType W1 = 2841;  /* 2048 * sqrt(2.0) * cos(1 * PI / 16) */
+    const intType W2 = 2676;  /* 2048 * sqrt(2.0) * cos(2 * PI / 16) */
+    const intType W3 = 2408;  /* 2048 * sqrt(2.0) * cos(3 * PI / 16) */
+    const intType W5 = 1609;  /* 2048 * sqrt(2.0) * cos(5 * PI / 16) */
+    const intType W6 = 1108;  /* 2048 * sqrt(2.0) * cos(6 * PI / 16) */
+    const intType W7 =  565;  /* 2048 * sqrt(2.0) * cos(7 * PI / 16) */
+    intType x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+  /* fastIdct8 */
+    if (a[step] == 0 && a[2 * step] == 0 && a[3 * step] == 0 &&
+        a[4 * step] == 0 && a[5 * step] == 0 && a[6 * step] == 0 &&
+        a[7 * step] == 0) {
+      a[step] = a[0];
+      a[2 * step] = a[0];
+      a[3 * step] = a[0];
+      a[4 * step] = a[0];
+      a[5 * step] = a[0];
+      a[6 * step] = a[0];
+      a[7 * step] = a[0];
+    } else {
+      x0 = a[0] * 2048 + 128;
+      x1 = a[4 * step] * 2048;
+      x2 = a[6 * step];
+      x3 = a[2 * step];
+      x4 = a[step];
+      x5 = a[7 * step];
+      x6 = a[5 * step];
+      x7 = a[3 * step];
+
+      /* First stage */
+      x8 = W7 * (x4 + x5);
+      x4 = x8 + (W1 - W7) * x4;
+      x5 = x8 - (W1 + W7) * x5;
+      x8 = W3 * (x6 + x7);
+      x6 = x8 - (W3 - W5) * x6;
+      x7 = x8 - (W3 + W5) * x7;
+
+      /* Second stage */
+      x8 = x0 + x1;
+      x0 -= x1;
+      x1 = W6 * (x3 + x2);
+      x2 = x1 - (W2 + W6) * x2;
+      x3 = x1 + (W2 - W6) * x3;
+      x1 = x4 + x6;
+      x4 -= x6;
+      x6 = x5 + x7;
+      x5 -= x7;
+
+      /* Third stage */
+      x7 = x8 + x3;
+      x8 -= x3;
+      x3 = x0 + x2;
+      x0 -= x2;
+      x2 = ASHR(181 * (x4 + x5) + 128, 8);
+      x4 = ASHR(181 * (x4 - x5) + 128, 8);
+
+      /* Fourth stage */
+      a[0]        = ASHR(x7 + x1, 11);
+      a[step]     = ASHR(x3 + x2, 11);
+      a[2 * step] = ASHR(x0 + x4, 11);
+      a[3 * step] = ASHR(x8 + x6, 11);
+      a[4 * step] = ASHR(x8 - x6, 11);
+      a[5 * step] = ASHR(x0 - x4, 11);
+      a[6 * step] = ASHR(x3 - x2, 11);
+      a[7 * step] = ASHR(x7 - x1, 11);
+    } /* if */
+  } /* fastIdct8 */
+
+
+
+/**
+ *  Copy a JPEG data block (array of 64 integers) to 'block'.
+ *  @return TRUE if 'dataBlock' has 64 elements, FALSE otherwise.
+ */
+static boolType getDataBlock (intType block[JPEG_BLOCK_SIZE],
+    const const_rtlArrayType dataBlock)
+
+  {
+    unsigned int index;
+
+  /* getDataBlock */
+    if (unlikely(arraySize(dataBlock) != JPEG_BLOCK_SIZE)) {
+      return FALSE;
+    } else {
+      for (index = 0; index < JPEG_BLOCK_SIZE; index++) {
+        block[index] = dataBlock->arr[index].value.intValue;
+      } /* for */
+      return TRUE;
+    } /* if */
+  } /* getDataBlock */
+
+
+
+static inline unsigned int paethPredictor (unsigned int a, unsigned int b,
+    unsigned int c)
+
+  {
+    int pa;
+    int pb;
+    int pc;
+
+  /* paethPredictor */
+    pa = abs((int) b - (int) c);
+    pb = abs((int) a - (int) c);
+    pc = abs((int) a + (int) b - 2 * (int) c);
+    if (pa <= pb && pa <= pc) {
+      return a;
+    } else if (pb <= pc) {
+      return b;
+    } else {
+      return c;
+    } /* if */
+  } /* paethPredictor */
+
+
+
 /**
  *  Assign source to *dest.
  *  A copy function assumes that *dest contains a legal value.
@@ -443,6 +667,56 @@ bstriType drwGetPixelDataFromArray (const const_rtlArrayType image)
 
 
 
+/**
+ *  Create a new pixmap from the pixels of an image.
+ *  The pixels of the image are stored line by line from top
+ *  downward. Every line has 'width' pixels from left to right.
+ *  @param image Pixel data as created with drwNewImage() or
+ *         drwGetPixelData().
+ *  @return the new pixmap.
+ *  @exception RANGE_ERROR If 'width' or 'height' are not positive
+ *             or if 'image' is too small for them.
+ *  @exception MEMORY_ERROR Not enough memory to create the pixmap.
+ */
+winType drwGetPixmapFromImage (const const_bstriType image, intType width,
+    intType height)
+
+  {
+    const int32Type *pixels;
+    memSizeType imageSize;
+    int32Type *image_data;
+    winType result;
+
+  /* drwGetPixmapFromImage */
+    logFunction(printf("drwGetPixmapFromImage(\"%s\", " FMT_D ", " FMT_D ")\n",
+                       bstriAsUnquotedCStri(image), width, height););
+    pixels = imagePixels(image, width, height);
+    if (unlikely(pixels == NULL || width == 0 || height == 0)) {
+      logError(printf("drwGetPixmapFromImage(\"%s\", " FMT_D ", " FMT_D "): "
+                      "Illegal dimensions or image too small.\n",
+                      bstriAsUnquotedCStri(image), width, height););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      imageSize = (memSizeType) width * (memSizeType) height * sizeof(int32Type);
+      /* Some drivers convert the pixels in place. */
+      if (unlikely((image_data = (int32Type *) malloc(imageSize)) == NULL)) {
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else {
+        memcpy(image_data, pixels, imageSize);
+        result = drwImage(image_data, (memSizeType) width,
+                          (memSizeType) height, TRUE);
+        free(image_data);
+      } /* if */
+    } /* if */
+    logFunction(printf("drwGetPixmapFromImage --> " FMT_U_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* drwGetPixmapFromImage */
+
+
+
 winType drwGetPixmapFromPixels (const const_rtlArrayType image)
 
   {
@@ -496,6 +770,567 @@ winType drwGetPixmapFromPixels (const const_rtlArrayType image)
 
 
 
+/**
+ *  Convert the luma and chroma values of a JPEG MCU to pixels.
+ *  The minimum coded unit (MCU) covers 8 * 'horizontal' columns and
+ *  8 * 'vertical' lines. Its luma blocks are stored from left to
+ *  right and from top downward in 'luma'. The chroma blocks are
+ *  subsampled by 'horizontal' and 'vertical'. All blocks contain
+ *  values after the IDCT (see drwJpegIdct). Pixels outside of the
+ *  image are skipped. Monochrome images use chroma blocks with zeros.
+ *  @param image Pixel data of an image with 'width' and 'height'.
+ *  @param left Zero based column of the left edge of the MCU.
+ *  @param upper Zero based line of the upper edge of the MCU.
+ *  @exception RANGE_ERROR If the image is too small for 'width' and
+ *             'height', if 'left' or 'upper' are negative, if the
+ *             sampling factors are not 1 or 2 or if the blocks have
+ *             the wrong size.
+ */
+void drwJpegColor (bstriType image, intType width, intType height,
+    intType left, intType upper, intType horizontal, intType vertical,
+    const const_rtlArrayType luma, const const_rtlArrayType chromaBlue,
+    const const_rtlArrayType chromaRed)
+
+  {
+    int32Type *pixels;
+    intType lumaBlocks[4][JPEG_BLOCK_SIZE];
+    intType cbBlock[JPEG_BLOCK_SIZE];
+    intType crBlock[JPEG_BLOCK_SIZE];
+    unsigned int numLuma;
+    unsigned int index;
+    boolType okay = TRUE;
+    memSizeType lineBeyond;
+    memSizeType columnBeyond;
+    memSizeType line;
+    memSizeType column;
+    int32Type *pixel;
+    const intType *lumaLine;
+    unsigned int chromaIndex;
+    intType luminance;
+    intType cb;
+    intType cr;
+
+  /* drwJpegColor */
+    logFunction(printf("drwJpegColor(\"%s\", " FMT_D ", " FMT_D ", "
+                       FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", *, *, *)\n",
+                       bstriAsUnquotedCStri(image), width, height,
+                       left, upper, horizontal, vertical););
+    pixels = imagePixels(image, width, height);
+    if (unlikely(pixels == NULL || left < 0 || upper < 0 ||
+                 horizontal < 1 || horizontal > 2 ||
+                 vertical < 1 || vertical > 2 ||
+                 arraySize(luma) < (memSizeType) (horizontal * vertical))) {
+      okay = FALSE;
+    } else {
+      numLuma = (unsigned int) (horizontal * vertical);
+      for (index = 0; okay && index < numLuma; index++) {
+        okay = getDataBlock(lumaBlocks[index], luma->arr[index].value.arrayValue);
+      } /* for */
+      okay = okay && getDataBlock(cbBlock, chromaBlue) &&
+                     getDataBlock(crBlock, chromaRed);
+    } /* if */
+    if (unlikely(!okay)) {
+      logError(printf("drwJpegColor(\"%s\", " FMT_D ", " FMT_D ", "
+                      FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", *, *, *): "
+                      "Illegal parameters.\n",
+                      bstriAsUnquotedCStri(image), width, height,
+                      left, upper, horizontal, vertical););
+      raise_error(RANGE_ERROR);
+    } else if (left < width && upper < height) {
+      if (unlikely(!channelTablesInitialized)) {
+        initChannelTables();
+      } /* if */
+      lineBeyond = (memSizeType) (upper + 8 * vertical <= height ?
+                                  8 * vertical : height - upper);
+      columnBeyond = (memSizeType) (left + 8 * horizontal <= width ?
+                                    8 * horizontal : width - left);
+      for (line = 0; line < lineBeyond; line++) {
+        pixel = &pixels[((memSizeType) upper + line) * (memSizeType) width +
+                        (memSizeType) left];
+        for (column = 0; column < columnBeyond; column++) {
+          lumaLine = &lumaBlocks[(line >> 3) * (memSizeType) horizontal +
+                                 (column >> 3)][(line & 7) << 3];
+          luminance = ASHR(lumaLine[column & 7], 3) + 128;
+          chromaIndex = (unsigned int) ((line / (memSizeType) vertical) << 3 |
+                                        column / (memSizeType) horizontal);
+          cb = cbBlock[chromaIndex];
+          cr = crBlock[chromaIndex];
+          pixel[column] = rgbPixel8(
+              clampColor(ASHR(cr * 359, 11) + luminance),
+              clampColor(luminance - ASHR(cb * 88 + cr * 183, 11)),
+              clampColor(ASHR(cb * 454, 11) + luminance));
+        } /* for */
+      } /* for */
+    } /* if */
+  } /* drwJpegColor */
+
+
+
+/**
+ *  Dequantize, unzigzag and transform a JPEG block of 64 coefficients.
+ *  The coefficients in 'dataBlock' and 'quantizationTable' are in
+ *  zigzag order. Afterwards 'dataBlock' contains the luma or chroma
+ *  values of an 8x8 area, line by line, scaled with factor 8 to the
+ *  range -1024 .. 1023. The values are not clamped, so they might
+ *  also be higher or lower than the limit.
+ *  @exception RANGE_ERROR If the blocks do not have 64 elements.
+ */
+void drwJpegIdct (rtlArrayType dataBlock,
+    const const_rtlArrayType quantizationTable)
+
+  {
+    static const unsigned char zigzag[JPEG_BLOCK_SIZE] = {
+         0,  1,  5,  6, 14, 15, 27, 28,
+         2,  4,  7, 13, 16, 26, 29, 42,
+         3,  8, 12, 17, 25, 30, 41, 43,
+         9, 11, 18, 24, 31, 40, 44, 53,
+        10, 19, 23, 32, 39, 45, 52, 54,
+        20, 22, 33, 38, 46, 51, 55, 60,
+        21, 34, 37, 47, 50, 56, 59, 61,
+        35, 36, 48, 49, 57, 58, 62, 63};
+    intType block[JPEG_BLOCK_SIZE];
+    unsigned int index;
+
+  /* drwJpegIdct */
+    if (unlikely(arraySize(dataBlock) != JPEG_BLOCK_SIZE ||
+                 arraySize(quantizationTable) != JPEG_BLOCK_SIZE)) {
+      logError(printf("drwJpegIdct(arr1 (size=" FMT_U_MEM "), "
+                      "arr2 (size=" FMT_U_MEM ")): Size not 64.\n",
+                      arraySize(dataBlock), arraySize(quantizationTable)););
+      raise_error(RANGE_ERROR);
+    } else {
+      for (index = 0; index < JPEG_BLOCK_SIZE; index++) {
+        block[index] = dataBlock->arr[zigzag[index]].value.intValue *
+                       quantizationTable->arr[zigzag[index]].value.intValue;
+      } /* for */
+      for (index = 0; index < JPEG_BLOCK_SIZE; index += 8) {
+        fastIdct8(&block[index], 1);
+      } /* for */
+      for (index = 0; index < 8; index++) {
+        fastIdct8(&block[index], 8);
+      } /* for */
+      for (index = 0; index < JPEG_BLOCK_SIZE; index++) {
+        dataBlock->arr[index].value.intValue = block[index];
+      } /* for */
+    } /* if */
+  } /* drwJpegIdct */
+
+
+
+/**
+ *  Create the pixel data of an image with the given dimensions.
+ *  All pixels are initialized with 'col'. The pixel at the zero
+ *  based position (x, y) has the index y * width + x.
+ *  @return the pixel data of the new image.
+ *  @exception RANGE_ERROR If 'width' or 'height' are negative.
+ *  @exception MEMORY_ERROR Not enough memory for the pixel data.
+ */
+bstriType drwNewImage (intType width, intType height, intType col)
+
+  {
+    memSizeType numPixels;
+    memSizeType pos;
+    int32Type *pixels;
+    bstriType result;
+
+  /* drwNewImage */
+    logFunction(printf("drwNewImage(" FMT_D ", " FMT_D ", " F_X(08) ")\n",
+                       width, height, col););
+    if (unlikely(width < 0 || height < 0)) {
+      logError(printf("drwNewImage(" FMT_D ", " FMT_D ", " F_X(08) "): "
+                      "Negative width or height.\n",
+                      width, height, col););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else if (unlikely((width != 0 && (uintType) height >
+                         MAX_MEMSIZETYPE / sizeof(int32Type) / (uintType) width) ||
+                        !ALLOC_BSTRI_SIZE_OK(result, (memSizeType) width *
+                            (memSizeType) height * sizeof(int32Type)))) {
+      raise_error(MEMORY_ERROR);
+      result = NULL;
+    } else {
+      numPixels = (memSizeType) width * (memSizeType) height;
+      result->size = numPixels * sizeof(int32Type);
+      if (col == 0) {
+        memset(result->mem, 0, result->size);
+      } else {
+        pixels = (int32Type *) result->mem;
+        for (pos = 0; pos < numPixels; pos++) {
+          pixels[pos] = (int32Type) col;
+        } /* for */
+      } /* if */
+    } /* if */
+    return result;
+  } /* drwNewImage */
+
+
+
+/**
+ *  Convert unfiltered PNG scanlines to pixels of an image.
+ *  The scanlines start at the index 'start' (starting with 1) of
+ *  'data'. Every scanline consists of a filter type byte and the
+ *  bytes of 'passWidth' samples. The pixel of the sample at (x, y)
+ *  is written to the column left + x * columnDelta and the line
+ *  upper + y * lineDelta of 'image'. Non-interlaced images use the
+ *  position (0, 0) and the deltas 1. The seven passes of an
+ *  interlaced image use the positions and deltas of Adam7.
+ *  Palette indices and grayscale samples with less than 8 bits are
+ *  mapped with 'palette'. Alpha samples are ignored.
+ *  @param image Pixel data of an image with 'width' columns.
+ *  @exception RANGE_ERROR If 'data' is too short, if a palette index
+ *             is outside of 'palette', if the pass does not fit into
+ *             'image' or if 'bitDepth' or 'colorType' are not legal.
+ */
+void drwPngPixels (bstriType image, intType width, const const_striType data,
+    intType start, intType passWidth, intType passHeight, intType bitDepth,
+    intType colorType, const const_rtlArrayType palette, intType left,
+    intType upper, intType columnDelta, intType lineDelta)
+
+  {
+    intType height;
+    int32Type *pixels;
+    memSizeType bytesPerPixel;
+    memSizeType bytesPerScanline;
+    memSizeType sampleBytes;
+    boolType usePalette;
+    int32Type paletteBuffer[256];
+    memSizeType paletteSize = 0;
+    memSizeType pos;
+    const strElemType *scanline;
+    unsigned int samplesPerByte;
+    unsigned int mask;
+    unsigned int sample;
+    unsigned int shift;
+    int32Type *pixel;
+    memSizeType line;
+    memSizeType column;
+    boolType okay = TRUE;
+
+  /* drwPngPixels */
+    logFunction(printf("drwPngPixels(\"%s\", " FMT_D ", \"%s\", " FMT_D
+                       ", " FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", *, "
+                       FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ")\n",
+                       bstriAsUnquotedCStri(image), width,
+                       striAsUnquotedCStri(data), start, passWidth,
+                       passHeight, bitDepth, colorType, left, upper,
+                       columnDelta, lineDelta););
+    height = width == 0 ? 0 :
+        (intType) (image->size / sizeof(int32Type) / (memSizeType) width);
+    pixels = imagePixels(image, width, height);
+    switch (colorType) {
+      case PNG_COLOR_TYPE_GRAYSCALE:       bytesPerPixel = 1; break;
+      case PNG_COLOR_TYPE_RGB:             bytesPerPixel = 3; break;
+      case PNG_COLOR_TYPE_PALETTE:         bytesPerPixel = 1; break;
+      case PNG_COLOR_TYPE_GRAYSCALE_ALPHA: bytesPerPixel = 2; break;
+      case PNG_COLOR_TYPE_RGB_ALPHA:       bytesPerPixel = 4; break;
+      default:                             bytesPerPixel = 0; break;
+    } /* switch */
+    usePalette = colorType == PNG_COLOR_TYPE_PALETTE || bitDepth < 8;
+    if (bitDepth == 16) {
+      bytesPerPixel *= 2;
+    } /* if */
+    if (unlikely(pixels == NULL || bytesPerPixel == 0 ||
+                 (bitDepth != 1 && bitDepth != 2 && bitDepth != 4 &&
+                  bitDepth != 8 && bitDepth != 16) ||
+                 (usePalette && (bitDepth == 16 ||
+                                 (colorType != PNG_COLOR_TYPE_GRAYSCALE &&
+                                  colorType != PNG_COLOR_TYPE_PALETTE))) ||
+                 passWidth < 0 || passHeight < 0 || start < 1 ||
+                 left < 0 || upper < 0 || columnDelta < 1 || lineDelta < 1 ||
+                 (passWidth != 0 &&
+                  (passWidth - 1 > (width - 1 - left) / columnDelta || left >= width)) ||
+                 (passHeight != 0 &&
+                  (passHeight - 1 > (height - 1 - upper) / lineDelta || upper >= height)))) {
+      okay = FALSE;
+    } else if (passWidth != 0 && passHeight != 0) {
+      if (bitDepth < 8) {
+        bytesPerScanline = 1 + ((memSizeType) passWidth * (memSizeType) bitDepth + 7) / 8;
+      } else {
+        bytesPerScanline = 1 + (memSizeType) passWidth * bytesPerPixel;
+      } /* if */
+      if (unlikely((memSizeType) (start - 1) > data->size ||
+                   (memSizeType) passHeight > (data->size - (memSizeType) (start - 1)) /
+                                              bytesPerScanline)) {
+        okay = FALSE;
+      } else {
+        if (unlikely(!channelTablesInitialized)) {
+          initChannelTables();
+        } /* if */
+        if (usePalette) {
+          paletteSize = arraySize(palette);
+          if (paletteSize > 256) {
+            paletteSize = 256;
+          } /* if */
+          for (pos = 0; pos < paletteSize; pos++) {
+            paletteBuffer[pos] = (int32Type) palette->arr[pos].value.intValue;
+          } /* for */
+        } /* if */
+        scanline = &data->mem[start - 1];
+        for (line = 0; okay && line < (memSizeType) passHeight; line++) {
+          pixel = &pixels[((memSizeType) upper + line * (memSizeType) lineDelta) *
+                          (memSizeType) width + (memSizeType) left];
+          if (usePalette) {
+            samplesPerByte = 8 / (unsigned int) bitDepth;
+            mask = (1U << bitDepth) - 1;
+            for (column = 0; column < (memSizeType) passWidth; column++) {
+              shift = 8 - (unsigned int) bitDepth *
+                      (unsigned int) (column % samplesPerByte + 1);
+              sample = ((unsigned int) scanline[1 + column / samplesPerByte] >> shift) & mask;
+              if (unlikely(sample >= paletteSize)) {
+                okay = FALSE;
+                column = (memSizeType) passWidth;
+              } else {
+                *pixel = paletteBuffer[sample];
+                pixel += columnDelta;
+              } /* if */
+            } /* for */
+          } else if (colorType == PNG_COLOR_TYPE_GRAYSCALE ||
+                     colorType == PNG_COLOR_TYPE_GRAYSCALE_ALPHA) {
+            for (column = 0; column < (memSizeType) passWidth; column++) {
+              sample = (unsigned int) scanline[1 + column * bytesPerPixel] & 0xff;
+              *pixel = rgbPixel8(sample, sample, sample);
+              pixel += columnDelta;
+            } /* for */
+          } else {
+            /* For 16 bit samples the more significant byte is used. */
+            sampleBytes = (memSizeType) bitDepth / 8;
+            for (column = 0; column < (memSizeType) passWidth; column++) {
+              pos = 1 + column * bytesPerPixel;
+              *pixel = rgbPixel8(
+                  (unsigned int) scanline[pos] & 0xff,
+                  (unsigned int) scanline[pos + sampleBytes] & 0xff,
+                  (unsigned int) scanline[pos + 2 * sampleBytes] & 0xff);
+              pixel += columnDelta;
+            } /* for */
+          } /* if */
+          scanline += bytesPerScanline;
+        } /* for */
+      } /* if */
+    } /* if */
+    if (unlikely(!okay)) {
+      logError(printf("drwPngPixels(\"%s\", " FMT_D ", \"%s\", " FMT_D
+                      ", " FMT_D ", " FMT_D ", " FMT_D ", " FMT_D ", *, "
+                      FMT_D ", " FMT_D ", " FMT_D ", " FMT_D "): "
+                      "Illegal parameters or data.\n",
+                      bstriAsUnquotedCStri(image), width,
+                      striAsUnquotedCStri(data), start, passWidth,
+                      passHeight, bitDepth, colorType, left, upper,
+                      columnDelta, lineDelta););
+      raise_error(RANGE_ERROR);
+    } /* if */
+  } /* drwPngPixels */
+
+
+
+/**
+ *  Undo the filters of PNG scanlines in place.
+ *  The scanlines start at the index 'start' (starting with 1) of
+ *  'data'. Every scanline consists of a filter type byte and
+ *  bytesPerScanline - 1 filtered bytes. The filter types 0 (none),
+ *  1 (sub), 2 (up), 3 (average) and 4 (paeth) are reversed. Other
+ *  filter types leave the scanline unchanged. The scanline before
+ *  the first one is assumed to contain zeros.
+ *  @param height Number of scanlines.
+ *  @param bytesPerPixel Distance of the byte to the left, which is
+ *         used by the filters (at least 1).
+ *  @exception RANGE_ERROR If 'data' is too short or if a parameter
+ *             is not legal.
+ */
+void drwPngUnfilter (striType data, intType start, intType height,
+    intType bytesPerScanline, intType bytesPerPixel)
+
+  {
+    strElemType *scanline;
+    const strElemType *upper = NULL;
+    memSizeType lineLength;
+    memSizeType bpp;
+    memSizeType line;
+    memSizeType pos;
+
+  /* drwPngUnfilter */
+    logFunction(printf("drwPngUnfilter(\"%s\", " FMT_D ", " FMT_D ", "
+                       FMT_D ", " FMT_D ")\n",
+                       striAsUnquotedCStri(data), start, height,
+                       bytesPerScanline, bytesPerPixel););
+    if (unlikely(start < 1 || height < 0 || bytesPerScanline < 1 ||
+                 bytesPerPixel < 1 ||
+                 (memSizeType) (start - 1) > data->size ||
+                 (uintType) height > (data->size - (memSizeType) (start - 1)) /
+                                     (uintType) bytesPerScanline)) {
+      logError(printf("drwPngUnfilter(\"%s\", " FMT_D ", " FMT_D ", "
+                      FMT_D ", " FMT_D "): Illegal parameters.\n",
+                      striAsUnquotedCStri(data), start, height,
+                      bytesPerScanline, bytesPerPixel););
+      raise_error(RANGE_ERROR);
+    } else {
+      lineLength = (memSizeType) bytesPerScanline - 1;
+      bpp = (memSizeType) bytesPerPixel;
+      if (bpp > lineLength) {
+        bpp = lineLength;
+      } /* if */
+      scanline = &data->mem[start];
+      for (line = 0; line < (memSizeType) height; line++) {
+        switch (scanline[-1]) {
+          case 1:
+            for (pos = bpp; pos < lineLength; pos++) {
+              scanline[pos] = (scanline[pos] + scanline[pos - bpp]) & 0xff;
+            } /* for */
+            break;
+          case 2:
+            if (upper != NULL) {
+              for (pos = 0; pos < lineLength; pos++) {
+                scanline[pos] = (scanline[pos] + upper[pos]) & 0xff;
+              } /* for */
+            } /* if */
+            break;
+          case 3:
+            if (upper == NULL) {
+              for (pos = bpp; pos < lineLength; pos++) {
+                scanline[pos] = (scanline[pos] + (scanline[pos - bpp] >> 1)) & 0xff;
+              } /* for */
+            } else {
+              for (pos = 0; pos < bpp; pos++) {
+                scanline[pos] = (scanline[pos] + (upper[pos] >> 1)) & 0xff;
+              } /* for */
+              for (pos = bpp; pos < lineLength; pos++) {
+                scanline[pos] = (scanline[pos] +
+                    ((scanline[pos - bpp] + upper[pos]) >> 1)) & 0xff;
+              } /* for */
+            } /* if */
+            break;
+          case 4:
+            if (upper == NULL) {
+              for (pos = bpp; pos < lineLength; pos++) {
+                scanline[pos] = (scanline[pos] + scanline[pos - bpp]) & 0xff;
+              } /* for */
+            } else {
+              for (pos = 0; pos < bpp; pos++) {
+                scanline[pos] = (scanline[pos] + upper[pos]) & 0xff;
+              } /* for */
+              for (pos = bpp; pos < lineLength; pos++) {
+                scanline[pos] = (scanline[pos] +
+                    paethPredictor(scanline[pos - bpp], upper[pos],
+                                   upper[pos - bpp])) & 0xff;
+              } /* for */
+            } /* if */
+            break;
+        } /* switch */
+        upper = scanline;
+        scanline += bytesPerScanline;
+      } /* for */
+    } /* if */
+  } /* drwPngUnfilter */
+
+
+
+/**
+ *  Set the pixel at the zero based position (x, y) of an image.
+ *  @param image Pixel data of an image with 'width' and 'height'.
+ *  @exception RANGE_ERROR If (x, y) is outside of the image or if
+ *             the image is too small for 'width' and 'height'.
+ */
+void drwSetImagePixel (bstriType image, intType width, intType height,
+    intType x, intType y, intType col)
+
+  {
+    int32Type *pixels;
+
+  /* drwSetImagePixel */
+    logFunction(printf("drwSetImagePixel(" FMT_U_MEM ", " FMT_D ", "
+                       FMT_D ", " FMT_D ", " FMT_D ", " F_X(08) ")\n",
+                       (memSizeType) image, width, height, x, y, col););
+    pixels = imagePixels(image, width, height);
+    if (unlikely(pixels == NULL || x < 0 || x >= width ||
+                 y < 0 || y >= height)) {
+      raise_error(RANGE_ERROR);
+    } else {
+      pixels[(memSizeType) y * (memSizeType) width + (memSizeType) x] =
+          (int32Type) col;
+    } /* if */
+  } /* drwSetImagePixel */
+
+
+
+/**
+ *  Rotate and mirror an image.
+ *  The result has the dimensions height x width, if 'swapXY' is
+ *  TRUE, and width x height otherwise. The pixel at (x, y) of the
+ *  result is taken from the source position (sx, sy), with
+ *  sx = swapXY ? y : x and sy = swapXY ? x : y. Afterwards sx is
+ *  mirrored with width - 1 - sx, if 'mirrorX' is TRUE, and sy is
+ *  mirrored with height - 1 - sy, if 'mirrorY' is TRUE.
+ *  @return the pixel data of the transformed image.
+ *  @exception RANGE_ERROR If the image is too small for 'width' and
+ *             'height'.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ */
+bstriType drwTransformImage (const const_bstriType image, intType width,
+    intType height, boolType swapXY, boolType mirrorX, boolType mirrorY)
+
+  {
+    const int32Type *pixels;
+    memSizeType srcWidth;
+    memSizeType srcHeight;
+    memSizeType destWidth;
+    memSizeType destHeight;
+    memSizeType xPos;
+    memSizeType yPos;
+    intType sourceIndex;
+    intType sourceStep;
+    int32Type *dest;
+    bstriType result;
+
+  /* drwTransformImage */
+    logFunction(printf("drwTransformImage(\"%s\", " FMT_D ", " FMT_D
+                       ", %d, %d, %d)\n",
+                       bstriAsUnquotedCStri(image), width, height,
+                       swapXY, mirrorX, mirrorY););
+    pixels = imagePixels(image, width, height);
+    if (unlikely(pixels == NULL)) {
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else if (unlikely(!ALLOC_BSTRI_SIZE_OK(result, (memSizeType) width *
+                            (memSizeType) height * sizeof(int32Type)))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->size = (memSizeType) width * (memSizeType) height * sizeof(int32Type);
+      srcWidth = (memSizeType) width;
+      srcHeight = (memSizeType) height;
+      destWidth = swapXY ? srcHeight : srcWidth;
+      destHeight = swapXY ? srcWidth : srcHeight;
+      dest = (int32Type *) result->mem;
+      /* Along a line of the result the source index moves by sourceStep. */
+      if (swapXY) {
+        sourceStep = mirrorY ? -width : width;
+      } else {
+        sourceStep = mirrorX ? -1 : 1;
+      } /* if */
+      for (yPos = 0; yPos < destHeight && destWidth != 0; yPos++) {
+        if (swapXY) {
+          /* The line yPos of the result is a column of the source. */
+          sourceIndex = (intType) ((mirrorY ? srcHeight - 1 : 0) * srcWidth +
+                                   (mirrorX ? srcWidth - 1 - yPos : yPos));
+        } else {
+          sourceIndex = (intType) ((mirrorY ? srcHeight - 1 - yPos : yPos) * srcWidth +
+                                   (mirrorX ? srcWidth - 1 : 0));
+        } /* if */
+        if (sourceStep == 1) {
+          memcpy(dest, &pixels[sourceIndex], destWidth * sizeof(int32Type));
+          dest += destWidth;
+        } else {
+          for (xPos = 0; xPos < destWidth; xPos++) {
+            *dest = pixels[sourceIndex];
+            dest++;
+            sourceIndex += sourceStep;
+          } /* for */
+        } /* if */
+      } /* for */
+    } /* if */
+    return result;
+  } /* drwTransformImage */
+
+
+
 const_bstriType pltAlign (const const_bstriType pointList)
 
   {
@@ -34,5 +34,24 @@ winType drwCreate (const winType source);
 void drwDestr (const winType old_win);
 intType drwGetImagePixel (const_bstriType image, intType width,
     intType height, intType x, intType y);
+winType drwGetPixmapFromImage (const const_bstriType image, intType width,
+    intType height);
 winType drwGetPixmapFromPixels (const const_rtlArrayType image);
+void drwJpegColor (bstriType image, intType width, intType height,
+    intType left, intType upper, intType horizontal, intType vertical,
+    const const_rtlArrayType luma, const const_rtlArrayType chromaBlue,
+    const const_rtlArrayType chromaRed);
+void drwJpegIdct (rtlArrayType dataBlock,
+    const const_rtlArrayType quantizationTable);
+bstriType drwNewImage (intType width, intType height, intType col);
+void drwPngPixels (bstriType image, intType width, const const_striType data,
+    intType start, intType passWidth, intType passHeight, intType bitDepth,
+    intType colorType, const const_rtlArrayType palette, intType left,
+    intType upper, intType columnDelta, intType lineDelta);
+void drwPngUnfilter (striType data, intType start, intType height,
+    intType bytesPerScanline, intType bytesPerPixel);
+void drwSetImagePixel (bstriType image, intType width, intType height,
+    intType x, intType y, intType col);
+bstriType drwTransformImage (const const_bstriType image, intType width,
+    intType height, boolType swapXY, boolType mirrorX, boolType mirrorY);
 const_bstriType pltAlign (const const_bstriType pointList);
@@ -41,6 +41,7 @@
 #include "data_rtl.h"
 #include "heaputl.h"
 #include "striutl.h"
+#include "arrutl.h"
 #include "syvarutl.h"
 #include "objutl.h"
 #include "traceutl.h"
@@ -103,6 +104,60 @@ static objectType toIntArray (rtlArrayType aRtlArray)
 
 
 
+/**
+ *  Convert an array of integer arrays to an rtlArrayType array.
+ *  The inner arrays are converted with gen_rtl_array().
+ *  The result must be freed with free_rtl_array_array().
+ *  @return the rtlArrayType array, or NULL if there is not enough memory.
+ */
+static rtlArrayType gen_rtl_array_array (arrayType anArray)
+
+  {
+    memSizeType arraySize;
+    memSizeType pos;
+    rtlArrayType rtlArray;
+
+  /* gen_rtl_array_array */
+    arraySize = arraySize(anArray);
+    if (ALLOC_RTL_ARRAY(rtlArray, arraySize)) {
+      rtlArray->min_position = anArray->min_position;
+      rtlArray->max_position = anArray->max_position;
+      for (pos = 0; pos < arraySize; pos++) {
+        rtlArray->arr[pos].value.arrayValue =
+            gen_rtl_array(take_array(&anArray->arr[pos]));
+        if (unlikely(rtlArray->arr[pos].value.arrayValue == NULL)) {
+          while (pos > 0) {
+            pos--;
+            FREE_RTL_ARRAY(rtlArray->arr[pos].value.arrayValue,
+                           arraySize(rtlArray->arr[pos].value.arrayValue));
+          } /* while */
+          FREE_RTL_ARRAY(rtlArray, arraySize);
+          return NULL;
+        } /* if */
+      } /* for */
+    } /* if */
+    return rtlArray;
+  } /* gen_rtl_array_array */
+
+
+
+static void free_rtl_array_array (rtlArrayType rtlArray)
+
+  {
+    memSizeType arraySize;
+    memSizeType pos;
+
+  /* free_rtl_array_array */
+    arraySize = arraySize(rtlArray);
+    for (pos = 0; pos < arraySize; pos++) {
+      FREE_RTL_ARRAY(rtlArray->arr[pos].value.arrayValue,
+                     arraySize(rtlArray->arr[pos].value.arrayValue));
+    } /* for */
+    FREE_RTL_ARRAY(rtlArray, arraySize);
+  } /* free_rtl_array_array */
+
+
+
 objectType gkb_button_pressed (listType arguments)
 
   { /* gkb_button_pressed */
@@ -785,6 +840,26 @@ objectType drw_get_pixmap (listType arguments)
 
 
 
+/**
+ *  Create a new pixmap from the pixels of an image.
+ *  @return the new pixmap.
+ *  @exception RANGE_ERROR If 'width' or 'height' are not positive
+ *             or if the image is too small for them.
+ */
+objectType drw_get_pixmap_from_image (listType arguments)
+
+  { /* drw_get_pixmap_from_image */
+    isit_bstri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_win_temp(
+        drwGetPixmapFromImage(take_bstri(arg_1(arguments)),
+                              take_int(arg_2(arguments)),
+                              take_int(arg_3(arguments))));
+  } /* drw_get_pixmap_from_image */
+
+
+
 objectType drw_get_pixmap_from_pixels (listType arguments)
 
   {
@@ -869,6 +944,96 @@ objectType drw_height (listType arguments)
 
 
 
+/**
+ *  Convert the luma and chroma blocks of a JPEG MCU to image pixels.
+ *  @exception RANGE_ERROR If the parameters are not legal.
+ */
+objectType drw_jpeg_color (listType arguments)
+
+  {
+    rtlArrayType luma;
+    rtlArrayType chromaBlue;
+    rtlArrayType chromaRed;
+
+  /* drw_jpeg_color */
+    isit_bstri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    isit_int(arg_4(arguments));
+    isit_int(arg_5(arguments));
+    isit_int(arg_6(arguments));
+    isit_int(arg_7(arguments));
+    isit_array(arg_8(arguments));
+    isit_array(arg_9(arguments));
+    isit_array(arg_10(arguments));
+    luma = gen_rtl_array_array(take_array(arg_8(arguments)));
+    chromaBlue = gen_rtl_array(take_array(arg_9(arguments)));
+    chromaRed = gen_rtl_array(take_array(arg_10(arguments)));
+    if (luma == NULL || chromaBlue == NULL || chromaRed == NULL) {
+      if (luma != NULL) {
+        free_rtl_array_array(luma);
+      } /* if */
+      if (chromaBlue != NULL) {
+        FREE_RTL_ARRAY(chromaBlue, arraySize(chromaBlue));
+      } /* if */
+      if (chromaRed != NULL) {
+        FREE_RTL_ARRAY(chromaRed, arraySize(chromaRed));
+      } /* if */
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } else {
+      drwJpegColor(take_bstri(arg_1(arguments)),
+                   take_int(arg_2(arguments)), take_int(arg_3(arguments)),
+                   take_int(arg_4(arguments)), take_int(arg_5(arguments)),
+                   take_int(arg_6(arguments)), take_int(arg_7(arguments)),
+                   luma, chromaBlue, chromaRed);
+      free_rtl_array_array(luma);
+      FREE_RTL_ARRAY(chromaBlue, arraySize(chromaBlue));
+      FREE_RTL_ARRAY(chromaRed, arraySize(chromaRed));
+    } /* if */
+    return SYS_EMPTY_OBJECT;
+  } /* drw_jpeg_color */
+
+
+
+/**
+ *  Dequantize, unzigzag and transform a JPEG block of 64 coefficients.
+ *  @exception RANGE_ERROR If the blocks do not have 64 elements.
+ */
+objectType drw_jpeg_idct (listType arguments)
+
+  {
+    arrayType dataBlock;
+    rtlArrayType block;
+    rtlArrayType quantizationTable;
+    memSizeType pos;
+
+  /* drw_jpeg_idct */
+    isit_array(arg_1(arguments));
+    isit_array(arg_2(arguments));
+    dataBlock = take_array(arg_1(arguments));
+    block = gen_rtl_array(dataBlock);
+    quantizationTable = gen_rtl_array(take_array(arg_2(arguments)));
+    if (block == NULL || quantizationTable == NULL) {
+      if (block != NULL) {
+        FREE_RTL_ARRAY(block, arraySize(block));
+      } /* if */
+      if (quantizationTable != NULL) {
+        FREE_RTL_ARRAY(quantizationTable, arraySize(quantizationTable));
+      } /* if */
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } else {
+      drwJpegIdct(block, quantizationTable);
+      for (pos = 0; pos < arraySize(dataBlock); pos++) {
+        dataBlock->arr[pos].value.intValue = block->arr[pos].value.intValue;
+      } /* for */
+      FREE_RTL_ARRAY(block, arraySize(block));
+      FREE_RTL_ARRAY(quantizationTable, arraySize(quantizationTable));
+    } /* if */
+    return SYS_EMPTY_OBJECT;
+  } /* drw_jpeg_idct */
+
+
+
 objectType drw_ne (listType arguments)
 
   { /* drw_ne */
@@ -884,6 +1049,25 @@ objectType drw_ne (listType arguments)
 
 
 
+/**
+ *  Create the pixel data of an image with the given dimensions.
+ *  @return the pixel data of the new image.
+ *  @exception RANGE_ERROR If 'width' or 'height' are negative.
+ */
+objectType drw_new_image (listType arguments)
+
+  { /* drw_new_image */
+    isit_int(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_bstri_temp(
+        drwNewImage(take_int(arg_1(arguments)),
+                    take_int(arg_2(arguments)),
+                    take_int(arg_3(arguments))));
+  } /* drw_new_image */
+
+
+
 objectType drw_new_pixmap (listType arguments)
 
   {
@@ -1190,6 +1374,68 @@ objectType drw_pline (listType arguments)
 
 
 
+/**
+ *  Convert unfiltered PNG scanlines to pixels of an image.
+ *  @exception RANGE_ERROR If the parameters or the data are not legal.
+ */
+objectType drw_png_pixels (listType arguments)
+
+  {
+    rtlArrayType palette;
+
+  /* drw_png_pixels */
+    isit_bstri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_stri(arg_3(arguments));
+    isit_int(arg_4(arguments));
+    isit_int(arg_5(arguments));
+    isit_int(arg_6(arguments));
+    isit_int(arg_7(arguments));
+    isit_int(arg_8(arguments));
+    isit_array(arg_9(arguments));
+    isit_int(arg_10(arguments));
+    isit_int(arg_11(arguments));
+    isit_int(arg_12(arguments));
+    isit_int(arg_13(arguments));
+    palette = gen_rtl_array(take_array(arg_9(arguments)));
+    if (palette == NULL) {
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } else {
+      drwPngPixels(take_bstri(arg_1(arguments)), take_int(arg_2(arguments)),
+                   take_stri(arg_3(arguments)), take_int(arg_4(arguments)),
+                   take_int(arg_5(arguments)), take_int(arg_6(arguments)),
+                   take_int(arg_7(arguments)), take_int(arg_8(arguments)),
+                   palette,
+                   take_int(arg_10(arguments)), take_int(arg_11(arguments)),
+                   take_int(arg_12(arguments)), take_int(arg_13(arguments)));
+      FREE_RTL_ARRAY(palette, arraySize(palette));
+    } /* if */
+    return SYS_EMPTY_OBJECT;
+  } /* drw_png_pixels */
+
+
+
+/**
+ *  Undo the filters of PNG scanlines in place.
+ *  @exception RANGE_ERROR If the string is too short or if a
+ *             parameter is not legal.
+ */
+objectType drw_png_unfilter (listType arguments)
+
+  { /* drw_png_unfilter */
+    isit_stri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    isit_int(arg_4(arguments));
+    isit_int(arg_5(arguments));
+    drwPngUnfilter(take_stri(arg_1(arguments)),
+                   take_int(arg_2(arguments)), take_int(arg_3(arguments)),
+                   take_int(arg_4(arguments)), take_int(arg_5(arguments)));
+    return SYS_EMPTY_OBJECT;
+  } /* drw_png_unfilter */
+
+
+
 /**
  *  Return the X position of the pointer relative to the specified window.
  *  The point of origin is the top left corner of the drawing area
@@ -1407,6 +1653,28 @@ objectType drw_set_cursor_visible (listType arguments)
 
 
 
+/**
+ *  Set the pixel at the zero based position (x, y) of an image.
+ *  @exception RANGE_ERROR If (x, y) is outside of the image.
+ */
+objectType drw_set_image_pixel (listType arguments)
+
+  { /* drw_set_image_pixel */
+    isit_bstri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    isit_int(arg_4(arguments));
+    isit_int(arg_5(arguments));
+    isit_int(arg_6(arguments));
+    drwSetImagePixel(take_bstri(arg_1(arguments)),
+                     take_int(arg_2(arguments)), take_int(arg_3(arguments)),
+                     take_int(arg_4(arguments)), take_int(arg_5(arguments)),
+                     take_int(arg_6(arguments)));
+    return SYS_EMPTY_OBJECT;
+  } /* drw_set_image_pixel */
+
+
+
 /**
  *  Set the pointer x/arg_2 and y/arg_3 position relative to aWindow/arg_1.
  *  The point of origin is the top left corner of the drawing area
@@ -1535,6 +1803,30 @@ objectType drw_to_top (listType arguments)
 
 
 
+/**
+ *  Rotate and mirror an image.
+ *  @return the pixel data of the transformed image.
+ */
+objectType drw_transform_image (listType arguments)
+
+  { /* drw_transform_image */
+    isit_bstri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    isit_bool(arg_4(arguments));
+    isit_bool(arg_5(arguments));
+    isit_bool(arg_6(arguments));
+    return bld_bstri_temp(
+        drwTransformImage(take_bstri(arg_1(arguments)),
+                          take_int(arg_2(arguments)),
+                          take_int(arg_3(arguments)),
+                          take_bool(arg_4(arguments)) == SYS_TRUE_OBJECT,
+                          take_bool(arg_5(arguments)) == SYS_TRUE_OBJECT,
+                          take_bool(arg_6(arguments)) == SYS_TRUE_OBJECT));
+  } /* drw_transform_image */
+
+
+
 objectType drw_value (listType arguments)
 
   {
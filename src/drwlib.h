@@ -56,10 +56,14 @@ objectType drw_get_pixel_array           (listType arguments);
 objectType drw_get_pixel_data            (listType arguments);
 objectType drw_get_pixel_data_from_array (listType arguments);
 objectType drw_get_pixmap                (listType arguments);
+objectType drw_get_pixmap_from_image     (listType arguments);
 objectType drw_get_pixmap_from_pixels    (listType arguments);
 objectType drw_hashcode                  (listType arguments);
 objectType drw_height                    (listType arguments);
+objectType drw_jpeg_color                (listType arguments);
+objectType drw_jpeg_idct                 (listType arguments);
 objectType drw_ne                        (listType arguments);
+objectType drw_new_image                 (listType arguments);
 objectType drw_new_pixmap                (listType arguments);
 objectType drw_open                      (listType arguments);
 objectType drw_open_sub_window           (listType arguments);
@@ -72,6 +76,8 @@ objectType drw_pfcircle                  (listType arguments);
 objectType drw_pfellipse                 (listType arguments);
 objectType drw_pixel_to_rgb              (listType arguments);
 objectType drw_pline                     (listType arguments);
+objectType drw_png_pixels                (listType arguments);
+objectType drw_png_unfilter              (listType arguments);
 objectType drw_pointer_xpos              (listType arguments);
 objectType drw_pointer_ypos              (listType arguments);
 objectType drw_poly_line                 (listType arguments);
@@ -84,6 +90,7 @@ objectType drw_screen_height             (listType arguments);
 objectType drw_screen_width              (listType arguments);
 objectType drw_set_content               (listType arguments);
 objectType drw_set_cursor_visible        (listType arguments);
+objectType drw_set_image_pixel           (listType arguments);
 objectType drw_set_pointer_pos           (listType arguments);
 objectType drw_set_pos                   (listType arguments);
 objectType drw_set_size                  (listType arguments);
@@ -92,6 +99,7 @@ objectType drw_set_window_name           (listType arguments);
 objectType drw_text                      (listType arguments);
 objectType drw_to_bottom                 (listType arguments);
 objectType drw_to_top                    (listType arguments);
+objectType drw_transform_image           (listType arguments);
 objectType drw_value                     (listType arguments);
 objectType drw_width                     (listType arguments);
 objectType drw_xpos                      (listType arguments);
@@ -38,6 +38,7 @@
 
 #include "common.h"
 #include "data.h"
+#include "data_rtl.h"
 #include "sigutl.h"
 #include "heaputl.h"
 #include "flistutl.h"
@@ -52,6 +53,8 @@
 #include "runerr.h"
 #include "match.h"
 #include "prclib.h"
+#include "option.h"
+#include "thrcode.h"
 
 #undef EXTERN
 #define EXTERN
@@ -61,6 +64,23 @@
 
 extern boolType interpreter_exception;
 
+#define ARG_FRAME_CHUNK_SIZE 4096
+#define SIZ_ARG_FRAME_CHUNK(cap) (sizeof(argFrameChunkRecord) + \
+                                  ((cap) - 1) * sizeof(listRecord))
+
+typedef struct argFrameChunkStruct *argFrameChunkType;
+
+typedef struct argFrameChunkStruct {
+    argFrameChunkType previous;
+    argFrameChunkType next;
+    memSizeType capacity;
+    memSizeType used;
+    listRecord args[1];
+  } argFrameChunkRecord;
+
+static argFrameChunkType argFrameChunk = NULL;
+static memSizeType argFrameUsed = 0;
+
 
 
 void doSuspendInterpreter (int signalNum)
@@ -175,7 +195,7 @@ objectType exec_object (register objectType object)
  */
 static inline void par_init (locListType form_param_list,
     listType *backup_form_params, listType act_param_list,
-    listType *evaluated_act_params)
+    const_listType act_param_values, listType *evaluated_act_params)
 
   {
     locListType form_param;
@@ -195,7 +215,12 @@ static inline void par_init (locListType form_param_list,
     while (form_param != NULL && !fail_flag) {
       append_to_list(backup_insert_place,
           form_param->local.object->value.objValue, act_param_list);
-      param_value = exec_object(act_param_list->obj);
+      if (act_param_values != NULL) {
+        param_value = act_param_values->obj;
+        act_param_values = act_param_values->next;
+      } else {
+        param_value = exec_object(act_param_list->obj);
+      } /* if */
       append_to_list(evaluated_insert_place, param_value, act_param_list);
       form_param = form_param->next;
       act_param_list = act_param_list->next;
@@ -486,8 +511,15 @@ static void show_arg_list (listType act_param_list)
 
 
 
-static objectType exec_lambda (const_blockType block,
-    listType actual_parameters, objectType object)
+/**
+ *  Call the function 'block' with the 'actual_parameters'.
+ *  If 'act_param_values' is NULL the actual parameters are evaluated
+ *  with exec_object(). Otherwise 'act_param_values' contains the
+ *  already evaluated parameters. This is used by the threaded code,
+ *  which evaluates the parameters itself.
+ */
+objectType exec_lambda (const_blockType block, listType actual_parameters,
+    const_listType act_param_values, objectType object)
 
   {
     objectType result;
@@ -499,7 +531,7 @@ static objectType exec_lambda (const_blockType block,
   /* exec_lambda */
     logFunction(printf("exec_lambda\n"););
     par_init(block->params, &backup_form_params, actual_parameters,
-        &evaluated_act_params);
+        act_param_values, &evaluated_act_params);
     if (fail_flag) {
       free_list(backup_form_params);
       free_list(evaluated_act_params);
@@ -511,7 +543,14 @@ static objectType exec_lambda (const_blockType block,
         result = fail_value;
       } else {
         if (res_init(&block->result, &backup_block_result)) {
-          result = exec_call(block->body);
+          if ((prog->option_flags & EXECUTE_THREADED_CODE) != 0 &&
+              !trace.actions && !trace.check_actions) {
+            /* Cast to mutable structure: The threaded code is */
+            /* created, when the block is executed first.      */
+            result = exec_block_code((blockType) block);
+          } else {
+            result = exec_call(block->body);
+          } /* if */
           if (fail_flag) {
             errInfoType ignored_err_info;
 
@@ -538,26 +577,119 @@ static objectType exec_lambda (const_blockType block,
 
 
 
+/**
+ *  Reserve an argument frame with numArgs list elements.
+ *  The elements of a frame are contiguous in memory, such that an
+ *  action can access its arguments by index. The elements are also
+ *  linked with their next pointers, such that the frame can be used
+ *  as listType as well. Frames are allocated from chunks, which are
+ *  used like a stack. Chunks are kept for reuse when the stack shrinks.
+ *  @return the new frame, or NULL if there is not enough memory.
+ */
+listType push_arg_frame (memSizeType numArgs)
+
+  {
+    argFrameChunkType newChunk;
+    argFrameChunkType unusedChunk;
+    memSizeType capacity;
+    listType frame;
+
+  /* push_arg_frame */
+    if (unlikely(argFrameChunk == NULL ||
+                 argFrameChunk->capacity - argFrameUsed < numArgs)) {
+      newChunk = argFrameChunk != NULL ? argFrameChunk->next : NULL;
+      if (newChunk != NULL && newChunk->capacity < numArgs) {
+        do {
+          unusedChunk = newChunk;
+          newChunk = newChunk->next;
+          FREE_HEAP(unusedChunk, SIZ_ARG_FRAME_CHUNK(unusedChunk->capacity));
+        } while (newChunk != NULL);
+        argFrameChunk->next = NULL;
+      } /* if */
+      if (newChunk == NULL) {
+        capacity = numArgs > ARG_FRAME_CHUNK_SIZE ? numArgs : ARG_FRAME_CHUNK_SIZE;
+        if (unlikely(!ALLOC_HEAP(newChunk, argFrameChunkType,
+                                 SIZ_ARG_FRAME_CHUNK(capacity)))) {
+          return NULL;
+        } /* if */
+        newChunk->previous = argFrameChunk;
+        newChunk->next = NULL;
+        newChunk->capacity = capacity;
+        if (argFrameChunk != NULL) {
+          argFrameChunk->next = newChunk;
+        } /* if */
+      } /* if */
+      if (argFrameChunk != NULL) {
+        argFrameChunk->used = argFrameUsed;
+      } /* if */
+      argFrameChunk = newChunk;
+      argFrameUsed = 0;
+    } /* if */
+    frame = &argFrameChunk->args[argFrameUsed];
+    argFrameUsed += numArgs;
+    return frame;
+  } /* push_arg_frame */
+
+
+
+/**
+ *  Release the argument frame and all frames above it.
+ *  The frame is searched in the chunks, because a longjmp() after a
+ *  memory error may leave frames behind, which have not been released.
+ */
+void pop_arg_frame (const_listType frame)
+
+  { /* pop_arg_frame */
+    while (frame < argFrameChunk->args ||
+           frame >= &argFrameChunk->args[argFrameChunk->capacity]) {
+      argFrameChunk = argFrameChunk->previous;
+    } /* while */
+    argFrameUsed = (memSizeType) (frame - argFrameChunk->args);
+    if (argFrameUsed == 0 && argFrameChunk->previous != NULL) {
+      argFrameChunk = argFrameChunk->previous;
+      argFrameUsed = argFrameChunk->used;
+    } /* if */
+  } /* pop_arg_frame */
+
+
+
 static listType eval_arg_list (register listType act_param_list, uint32Type *temp_bits_ptr)
 
   {
-    listType evaluated_act_params = NULL;
+    const_listType param_elem;
+    memSizeType num_args = 0;
+    listType evaluated_act_params;
+    register listType frame_elem;
     register objectType evaluated_object;
-    register listType *evaluated_insert_place;
     uint32Type temp_bits = 0;
     int param_num = 0;
 
   /* eval_arg_list */
-    evaluated_insert_place = &evaluated_act_params;
-    while (act_param_list != NULL && !fail_flag) {
-      evaluated_object = exec_object(act_param_list->obj);
-      append_to_list(evaluated_insert_place, evaluated_object, act_param_list);
-      if (evaluated_object != NULL && TEMP_OBJECT(evaluated_object)) {
-        temp_bits |= (uint32Type) 1 << param_num;
+    for (param_elem = act_param_list; param_elem != NULL;
+         param_elem = param_elem->next) {
+      num_args++;
+    } /* for */
+    if (num_args == 0) {
+      evaluated_act_params = NULL;
+    } else if (unlikely((evaluated_act_params = push_arg_frame(num_args)) == NULL)) {
+      if (!fail_flag) {
+        raise_with_arguments(SYS_MEM_EXCEPTION, act_param_list);
       } /* if */
-      act_param_list = act_param_list->next;
-      param_num++;
-    } /* while */
+    } else {
+      frame_elem = evaluated_act_params;
+      do {
+        evaluated_object = exec_object(act_param_list->obj);
+        frame_elem->next = &frame_elem[1];
+        frame_elem->obj = evaluated_object;
+        if (evaluated_object != NULL && TEMP_OBJECT(evaluated_object)) {
+          temp_bits |= (uint32Type) 1 << param_num;
+        } /* if */
+        act_param_list = act_param_list->next;
+        frame_elem++;
+        param_num++;
+      } while (act_param_list != NULL && !fail_flag);
+      frame_elem[-1].next = NULL;
+    } /* if */
     *temp_bits_ptr = temp_bits;
     return evaluated_act_params;
   } /* eval_arg_list */
@@ -567,22 +699,20 @@ static listType eval_arg_list (register listType act_param_list, uint32Type *tem
 static void dump_arg_list (listType evaluated_act_params, uint32Type temp_bits)
 
   {
-    register listType list_end;
+    register listType frame_elem;
 
   /* dump_arg_list */
     if (evaluated_act_params != NULL) {
-      list_end = evaluated_act_params;
-      while (list_end->next != NULL) {
-        if (list_end->obj != NULL && temp_bits & 1 && TEMP_OBJECT(list_end->obj)) {
-          dump_any_temp(list_end->obj);
+      frame_elem = evaluated_act_params;
+      while (temp_bits != 0) {
+        if (temp_bits & 1 && frame_elem->obj != NULL &&
+            TEMP_OBJECT(frame_elem->obj)) {
+          dump_any_temp(frame_elem->obj);
         } /* if */
-        list_end = list_end->next;
+        frame_elem++;
         temp_bits >>= 1;
       } /* while */
-      if (list_end->obj != NULL && temp_bits & 1 && TEMP_OBJECT(list_end->obj)) {
-        dump_any_temp(list_end->obj);
-      } /* if */
-      free_list2(evaluated_act_params, list_end);
+      pop_arg_frame(evaluated_act_params);
     } /* if */
   } /* dump_arg_list */
 
@@ -760,7 +890,7 @@ objectType exec_call (objectType object)
         prot_list(actual_parameters);
         printf("\n"); */
         result = exec_lambda(subroutine_object->value.blockValue,
-            actual_parameters, object);
+            actual_parameters, NULL, object);
         break;
       case CONSTENUMOBJECT:
 /*        printf("constenumobject ");
@@ -940,7 +1070,7 @@ objectType evaluate (objectType object)
         result = object;
         break;
       case BLOCKOBJECT:
-        result = exec_lambda(object->value.blockValue, NULL, object);
+        result = exec_lambda(object->value.blockValue, NULL, NULL, object);
         break;
       case ACTOBJECT:
         result = exec_action(object, NULL, NULL);
@@ -35,6 +35,10 @@ EXTERN volatile int signal_number;
 
 void doSuspendInterpreter (int signalNum);
 objectType exec_object (register objectType object);
+objectType exec_lambda (const_blockType block, listType actual_parameters,
+    const_listType act_param_values, objectType object);
+listType push_arg_frame (memSizeType numArgs);
+void pop_arg_frame (const_listType frame);
 objectType exec_call (objectType object);
 objectType do_exec_call (objectType object, errInfoType *err_info);
 objectType evaluate (objectType object);
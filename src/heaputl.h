@@ -258,7 +258,7 @@ EXTERN memSizeType hs;
 #define SIZ_STRI(len)    ((sizeof(striRecord)     - sizeof(strElemType))  + (len) * sizeof(strElemType))
 #define SIZ_BSTRI(len)   ((sizeof(bstriRecord)    - sizeof(ucharType))    + (len) * sizeof(ucharType))
 #define SIZ_ARR(len)     ((sizeof(arrayRecord)    - sizeof(objectRecord)) + (len) * sizeof(objectRecord))
-#define SIZ_HSH(len)     ((sizeof(hashRecord)     - sizeof(hashElemType)) + (len) * sizeof(hashElemType))
+#define SIZ_HSH(len)     (sizeof(hashRecord)      + (len) * sizeof(hashElemType))
 #define SIZ_SET(len)     ((sizeof(setRecord)      - sizeof(bitSetType))   + (len) * sizeof(bitSetType))
 #define SIZ_SCT(len)     ((sizeof(structRecord)   - sizeof(objectRecord)) + (len) * sizeof(objectRecord))
 #define SIZ_BIG(len)     ((sizeof_bigIntRecord    - sizeof_bigDigitType)  + (len) * sizeof_bigDigitType)
@@ -266,7 +266,8 @@ EXTERN memSizeType hs;
 #define SIZ_TAB(tp, nr)  (sizeof(tp) * (nr))
 #define SIZ_RTL_L_ELEM   (sizeof(rtlListRecord))
 #define SIZ_RTL_ARR(len) ((sizeof(rtlArrayRecord) - sizeof(rtlObjectType))   + (len) * sizeof(rtlObjectType))
-#define SIZ_RTL_HSH(len) ((sizeof(rtlHashRecord)  - sizeof(rtlHashElemType)) + (len) * sizeof(rtlHashElemType))
+#define SIZ_RTL_HSH(len) (sizeof(rtlHashRecord)   + (len) * sizeof(rtlHashElemType))
+#define SIZ_RTL_FLAT_TAB(len) ((len) * (sizeof(rtlFlatHashElemRecord) + sizeof(unsigned char)))
 
 #define SIZ_STRI_0       (sizeof(emptyStriRecord))
 #define SIZ_BSTRI_0      (sizeof(emptyBStriRecord))
@@ -542,47 +543,74 @@ EXTERN unsigned int sflist_allowed;
 #define FREE_RTL_L_ELEM(var)       (CNT(CNT2_RTL_L_ELEM(SIZ_RTL_L_ELEM)) FREE_HEAP(var, SIZ_RTL_L_ELEM))
 
 
+/* With capacity the size of an array can be less than its capacity. */
+/* In this case FREE_ARRAY and REALLOC_ARRAY use the capacity to     */
+/* compute the heap size and COUNT3_ARRAY does nothing.              */
 #if WITH_ARRAY_CAPACITY
 #define HEAP_ALLOC_ARRAY(var,cap)       (ALLOC_HEAP(var,arrayType,SIZ_ARR(cap))?((var)->capacity=(cap),CNT(CNT1_ARR(cap,SIZ_ARR(cap))) TRUE):FALSE)
-#define HEAP_REALLOC_ARRAY(var,old,cap) (((var=REALLOC_HEAP(old,arrayType,SIZ_ARR(cap)))!=NULL)?((var)->capacity=(cap), TRUE):FALSE)
+#define HEAP_REALLOC_ARRAY(var,old,cap) (((var=REALLOC_HEAP(old,arrayType,SIZ_ARR(cap)))!=NULL)?(CNT(COUNT3_ARRAY_CAPACITY((var)->capacity,cap))(var)->capacity=(cap), TRUE):FALSE)
+#define HEAP_FREE_ARRAY(var,unused)     (CNT(CNT2_ARR((var)->capacity, SIZ_ARR((var)->capacity))) FREE_HEAP(var, SIZ_ARR((var)->capacity)))
 #define ALLOC_EMPTY_ARRAY(var)          (ALLOC_HEAP(var,emptyArrayType,SIZ_ARR_0)?((var)->capacity=0,CNT(CNT1_ARR(0,SIZ_ARR_0)) TRUE):FALSE)
+#define COUNT3_ARRAY(cap1,cap2)
 #else
 #define HEAP_ALLOC_ARRAY(var,cap)       (ALLOC_HEAP(var,arrayType,SIZ_ARR(cap))?CNT(CNT1_ARR(cap,SIZ_ARR(cap))) TRUE:FALSE)
 #define HEAP_REALLOC_ARRAY(var,old,cap) ((var=REALLOC_HEAP(old,arrayType,SIZ_ARR(cap)))!=NULL)
+#define HEAP_FREE_ARRAY(var,cap)        (CNT(CNT2_ARR(cap, SIZ_ARR(cap))) FREE_HEAP(var, SIZ_ARR(cap)))
 #define ALLOC_EMPTY_ARRAY(var)          (ALLOC_HEAP(var,emptyArrayType,SIZ_ARR_0)?CNT(CNT1_ARR(0,SIZ_ARR_0)) TRUE:FALSE)
+#define COUNT3_ARRAY(cap1,cap2)         COUNT3_ARRAY_CAPACITY(cap1, cap2)
 #endif
 
 #define ALLOC_ARRAY(var,cap)       HEAP_ALLOC_ARRAY(var, cap)
-#define FREE_ARRAY(var,cap)        (CNT(CNT2_ARR(cap, SIZ_ARR(cap))) FREE_HEAP(var, SIZ_ARR(cap)))
+#define FREE_ARRAY(var,cap)        HEAP_FREE_ARRAY(var, cap)
 #define REALLOC_ARRAY(var,old,cap) HEAP_REALLOC_ARRAY(var, old, cap)
-#define COUNT3_ARRAY(cap1,cap2)    CNT3(CNT2_ARR(cap1, SIZ_ARR(cap1)), CNT1_ARR(cap2, SIZ_ARR(cap2)))
+#define COUNT3_ARRAY_CAPACITY(cap1,cap2) CNT3(CNT2_ARR(cap1, SIZ_ARR(cap1)), CNT1_ARR(cap2, SIZ_ARR(cap2)))
 
 
 #if WITH_RTL_ARRAY_CAPACITY
 #define HEAP_ALLOC_RTL_ARRAY(var,cap)       (ALLOC_HEAP(var,rtlArrayType,SIZ_RTL_ARR(cap))?((var)->capacity=(cap),CNT(CNT1_RTL_ARR(cap,SIZ_RTL_ARR(cap))) TRUE):FALSE)
-#define HEAP_REALLOC_RTL_ARRAY(var,old,cap) (((var=REALLOC_HEAP(old,rtlArrayType,SIZ_RTL_ARR(cap)))!=NULL)?((var)->capacity=(cap), TRUE):FALSE)
+#define HEAP_REALLOC_RTL_ARRAY(var,old,cap) (((var=REALLOC_HEAP(old,rtlArrayType,SIZ_RTL_ARR(cap)))!=NULL)?(CNT(COUNT3_RTL_ARRAY_CAPACITY((var)->capacity,cap))(var)->capacity=(cap), TRUE):FALSE)
+#define HEAP_FREE_RTL_ARRAY(var,unused)     (CNT(CNT2_RTL_ARR((var)->capacity, SIZ_RTL_ARR((var)->capacity))) FREE_HEAP(var, SIZ_RTL_ARR((var)->capacity)))
+#define COUNT3_RTL_ARRAY(cap1,cap2)
 #else
 #define HEAP_ALLOC_RTL_ARRAY(var,cap)       (ALLOC_HEAP(var,rtlArrayType,SIZ_RTL_ARR(cap))?CNT(CNT1_RTL_ARR(cap,SIZ_RTL_ARR(cap))) TRUE:FALSE)
 #define HEAP_REALLOC_RTL_ARRAY(var,old,cap) ((var=REALLOC_HEAP(old,rtlArrayType,SIZ_RTL_ARR(cap)))!=NULL)
+#define HEAP_FREE_RTL_ARRAY(var,cap)        (CNT(CNT2_RTL_ARR(cap, SIZ_RTL_ARR(cap))) FREE_HEAP(var, SIZ_RTL_ARR(cap)))
+#define COUNT3_RTL_ARRAY(cap1,cap2)         COUNT3_RTL_ARRAY_CAPACITY(cap1, cap2)
 #endif
 
 #define ALLOC_RTL_ARRAY(var,cap)       HEAP_ALLOC_RTL_ARRAY(var, cap)
-#define FREE_RTL_ARRAY(var,cap)        (CNT(CNT2_RTL_ARR(cap, SIZ_RTL_ARR(cap))) FREE_HEAP(var, SIZ_RTL_ARR(cap)))
+#define FREE_RTL_ARRAY(var,cap)        HEAP_FREE_RTL_ARRAY(var, cap)
 #define REALLOC_RTL_ARRAY(var,old,cap) HEAP_REALLOC_RTL_ARRAY(var, old, cap)
-#define COUNT3_RTL_ARRAY(cap1,cap2)    CNT3(CNT2_RTL_ARR(cap1, SIZ_RTL_ARR(cap1)), CNT1_RTL_ARR(cap2, SIZ_RTL_ARR(cap2)))
+#define COUNT3_RTL_ARRAY_CAPACITY(cap1,cap2) CNT3(CNT2_RTL_ARR(cap1, SIZ_RTL_ARR(cap1)), CNT1_RTL_ARR(cap2, SIZ_RTL_ARR(cap2)))
 
+/* Arrays, which grow with push, append and extend, double their     */
+/* capacity. This way appending an element is amortized O(1).        */
+#define MIN_ARRAY_GROW_CAPACITY 8
 
-#define ALLOC_HASH(var,len)        (ALLOC_HEAP(var, hashType, SIZ_HSH(len))?CNT(CNT1_HSH(len, SIZ_HSH(len))) TRUE:FALSE)
-#define FREE_HASH(var,len)         (CNT(CNT2_HSH(len, SIZ_HSH(len))) FREE_HEAP(var, SIZ_HSH(len)))
-#define REALLOC_HASH(var,ln1,ln2)  REALLOC_HEAP(var, hashType, SIZ_HSH(ln2))
+
+/* The table of a hash map is allocated separately. This way the  */
+/* table can be resized without changing the address of the hash. */
+#define ALLOC_HASH_TABLE(var,len)  ALLOC_HEAP(var, hashElemType *, (len) * sizeof(hashElemType))
+#define FREE_HASH_TABLE(var,len)   FREE_HEAP(var, (len) * sizeof(hashElemType))
+#define ALLOC_HASH(var,len)        (ALLOC_HEAP(var, hashType, SIZ_HSH(0))?(ALLOC_HASH_TABLE((var)->table, len)?CNT(CNT1_HSH(len, SIZ_HSH(len))) TRUE:(FREE_HEAP(var, SIZ_HSH(0)), FALSE)):FALSE)
+#define FREE_HASH(var,len)         (CNT(CNT2_HSH(len, SIZ_HSH(len))) FREE_HASH_TABLE((var)->table, len), FREE_HEAP(var, SIZ_HSH(0)))
 #define COUNT3_HASH(len1,len2)     CNT3(CNT2_HSH(len1, SIZ_HSH(len1)), CNT1_HSH(len2, SIZ_HSH(len2)))
 
 
-#define ALLOC_RTL_HASH(var,len)       (ALLOC_HEAP(var, rtlHashType, SIZ_RTL_HSH(len))?CNT(CNT1_RTL_HSH(len, SIZ_RTL_HSH(len))) TRUE:FALSE)
-#define FREE_RTL_HASH(var,len)        (CNT(CNT2_RTL_HSH(len, SIZ_RTL_HSH(len))) FREE_HEAP(var, SIZ_RTL_HSH(len)))
-#define REALLOC_RTL_HASH(var,ln1,ln2) REALLOC_HEAP(var, rtlHashType, SIZ_RTL_HSH(ln2))
+#define ALLOC_RTL_HASH_TABLE(var,len) ALLOC_HEAP(var, rtlHashElemType *, (len) * sizeof(rtlHashElemType))
+#define FREE_RTL_HASH_TABLE(var,len)  FREE_HEAP(var, (len) * sizeof(rtlHashElemType))
+#define ALLOC_RTL_HASH(var,len)       (ALLOC_HEAP(var, rtlHashType, SIZ_RTL_HSH(0))?(ALLOC_RTL_HASH_TABLE((var)->table, len)?CNT(CNT1_RTL_HSH(len, SIZ_RTL_HSH(len))) TRUE:(FREE_HEAP(var, SIZ_RTL_HSH(0)), FALSE)):FALSE)
+#define FREE_RTL_HASH(var,len)        (CNT(CNT2_RTL_HSH(len, SIZ_RTL_HSH(len))) FREE_RTL_HASH_TABLE((var)->table, len), FREE_HEAP(var, SIZ_RTL_HSH(0)))
 #define COUNT3_RTL_HASH(len1,len2)    CNT3(CNT2_RTL_HSH(len1, SIZ_RTL_HSH(len1)), CNT1_RTL_HSH(len2, SIZ_RTL_HSH(len2)))
 
+/* A flat hash table consists of the elements followed by one */
+/* control byte per element. It is allocated when the first   */
+/* element is added to a flat hash map.                        */
+#define ALLOC_RTL_FLAT_HASH(var)       (ALLOC_HEAP(var, rtlHashType, SIZ_RTL_HSH(0))?CNT(CNT1_RTL_HSH(0, SIZ_RTL_HSH(0))) TRUE:FALSE)
+#define FREE_RTL_FLAT_HASH(var)        (CNT(CNT2_RTL_HSH(0, SIZ_RTL_HSH(0))) FREE_HEAP(var, SIZ_RTL_HSH(0)))
+#define ALLOC_RTL_FLAT_TABLE(var,len)  (ALLOC_HEAP(var, rtlFlatHashElemType, SIZ_RTL_FLAT_TAB(len))?CNT(CNT1_BYT(SIZ_RTL_FLAT_TAB(len))) TRUE:FALSE)
+#define FREE_RTL_FLAT_TABLE(var,len)   (CNT(CNT2_BYT(SIZ_RTL_FLAT_TAB(len))) FREE_HEAP(var, SIZ_RTL_FLAT_TAB(len)))
+
 
 #define ALLOC_SET(var,len)         (ALLOC_HEAP(var, setType, SIZ_SET(len))?CNT(CNT1_SET(len, SIZ_SET(len))) TRUE:FALSE)
 #define FREE_SET(var,len)          (CNT(CNT2_SET(len, SIZ_SET(len))) FREE_HEAP(var, SIZ_SET(len)))
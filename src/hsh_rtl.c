@@ -62,9 +62,35 @@
 
 
 #define TABLE_BITS 10
+#define MAX_TABLE_BITS (INT_SIZE - 2)
 #define TABLE_SIZE(bits) ((unsigned int) 1 << (bits))
 #define TABLE_MASK(bits) (TABLE_SIZE(bits)-1)
 
+/* The table is doubled when there are more elements than slots.  */
+/* It is halved when less than a quarter of the slots would be    */
+/* used. A table never shrinks below TABLE_SIZE(TABLE_BITS).      */
+#define HASH_TOO_FULL(hash)  ((hash)->size > (hash)->table_size && (hash)->bits < MAX_TABLE_BITS)
+#define HASH_TOO_EMPTY(hash) ((hash)->bits > TABLE_BITS && (hash)->size < (hash)->table_size >> 2)
+
+/* Flat hash maps start without table. The first table has        */
+/* TABLE_SIZE(FLAT_MIN_BITS) slots. The table is doubled before   */
+/* more than 7/8 of the slots are used. It is halved when less    */
+/* than 1/8 of the slots are used.                                */
+#define FLAT_MIN_BITS 3
+#define FLAT_MAX_BITS (INT_SIZE - 2)
+#define FLAT_MAX_DISTANCE 255
+#define FLAT_TOO_FULL(hash)  ((hash)->size >= (hash)->table_size - ((hash)->table_size >> 3))
+#define FLAT_TOO_EMPTY(hash) ((hash)->bits > FLAT_MIN_BITS && (hash)->size < (hash)->table_size >> 3)
+
+/* The home slot is computed with Fibonacci hashing. The upper    */
+/* bits of the product are well mixed, even for sequential keys.  */
+#if GENERIC_SIZE == 64
+#define FLAT_HASH_MULTIPLIER GENERIC_SUFFIX(0x9e3779b97f4a7c15)
+#else
+#define FLAT_HASH_MULTIPLIER GENERIC_SUFFIX(0x9e3779b9)
+#endif
+#define FLAT_HOME(hash,key) ((unsigned int) (((genericType) (key) * FLAT_HASH_MULTIPLIER) >> (GENERIC_SIZE - (hash)->bits)))
+
 
 
 void freeGenericHash (rtlHashType genericHash)
@@ -137,7 +163,7 @@ static void free_hash (const const_rtlHashType old_hash,
 
 
 static rtlHashElemType new_helem_generic (genericType key, genericType data,
-    errInfoType *err_info)
+    intType hashcode, errInfoType *err_info)
 
   {
     rtlHashElemType helem;
@@ -151,6 +177,7 @@ static rtlHashElemType new_helem_generic (genericType key, genericType data,
       helem->data.value.genericValue = data;
       helem->next_less = NULL;
       helem->next_greater = NULL;
+      helem->hashcode = (unsigned int) hashcode;
       /* printf("new_helem_generic(" FMT_U_GEN ", " FMT_U_GEN ")\n",
           helem->key.value.genericValue,
           helem->data.value.genericValue); */
@@ -161,8 +188,8 @@ static rtlHashElemType new_helem_generic (genericType key, genericType data,
 
 
 static rtlHashElemType new_helem (rtlValueUnion key, rtlValueUnion data,
-    const createFuncType key_create_func, const createFuncType data_create_func,
-    errInfoType *err_info)
+    intType hashcode, const createFuncType key_create_func,
+    const createFuncType data_create_func, errInfoType *err_info)
 
   {
     rtlHashElemType helem;
@@ -176,6 +203,7 @@ static rtlHashElemType new_helem (rtlValueUnion key, rtlValueUnion data,
       helem->data.value = data_create_func(data);
       helem->next_less = NULL;
       helem->next_greater = NULL;
+      helem->hashcode = (unsigned int) hashcode;
       /* printf("new_helem(" FMT_U_GEN ", " FMT_U_GEN ")\n",
           helem->key.value.genericValue,
           helem->data.value.genericValue); */
@@ -197,6 +225,8 @@ static rtlHashType new_hash (unsigned int bits)
       hash->mask = TABLE_MASK(bits);
       hash->table_size = TABLE_SIZE(bits);
       hash->size = 0;
+      hash->flat_table = NULL;
+      hash->flat_control = NULL;
       memset(hash->table, 0, hash->table_size * sizeof(rtlHashElemType));
     } /* if */
     logFunction(printf("new_hash(%u) --> " FMT_X_MEM "\n",
@@ -206,6 +236,212 @@ static rtlHashType new_hash (unsigned int bits)
 
 
 
+/**
+ *  Convert the tree 'helem' to a list, which is sorted in search order.
+ *  The list is linked with next_greater and 'tail' is appended to it.
+ *  The number of elements in the tree is added to 'length'.
+ *  @return the head of the list.
+ */
+static rtlHashElemType helem_to_list (rtlHashElemType helem,
+    rtlHashElemType tail, memSizeType *length)
+
+  {
+    rtlHashElemType smaller;
+
+  /* helem_to_list */
+    while (helem != NULL) {
+      if (helem->next_less != NULL) {
+        tail = helem_to_list(helem->next_less, tail, length);
+      } /* if */
+      smaller = helem->next_greater;
+      helem->next_less = NULL;
+      helem->next_greater = tail;
+      tail = helem;
+      (*length)++;
+      helem = smaller;
+    } /* while */
+    return tail;
+  } /* helem_to_list */
+
+
+
+/**
+ *  Build a balanced tree from the first 'length' elements of '*list'.
+ *  The list must be sorted in search order (see helem_to_list).
+ *  Afterwards '*list' refers to the rest of the list.
+ *  @return the root of the tree.
+ */
+static rtlHashElemType list_to_helem (rtlHashElemType *list, memSizeType length)
+
+  {
+    rtlHashElemType smaller;
+    rtlHashElemType root;
+
+  /* list_to_helem */
+    if (length == 0) {
+      root = NULL;
+    } else {
+      smaller = list_to_helem(list, length >> 1);
+      root = *list;
+      *list = root->next_greater;
+      root->next_greater = smaller;
+      root->next_less = list_to_helem(list, length - (length >> 1) - 1);
+    } /* if */
+    return root;
+  } /* list_to_helem */
+
+
+
+/**
+ *  Merge two lists, which are sorted in search order.
+ *  If 'cmp_func' is NULL the keys are compared as genericType values.
+ *  @return the head of the merged list.
+ */
+static rtlHashElemType merge_helem_lists (rtlHashElemType list1,
+    rtlHashElemType list2, const compareFuncType cmp_func)
+
+  {
+    rtlHashElemType head = NULL;
+    rtlHashElemType *insert_pos = &head;
+    boolType take_first;
+
+  /* merge_helem_lists */
+    while (list1 != NULL && list2 != NULL) {
+      if (cmp_func == NULL) {
+        take_first = list1->key.value.genericValue < list2->key.value.genericValue;
+      } else {
+        take_first = cmp_func(list1->key.value, list2->key.value) < 0;
+      } /* if */
+      if (take_first) {
+        *insert_pos = list1;
+        list1 = list1->next_greater;
+      } else {
+        *insert_pos = list2;
+        list2 = list2->next_greater;
+      } /* if */
+      insert_pos = &(*insert_pos)->next_greater;
+    } /* while */
+    if (list1 != NULL) {
+      *insert_pos = list1;
+    } else {
+      *insert_pos = list2;
+    } /* if */
+    return head;
+  } /* merge_helem_lists */
+
+
+
+/**
+ *  Double the number of slots in the table of 'aHashMap'.
+ *  Every slot is split into two slots, which is possible without
+ *  comparing keys. The trees of the new slots are balanced.
+ *  If there is not enough memory the table is left unchanged.
+ */
+static void grow_hash (const rtlHashType aHashMap)
+
+  {
+    unsigned int old_size;
+    unsigned int new_bits;
+    rtlHashElemType *new_table;
+    unsigned int number;
+    rtlHashElemType list;
+    rtlHashElemType lower_list;
+    rtlHashElemType upper_list;
+    rtlHashElemType *lower_insert;
+    rtlHashElemType *upper_insert;
+    memSizeType length;
+    memSizeType lower_length;
+
+  /* grow_hash */
+    logFunction(printf("grow_hash(" FMT_X_MEM ") size=" FMT_U_MEM
+                       ", table_size=%u\n", (memSizeType) aHashMap,
+                       aHashMap->size, aHashMap->table_size););
+    old_size = aHashMap->table_size;
+    new_bits = aHashMap->bits + 1;
+    if (likely(ALLOC_RTL_HASH_TABLE(new_table, TABLE_SIZE(new_bits)))) {
+      for (number = 0; number < old_size; number++) {
+        length = 0;
+        list = helem_to_list(aHashMap->table[number], NULL, &length);
+        lower_insert = &lower_list;
+        upper_insert = &upper_list;
+        lower_length = 0;
+        while (list != NULL) {
+          if ((list->hashcode & old_size) == 0) {
+            *lower_insert = list;
+            lower_insert = &list->next_greater;
+            lower_length++;
+          } else {
+            *upper_insert = list;
+            upper_insert = &list->next_greater;
+          } /* if */
+          list = list->next_greater;
+        } /* while */
+        *lower_insert = NULL;
+        *upper_insert = NULL;
+        new_table[number] = list_to_helem(&lower_list, lower_length);
+        new_table[number + old_size] =
+            list_to_helem(&upper_list, length - lower_length);
+      } /* for */
+      FREE_RTL_HASH_TABLE(aHashMap->table, old_size);
+      COUNT3_RTL_HASH(old_size, TABLE_SIZE(new_bits));
+      aHashMap->table = new_table;
+      aHashMap->bits = new_bits;
+      aHashMap->mask = TABLE_MASK(new_bits);
+      aHashMap->table_size = TABLE_SIZE(new_bits);
+    } /* if */
+    logFunction(printf("grow_hash --> table_size=%u\n",
+                       aHashMap->table_size););
+  } /* grow_hash */
+
+
+
+/**
+ *  Halve the number of slots in the table of 'aHashMap'.
+ *  The trees of two slots are merged with 'cmp_func'. If 'cmp_func'
+ *  is NULL the keys are compared as genericType values.
+ *  If there is not enough memory the table is left unchanged.
+ */
+static void shrink_hash (const rtlHashType aHashMap,
+    const compareFuncType cmp_func)
+
+  {
+    unsigned int old_size;
+    unsigned int new_bits;
+    rtlHashElemType *new_table;
+    unsigned int number;
+    rtlHashElemType lower_list;
+    rtlHashElemType upper_list;
+    rtlHashElemType list;
+    memSizeType length;
+
+  /* shrink_hash */
+    logFunction(printf("shrink_hash(" FMT_X_MEM ") size=" FMT_U_MEM
+                       ", table_size=%u\n", (memSizeType) aHashMap,
+                       aHashMap->size, aHashMap->table_size););
+    old_size = aHashMap->table_size;
+    new_bits = aHashMap->bits - 1;
+    if (likely(ALLOC_RTL_HASH_TABLE(new_table, TABLE_SIZE(new_bits)))) {
+      for (number = 0; number < TABLE_SIZE(new_bits); number++) {
+        length = 0;
+        lower_list = helem_to_list(aHashMap->table[number], NULL, &length);
+        upper_list = helem_to_list(aHashMap->table[number + TABLE_SIZE(new_bits)],
+                                   NULL, &length);
+        list = merge_helem_lists(lower_list, upper_list, cmp_func);
+        new_table[number] = list_to_helem(&list, length);
+      } /* for */
+      FREE_RTL_HASH_TABLE(aHashMap->table, old_size);
+      COUNT3_RTL_HASH(old_size, TABLE_SIZE(new_bits));
+      aHashMap->table = new_table;
+      aHashMap->bits = new_bits;
+      aHashMap->mask = TABLE_MASK(new_bits);
+      aHashMap->table_size = TABLE_SIZE(new_bits);
+    } /* if */
+    logFunction(printf("shrink_hash --> table_size=%u\n",
+                       aHashMap->table_size););
+  } /* shrink_hash */
+
+
+
 static rtlHashElemType create_helem (const const_rtlHashElemType source_helem,
     const createFuncType key_create_func, const createFuncType data_create_func,
     errInfoType *err_info)
@@ -221,6 +457,7 @@ static rtlHashElemType create_helem (const const_rtlHashElemType source_helem,
           key_create_func(source_helem->key.value);
       dest_helem->data.value =
           data_create_func(source_helem->data.value);
+      dest_helem->hashcode = source_helem->hashcode;
       if (source_helem->next_less != NULL) {
         dest_helem->next_less = create_helem(source_helem->next_less,
             key_create_func, data_create_func, err_info);
@@ -486,6 +723,216 @@ static inline const_rtlHashElemType get_hash_elem (const const_rtlHashType curr_
 
 
 
+/**
+ *  Search the element with the key 'aKey' in the flat hash map 'aHashMap'.
+ *  A flat hash map uses open addressing with linear probing. Elements
+ *  are placed with Robin Hood hashing: The control byte of a used
+ *  slot contains the distance from the home slot of the element plus 1.
+ *  The search can stop as soon as a slot with a smaller distance is
+ *  found. Keys are compared with their genericValue.
+ *  @return the element with the key 'aKey', or
+ *          NULL if 'aHashMap' does not have an element with this key.
+ */
+static rtlFlatHashElemType flat_find (const const_rtlHashType aHashMap,
+    const genericType aKey)
+
+  {
+    const unsigned char *control;
+    unsigned int pos;
+    unsigned int distance;
+
+  /* flat_find */
+    if (aHashMap->size != 0) {
+      control = aHashMap->flat_control;
+      pos = FLAT_HOME(aHashMap, aKey);
+      distance = 1;
+      while (control[pos] >= distance) {
+        if (control[pos] == distance &&
+            aHashMap->flat_table[pos].key.value.genericValue == aKey) {
+          return &aHashMap->flat_table[pos];
+        } /* if */
+        pos = (pos + 1) & aHashMap->mask;
+        distance++;
+      } /* while */
+    } /* if */
+    return NULL;
+  } /* flat_find */
+
+
+
+/**
+ *  Place 'element' in the table of the flat hash map 'aHashMap'.
+ *  The key of 'element' must not be present in 'aHashMap' and the
+ *  table must have a free slot. Elements with a smaller distance
+ *  from their home slot are moved towards the next free slot.
+ *  @return TRUE if 'element' has been placed, or
+ *          FALSE if the distance from the home slot would be too
+ *          big. In this case the table is not changed.
+ */
+static boolType flat_place (const rtlHashType aHashMap,
+    rtlFlatHashElemRecord element)
+
+  {
+    unsigned char *control;
+    unsigned int pos;
+    unsigned int distance;
+    unsigned int swapDistance;
+    rtlFlatHashElemRecord swapElement;
+
+  /* flat_place */
+    control = aHashMap->flat_control;
+    pos = FLAT_HOME(aHashMap, element.key.value.genericValue);
+    /* Moving elements never increases the distance beyond the */
+    /* number of slots between the home slot and a free slot.  */
+    distance = 1;
+    while (control[pos] != 0) {
+      if (distance >= FLAT_MAX_DISTANCE) {
+        return FALSE;
+      } /* if */
+      pos = (pos + 1) & aHashMap->mask;
+      distance++;
+    } /* while */
+    pos = FLAT_HOME(aHashMap, element.key.value.genericValue);
+    distance = 1;
+    while (control[pos] != 0) {
+      if (control[pos] < distance) {
+        swapElement = aHashMap->flat_table[pos];
+        swapDistance = control[pos];
+        aHashMap->flat_table[pos] = element;
+        control[pos] = (unsigned char) distance;
+        element = swapElement;
+        distance = swapDistance;
+      } /* if */
+      pos = (pos + 1) & aHashMap->mask;
+      distance++;
+    } /* while */
+    aHashMap->flat_table[pos] = element;
+    control[pos] = (unsigned char) distance;
+    return TRUE;
+  } /* flat_place */
+
+
+
+/**
+ *  Remove the element at the position 'pos' from 'aHashMap'.
+ *  The following elements, which are not at their home slot,
+ *  are shifted back by one slot. This way no tombstones are needed.
+ */
+static void flat_remove (const rtlHashType aHashMap, unsigned int pos)
+
+  {
+    unsigned char *control;
+    unsigned int next;
+
+  /* flat_remove */
+    control = aHashMap->flat_control;
+    next = (pos + 1) & aHashMap->mask;
+    while (control[next] > 1) {
+      aHashMap->flat_table[pos] = aHashMap->flat_table[next];
+      control[pos] = (unsigned char) (control[next] - 1);
+      pos = next;
+      next = (next + 1) & aHashMap->mask;
+    } /* while */
+    control[pos] = 0;
+  } /* flat_remove */
+
+
+
+/**
+ *  Move the elements of 'aHashMap' to a new table with 2 ** bits slots.
+ *  If a probe sequence in the new table would be too long
+ *  a table with more slots is used.
+ *  @return TRUE if the table has been resized, or
+ *          FALSE if there is not enough memory. In this
+ *          case 'aHashMap' is not changed.
+ */
+static boolType flat_resize (const rtlHashType aHashMap, unsigned int bits)
+
+  {
+    rtlFlatHashElemType old_table;
+    unsigned char *old_control;
+    unsigned int old_bits;
+    unsigned int old_size;
+    rtlFlatHashElemType new_table;
+    unsigned int number;
+    boolType okay = FALSE;
+
+  /* flat_resize */
+    logFunction(printf("flat_resize(" FMT_X_MEM ", %u)\n",
+                       (memSizeType) aHashMap, bits););
+    old_table = aHashMap->flat_table;
+    old_control = aHashMap->flat_control;
+    old_bits = aHashMap->bits;
+    old_size = aHashMap->table_size;
+    while (!okay && bits <= FLAT_MAX_BITS &&
+           ALLOC_RTL_FLAT_TABLE(new_table, TABLE_SIZE(bits))) {
+      aHashMap->bits = bits;
+      aHashMap->mask = TABLE_MASK(bits);
+      aHashMap->table_size = TABLE_SIZE(bits);
+      aHashMap->flat_table = new_table;
+      aHashMap->flat_control = (unsigned char *) &new_table[aHashMap->table_size];
+      memset(aHashMap->flat_control, 0, aHashMap->table_size);
+      okay = TRUE;
+      for (number = 0; okay && number < old_size; number++) {
+        if (old_control[number] != 0) {
+          okay = flat_place(aHashMap, old_table[number]);
+        } /* if */
+      } /* for */
+      if (!okay) {
+        FREE_RTL_FLAT_TABLE(new_table, TABLE_SIZE(bits));
+        bits++;
+      } /* if */
+    } /* while */
+    if (okay) {
+      if (old_table != NULL) {
+        FREE_RTL_FLAT_TABLE(old_table, old_size);
+      } /* if */
+    } else {
+      aHashMap->bits = old_bits;
+      aHashMap->mask = old_size != 0 ? TABLE_MASK(old_bits) : 0;
+      aHashMap->table_size = old_size;
+      aHashMap->flat_table = old_table;
+      aHashMap->flat_control = old_control;
+    } /* if */
+    logFunction(printf("flat_resize --> %d (table_size=%u)\n",
+                       okay, aHashMap->table_size););
+    return okay;
+  } /* flat_resize */
+
+
+
+/**
+ *  Add an element with 'aKey' and 'data' to the flat hash map 'aHashMap'.
+ *  The key 'aKey' must not be present in 'aHashMap'. The table is
+ *  doubled before it gets too full.
+ *  @return TRUE if the element has been added, or
+ *          FALSE if there is not enough memory.
+ */
+static boolType flat_add (const rtlHashType aHashMap, const rtlValueUnion aKey,
+    const rtlValueUnion data)
+
+  {
+    rtlFlatHashElemRecord element;
+
+  /* flat_add */
+    if (FLAT_TOO_FULL(aHashMap) &&
+        !flat_resize(aHashMap, aHashMap->table_size == 0 ?
+                               FLAT_MIN_BITS : aHashMap->bits + 1)) {
+      return FALSE;
+    } /* if */
+    element.key.value = aKey;
+    element.data.value = data;
+    while (!flat_place(aHashMap, element)) {
+      if (!flat_resize(aHashMap, aHashMap->bits + 1)) {
+        return FALSE;
+      } /* if */
+    } /* while */
+    aHashMap->size++;
+    return TRUE;
+  } /* flat_add */
+
+
+
 #ifdef OUT_OF_ORDER
 static void dump_helem (const_rtlHashElemType curr_helem)
 
@@ -551,7 +998,7 @@ boolType hashAdd (const rtlHashType aHashMap, const rtlValueUnion aKey,
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = new_helem(
-          aKey, data, key_create_func, data_create_func, &err_info);
+          aKey, data, hashcode, key_create_func, data_create_func, &err_info);
       /*
       hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
       printf("aKey=%llX\n", (unsigned long long) aKey);
@@ -565,7 +1012,7 @@ boolType hashAdd (const rtlHashType aHashMap, const rtlValueUnion aKey,
         cmp = cmp_func(hashelem->key.value, aKey);
         if (cmp < 0) {
           if (hashelem->next_less == NULL) {
-            hashelem->next_less = new_helem(aKey, data,
+            hashelem->next_less = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -578,7 +1025,7 @@ boolType hashAdd (const rtlHashType aHashMap, const rtlValueUnion aKey,
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            hashelem->next_greater = new_helem(aKey, data,
+            hashelem->next_greater = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -592,6 +1039,8 @@ boolType hashAdd (const rtlHashType aHashMap, const rtlValueUnion aKey,
       if (err_info == MEMORY_ERROR) {
         aHashMap->size--;
       } /* if */
+    } else if (HASH_TOO_FULL(aHashMap)) {
+      grow_hash(aHashMap);
     } /* if */
     logFunction(printf("hashAdd(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U_GEN ", " FMT_U ") size=" FMT_U_MEM " --> %d\n",
@@ -720,6 +1169,26 @@ printf("%lX\n", (long unsigned) aKey);
 
 
 
+/**
+ *  Determine if 'aKey' is an element of the flat hash map 'aHashMap'.
+ *  @return TRUE if 'aKey' is an element of 'aHashMap',
+ *          FALSE otherwise.
+ */
+boolType hshContainsFlat (const const_rtlHashType aHashMap, const rtlValueUnion aKey)
+
+  {
+    boolType result;
+
+  /* hshContainsFlat */
+    logFunction(printf("hshContainsFlat(" FMT_X_MEM ", " FMT_U_GEN ")\n",
+                       (memSizeType) aHashMap, aKey.genericValue););
+    result = flat_find(aHashMap, aKey.genericValue) != NULL;
+    logFunction(printf("hshContainsFlat --> %d\n", result););
+    return result;
+  } /* hshContainsFlat */
+
+
+
 /**
  *  Assign source to *dest.
  *  A copy function assumes that *dest contains a legal value.
@@ -757,6 +1226,57 @@ void hshCpy (rtlHashType *const dest, const const_rtlHashType source,
 
 
 
+/**
+ *  Assign source to *dest.
+ *  Keys and values of flat hash maps are simple values.
+ *  Therefore the table of source is copied with memcpy().
+ *  @exception MEMORY_ERROR Not enough memory to create dest.
+ */
+void hshCpyFlat (rtlHashType *const dest, const const_rtlHashType source)
+
+  {
+    rtlHashType dest_hash;
+    rtlFlatHashElemType new_table;
+
+  /* hshCpyFlat */
+    logFunction(printf("hshCpyFlat(" FMT_X_MEM ", " FMT_X_MEM ")\n",
+                       (memSizeType) *dest, (memSizeType) source););
+    dest_hash = *dest;
+    /* The following check avoids an error for: aHash := aHash; */
+    if (dest_hash != source) {
+      if (dest_hash->table_size != source->table_size) {
+        if (source->table_size == 0) {
+          new_table = NULL;
+        } else if (unlikely(!ALLOC_RTL_FLAT_TABLE(new_table, source->table_size))) {
+          raise_error(MEMORY_ERROR);
+          return;
+        } /* if */
+        if (dest_hash->flat_table != NULL) {
+          FREE_RTL_FLAT_TABLE(dest_hash->flat_table, dest_hash->table_size);
+        } /* if */
+        dest_hash->table_size = source->table_size;
+        dest_hash->flat_table = new_table;
+        if (new_table == NULL) {
+          dest_hash->flat_control = NULL;
+        } else {
+          dest_hash->flat_control =
+              (unsigned char *) &new_table[source->table_size];
+        } /* if */
+      } /* if */
+      dest_hash->bits = source->bits;
+      dest_hash->mask = source->mask;
+      dest_hash->size = source->size;
+      if (source->table_size != 0) {
+        /* The control bytes follow the elements and are copied too. */
+        memcpy(dest_hash->flat_table, source->flat_table,
+               SIZ_RTL_FLAT_TAB(source->table_size));
+      } /* if */
+    } /* if */
+    logFunction(printf("hshCpyFlat -->\n"););
+  } /* hshCpyFlat */
+
+
+
 /**
  *  Return a copy of source, that can be assigned to a new destination.
  *  It is assumed that the destination of the assignment is undefined.
@@ -789,6 +1309,49 @@ rtlHashType hshCreate (const const_rtlHashType source,
 
 
 
+/**
+ *  Return a copy of the flat hash map source.
+ *  @return a copy of source.
+ *  @exception MEMORY_ERROR Not enough memory to represent the result.
+ */
+rtlHashType hshCreateFlat (const const_rtlHashType source)
+
+  {
+    rtlHashType result;
+
+  /* hshCreateFlat */
+    logFunction(printf("hshCreateFlat(" FMT_X_MEM ")\n",
+                       (memSizeType) source););
+    if (unlikely(!ALLOC_RTL_FLAT_HASH(result))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->bits = source->bits;
+      result->mask = source->mask;
+      result->table_size = source->table_size;
+      result->size = source->size;
+      result->table = NULL;
+      if (source->table_size == 0) {
+        result->flat_table = NULL;
+        result->flat_control = NULL;
+      } else if (unlikely(!ALLOC_RTL_FLAT_TABLE(result->flat_table,
+                                                source->table_size))) {
+        FREE_RTL_FLAT_HASH(result);
+        result = NULL;
+        raise_error(MEMORY_ERROR);
+      } else {
+        result->flat_control =
+            (unsigned char *) &result->flat_table[source->table_size];
+        memcpy(result->flat_table, source->flat_table,
+               SIZ_RTL_FLAT_TAB(source->table_size));
+      } /* if */
+    } /* if */
+    logFunction(printf("hshCreateFlat --> " FMT_X_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* hshCreateFlat */
+
+
+
 /**
  *  Free the memory referred by 'old_hash'.
  *  After hshDestr is left 'old_hash' refers to not existing memory.
@@ -805,6 +1368,24 @@ void hshDestr (const const_rtlHashType old_hash,
 
 
 
+/**
+ *  Free the memory referred by the flat hash map 'old_hash'.
+ */
+void hshDestrFlat (const const_rtlHashType old_hash)
+
+  { /* hshDestrFlat */
+    logFunction(printf("hshDestrFlat(" FMT_X_MEM ")\n", (memSizeType) old_hash););
+    if (old_hash != NULL) {
+      if (old_hash->flat_table != NULL) {
+        FREE_RTL_FLAT_TABLE(old_hash->flat_table, old_hash->table_size);
+      } /* if */
+      FREE_RTL_FLAT_HASH(old_hash);
+    } /* if */
+    logFunction(printf("hshDestrFlat -->\n"););
+  } /* hshDestrFlat */
+
+
+
 /**
  *  Create an empty hash table.
  *  @return an empty hash table.
@@ -828,6 +1409,37 @@ rtlHashType hshEmpty (void)
 
 
 
+/**
+ *  Create an empty flat hash map.
+ *  The table is allocated when the first element is added.
+ *  @return an empty flat hash map.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ */
+rtlHashType hshEmptyFlat (void)
+
+  {
+    rtlHashType result;
+
+  /* hshEmptyFlat */
+    logFunction(printf("hshEmptyFlat()\n"););
+    if (unlikely(!ALLOC_RTL_FLAT_HASH(result))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->bits = 0;
+      result->mask = 0;
+      result->table_size = 0;
+      result->size = 0;
+      result->table = NULL;
+      result->flat_table = NULL;
+      result->flat_control = NULL;
+    } /* if */
+    logFunction(printf("hshEmptyFlat --> " FMT_X_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* hshEmptyFlat */
+
+
+
 /**
  *  Remove the element with the key 'aKey' from the hash map 'aHashMap'.
  */
@@ -873,6 +1485,9 @@ void hshExclGeneric (const rtlHashType aHashMap, const genericType aKey,
         hashelem = hashelem->next_greater;
       } /* if */
     } /* while */
+    if (HASH_TOO_EMPTY(aHashMap)) {
+      shrink_hash(aHashMap, NULL);
+    } /* if */
     logFunction(printf("hshExclGeneric(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U ") size=" FMT_U_MEM " -->\n",
                        (memSizeType) aHashMap, aKey, hashcode, aHashMap->size););
@@ -932,6 +1547,9 @@ void hshExcl (const rtlHashType aHashMap, const rtlValueUnion aKey,
         hashelem = hashelem->next_greater;
       } /* if */
     } /* while */
+    if (HASH_TOO_EMPTY(aHashMap)) {
+      shrink_hash(aHashMap, cmp_func);
+    } /* if */
     logFunction(printf("hshExcl(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U ") size=" FMT_U_MEM " -->\n",
                        (memSizeType) aHashMap, aKey.genericValue,
@@ -940,6 +1558,32 @@ void hshExcl (const rtlHashType aHashMap, const rtlValueUnion aKey,
 
 
 
+/**
+ *  Remove the element with the key 'aKey' from the flat hash map 'aHashMap'.
+ */
+void hshExclFlat (const rtlHashType aHashMap, const rtlValueUnion aKey)
+
+  {
+    rtlFlatHashElemType element;
+
+  /* hshExclFlat */
+    logFunction(printf("hshExclFlat(" FMT_X_MEM ", " FMT_U_GEN ")\n",
+                       (memSizeType) aHashMap, aKey.genericValue););
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (element != NULL) {
+      flat_remove(aHashMap, (unsigned int) (element - aHashMap->flat_table));
+      aHashMap->size--;
+      if (FLAT_TOO_EMPTY(aHashMap)) {
+        /* If there is not enough memory the table keeps its size. */
+        flat_resize(aHashMap, aHashMap->bits - 1);
+      } /* if */
+    } /* if */
+    logFunction(printf("hshExclFlat --> (size=" FMT_U_MEM ")\n",
+                       aHashMap->size););
+  } /* hshExclFlat */
+
+
+
 rtlHashType hshGenHash (rtlHashElemType keyValuePairs,
     const hashCodeFuncType key_hash_code_func, const compareFuncType cmp_func,
     const destrFuncType key_destr_func, const destrFuncType data_destr_func)
@@ -966,6 +1610,7 @@ rtlHashType hshGenHash (rtlHashElemType keyValuePairs,
         currentKeyValue->next_greater = NULL;
         hashCode = (unsigned int) key_hash_code_func(
             currentKeyValue->key.value);
+        currentKeyValue->hashcode = hashCode;
         hashElem = aHashMap->table[hashCode & aHashMap->mask];
         if (hashElem == NULL) {
           aHashMap->table[hashCode & aHashMap->mask] = currentKeyValue;
@@ -1000,6 +1645,9 @@ rtlHashType hshGenHash (rtlHashElemType keyValuePairs,
             } /* if */
           } while (hashElem != NULL);
         } /* if */
+        if (HASH_TOO_FULL(aHashMap)) {
+          grow_hash(aHashMap);
+        } /* if */
       } /* while */
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         free_hash(aHashMap, key_destr_func, data_destr_func);
@@ -1012,6 +1660,50 @@ rtlHashType hshGenHash (rtlHashElemType keyValuePairs,
 
 
 
+/**
+ *  Create a flat hash map from the list 'keyValuePairs'.
+ *  The elements of the list are freed.
+ *  @return the new flat hash map.
+ *  @exception RANGE_ERROR If a key is used twice.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ */
+rtlHashType hshGenHashFlat (rtlHashElemType keyValuePairs)
+
+  {
+    rtlHashElemType currentKeyValue;
+    errInfoType err_info = OKAY_NO_ERROR;
+    rtlHashType aHashMap;
+
+  /* hshGenHashFlat */
+    logFunction(printf("hshGenHashFlat(" FMT_X_MEM ")\n",
+                       (memSizeType) keyValuePairs););
+    aHashMap = hshEmptyFlat();
+    while (keyValuePairs != NULL) {
+      currentKeyValue = keyValuePairs;
+      keyValuePairs = keyValuePairs->next_greater;
+      if (aHashMap != NULL && err_info == OKAY_NO_ERROR) {
+        if (flat_find(aHashMap, currentKeyValue->key.value.genericValue) != NULL) {
+          logError(printf("hshGenHashFlat: A key is used twice.\n"););
+          err_info = RANGE_ERROR;
+        } else if (unlikely(!flat_add(aHashMap, currentKeyValue->key.value,
+                                      currentKeyValue->data.value))) {
+          err_info = MEMORY_ERROR;
+        } /* if */
+      } /* if */
+      FREE_RECORD(currentKeyValue, rtlHashElemRecord, count.rtl_helem);
+    } /* while */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      hshDestrFlat(aHashMap);
+      raise_error(err_info);
+      aHashMap = NULL;
+    } /* if */
+    logFunction(printf("hshGenHashFlat --> " FMT_X_MEM "\n",
+                       (memSizeType) aHashMap););
+    return aHashMap;
+  } /* hshGenHashFlat */
+
+
+
 rtlHashElemType hshGenKeyValue (const rtlValueUnion aKey, const rtlValueUnion aValue)
 
   {
@@ -1084,6 +1776,39 @@ rtlValueUnion hshIdx (const const_rtlHashType aHashMap,
 
 
 
+/**
+ *  Access one value from the flat hash map 'aHashMap'.
+ *  @return the element with the key 'aKey' from 'aHashMap'.
+ *  @exception INDEX_ERROR If 'aHashMap' does not have an element
+ *             with the key 'aKey'.
+ */
+rtlValueUnion hshIdxFlat (const const_rtlHashType aHashMap,
+    const rtlValueUnion aKey)
+
+  {
+    rtlFlatHashElemType element;
+    rtlValueUnion result;
+
+  /* hshIdxFlat */
+    logFunction(printf("hshIdxFlat(" FMT_X_MEM ", " FMT_U_GEN ")\n",
+                       (memSizeType) aHashMap, aKey.genericValue););
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (unlikely(element == NULL)) {
+      logError(printf("hshIdxFlat(" FMT_X_MEM ", " FMT_U_GEN "): "
+                      "Hashmap does not have an element with the key.\n",
+                      (memSizeType) aHashMap, aKey.genericValue););
+      raise_error(INDEX_ERROR);
+      result.genericValue = 0;
+    } else {
+      result = element->data.value;
+    } /* if */
+    logFunction(printf("hshIdxFlat --> " FMT_U_GEN "\n",
+                       result.genericValue););
+    return result;
+  } /* hshIdxFlat */
+
+
+
 /**
  *  Determine the address of a value from the hash table 'aHashMap'.
  *  @return the address of the element with the key 'aKey' from 'aHashMap'.
@@ -1134,6 +1859,39 @@ rtlObjectType *hshIdxAddr (const const_rtlHashType aHashMap,
 
 
 
+/**
+ *  Determine the address of a value from the flat hash map 'aHashMap'.
+ *  @return the address of the element with the key 'aKey' from 'aHashMap'.
+ *  @exception INDEX_ERROR If 'aHashMap' does not have an element
+ *             with the key 'aKey'.
+ */
+rtlObjectType *hshIdxAddrFlat (const const_rtlHashType aHashMap,
+    const rtlValueUnion aKey)
+
+  {
+    rtlFlatHashElemType element;
+    rtlObjectType *result;
+
+  /* hshIdxAddrFlat */
+    logFunction(printf("hshIdxAddrFlat(" FMT_X_MEM ", " FMT_U_GEN ")\n",
+                       (memSizeType) aHashMap, aKey.genericValue););
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (unlikely(element == NULL)) {
+      logError(printf("hshIdxAddrFlat(" FMT_X_MEM ", " FMT_U_GEN "): "
+                      "Hashmap does not have an element with the key.\n",
+                      (memSizeType) aHashMap, aKey.genericValue););
+      raise_error(INDEX_ERROR);
+      result = NULL;
+    } else {
+      result = &element->data;
+    } /* if */
+    logFunction(printf("hshIdxAddrFlat --> " FMT_U_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* hshIdxAddrFlat */
+
+
+
 /**
  *  Determine the address of a value from the hash table 'aHashMap'.
  *  @return the address of the element with the key 'aKey' from 'aHashMap' or
@@ -1179,6 +1937,34 @@ rtlObjectType *hshIdxAddr2 (const const_rtlHashType aHashMap,
 
 
 
+/**
+ *  Determine the address of a value from the flat hash map 'aHashMap'.
+ *  @return the address of the element with the key 'aKey' from 'aHashMap' or
+ *          NULL if 'aHashMap' does not have an element with the key 'aKey'.
+ */
+rtlObjectType *hshIdxAddr2Flat (const const_rtlHashType aHashMap,
+    const rtlValueUnion aKey)
+
+  {
+    rtlFlatHashElemType element;
+    rtlObjectType *result;
+
+  /* hshIdxAddr2Flat */
+    logFunction(printf("hshIdxAddr2Flat(" FMT_X_MEM ", " FMT_U_GEN ")\n",
+                       (memSizeType) aHashMap, aKey.genericValue););
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (element != NULL) {
+      result = &element->data;
+    } else {
+      result = NULL;
+    } /* if */
+    logFunction(printf("hshIdxAddr2Flat --> " FMT_U_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* hshIdxAddr2Flat */
+
+
+
 void hshSetGeneric (const const_rtlHashType aHashMap,
     const genericType aKey, intType hashcode,
     const genericType newValue)
@@ -1242,15 +2028,16 @@ genericType hshIdxEnterGeneric (const rtlHashType aHashMap,
                        (memSizeType) aHashMap, aKey, defaultData, hashcode););
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
-      result_hashelem = new_helem_generic(aKey, defaultData, &err_info);
+      result_hashelem = new_helem_generic(aKey, defaultData, hashcode,
+                                          &err_info);
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = result_hashelem;
       aHashMap->size++;
     } else {
       do {
         if (hashelem->key.value.genericValue < aKey) {
           if (hashelem->next_less == NULL) {
-            result_hashelem = new_helem_generic(aKey, defaultData,
-                                                &err_info);
+            result_hashelem = new_helem_generic(aKey, defaultData, hashcode,
+                                          &err_info);
             hashelem->next_less = result_hashelem;
             aHashMap->size++;
             hashelem = NULL;
@@ -1262,8 +2049,8 @@ genericType hshIdxEnterGeneric (const rtlHashType aHashMap,
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            result_hashelem = new_helem_generic(aKey, defaultData,
-                                                &err_info);
+            result_hashelem = new_helem_generic(aKey, defaultData, hashcode,
+                                          &err_info);
             hashelem->next_greater = result_hashelem;
             aHashMap->size++;
             hashelem = NULL;
@@ -1279,6 +2066,9 @@ genericType hshIdxEnterGeneric (const rtlHashType aHashMap,
       result = 0;
     } else {
       result = result_hashelem->data.value.genericValue;
+      if (HASH_TOO_FULL(aHashMap)) {
+        grow_hash(aHashMap);
+      } /* if */
     } /* if */
     logFunction(printf("hshIdxEnterGeneric(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U_GEN ", " FMT_U ") --> " FMT_U_GEN "\n",
@@ -1443,7 +2233,7 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = new_helem(
-          aKey, data, key_create_func, data_create_func, &err_info);
+          aKey, data, hashcode, key_create_func, data_create_func, &err_info);
       /*
       hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
       printf("aKey=%llX\n", (unsigned long long) aKey);
@@ -1457,7 +2247,7 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
         cmp = cmp_func(hashelem->key.value, aKey);
         if (cmp < 0) {
           if (hashelem->next_less == NULL) {
-            hashelem->next_less = new_helem(aKey, data,
+            hashelem->next_less = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1469,7 +2259,7 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            hashelem->next_greater = new_helem(aKey, data,
+            hashelem->next_greater = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1482,6 +2272,8 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
     if (unlikely(err_info != OKAY_NO_ERROR)) {
       aHashMap->size--;
       raise_error(MEMORY_ERROR);
+    } else if (HASH_TOO_FULL(aHashMap)) {
+      grow_hash(aHashMap);
     } /* if */
     logFunction(printf("hshIncl(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U_GEN ", " FMT_U ") size=" FMT_U_MEM " -->\n",
@@ -1491,6 +2283,35 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
 
 
 
+/**
+ *  Add 'data' with the key 'aKey' to the flat hash map 'aHashMap'.
+ *  If an element with the key 'aKey' already exists,
+ *  it is overwritten with 'data'.
+ *  @exception MEMORY_ERROR If there is not enough memory.
+ */
+void hshInclFlat (const rtlHashType aHashMap, const rtlValueUnion aKey,
+    const rtlValueUnion data)
+
+  {
+    rtlFlatHashElemType element;
+
+  /* hshInclFlat */
+    logFunction(printf("hshInclFlat(" FMT_X_MEM ", " FMT_U_GEN ", "
+                       FMT_U_GEN ") size=" FMT_U_MEM "\n",
+                       (memSizeType) aHashMap, aKey.genericValue,
+                       data.genericValue, aHashMap->size););
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (element != NULL) {
+      element->data.value = data;
+    } else if (unlikely(!flat_add(aHashMap, aKey, data))) {
+      raise_error(MEMORY_ERROR);
+    } /* if */
+    logFunction(printf("hshInclFlat --> (size=" FMT_U_MEM ")\n",
+                       aHashMap->size););
+  } /* hshInclFlat */
+
+
+
 /**
  *  Obtain the keys of the hash map 'aHashMap'.
  *  @return the keys of the hash map.
@@ -1508,6 +2329,37 @@ rtlArrayType hshKeys (const const_rtlHashType aHashMap,
 
 
 
+/**
+ *  Obtain the keys of the flat hash map 'aHashMap'.
+ *  @return the keys of the hash map.
+ */
+rtlArrayType hshKeysFlat (const const_rtlHashType aHashMap)
+
+  {
+    memSizeType arr_pos = 0;
+    unsigned int number;
+    rtlArrayType key_array;
+
+  /* hshKeysFlat */
+    if (unlikely(aHashMap->size > INTTYPE_MAX ||
+                 !ALLOC_RTL_ARRAY(key_array, aHashMap->size))) {
+      raise_error(MEMORY_ERROR);
+      key_array = NULL;
+    } else {
+      key_array->min_position = 1;
+      key_array->max_position = (intType) aHashMap->size;
+      for (number = 0; arr_pos < aHashMap->size; number++) {
+        if (aHashMap->flat_control[number] != 0) {
+          key_array->arr[arr_pos] = aHashMap->flat_table[number].key;
+          arr_pos++;
+        } /* if */
+      } /* for */
+    } /* if */
+    return key_array;
+  } /* hshKeysFlat */
+
+
+
 /**
  *  Compute pseudo-random hash table element from 'aHashMap'.
  *  The hash table element contains key and value.
@@ -1543,6 +2395,40 @@ const_rtlHashElemType hshRand (const const_rtlHashType aHashMap)
 
 
 
+/**
+ *  Compute pseudo-random element from the flat hash map 'aHashMap'.
+ *  Random slots are tried until a used slot is found. Since at least
+ *  1/8 of the slots are used this needs 8 tries at most on average.
+ *  @return a random element such that hshRandFlat(aHashMap) in aHashMap holds.
+ *  @exception RANGE_ERROR If 'aHashMap' is empty.
+ */
+const_rtlFlatHashElemType hshRandFlat (const const_rtlHashType aHashMap)
+
+  {
+    unsigned int pos;
+    const_rtlFlatHashElemType result;
+
+  /* hshRandFlat */
+    logFunction(printf("hshRandFlat(" FMT_U_MEM ")\n",
+                       (memSizeType) aHashMap););
+    if (unlikely(aHashMap->size == 0)) {
+      logError(printf("hshRandFlat(): Hash map is empty.\n"););
+      raise_error(RANGE_ERROR);
+      return NULL;
+    } else {
+      do {
+        pos = (unsigned int) intRand((intType) 0,
+                                     (intType) aHashMap->mask);
+      } while (aHashMap->flat_control[pos] == 0);
+      result = &aHashMap->flat_table[pos];
+    } /* if */
+    logFunction(printf("hshRandFlat --> " FMT_U_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* hshRandFlat */
+
+
+
 /**
  *  Add 'data' with the key 'aKey' to the hash map 'aHashMap'.
  *  If an element with the key 'aKey' already exists,
@@ -1572,7 +2458,7 @@ rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = new_helem(
-          aKey, data, key_create_func, data_create_func, &err_info);
+          aKey, data, hashcode, key_create_func, data_create_func, &err_info);
       aHashMap->size++;
       result = data;
     } else {
@@ -1580,7 +2466,7 @@ rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
         cmp = cmp_func(hashelem->key.value, aKey);
         if (cmp < 0) {
           if (hashelem->next_less == NULL) {
-            hashelem->next_less = new_helem(aKey, data,
+            hashelem->next_less = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             result = data;
@@ -1594,7 +2480,7 @@ rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            hashelem->next_greater = new_helem(aKey, data,
+            hashelem->next_greater = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             result = data;
@@ -1608,6 +2494,8 @@ rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
     if (unlikely(err_info != OKAY_NO_ERROR)) {
       aHashMap->size--;
       raise_error(MEMORY_ERROR);
+    } else if (HASH_TOO_FULL(aHashMap)) {
+      grow_hash(aHashMap);
     } /* if */
     logFunction(printf("hshUpdate(" FMT_X_MEM ", " FMT_U_GEN ", "
                        FMT_U_GEN ", " FMT_U ") size=" FMT_U_MEM " -->\n",
@@ -1618,6 +2506,41 @@ rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
 
 
 
+/**
+ *  Add 'data' with the key 'aKey' to the flat hash map 'aHashMap'.
+ *  If an element with the key 'aKey' already exists,
+ *  it is overwritten with 'data'.
+ *  @return the old element with the key 'aKey' or
+ *          the new data value if no old element existed.
+ *  @exception MEMORY_ERROR If there is not enough memory.
+ */
+rtlValueUnion hshUpdateFlat (const rtlHashType aHashMap,
+    const rtlValueUnion aKey, const rtlValueUnion data)
+
+  {
+    rtlFlatHashElemType element;
+    rtlValueUnion result;
+
+  /* hshUpdateFlat */
+    logFunction(printf("hshUpdateFlat(" FMT_X_MEM ", " FMT_U_GEN ", "
+                       FMT_U_GEN ") size=" FMT_U_MEM "\n",
+                       (memSizeType) aHashMap, aKey.genericValue,
+                       data.genericValue, aHashMap->size););
+    result = data;
+    element = flat_find(aHashMap, aKey.genericValue);
+    if (element != NULL) {
+      result = element->data.value;
+      element->data.value = data;
+    } else if (unlikely(!flat_add(aHashMap, aKey, data))) {
+      raise_error(MEMORY_ERROR);
+    } /* if */
+    logFunction(printf("hshUpdateFlat --> " FMT_U_GEN " (size=" FMT_U_MEM ")\n",
+                       result.genericValue, aHashMap->size););
+    return result;
+  } /* hshUpdateFlat */
+
+
+
 /**
  *  Obtain the values of the hash map 'aHashMap'.
  *  @return the values of the hash map.
@@ -1632,3 +2555,34 @@ rtlArrayType hshValues (const const_rtlHashType aHashMap,
     value_array = values_hash(aHashMap, value_create_func);
     return value_array;
   } /* hshValues */
+
+
+
+/**
+ *  Obtain the values of the flat hash map 'aHashMap'.
+ *  @return the values of the hash map.
+ */
+rtlArrayType hshValuesFlat (const const_rtlHashType aHashMap)
+
+  {
+    memSizeType arr_pos = 0;
+    unsigned int number;
+    rtlArrayType value_array;
+
+  /* hshValuesFlat */
+    if (unlikely(aHashMap->size > INTTYPE_MAX ||
+                 !ALLOC_RTL_ARRAY(value_array, aHashMap->size))) {
+      raise_error(MEMORY_ERROR);
+      value_array = NULL;
+    } else {
+      value_array->min_position = 1;
+      value_array->max_position = (intType) aHashMap->size;
+      for (number = 0; arr_pos < aHashMap->size; number++) {
+        if (aHashMap->flat_control[number] != 0) {
+          value_array->arr[arr_pos] = aHashMap->flat_table[number].data;
+          arr_pos++;
+        } /* if */
+      } /* for */
+    } /* if */
+    return value_array;
+  } /* hshValuesFlat */
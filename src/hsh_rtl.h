@@ -42,41 +42,55 @@ boolType hshContainsGeneric (const const_rtlHashType aHashMap,
 boolType hshContains (const const_rtlHashType aHashMap,
                       const rtlValueUnion aKey, intType hashcode,
                       const compareFuncType cmp_func);
+boolType hshContainsFlat (const const_rtlHashType aHashMap,
+                          const rtlValueUnion aKey);
 void hshCpy (rtlHashType *const dest, const const_rtlHashType source,
              const createFuncType key_create_func,
              const destrFuncType key_destr_func,
              const createFuncType data_create_func,
              const destrFuncType data_destr_func);
+void hshCpyFlat (rtlHashType *const dest, const const_rtlHashType source);
 rtlHashType hshCreate (const const_rtlHashType source,
                        const createFuncType key_create_func,
                        const destrFuncType key_destr_func,
                        const createFuncType data_create_func,
                        const destrFuncType data_destr_func);
+rtlHashType hshCreateFlat (const const_rtlHashType source);
 void hshDestr (const const_rtlHashType old_hash,
                const destrFuncType key_destr_func,
                const destrFuncType data_destr_func);
+void hshDestrFlat (const const_rtlHashType old_hash);
 rtlHashType hshEmpty (void);
+rtlHashType hshEmptyFlat (void);
 void hshExclGeneric (const rtlHashType hash1, const genericType key,
                      intType hashcode);
 void hshExcl (const rtlHashType aHashMap, const rtlValueUnion aKey,
               intType hashcode, const compareFuncType cmp_func,
               const destrFuncType key_destr_func,
               const destrFuncType data_destr_func);
+void hshExclFlat (const rtlHashType aHashMap, const rtlValueUnion aKey);
 rtlHashType hshGenHash (rtlHashElemType keyValuePairs,
                         const hashCodeFuncType key_hash_code_func,
                         const compareFuncType cmp_func,
                         const destrFuncType key_destr_func,
                         const destrFuncType data_destr_func);
+rtlHashType hshGenHashFlat (rtlHashElemType keyValuePairs);
 rtlHashElemType hshGenKeyValue (const rtlValueUnion aKey, const rtlValueUnion aValue);
 rtlValueUnion hshIdx (const const_rtlHashType aHashMap,
                       const rtlValueUnion aKey, intType hashcode,
                       const compareFuncType cmp_func);
+rtlValueUnion hshIdxFlat (const const_rtlHashType aHashMap,
+                          const rtlValueUnion aKey);
 rtlObjectType *hshIdxAddr (const const_rtlHashType aHashMap,
                            const rtlValueUnion aKey, intType hashcode,
                            const compareFuncType cmp_func);
+rtlObjectType *hshIdxAddrFlat (const const_rtlHashType aHashMap,
+                               const rtlValueUnion aKey);
 rtlObjectType *hshIdxAddr2 (const const_rtlHashType aHashMap,
                             const rtlValueUnion aKey, intType hashcode,
                             const compareFuncType cmp_func);
+rtlObjectType *hshIdxAddr2Flat (const const_rtlHashType aHashMap,
+                                const rtlValueUnion aKey);
 void hshSetGeneric (const const_rtlHashType aHashMap,
                     const genericType aKey, intType hashcode,
                     const genericType newValue);
@@ -103,15 +117,23 @@ void hshIncl (const rtlHashType aHashMap, const rtlValueUnion aKey,
               const createFuncType key_create_func,
               const createFuncType data_create_func,
               const copyFuncType data_copy_func);
+void hshInclFlat (const rtlHashType aHashMap, const rtlValueUnion aKey,
+                  const rtlValueUnion data);
 rtlArrayType hshKeys (const const_rtlHashType aHashMap,
                       const createFuncType key_create_func,
                       const destrFuncType key_destr_func);
+rtlArrayType hshKeysFlat (const const_rtlHashType aHashMap);
 const_rtlHashElemType hshRand (const const_rtlHashType aHashMap);
+const_rtlFlatHashElemType hshRandFlat (const const_rtlHashType aHashMap);
 rtlValueUnion hshUpdate (const rtlHashType aHashMap, const rtlValueUnion aKey,
                          const rtlValueUnion data, intType hashcode,
                          const compareFuncType cmp_func,
                          const createFuncType key_create_func,
                          const createFuncType data_create_func);
+rtlValueUnion hshUpdateFlat (const rtlHashType aHashMap,
+                             const rtlValueUnion aKey,
+                             const rtlValueUnion data);
 rtlArrayType hshValues (const const_rtlHashType aHashMap,
                         const createFuncType value_create_func,
                         const destrFuncType value_destr_func);
+rtlArrayType hshValuesFlat (const const_rtlHashType aHashMap);
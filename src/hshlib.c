@@ -55,9 +55,16 @@
 
 
 #define TABLE_BITS 10
+#define MAX_TABLE_BITS (INT_SIZE - 2)
 #define TABLE_SIZE(bits) ((unsigned int) 1 << (bits))
 #define TABLE_MASK(bits) (TABLE_SIZE(bits)-1)
 
+/* The table is doubled when there are more elements than slots.  */
+/* It is halved when less than a quarter of the slots would be    */
+/* used. A table never shrinks below TABLE_SIZE(TABLE_BITS).      */
+#define HASH_TOO_FULL(hash)  ((hash)->size > (hash)->table_size && (hash)->bits < MAX_TABLE_BITS)
+#define HASH_TOO_EMPTY(hash) ((hash)->bits > TABLE_BITS && (hash)->size < (hash)->table_size >> 2)
+
 typedef struct hashElemStruct *const hashElemType_const;
 
 
@@ -122,7 +129,7 @@ static void free_hash (hashType old_hash, objectType key_destr_func,
 
 
 
-static hashElemType new_helem (objectType key, objectType data,
+static hashElemType new_helem (objectType key, objectType data, intType hashcode,
     objectType key_create_func, objectType data_create_func, errInfoType *err_info)
 
   {
@@ -142,6 +149,7 @@ static hashElemType new_helem (objectType key, objectType data,
       param3_call(data_create_func, &helem->data, SYS_CREA_OBJECT, data);
       helem->next_less = NULL;
       helem->next_greater = NULL;
+      helem->hashcode = (unsigned int) hashcode;
     } /* if */
     return helem;
   } /* new_helem */
@@ -166,6 +174,212 @@ static hashType new_hash (unsigned int bits)
 
 
 
+/**
+ *  Convert the tree 'helem' to a list, which is sorted in search order.
+ *  The list is linked with next_greater and 'tail' is appended to it.
+ *  The number of elements in the tree is added to 'length'.
+ *  @return the head of the list.
+ */
+static hashElemType helem_to_list (hashElemType helem, hashElemType tail,
+    memSizeType *length)
+
+  {
+    hashElemType smaller;
+
+  /* helem_to_list */
+    while (helem != NULL) {
+      if (helem->next_less != NULL) {
+        tail = helem_to_list(helem->next_less, tail, length);
+      } /* if */
+      smaller = helem->next_greater;
+      helem->next_less = NULL;
+      helem->next_greater = tail;
+      tail = helem;
+      (*length)++;
+      helem = smaller;
+    } /* while */
+    return tail;
+  } /* helem_to_list */
+
+
+
+/**
+ *  Build a balanced tree from the first 'length' elements of '*list'.
+ *  The list must be sorted in search order (see helem_to_list).
+ *  Afterwards '*list' refers to the rest of the list.
+ *  @return the root of the tree.
+ */
+static hashElemType list_to_helem (hashElemType *list, memSizeType length)
+
+  {
+    hashElemType smaller;
+    hashElemType root;
+
+  /* list_to_helem */
+    if (length == 0) {
+      root = NULL;
+    } else {
+      smaller = list_to_helem(list, length >> 1);
+      root = *list;
+      *list = root->next_greater;
+      root->next_greater = smaller;
+      root->next_less = list_to_helem(list, length - (length >> 1) - 1);
+    } /* if */
+    return root;
+  } /* list_to_helem */
+
+
+
+/**
+ *  Merge two lists, which are sorted in search order.
+ *  @return the head of the merged list.
+ */
+static hashElemType merge_helem_lists (hashElemType list1, hashElemType list2,
+    objectType cmp_func)
+
+  {
+    hashElemType head = NULL;
+    hashElemType *insert_pos = &head;
+    objectType cmp_obj;
+    intType cmp;
+
+  /* merge_helem_lists */
+    while (list1 != NULL && list2 != NULL) {
+      cmp_obj = param3_call(cmp_func, &list1->key, &list2->key, cmp_func);
+      if (cmp_obj != NULL && CATEGORY_OF_OBJ(cmp_obj) == INTOBJECT) {
+        cmp = take_int(cmp_obj);
+        FREE_OBJECT(cmp_obj);
+      } else {
+        cmp = -1;
+      } /* if */
+      if (cmp < 0) {
+        *insert_pos = list1;
+        list1 = list1->next_greater;
+      } else {
+        *insert_pos = list2;
+        list2 = list2->next_greater;
+      } /* if */
+      insert_pos = &(*insert_pos)->next_greater;
+    } /* while */
+    if (list1 != NULL) {
+      *insert_pos = list1;
+    } else {
+      *insert_pos = list2;
+    } /* if */
+    return head;
+  } /* merge_helem_lists */
+
+
+
+/**
+ *  Double the number of slots in the table of 'aHashMap'.
+ *  Every slot is split into two slots, which is possible without
+ *  comparing keys. The trees of the new slots are balanced.
+ *  If there is not enough memory the table is left unchanged.
+ */
+static void grow_hash (hashType aHashMap)
+
+  {
+    unsigned int old_size;
+    unsigned int new_bits;
+    hashElemType *new_table;
+    unsigned int number;
+    hashElemType list;
+    hashElemType lower_list;
+    hashElemType upper_list;
+    hashElemType *lower_insert;
+    hashElemType *upper_insert;
+    memSizeType length;
+    memSizeType lower_length;
+
+  /* grow_hash */
+    logFunction(printf("grow_hash(" FMT_X_MEM ") size=" FMT_U_MEM
+                       ", table_size=%u\n", (memSizeType) aHashMap,
+                       aHashMap->size, aHashMap->table_size););
+    old_size = aHashMap->table_size;
+    new_bits = aHashMap->bits + 1;
+    if (likely(ALLOC_HASH_TABLE(new_table, TABLE_SIZE(new_bits)))) {
+      for (number = 0; number < old_size; number++) {
+        length = 0;
+        list = helem_to_list(aHashMap->table[number], NULL, &length);
+        lower_insert = &lower_list;
+        upper_insert = &upper_list;
+        lower_length = 0;
+        while (list != NULL) {
+          if ((list->hashcode & old_size) == 0) {
+            *lower_insert = list;
+            lower_insert = &list->next_greater;
+            lower_length++;
+          } else {
+            *upper_insert = list;
+            upper_insert = &list->next_greater;
+          } /* if */
+          list = list->next_greater;
+        } /* while */
+        *lower_insert = NULL;
+        *upper_insert = NULL;
+        new_table[number] = list_to_helem(&lower_list, lower_length);
+        new_table[number + old_size] =
+            list_to_helem(&upper_list, length - lower_length);
+      } /* for */
+      FREE_HASH_TABLE(aHashMap->table, old_size);
+      COUNT3_HASH(old_size, TABLE_SIZE(new_bits));
+      aHashMap->table = new_table;
+      aHashMap->bits = new_bits;
+      aHashMap->mask = TABLE_MASK(new_bits);
+      aHashMap->table_size = TABLE_SIZE(new_bits);
+    } /* if */
+    logFunction(printf("grow_hash --> table_size=%u\n",
+                       aHashMap->table_size););
+  } /* grow_hash */
+
+
+
+/**
+ *  Halve the number of slots in the table of 'aHashMap'.
+ *  The trees of two slots are merged with 'cmp_func'.
+ *  If there is not enough memory the table is left unchanged.
+ */
+static void shrink_hash (hashType aHashMap, objectType cmp_func)
+
+  {
+    unsigned int old_size;
+    unsigned int new_bits;
+    hashElemType *new_table;
+    unsigned int number;
+    hashElemType lower_list;
+    hashElemType upper_list;
+    hashElemType list;
+    memSizeType length;
+
+  /* shrink_hash */
+    logFunction(printf("shrink_hash(" FMT_X_MEM ") size=" FMT_U_MEM
+                       ", table_size=%u\n", (memSizeType) aHashMap,
+                       aHashMap->size, aHashMap->table_size););
+    old_size = aHashMap->table_size;
+    new_bits = aHashMap->bits - 1;
+    if (likely(ALLOC_HASH_TABLE(new_table, TABLE_SIZE(new_bits)))) {
+      for (number = 0; number < TABLE_SIZE(new_bits); number++) {
+        length = 0;
+        lower_list = helem_to_list(aHashMap->table[number], NULL, &length);
+        upper_list = helem_to_list(aHashMap->table[number + TABLE_SIZE(new_bits)],
+                                   NULL, &length);
+        list = merge_helem_lists(lower_list, upper_list, cmp_func);
+        new_table[number] = list_to_helem(&list, length);
+      } /* for */
+      FREE_HASH_TABLE(aHashMap->table, old_size);
+      COUNT3_HASH(old_size, TABLE_SIZE(new_bits));
+      aHashMap->table = new_table;
+      aHashMap->bits = new_bits;
+      aHashMap->mask = TABLE_MASK(new_bits);
+      aHashMap->table_size = TABLE_SIZE(new_bits);
+    } /* if */
+    logFunction(printf("shrink_hash --> table_size=%u\n",
+                       aHashMap->table_size););
+  } /* shrink_hash */
+
+
+
 static hashElemType create_helem (hashElemType source_helem,
     objectType key_create_func, objectType data_create_func,
     errInfoType *err_info)
@@ -189,6 +403,7 @@ static hashElemType create_helem (hashElemType source_helem,
       SET_ANY_FLAG(&dest_helem->data, HAS_POSINFO(&source_helem->data));
       dest_helem->data.type_of = source_helem->data.type_of;
       param3_call(data_create_func, &dest_helem->data, SYS_CREA_OBJECT, &source_helem->data);
+      dest_helem->hashcode = source_helem->hashcode;
       if (source_helem->next_less != NULL) {
         dest_helem->next_less = create_helem(source_helem->next_less,
             key_create_func, data_create_func, err_info);
@@ -919,6 +1134,9 @@ objectType hsh_excl (listType arguments)
         hashelem = hashelem->next_greater;
       } /* if */
     } /* while */
+    if (HASH_TOO_EMPTY(aHashMap)) {
+      shrink_hash(aHashMap, cmp_func);
+    } /* if */
     return SYS_EMPTY_OBJECT;
   } /* hsh_excl */
 
@@ -1069,6 +1287,7 @@ objectType hsh_gen_hash (listType arguments)
         isit_int(hashCodeObj);
         hashCode = (unsigned int) take_int(hashCodeObj);
         FREE_OBJECT(hashCodeObj);
+        currentKeyValue->hashcode = hashCode;
         hashElem = aHashMap->table[hashCode & aHashMap->mask];
         if (hashElem == NULL) {
           aHashMap->table[hashCode & aHashMap->mask] = currentKeyValue;
@@ -1106,6 +1325,9 @@ objectType hsh_gen_hash (listType arguments)
             } /* if */
           } while (hashElem != NULL);
         } /* if */
+        if (HASH_TOO_FULL(aHashMap)) {
+          grow_hash(aHashMap);
+        } /* if */
       } /* while */
       logFunction(printf("hsh_gen_hash -->\n"););
       if (unlikely(err_info != OKAY_NO_ERROR)) {
@@ -1430,7 +1652,7 @@ objectType hsh_incl (listType arguments)
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = new_helem(aKey, data,
-          key_create_func, data_create_func, &err_info);
+          hashcode, key_create_func, data_create_func, &err_info);
       aHashMap->size++;
     } else if (unlikely(cmp_func == NULL)) {
       logError(printf("hsh_incl: cmp_func == NULL\n"););
@@ -1444,7 +1666,7 @@ objectType hsh_incl (listType arguments)
         FREE_OBJECT(cmp_obj);
         if (cmp < 0) {
           if (hashelem->next_less == NULL) {
-            hashelem->next_less = new_helem(aKey, data,
+            hashelem->next_less = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1456,7 +1678,7 @@ objectType hsh_incl (listType arguments)
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            hashelem->next_greater = new_helem(aKey, data,
+            hashelem->next_greater = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1471,6 +1693,9 @@ objectType hsh_incl (listType arguments)
       return raise_with_obj_and_args(SYS_MEM_EXCEPTION,
                                      hash_exec_object, arguments);
     } else {
+      if (HASH_TOO_FULL(aHashMap)) {
+        grow_hash(aHashMap);
+      } /* if */
       return SYS_EMPTY_OBJECT;
     } /* if */
   } /* hsh_incl */
@@ -1629,7 +1854,7 @@ objectType hsh_update (listType arguments)
     hashelem = aHashMap->table[(unsigned int) hashcode & aHashMap->mask];
     if (hashelem == NULL) {
       aHashMap->table[(unsigned int) hashcode & aHashMap->mask] = new_helem(aKey, data,
-          key_create_func, data_create_func, &err_info);
+          hashcode, key_create_func, data_create_func, &err_info);
       aHashMap->size++;
     } else if (unlikely(cmp_func == NULL)) {
       logError(printf("hsh_update: cmp_func == NULL\n"););
@@ -1643,7 +1868,7 @@ objectType hsh_update (listType arguments)
         FREE_OBJECT(cmp_obj);
         if (cmp < 0) {
           if (hashelem->next_less == NULL) {
-            hashelem->next_less = new_helem(aKey, data,
+            hashelem->next_less = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1657,7 +1882,7 @@ objectType hsh_update (listType arguments)
           hashelem = NULL;
         } else {
           if (hashelem->next_greater == NULL) {
-            hashelem->next_greater = new_helem(aKey, data,
+            hashelem->next_greater = new_helem(aKey, data, hashcode,
                 key_create_func, data_create_func, &err_info);
             aHashMap->size++;
             hashelem = NULL;
@@ -1671,6 +1896,8 @@ objectType hsh_update (listType arguments)
       aHashMap->size--;
       return raise_with_obj_and_args(SYS_MEM_EXCEPTION,
                                      hash_exec_object, arguments);
+    } else if (HASH_TOO_FULL(aHashMap)) {
+      grow_hash(aHashMap);
     } /* if */
     /* printf("hsh_update -> ");
     trace1(data);
@@ -0,0 +1,916 @@
+/********************************************************************/
+/*                                                                  */
+/*  mdg_rtl.c     Primitive actions for message digests.            */
+/*  Copyright (C) 2026  Thomas Mertes                               */
+/*                                                                  */
+/*  This file is part of the Seed7 Runtime Library.                 */
+/*                                                                  */
+/*  The Seed7 Runtime Library is free software; you can             */
+/*  redistribute it and/or modify it under the terms of the GNU     */
+/*  Lesser General Public License as published by the Free Software */
+/*  Foundation; either version 2.1 of the License, or (at your      */
+/*  option) any later version.                                      */
+/*                                                                  */
+/*  The Seed7 Runtime Library is distributed in the hope that it    */
+/*  will be useful, but WITHOUT ANY WARRANTY; without even the      */
+/*  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR */
+/*  PURPOSE.  See the GNU Lesser General Public License for more    */
+/*  details.                                                        */
+/*                                                                  */
+/*  You should have received a copy of the GNU Lesser General       */
+/*  Public License along with this program; if not, write to the    */
+/*  Free Software Foundation, Inc., 51 Franklin Street,             */
+/*  Fifth Floor, Boston, MA  02110-1301, USA.                       */
+/*                                                                  */
+/*  Module: Seed7 Runtime Library                                   */
+/*  File: seed7/src/mdg_rtl.c                                       */
+/*  Changes: 2026  Thomas Mertes                                    */
+/*  Content: Primitive actions for message digests.                 */
+/*                                                                  */
+/********************************************************************/
+
+#define LOG_FUNCTIONS 0
+#define VERBOSE_EXCEPTIONS 0
+
+#include "version.h"
+
+#include "stdlib.h"
+#include "stdio.h"
+
+#include "common.h"
+#include "data_rtl.h"
+#include "heaputl.h"
+#include "striutl.h"
+#include "rtl_err.h"
+
+#undef EXTERN
+#define EXTERN
+#include "mdg_rtl.h"
+
+
+/* The compression functions process the data in blocks of bytes. */
+/* The chaining value (state) of a hash function is represented as */
+/* string of bytes. This way the Seed7 library can keep it in a    */
+/* string and no special type is needed.                           */
+#define MD5_BLOCK_SIZE      64
+#define MD5_STATE_SIZE      16
+#define SHA1_BLOCK_SIZE     64
+#define SHA1_STATE_SIZE     20
+#define SHA256_BLOCK_SIZE   64
+#define SHA256_STATE_SIZE   32
+#define SHA512_BLOCK_SIZE  128
+#define SHA512_STATE_SIZE   64
+#define KECCAK_STATE_SIZE  200
+
+#define ROTL32(x, n) ((uint32Type) ((x) << (n)) | ((x) >> (32 - (n))))
+#define ROTR32(x, n) ((uint32Type) ((x) >> (n)) | ((x) << (32 - (n))))
+#define ROTL64(x, n) ((uint64Type) ((x) << (n)) | ((x) >> ((64 - (n)) & 63)))
+#define ROTR64(x, n) ((uint64Type) ((x) >> (n)) | ((x) << (64 - (n))))
+
+static const uint32Type md5SineTable[] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+  };
+
+static const unsigned int md5ShiftAmount[] = {
+    7, 12, 17, 22,  5,  9, 14, 20,  4, 11, 16, 23,  6, 10, 15, 21
+  };
+
+static const uint32Type sha256RoundConstant[] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+  };
+
+static const uint64Type sha512RoundConstant[] = {
+    UINT64_SUFFIX(0x428a2f98d728ae22), UINT64_SUFFIX(0x7137449123ef65cd),
+    UINT64_SUFFIX(0xb5c0fbcfec4d3b2f), UINT64_SUFFIX(0xe9b5dba58189dbbc),
+    UINT64_SUFFIX(0x3956c25bf348b538), UINT64_SUFFIX(0x59f111f1b605d019),
+    UINT64_SUFFIX(0x923f82a4af194f9b), UINT64_SUFFIX(0xab1c5ed5da6d8118),
+    UINT64_SUFFIX(0xd807aa98a3030242), UINT64_SUFFIX(0x12835b0145706fbe),
+    UINT64_SUFFIX(0x243185be4ee4b28c), UINT64_SUFFIX(0x550c7dc3d5ffb4e2),
+    UINT64_SUFFIX(0x72be5d74f27b896f), UINT64_SUFFIX(0x80deb1fe3b1696b1),
+    UINT64_SUFFIX(0x9bdc06a725c71235), UINT64_SUFFIX(0xc19bf174cf692694),
+    UINT64_SUFFIX(0xe49b69c19ef14ad2), UINT64_SUFFIX(0xefbe4786384f25e3),
+    UINT64_SUFFIX(0x0fc19dc68b8cd5b5), UINT64_SUFFIX(0x240ca1cc77ac9c65),
+    UINT64_SUFFIX(0x2de92c6f592b0275), UINT64_SUFFIX(0x4a7484aa6ea6e483),
+    UINT64_SUFFIX(0x5cb0a9dcbd41fbd4), UINT64_SUFFIX(0x76f988da831153b5),
+    UINT64_SUFFIX(0x983e5152ee66dfab), UINT64_SUFFIX(0xa831c66d2db43210),
+    UINT64_SUFFIX(0xb00327c898fb213f), UINT64_SUFFIX(0xbf597fc7beef0ee4),
+    UINT64_SUFFIX(0xc6e00bf33da88fc2), UINT64_SUFFIX(0xd5a79147930aa725),
+    UINT64_SUFFIX(0x06ca6351e003826f), UINT64_SUFFIX(0x142929670a0e6e70),
+    UINT64_SUFFIX(0x27b70a8546d22ffc), UINT64_SUFFIX(0x2e1b21385c26c926),
+    UINT64_SUFFIX(0x4d2c6dfc5ac42aed), UINT64_SUFFIX(0x53380d139d95b3df),
+    UINT64_SUFFIX(0x650a73548baf63de), UINT64_SUFFIX(0x766a0abb3c77b2a8),
+    UINT64_SUFFIX(0x81c2c92e47edaee6), UINT64_SUFFIX(0x92722c851482353b),
+    UINT64_SUFFIX(0xa2bfe8a14cf10364), UINT64_SUFFIX(0xa81a664bbc423001),
+    UINT64_SUFFIX(0xc24b8b70d0f89791), UINT64_SUFFIX(0xc76c51a30654be30),
+    UINT64_SUFFIX(0xd192e819d6ef5218), UINT64_SUFFIX(0xd69906245565a910),
+    UINT64_SUFFIX(0xf40e35855771202a), UINT64_SUFFIX(0x106aa07032bbd1b8),
+    UINT64_SUFFIX(0x19a4c116b8d2d0c8), UINT64_SUFFIX(0x1e376c085141ab53),
+    UINT64_SUFFIX(0x2748774cdf8eeb99), UINT64_SUFFIX(0x34b0bcb5e19b48a8),
+    UINT64_SUFFIX(0x391c0cb3c5c95a63), UINT64_SUFFIX(0x4ed8aa4ae3418acb),
+    UINT64_SUFFIX(0x5b9cca4f7763e373), UINT64_SUFFIX(0x682e6ff3d6b2b8a3),
+    UINT64_SUFFIX(0x748f82ee5defb2fc), UINT64_SUFFIX(0x78a5636f43172f60),
+    UINT64_SUFFIX(0x84c87814a1f0ab72), UINT64_SUFFIX(0x8cc702081a6439ec),
+    UINT64_SUFFIX(0x90befffa23631e28), UINT64_SUFFIX(0xa4506cebde82bde9),
+    UINT64_SUFFIX(0xbef9a3f7b2c67915), UINT64_SUFFIX(0xc67178f2e372532b),
+    UINT64_SUFFIX(0xca273eceea26619c), UINT64_SUFFIX(0xd186b8c721c0c207),
+    UINT64_SUFFIX(0xeada7dd6cde0eb1e), UINT64_SUFFIX(0xf57d4f7fee6ed178),
+    UINT64_SUFFIX(0x06f067aa72176fba), UINT64_SUFFIX(0x0a637dc5a2c898a6),
+    UINT64_SUFFIX(0x113f9804bef90dae), UINT64_SUFFIX(0x1b710b35131c471b),
+    UINT64_SUFFIX(0x28db77f523047d84), UINT64_SUFFIX(0x32caab7b40c72493),
+    UINT64_SUFFIX(0x3c9ebe0a15c9bebc), UINT64_SUFFIX(0x431d67c49c100d4c),
+    UINT64_SUFFIX(0x4cc5d4becb3e42b6), UINT64_SUFFIX(0x597f299cfc657e2a),
+    UINT64_SUFFIX(0x5fcb6fab3ad6faec), UINT64_SUFFIX(0x6c44198c4a475817)
+  };
+
+static const uint64Type keccakRoundConstant[] = {
+    UINT64_SUFFIX(0x0000000000000001), UINT64_SUFFIX(0x0000000000008082),
+    UINT64_SUFFIX(0x800000000000808a), UINT64_SUFFIX(0x8000000080008000),
+    UINT64_SUFFIX(0x000000000000808b), UINT64_SUFFIX(0x0000000080000001),
+    UINT64_SUFFIX(0x8000000080008081), UINT64_SUFFIX(0x8000000000008009),
+    UINT64_SUFFIX(0x000000000000008a), UINT64_SUFFIX(0x0000000000000088),
+    UINT64_SUFFIX(0x0000000080008009), UINT64_SUFFIX(0x000000008000000a),
+    UINT64_SUFFIX(0x000000008000808b), UINT64_SUFFIX(0x800000000000008b),
+    UINT64_SUFFIX(0x8000000000008089), UINT64_SUFFIX(0x8000000000008003),
+    UINT64_SUFFIX(0x8000000000008002), UINT64_SUFFIX(0x8000000000000080),
+    UINT64_SUFFIX(0x000000000000800a), UINT64_SUFFIX(0x800000008000000a),
+    UINT64_SUFFIX(0x8000000080008081), UINT64_SUFFIX(0x8000000000008080),
+    UINT64_SUFFIX(0x0000000080000001), UINT64_SUFFIX(0x8000000080008008)
+  };
+
+/* Rotation offsets and lane positions of the combined rho and pi steps. */
+static const unsigned int keccakRotation[] = {
+     1,  3,  6, 10, 15, 21, 28, 36, 45, 55,  2, 14,
+    27, 41, 56,  8, 25, 43, 62, 18, 39, 61, 20, 44
+  };
+
+static const unsigned int keccakPiLane[] = {
+    10,  7, 11, 17, 18,  3,  5, 16,  8, 21, 24,  4,
+    15, 23, 19, 13, 12,  2, 20, 14, 22,  9,  6,  1
+  };
+
+
+
+/**
+ *  Determine the first block and the number of full blocks of data.
+ *  @return the first data element to be processed.
+ */
+static const strElemType *findBlocks (const const_striType data,
+    intType start, memSizeType blockSize, memSizeType *numBlocks)
+
+  { /* findBlocks */
+    if ((uintType) start > data->size) {
+      *numBlocks = 0;
+      return data->mem;
+    } else {
+      *numBlocks = (data->size - (memSizeType) start + 1) / blockSize;
+      return &data->mem[start - 1];
+    } /* if */
+  } /* findBlocks */
+
+
+
+static inline strElemType loadWords32Be (const strElemType *mem,
+    uint32Type *word, unsigned int numWords)
+
+  {
+    unsigned int idx;
+    strElemType check = 0;
+
+  /* loadWords32Be */
+    for (idx = 0; idx < numWords; idx++) {
+      check |= mem[0] | mem[1] | mem[2] | mem[3];
+      word[idx] = (uint32Type) mem[0] << 24 | (uint32Type) mem[1] << 16 |
+                  (uint32Type) mem[2] <<  8 | (uint32Type) mem[3];
+      mem += 4;
+    } /* for */
+    return check;
+  } /* loadWords32Be */
+
+
+
+static inline strElemType loadWords32Le (const strElemType *mem,
+    uint32Type *word, unsigned int numWords)
+
+  {
+    unsigned int idx;
+    strElemType check = 0;
+
+  /* loadWords32Le */
+    for (idx = 0; idx < numWords; idx++) {
+      check |= mem[0] | mem[1] | mem[2] | mem[3];
+      word[idx] = (uint32Type) mem[0]       | (uint32Type) mem[1] <<  8 |
+                  (uint32Type) mem[2] << 16 | (uint32Type) mem[3] << 24;
+      mem += 4;
+    } /* for */
+    return check;
+  } /* loadWords32Le */
+
+
+
+static inline strElemType loadWords64Be (const strElemType *mem,
+    uint64Type *word, unsigned int numWords)
+
+  {
+    unsigned int idx;
+    strElemType check = 0;
+
+  /* loadWords64Be */
+    for (idx = 0; idx < numWords; idx++) {
+      check |= mem[0] | mem[1] | mem[2] | mem[3] |
+               mem[4] | mem[5] | mem[6] | mem[7];
+      word[idx] = (uint64Type) mem[0] << 56 | (uint64Type) mem[1] << 48 |
+                  (uint64Type) mem[2] << 40 | (uint64Type) mem[3] << 32 |
+                  (uint64Type) mem[4] << 24 | (uint64Type) mem[5] << 16 |
+                  (uint64Type) mem[6] <<  8 | (uint64Type) mem[7];
+      mem += 8;
+    } /* for */
+    return check;
+  } /* loadWords64Be */
+
+
+
+static inline strElemType loadWords64Le (const strElemType *mem,
+    uint64Type *word, unsigned int numWords)
+
+  {
+    unsigned int idx;
+    strElemType check = 0;
+
+  /* loadWords64Le */
+    for (idx = 0; idx < numWords; idx++) {
+      check |= mem[0] | mem[1] | mem[2] | mem[3] |
+               mem[4] | mem[5] | mem[6] | mem[7];
+      word[idx] = (uint64Type) mem[0]       | (uint64Type) mem[1] <<  8 |
+                  (uint64Type) mem[2] << 16 | (uint64Type) mem[3] << 24 |
+                  (uint64Type) mem[4] << 32 | (uint64Type) mem[5] << 40 |
+                  (uint64Type) mem[6] << 48 | (uint64Type) mem[7] << 56;
+      mem += 8;
+    } /* for */
+    return check;
+  } /* loadWords64Le */
+
+
+
+static striType storeWords32 (const uint32Type *word, unsigned int numWords,
+    boolType bigEndian)
+
+  {
+    unsigned int idx;
+    unsigned int byteNum;
+    strElemType *mem;
+    striType result;
+
+  /* storeWords32 */
+    if (unlikely(!ALLOC_STRI_SIZE_OK(result, 4 * (memSizeType) numWords))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->size = 4 * (memSizeType) numWords;
+      mem = result->mem;
+      for (idx = 0; idx < numWords; idx++) {
+        for (byteNum = 0; byteNum < 4; byteNum++) {
+          if (bigEndian) {
+            *mem = (word[idx] >> (8 * (3 - byteNum))) & 0xff;
+          } else {
+            *mem = (word[idx] >> (8 * byteNum)) & 0xff;
+          } /* if */
+          mem++;
+        } /* for */
+      } /* for */
+    } /* if */
+    return result;
+  } /* storeWords32 */
+
+
+
+static striType storeWords64 (const uint64Type *word, unsigned int numWords,
+    boolType bigEndian)
+
+  {
+    unsigned int idx;
+    unsigned int byteNum;
+    strElemType *mem;
+    striType result;
+
+  /* storeWords64 */
+    if (unlikely(!ALLOC_STRI_SIZE_OK(result, 8 * (memSizeType) numWords))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      result->size = 8 * (memSizeType) numWords;
+      mem = result->mem;
+      for (idx = 0; idx < numWords; idx++) {
+        for (byteNum = 0; byteNum < 8; byteNum++) {
+          if (bigEndian) {
+            *mem = (strElemType) (word[idx] >> (8 * (7 - byteNum))) & 0xff;
+          } else {
+            *mem = (strElemType) (word[idx] >> (8 * byteNum)) & 0xff;
+          } /* if */
+          mem++;
+        } /* for */
+      } /* for */
+    } /* if */
+    return result;
+  } /* storeWords64 */
+
+
+
+static void md5Block (uint32Type *hash, const uint32Type *word)
+
+  {
+    uint32Type a, b, c, d;
+    uint32Type temp;
+    unsigned int idx;
+
+  /* md5Block */
+    a = hash[0];
+    b = hash[1];
+    c = hash[2];
+    d = hash[3];
+    for (idx = 0; idx < 16; idx++) {
+      temp = a + ((b & c) | (~b & d)) + md5SineTable[idx] + word[idx];
+      a = d;
+      d = c;
+      c = b;
+      b += ROTL32(temp, md5ShiftAmount[idx & 3]);
+    } /* for */
+    for (; idx < 32; idx++) {
+      temp = a + ((d & b) | (~d & c)) + md5SineTable[idx] +
+             word[(5 * idx + 1) & 15];
+      a = d;
+      d = c;
+      c = b;
+      b += ROTL32(temp, md5ShiftAmount[4 + (idx & 3)]);
+    } /* for */
+    for (; idx < 48; idx++) {
+      temp = a + (b ^ c ^ d) + md5SineTable[idx] + word[(3 * idx + 5) & 15];
+      a = d;
+      d = c;
+      c = b;
+      b += ROTL32(temp, md5ShiftAmount[8 + (idx & 3)]);
+    } /* for */
+    for (; idx < 64; idx++) {
+      temp = a + (c ^ (b | ~d)) + md5SineTable[idx] + word[(7 * idx) & 15];
+      a = d;
+      d = c;
+      c = b;
+      b += ROTL32(temp, md5ShiftAmount[12 + (idx & 3)]);
+    } /* for */
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+  } /* md5Block */
+
+
+
+/**
+ *  Compute the next word of the SHA-1 message schedule.
+ *  Only the last 16 words of the schedule are kept in 'word'.
+ */
+static inline uint32Type sha1Expand (uint32Type *word, unsigned int idx)
+
+  {
+    uint32Type temp;
+
+  /* sha1Expand */
+    temp = word[(idx + 13) & 15] ^ word[(idx + 8) & 15] ^
+           word[(idx + 2) & 15] ^ word[idx & 15];
+    word[idx & 15] = ROTL32(temp, 1);
+    return word[idx & 15];
+  } /* sha1Expand */
+
+
+
+static void sha1Block (uint32Type *hash, uint32Type *word)
+
+  {
+    uint32Type a, b, c, d, e;
+    uint32Type temp;
+    unsigned int idx;
+
+  /* sha1Block */
+    a = hash[0];
+    b = hash[1];
+    c = hash[2];
+    d = hash[3];
+    e = hash[4];
+    for (idx = 0; idx < 20; idx++) {
+      temp = ROTL32(a, 5) + ((b & c) | (~b & d)) + 0x5a827999 + e +
+             (idx < 16 ? word[idx] : sha1Expand(word, idx));
+      e = d;
+      d = c;
+      c = ROTL32(b, 30);
+      b = a;
+      a = temp;
+    } /* for */
+    for (; idx < 40; idx++) {
+      temp = ROTL32(a, 5) + (b ^ c ^ d) + 0x6ed9eba1 + e +
+             sha1Expand(word, idx);
+      e = d;
+      d = c;
+      c = ROTL32(b, 30);
+      b = a;
+      a = temp;
+    } /* for */
+    for (; idx < 60; idx++) {
+      temp = ROTL32(a, 5) + ((b & c) | (b & d) | (c & d)) + 0x8f1bbcdc +
+             e + sha1Expand(word, idx);
+      e = d;
+      d = c;
+      c = ROTL32(b, 30);
+      b = a;
+      a = temp;
+    } /* for */
+    for (; idx < 80; idx++) {
+      temp = ROTL32(a, 5) + (b ^ c ^ d) + 0xca62c1d6 + e +
+             sha1Expand(word, idx);
+      e = d;
+      d = c;
+      c = ROTL32(b, 30);
+      b = a;
+      a = temp;
+    } /* for */
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+  } /* sha1Block */
+
+
+
+static void sha256Block (uint32Type *hash, uint32Type *word)
+
+  {
+    uint32Type a, b, c, d, e, f, g, h;
+    uint32Type s0, s1;
+    uint32Type temp1, temp2;
+    unsigned int idx;
+
+  /* sha256Block */
+    for (idx = 16; idx < 64; idx++) {
+      s0 = ROTR32(word[idx - 15], 7) ^ ROTR32(word[idx - 15], 18) ^
+           (word[idx - 15] >> 3);
+      s1 = ROTR32(word[idx - 2], 17) ^ ROTR32(word[idx - 2], 19) ^
+           (word[idx - 2] >> 10);
+      word[idx] = word[idx - 16] + s0 + word[idx - 7] + s1;
+    } /* for */
+    a = hash[0];
+    b = hash[1];
+    c = hash[2];
+    d = hash[3];
+    e = hash[4];
+    f = hash[5];
+    g = hash[6];
+    h = hash[7];
+    for (idx = 0; idx < 64; idx++) {
+      s1 = ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25);
+      temp1 = h + s1 + ((e & f) ^ (~e & g)) + sha256RoundConstant[idx] +
+              word[idx];
+      s0 = ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22);
+      temp2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + temp1;
+      d = c;
+      c = b;
+      b = a;
+      a = temp1 + temp2;
+    } /* for */
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+  } /* sha256Block */
+
+
+
+static void sha512Block (uint64Type *hash, uint64Type *word)
+
+  {
+    uint64Type a, b, c, d, e, f, g, h;
+    uint64Type s0, s1;
+    uint64Type temp1, temp2;
+    unsigned int idx;
+
+  /* sha512Block */
+    for (idx = 16; idx < 80; idx++) {
+      s0 = ROTR64(word[idx - 15], 1) ^ ROTR64(word[idx - 15], 8) ^
+           (word[idx - 15] >> 7);
+      s1 = ROTR64(word[idx - 2], 19) ^ ROTR64(word[idx - 2], 61) ^
+           (word[idx - 2] >> 6);
+      word[idx] = word[idx - 16] + s0 + word[idx - 7] + s1;
+    } /* for */
+    a = hash[0];
+    b = hash[1];
+    c = hash[2];
+    d = hash[3];
+    e = hash[4];
+    f = hash[5];
+    g = hash[6];
+    h = hash[7];
+    for (idx = 0; idx < 80; idx++) {
+      s1 = ROTR64(e, 14) ^ ROTR64(e, 18) ^ ROTR64(e, 41);
+      temp1 = h + s1 + ((e & f) ^ (~e & g)) + sha512RoundConstant[idx] +
+              word[idx];
+      s0 = ROTR64(a, 28) ^ ROTR64(a, 34) ^ ROTR64(a, 39);
+      temp2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + temp1;
+      d = c;
+      c = b;
+      b = a;
+      a = temp1 + temp2;
+    } /* for */
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+  } /* sha512Block */
+
+
+
+static void keccakF1600 (uint64Type *lane)
+
+  {
+    uint64Type column[5];
+    uint64Type delta;
+    uint64Type current;
+    uint64Type saved;
+    unsigned int round;
+    unsigned int idx;
+    unsigned int x;
+
+  /* keccakF1600 */
+    for (round = 0; round < 24; round++) {
+      /* Theta step */
+      for (x = 0; x < 5; x++) {
+        column[x] = lane[x] ^ lane[x + 5] ^ lane[x + 10] ^
+                    lane[x + 15] ^ lane[x + 20];
+      } /* for */
+      for (x = 0; x < 5; x++) {
+        delta = column[(x + 4) % 5] ^ ROTL64(column[(x + 1) % 5], 1);
+        lane[x]      ^= delta;
+        lane[x + 5]  ^= delta;
+        lane[x + 10] ^= delta;
+        lane[x + 15] ^= delta;
+        lane[x + 20] ^= delta;
+      } /* for */
+      /* Rho and pi steps */
+      current = lane[1];
+      for (idx = 0; idx < 24; idx++) {
+        saved = lane[keccakPiLane[idx]];
+        lane[keccakPiLane[idx]] = ROTL64(current, keccakRotation[idx]);
+        current = saved;
+      } /* for */
+      /* Chi step */
+      for (idx = 0; idx < 25; idx += 5) {
+        column[0] = lane[idx];
+        column[1] = lane[idx + 1];
+        column[2] = lane[idx + 2];
+        column[3] = lane[idx + 3];
+        column[4] = lane[idx + 4];
+        lane[idx]     = column[0] ^ (~column[1] & column[2]);
+        lane[idx + 1] = column[1] ^ (~column[2] & column[3]);
+        lane[idx + 2] = column[2] ^ (~column[3] & column[4]);
+        lane[idx + 3] = column[3] ^ (~column[4] & column[0]);
+        lane[idx + 4] = column[4] ^ (~column[0] & column[1]);
+      } /* for */
+      /* Iota step */
+      lane[0] ^= keccakRoundConstant[round];
+    } /* for */
+  } /* keccakF1600 */
+
+
+
+/**
+ *  Absorb data into a Keccak-f[1600] sponge state.
+ *  All full blocks of 'rate' bytes, that start at the position
+ *  'start' of 'data', are xored into the state and the
+ *  Keccak-f[1600] permutation is applied after every block.
+ *  Remaining bytes at the end of 'data' are ignored.
+ *  The padding of the last block must be done by the caller.
+ *  @param state Sponge state with 200 bytes (25 little endian lanes).
+ *  @param data Byte string with the data to be absorbed.
+ *  @param start Position of the first byte to be absorbed.
+ *  @param rate Number of bytes per block (a multiple of 8 up to 200).
+ *  @return the new state after absorbing the data.
+ *  @exception RANGE_ERROR The state does not have 200 bytes, 'start'
+ *             is not positive, 'rate' is not allowed or 'state' or
+ *             'data' contain characters beyond '\255;'.
+ *  @exception MEMORY_ERROR Not enough memory to create the result.
+ */
+striType mdgKeccak (const const_striType state, const const_striType data,
+    intType start, intType rate)
+
+  {
+    uint64Type lane[25];
+    uint64Type blockLane[25];
+    const strElemType *mem;
+    memSizeType numBlocks;
+    unsigned int numLanes;
+    unsigned int idx;
+    strElemType check;
+    striType result;
+
+  /* mdgKeccak */
+    logFunction(printf("mdgKeccak(\"%s\", \"%s\", " FMT_D ", " FMT_D ")\n",
+                       striAsUnquotedCStri(state), striAsUnquotedCStri(data),
+                       start, rate););
+    if (unlikely(state->size != KECCAK_STATE_SIZE || start <= 0 ||
+                 rate <= 0 || rate > KECCAK_STATE_SIZE || rate % 8 != 0)) {
+      logError(printf("mdgKeccak(state of size " FMT_U_MEM ", data, "
+                      FMT_D ", " FMT_D "): Illegal parameter.\n",
+                      state->size, start, rate););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      numLanes = (unsigned int) rate / 8;
+      check = loadWords64Le(state->mem, lane, 25);
+      mem = findBlocks(data, start, (memSizeType) rate, &numBlocks);
+      for (; numBlocks > 0; numBlocks--) {
+        check |= loadWords64Le(mem, blockLane, numLanes);
+        for (idx = 0; idx < numLanes; idx++) {
+          lane[idx] ^= blockLane[idx];
+        } /* for */
+        keccakF1600(lane);
+        mem += rate;
+      } /* for */
+      if (unlikely(check > 255)) {
+        logError(printf("mdgKeccak: Character beyond '\\255;'.\n"););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = storeWords64(lane, 25, FALSE);
+      } /* if */
+    } /* if */
+    return result;
+  } /* mdgKeccak */
+
+
+
+/**
+ *  Apply the MD5 compression function to blocks of data.
+ *  All full 64 byte blocks, that start at the position 'start'
+ *  of 'data', are processed. Remaining bytes at the end of 'data'
+ *  are ignored. The padding must be done by the caller.
+ *  @param state Chaining value with 16 bytes (4 little endian words).
+ *  @param data Byte string with the data to be processed.
+ *  @param start Position of the first byte to be processed.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR The state does not have 16 bytes, 'start'
+ *             is not positive or 'state' or 'data' contain
+ *             characters beyond '\255;'.
+ *  @exception MEMORY_ERROR Not enough memory to create the result.
+ */
+striType mdgMd5 (const const_striType state, const const_striType data,
+    intType start)
+
+  {
+    uint32Type hash[4];
+    uint32Type word[16];
+    const strElemType *mem;
+    memSizeType numBlocks;
+    strElemType check;
+    striType result;
+
+  /* mdgMd5 */
+    logFunction(printf("mdgMd5(\"%s\", \"%s\", " FMT_D ")\n",
+                       striAsUnquotedCStri(state), striAsUnquotedCStri(data),
+                       start););
+    if (unlikely(state->size != MD5_STATE_SIZE || start <= 0)) {
+      logError(printf("mdgMd5(state of size " FMT_U_MEM ", data, "
+                      FMT_D "): Illegal parameter.\n",
+                      state->size, start););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      check = loadWords32Le(state->mem, hash, 4);
+      mem = findBlocks(data, start, MD5_BLOCK_SIZE, &numBlocks);
+      for (; numBlocks > 0; numBlocks--) {
+        check |= loadWords32Le(mem, word, 16);
+        md5Block(hash, word);
+        mem += MD5_BLOCK_SIZE;
+      } /* for */
+      if (unlikely(check > 255)) {
+        logError(printf("mdgMd5: Character beyond '\\255;'.\n"););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = storeWords32(hash, 4, FALSE);
+      } /* if */
+    } /* if */
+    return result;
+  } /* mdgMd5 */
+
+
+
+/**
+ *  Apply the SHA-1 compression function to blocks of data.
+ *  All full 64 byte blocks, that start at the position 'start'
+ *  of 'data', are processed. Remaining bytes at the end of 'data'
+ *  are ignored. The padding must be done by the caller.
+ *  @param state Chaining value with 20 bytes (5 big endian words).
+ *  @param data Byte string with the data to be processed.
+ *  @param start Position of the first byte to be processed.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR The state does not have 20 bytes, 'start'
+ *             is not positive or 'state' or 'data' contain
+ *             characters beyond '\255;'.
+ *  @exception MEMORY_ERROR Not enough memory to create the result.
+ */
+striType mdgSha1 (const const_striType state, const const_striType data,
+    intType start)
+
+  {
+    uint32Type hash[5];
+    uint32Type word[16];
+    const strElemType *mem;
+    memSizeType numBlocks;
+    strElemType check;
+    striType result;
+
+  /* mdgSha1 */
+    logFunction(printf("mdgSha1(\"%s\", \"%s\", " FMT_D ")\n",
+                       striAsUnquotedCStri(state), striAsUnquotedCStri(data),
+                       start););
+    if (unlikely(state->size != SHA1_STATE_SIZE || start <= 0)) {
+      logError(printf("mdgSha1(state of size " FMT_U_MEM ", data, "
+                      FMT_D "): Illegal parameter.\n",
+                      state->size, start););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      check = loadWords32Be(state->mem, hash, 5);
+      mem = findBlocks(data, start, SHA1_BLOCK_SIZE, &numBlocks);
+      for (; numBlocks > 0; numBlocks--) {
+        check |= loadWords32Be(mem, word, 16);
+        sha1Block(hash, word);
+        mem += SHA1_BLOCK_SIZE;
+      } /* for */
+      if (unlikely(check > 255)) {
+        logError(printf("mdgSha1: Character beyond '\\255;'.\n"););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = storeWords32(hash, 5, TRUE);
+      } /* if */
+    } /* if */
+    return result;
+  } /* mdgSha1 */
+
+
+
+/**
+ *  Apply the SHA-256 compression function to blocks of data.
+ *  This function is also used for SHA-224, which differs only in
+ *  the initial chaining value and the length of the digest.
+ *  All full 64 byte blocks, that start at the position 'start'
+ *  of 'data', are processed. Remaining bytes at the end of 'data'
+ *  are ignored. The padding must be done by the caller.
+ *  @param state Chaining value with 32 bytes (8 big endian words).
+ *  @param data Byte string with the data to be processed.
+ *  @param start Position of the first byte to be processed.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR The state does not have 32 bytes, 'start'
+ *             is not positive or 'state' or 'data' contain
+ *             characters beyond '\255;'.
+ *  @exception MEMORY_ERROR Not enough memory to create the result.
+ */
+striType mdgSha256 (const const_striType state, const const_striType data,
+    intType start)
+
+  {
+    uint32Type hash[8];
+    uint32Type word[64];
+    const strElemType *mem;
+    memSizeType numBlocks;
+    strElemType check;
+    striType result;
+
+  /* mdgSha256 */
+    logFunction(printf("mdgSha256(\"%s\", \"%s\", " FMT_D ")\n",
+                       striAsUnquotedCStri(state), striAsUnquotedCStri(data),
+                       start););
+    if (unlikely(state->size != SHA256_STATE_SIZE || start <= 0)) {
+      logError(printf("mdgSha256(state of size " FMT_U_MEM ", data, "
+                      FMT_D "): Illegal parameter.\n",
+                      state->size, start););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      check = loadWords32Be(state->mem, hash, 8);
+      mem = findBlocks(data, start, SHA256_BLOCK_SIZE, &numBlocks);
+      for (; numBlocks > 0; numBlocks--) {
+        check |= loadWords32Be(mem, word, 16);
+        sha256Block(hash, word);
+        mem += SHA256_BLOCK_SIZE;
+      } /* for */
+      if (unlikely(check > 255)) {
+        logError(printf("mdgSha256: Character beyond '\\255;'.\n"););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = storeWords32(hash, 8, TRUE);
+      } /* if */
+    } /* if */
+    return result;
+  } /* mdgSha256 */
+
+
+
+/**
+ *  Apply the SHA-512 compression function to blocks of data.
+ *  This function is also used for SHA-384, which differs only in
+ *  the initial chaining value and the length of the digest.
+ *  All full 128 byte blocks, that start at the position 'start'
+ *  of 'data', are processed. Remaining bytes at the end of 'data'
+ *  are ignored. The padding must be done by the caller.
+ *  @param state Chaining value with 64 bytes (8 big endian words).
+ *  @param data Byte string with the data to be processed.
+ *  @param start Position of the first byte to be processed.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR The state does not have 64 bytes, 'start'
+ *             is not positive or 'state' or 'data' contain
+ *             characters beyond '\255;'.
+ *  @exception MEMORY_ERROR Not enough memory to create the result.
+ */
+striType mdgSha512 (const const_striType state, const const_striType data,
+    intType start)
+
+  {
+    uint64Type hash[8];
+    uint64Type word[80];
+    const strElemType *mem;
+    memSizeType numBlocks;
+    strElemType check;
+    striType result;
+
+  /* mdgSha512 */
+    logFunction(printf("mdgSha512(\"%s\", \"%s\", " FMT_D ")\n",
+                       striAsUnquotedCStri(state), striAsUnquotedCStri(data),
+                       start););
+    if (unlikely(state->size != SHA512_STATE_SIZE || start <= 0)) {
+      logError(printf("mdgSha512(state of size " FMT_U_MEM ", data, "
+                      FMT_D "): Illegal parameter.\n",
+                      state->size, start););
+      raise_error(RANGE_ERROR);
+      result = NULL;
+    } else {
+      check = loadWords64Be(state->mem, hash, 8);
+      mem = findBlocks(data, start, SHA512_BLOCK_SIZE, &numBlocks);
+      for (; numBlocks > 0; numBlocks--) {
+        check |= loadWords64Be(mem, word, 16);
+        sha512Block(hash, word);
+        mem += SHA512_BLOCK_SIZE;
+      } /* for */
+      if (unlikely(check > 255)) {
+        logError(printf("mdgSha512: Character beyond '\\255;'.\n"););
+        raise_error(RANGE_ERROR);
+        result = NULL;
+      } else {
+        result = storeWords64(hash, 8, TRUE);
+      } /* if */
+    } /* if */
+    return result;
+  } /* mdgSha512 */
@@ -0,0 +1,141 @@
+/********************************************************************/
+/*                                                                  */
+/*  s7   Seed7 interpreter                                          */
+/*  Copyright (C) 2026  Thomas Mertes                               */
+/*                                                                  */
+/*  This program is free software; you can redistribute it and/or   */
+/*  modify it under the terms of the GNU General Public License as  */
+/*  published by the Free Software Foundation; either version 2 of  */
+/*  the License, or (at your option) any later version.             */
+/*                                                                  */
+/*  This program is distributed in the hope that it will be useful, */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the   */
+/*  GNU General Public License for more details.                    */
+/*                                                                  */
+/*  You should have received a copy of the GNU General Public       */
+/*  License along with this program; if not, write to the           */
+/*  Free Software Foundation, Inc., 51 Franklin Street,             */
+/*  Fifth Floor, Boston, MA  02110-1301, USA.                       */
+/*                                                                  */
+/*  Module: Library                                                 */
+/*  File: seed7/src/mdglib.c                                        */
+/*  Changes: 2026  Thomas Mertes                                    */
+/*  Content: All primitive actions for message digests.             */
+/*                                                                  */
+/********************************************************************/
+
+#define LOG_FUNCTIONS 0
+#define VERBOSE_EXCEPTIONS 0
+
+#include "version.h"
+
+#include "stdlib.h"
+#include "stdio.h"
+
+#include "common.h"
+#include "data.h"
+#include "heaputl.h"
+#include "objutl.h"
+#include "runerr.h"
+#include "mdg_rtl.h"
+
+#undef EXTERN
+#define EXTERN
+#include "mdglib.h"
+
+
+
+/**
+ *  Absorb full blocks of 'data' into a Keccak-f[1600] sponge state.
+ *  @return the new sponge state after absorbing the data.
+ *  @exception RANGE_ERROR A parameter is illegal or a character
+ *             is beyond '\255;'.
+ */
+objectType mdg_keccak (listType arguments)
+
+  { /* mdg_keccak */
+    isit_stri(arg_1(arguments));
+    isit_stri(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    isit_int(arg_4(arguments));
+    return bld_stri_temp(
+        mdgKeccak(take_stri(arg_1(arguments)), take_stri(arg_2(arguments)),
+                  take_int(arg_3(arguments)), take_int(arg_4(arguments))));
+  } /* mdg_keccak */
+
+
+
+/**
+ *  Apply the MD5 compression function to full blocks of 'data'.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR A parameter is illegal or a character
+ *             is beyond '\255;'.
+ */
+objectType mdg_md5 (listType arguments)
+
+  { /* mdg_md5 */
+    isit_stri(arg_1(arguments));
+    isit_stri(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_stri_temp(
+        mdgMd5(take_stri(arg_1(arguments)), take_stri(arg_2(arguments)),
+               take_int(arg_3(arguments))));
+  } /* mdg_md5 */
+
+
+
+/**
+ *  Apply the SHA-1 compression function to full blocks of 'data'.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR A parameter is illegal or a character
+ *             is beyond '\255;'.
+ */
+objectType mdg_sha1 (listType arguments)
+
+  { /* mdg_sha1 */
+    isit_stri(arg_1(arguments));
+    isit_stri(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_stri_temp(
+        mdgSha1(take_stri(arg_1(arguments)), take_stri(arg_2(arguments)),
+                take_int(arg_3(arguments))));
+  } /* mdg_sha1 */
+
+
+
+/**
+ *  Apply the SHA-256 compression function to full blocks of 'data'.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR A parameter is illegal or a character
+ *             is beyond '\255;'.
+ */
+objectType mdg_sha256 (listType arguments)
+
+  { /* mdg_sha256 */
+    isit_stri(arg_1(arguments));
+    isit_stri(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_stri_temp(
+        mdgSha256(take_stri(arg_1(arguments)), take_stri(arg_2(arguments)),
+                  take_int(arg_3(arguments))));
+  } /* mdg_sha256 */
+
+
+
+/**
+ *  Apply the SHA-512 compression function to full blocks of 'data'.
+ *  @return the new chaining value after processing the data.
+ *  @exception RANGE_ERROR A parameter is illegal or a character
+ *             is beyond '\255;'.
+ */
+objectType mdg_sha512 (listType arguments)
+
+  { /* mdg_sha512 */
+    isit_stri(arg_1(arguments));
+    isit_stri(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    return bld_stri_temp(
+        mdgSha512(take_stri(arg_1(arguments)), take_stri(arg_2(arguments)),
+                  take_int(arg_3(arguments))));
+  } /* mdg_sha512 */
@@ -405,6 +405,7 @@ void appendSet (striType *const msg, const_setType setValue)
     intType position;
     bitSetType bitset_elem;
     unsigned int bit_index;
+    intType last_elem;
     boolType first_elem;
 
   /* appendSet */
@@ -413,6 +414,17 @@ void appendSet (striType *const msg, const_setType setValue)
     if (setValue != NULL) {
       appendChar(msg, '{');
       first_elem = TRUE;
+      if (isSparseSet(setValue) && !setIsEmpty(setValue)) {
+        /* The loop below is skipped for a sparse set. */
+        position = setMin(setValue);
+        last_elem = setMax(setValue);
+        appendInt(msg, position);
+        while (position != last_elem) {
+          position = setNext(setValue, position);
+          appendCStri(msg, ", ");
+          appendInt(msg, position);
+        } /* while */
+      } /* if */
       for (position = setValue->min_position; position <= setValue->max_position; position++) {
         bitset_elem = setValue->bitset[position - setValue->min_position];
         if (bitset_elem != 0) {
@@ -1286,6 +1286,31 @@ static objectType eval_type (objectType object)
 
 
 
+/**
+ *  Call a dcl_ref action with the elements of param_descr.
+ *  Actions expect their arguments in a contiguous argument frame.
+ *  Therefore the first elements of param_descr are copied to a frame.
+ */
+static objectType call_dcl_ref (objectType (*dcl_ref) (listType),
+    const_listType param_descr)
+
+  {
+    listRecord arg_frame[4];
+    memSizeType num_args = 0;
+
+  /* call_dcl_ref */
+    while (param_descr != NULL && num_args < 4) {
+      arg_frame[num_args].obj = param_descr->obj;
+      arg_frame[num_args].next = &arg_frame[num_args + 1];
+      param_descr = param_descr->next;
+      num_args++;
+    } /* while */
+    arg_frame[num_args - 1].next = NULL;
+    return dcl_ref(arg_frame);
+  } /* call_dcl_ref */
+
+
+
 static objectType dollar_parameter (objectType param_object,
     errInfoType *err_info)
 
@@ -1318,9 +1343,9 @@ static objectType dollar_parameter (objectType param_object,
               if (CATEGORY_OF_OBJ(type_of_parameter) == TYPEOBJECT) {
                 if (param_descr->next->next != NULL) {
                   if (GET_ENTITY(param_descr->next->next->obj)->ident == prog->id_for.colon) {
-                    param_object = dcl_ref2(param_descr);
+                    param_object = call_dcl_ref(dcl_ref2, param_descr);
                   } else {
-                    param_object = dcl_ref1(param_descr);
+                    param_object = call_dcl_ref(dcl_ref1, param_descr);
                   } /* if */
                   if (param_object == NULL) {
                     *err_info = MEMORY_ERROR;
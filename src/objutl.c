@@ -55,6 +55,7 @@
 #include "pcs_drv.h"
 #include "pol_drv.h"
 #include "fil_rtl.h"
+#include "set_rtl.h"
 #include "soc_rtl.h"
 #if WITH_SQL
 #include "sql_rtl.h"
@@ -860,8 +861,7 @@ void dump_temp_value (objectType object)
         break;
       case SETOBJECT:
         if (object->value.setValue != NULL) {
-          FREE_SET(object->value.setValue,
-                   bitsetSize(object->value.setValue));
+          setDestr(object->value.setValue);
         } /* if */
         SET_UNUSED_FLAG(object);
         break;
@@ -25,18 +25,30 @@
 /*                                                                  */
 /********************************************************************/
 
-#define arg_1(arguments) arguments->obj
-#define arg_2(arguments) arguments->next->obj
-#define arg_3(arguments) arguments->next->next->obj
-#define arg_4(arguments) arguments->next->next->next->obj
-#define arg_5(arguments) arguments->next->next->next->next->obj
-#define arg_6(arguments) arguments->next->next->next->next->next->obj
-#define arg_7(arguments) arguments->next->next->next->next->next->next->obj
-#define arg_8(arguments) arguments->next->next->next->next->next->next->next->obj
-#define arg_9(arguments) arguments->next->next->next->next->next->next->next->next->obj
-#define arg_10(arguments) arguments->next->next->next->next->next->next->next->next->next->obj
-#define arg_11(arguments) arguments->next->next->next->next->next->next->next->next->next->next->obj
-#define arg_12(arguments) arguments->next->next->next->next->next->next->next->next->next->next->next->obj
+/* The arguments of an action are stored in a contiguous argument  */
+/* frame (see exec.c). The arguments can be accessed by index.      */
+/* The elements of a frame are also linked with their next pointer. */
+#define arg_1(arguments) (arguments)[0].obj
+#define arg_2(arguments) (arguments)[1].obj
+#define arg_3(arguments) (arguments)[2].obj
+#define arg_4(arguments) (arguments)[3].obj
+#define arg_5(arguments) (arguments)[4].obj
+#define arg_6(arguments) (arguments)[5].obj
+#define arg_7(arguments) (arguments)[6].obj
+#define arg_8(arguments) (arguments)[7].obj
+#define arg_9(arguments) (arguments)[8].obj
+#define arg_10(arguments) (arguments)[9].obj
+#define arg_11(arguments) (arguments)[10].obj
+#define arg_12(arguments) (arguments)[11].obj
+#define arg_13(arguments) (arguments)[12].obj
+
+/* Other lists, e.g. the parameters of a call object, are linked lists. */
+#define list_elem_1(list) (list)->obj
+#define list_elem_2(list) (list)->next->obj
+#define list_elem_3(list) (list)->next->next->obj
+#define list_elem_4(list) (list)->next->next->next->obj
+#define list_elem_5(list) (list)->next->next->next->next->obj
+#define list_elem_6(list) (list)->next->next->next->next->next->obj
 
 #define take_act_obj(arg)    (CATEGORY_OF_OBJ(arg) == MATCHOBJECT ? take_reflist(arg)->obj : (arg))
 #define take_obj_action(arg) take_act_obj(arg)->value.actValue
@@ -38,6 +38,7 @@
 #define WRITE_LINE_NUMBERS    1024
 #define SHOW_IDENT_TABLE      2048
 #define SHOW_STATISTICS       4096
+#define EXECUTE_THREADED_CODE 8192
 
 typedef struct optionStruct {
     striType          sourceFileArgument;
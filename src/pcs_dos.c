@@ -162,6 +162,29 @@ intType pcsExitValue (const const_processType process)
 
 
 
+/**
+ *  Create worker processes.
+ *  DOS cannot fork a copy of the calling process. Instead the
+ *  calling process continues as the only worker.
+ *  @param workerCount Number of worker processes to be created.
+ *  @return 1, the worker number of the calling process.
+ *  @exception RANGE_ERROR If 'workerCount' is not positive.
+ */
+intType pcsForkWorkers (intType workerCount)
+
+  { /* pcsForkWorkers */
+    logFunction(printf("pcsForkWorkers(" FMT_D ")\n", workerCount););
+    if (unlikely(workerCount <= 0)) {
+      logError(printf("pcsForkWorkers(" FMT_D "): "
+                      "Worker count not in allowed range.\n",
+                      workerCount););
+      raise_error(RANGE_ERROR);
+    } /* if */
+    return 1;
+  } /* pcsForkWorkers */
+
+
+
 /**
  *  Free the memory referred by 'oldProcess'.
  *  After pcsFree is left 'oldProcess' refers to not existing memory.
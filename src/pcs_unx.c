@@ -43,6 +43,7 @@
 #include "fcntl.h"
 #include "signal.h"
 #include "errno.h"
+#include "time.h"
 
 #if UNISTD_H_PRESENT
 #include "unistd.h"
@@ -71,6 +72,13 @@ typedef struct {
 
 typedef const unx_processRecord *const_unx_processType;
 
+#define MINIMUM_WORKER_LIFETIME 1
+
+static const int supervisorSignals[] = {SIGTERM, SIGINT, SIGHUP};
+#define NUM_SUPERVISOR_SIGNALS (sizeof(supervisorSignals) / sizeof(int))
+
+static volatile sig_atomic_t supervisorStopSignal = 0;
+
 #if DO_HEAP_STATISTIC
 size_t sizeof_processRecord = sizeof(unx_processRecord);
 #endif
@@ -315,6 +323,212 @@ intType pcsExitValue (const const_processType process)
 
 
 
+static void handleSupervisorSignal (int signalNum)
+
+  { /* handleSupervisorSignal */
+    supervisorStopSignal = signalNum;
+  } /* handleSupervisorSignal */
+
+
+
+static void setSupervisorSignals (struct sigaction *oldActions)
+
+  {
+    struct sigaction sigAct;
+    unsigned int pos;
+
+  /* setSupervisorSignals */
+    sigemptyset(&sigAct.sa_mask);
+    /* Without SA_RESTART a signal interrupts waitpid() with EINTR. */
+    sigAct.sa_flags = 0;
+    sigAct.sa_handler = handleSupervisorSignal;
+    for (pos = 0; pos < NUM_SUPERVISOR_SIGNALS; pos++) {
+      if (sigaction(supervisorSignals[pos], &sigAct, &oldActions[pos]) != 0) {
+        logError(printf("setSupervisorSignals: sigaction(%d, *, *) failed:\n"
+                        "errno=%d\nerror: %s\n",
+                        supervisorSignals[pos], errno, strerror(errno)););
+      } /* if */
+    } /* for */
+  } /* setSupervisorSignals */
+
+
+
+static void restoreSignals (const struct sigaction *oldActions)
+
+  {
+    unsigned int pos;
+
+  /* restoreSignals */
+    for (pos = 0; pos < NUM_SUPERVISOR_SIGNALS; pos++) {
+      (void) sigaction(supervisorSignals[pos], &oldActions[pos], NULL);
+    } /* for */
+  } /* restoreSignals */
+
+
+
+/**
+ *  Send SIGTERM to all workers that are still running.
+ */
+static void stopWorkers (const pid_t *workerPids, intType workerCount)
+
+  {
+    intType index;
+
+  /* stopWorkers */
+    for (index = 0; index < workerCount; index++) {
+      if (workerPids[index] != 0) {
+        (void) kill(workerPids[index], SIGTERM);
+      } /* if */
+    } /* for */
+  } /* stopWorkers */
+
+
+
+static pid_t forkWorker (time_t *startTime)
+
+  {
+    pid_t pid;
+
+  /* forkWorker */
+    /* Buffered output would be written by the worker too. */
+    fflush(NULL);
+    *startTime = time(NULL);
+    pid = fork();
+    if (unlikely(pid == (pid_t) -1)) {
+      logError(printf("forkWorker: fork failed:\n"
+                      "errno=%d\nerror: %s\n",
+                      errno, strerror(errno)););
+    } /* if */
+    return pid;
+  } /* forkWorker */
+
+
+
+/**
+ *  Fork worker processes and supervise them.
+ *  The function creates 'workerCount' copies of the calling process.
+ *  In a worker the function returns its worker number (1 to
+ *  'workerCount'). Resources opened before (e.g. a listening socket)
+ *  are inherited by all workers. The calling process becomes the
+ *  supervisor. It waits for its workers and restarts a worker, with
+ *  the same worker number, if it terminated with a signal or with
+ *  an exit value other than 0. A worker that terminates within one
+ *  second after it was started is restarted with a delay of one
+ *  second. If the supervisor receives SIGTERM, SIGINT or SIGHUP it
+ *  sends SIGTERM to the workers and does not restart them anymore.
+ *  @param workerCount Number of worker processes to be created.
+ *  @return the worker number in a worker process, or
+ *          0 in the supervisor, when all workers have terminated.
+ *  @exception RANGE_ERROR If 'workerCount' is not positive.
+ *  @exception MEMORY_ERROR Not enough memory to manage the workers.
+ *  @exception FILE_ERROR Not all workers could be created.
+ */
+intType pcsForkWorkers (intType workerCount)
+
+  {
+    pid_t *workerPids;
+    time_t *startTimes;
+    struct sigaction oldActions[NUM_SUPERVISOR_SIGNALS];
+    intType index;
+    intType runningWorkers = 0;
+    boolType forkFailed = FALSE;
+    boolType stopping = FALSE;
+    pid_t pid;
+    int status;
+    intType workerNumber = 0;
+
+  /* pcsForkWorkers */
+    logFunction(printf("pcsForkWorkers(" FMT_D ")\n", workerCount););
+    if (unlikely(workerCount <= 0 ||
+                 (uintType) workerCount > MAX_MEMSIZETYPE / sizeof(time_t))) {
+      logError(printf("pcsForkWorkers(" FMT_D "): "
+                      "Worker count not in allowed range.\n",
+                      workerCount););
+      raise_error(RANGE_ERROR);
+    } else if (unlikely((workerPids = (pid_t *) malloc(
+                         (size_t) workerCount * sizeof(pid_t))) == NULL)) {
+      raise_error(MEMORY_ERROR);
+    } else if (unlikely((startTimes = (time_t *) malloc(
+                         (size_t) workerCount * sizeof(time_t))) == NULL)) {
+      free(workerPids);
+      raise_error(MEMORY_ERROR);
+    } else {
+      memset(workerPids, 0, (size_t) workerCount * sizeof(pid_t));
+      supervisorStopSignal = 0;
+      setSupervisorSignals(oldActions);
+      for (index = 0; index < workerCount && workerNumber == 0 && !forkFailed;
+           index++) {
+        pid = forkWorker(&startTimes[index]);
+        if (pid == 0) {
+          workerNumber = index + 1;
+        } else if (unlikely(pid == (pid_t) -1)) {
+          forkFailed = TRUE;
+        } else {
+          workerPids[index] = pid;
+          runningWorkers++;
+        } /* if */
+      } /* for */
+      if (workerNumber == 0) {
+        if (forkFailed) {
+          stopping = TRUE;
+          stopWorkers(workerPids, workerCount);
+        } /* if */
+        while (runningWorkers != 0) {
+          if (supervisorStopSignal != 0 && !stopping) {
+            logMessage(printf("pcsForkWorkers: signal %d received\n",
+                              (int) supervisorStopSignal););
+            stopping = TRUE;
+            stopWorkers(workerPids, workerCount);
+          } /* if */
+          pid = waitpid(-1, &status, 0);
+          if (pid == (pid_t) -1) {
+            if (errno != EINTR) {
+              logError(printf("pcsForkWorkers: waitpid(-1, *, 0) failed:\n"
+                              "errno=%d\nerror: %s\n",
+                              errno, strerror(errno)););
+              runningWorkers = 0;
+            } /* if */
+          } else {
+            for (index = 0; index < workerCount && workerPids[index] != pid;
+                 index++) ;
+            if (index < workerCount) {
+              workerPids[index] = 0;
+              runningWorkers--;
+              if (!stopping && (!WIFEXITED(status) || WEXITSTATUS(status) != 0)) {
+                logMessage(printf("pcsForkWorkers: restart worker " FMT_D "\n",
+                                  index + 1););
+                if (time(NULL) - startTimes[index] < MINIMUM_WORKER_LIFETIME) {
+                  sleep(MINIMUM_WORKER_LIFETIME);
+                } /* if */
+                if (supervisorStopSignal == 0) {
+                  pid = forkWorker(&startTimes[index]);
+                  if (pid == 0) {
+                    workerNumber = index + 1;
+                    runningWorkers = 0;
+                  } else if (pid != (pid_t) -1) {
+                    workerPids[index] = pid;
+                    runningWorkers++;
+                  } /* if */
+                } /* if */
+              } /* if */
+            } /* if */
+          } /* if */
+        } /* while */
+      } /* if */
+      restoreSignals(oldActions);
+      free(workerPids);
+      free(startTimes);
+      if (unlikely(forkFailed && workerNumber == 0)) {
+        raise_error(FILE_ERROR);
+      } /* if */
+    } /* if */
+    logFunction(printf("pcsForkWorkers(" FMT_D ") --> " FMT_D "\n",
+                       workerCount, workerNumber););
+    return workerNumber;
+  } /* pcsForkWorkers */
+
+
+
 /**
  *  Free the memory referred by 'oldProcess'.
  *  After pcsFree is left 'oldProcess' refers to not existing memory.
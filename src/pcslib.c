@@ -321,6 +321,23 @@ objectType pcs_exit_value (listType arguments)
 
 
 
+/**
+ *  Fork worker processes and supervise them.
+ *  @return the worker number in a worker process, or
+ *          0 in the supervisor, when all workers have terminated.
+ *  @exception RANGE_ERROR If the worker count is not positive.
+ *  @exception FILE_ERROR Not all workers could be created.
+ */
+objectType pcs_fork_workers (listType arguments)
+
+  { /* pcs_fork_workers */
+    isit_int(arg_1(arguments));
+    return bld_int_temp(
+        pcsForkWorkers(take_int(arg_1(arguments))));
+  } /* pcs_fork_workers */
+
+
+
 /**
  *  Compute the hash value of a process.
  *  @return the hash value.
@@ -35,6 +35,7 @@ objectType pcs_destr        (listType arguments);
 objectType pcs_empty        (listType arguments);
 objectType pcs_eq           (listType arguments);
 objectType pcs_exit_value   (listType arguments);
+objectType pcs_fork_workers (listType arguments);
 objectType pcs_hashcode     (listType arguments);
 objectType pcs_is_alive     (listType arguments);
 objectType pcs_kill         (listType arguments);
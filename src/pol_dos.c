@@ -290,6 +290,20 @@ void polPoll (const pollType pollData)
 
 
 
+/**
+ *  Waits for one or more of the checkedEvents from 'pollData'
+ *  or until the timeout is reached.
+ *  @exception FILE_ERROR The system function returns an error.
+ */
+void polPollTimeout (const pollType pollData, intType seconds,
+    intType micro_seconds)
+
+  { /* polPollTimeout */
+    raise_error(FILE_ERROR);
+  } /* polPollTimeout */
+
+
+
 /**
  *  Remove 'eventsToCheck' for 'aSocket' from 'pollData'.
  *  'EventsToCheck' can have one of the following values:
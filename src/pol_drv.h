@@ -62,5 +62,7 @@ void polIterChecks (const pollType pollData, intType pollMode);
 void polIterFindings (const pollType pollData, intType pollMode);
 rtlValueUnion polNextFile (const pollType pollData, const rtlValueUnion nullFile);
 void polPoll (const pollType pollData);
+void polPollTimeout (const pollType pollData, intType seconds,
+                     intType micro_seconds);
 void polRemoveCheck (const pollType pollData, const socketType aSocket,
                      intType eventsToCheck);
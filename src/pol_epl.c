@@ -0,0 +1,1262 @@
+/********************************************************************/
+/*                                                                  */
+/*  pol_epl.c     Poll type and function using Linux epoll.         */
+/*  Copyright (C) 1989 - 2026  Thomas Mertes                        */
+/*                                                                  */
+/*  This file is part of the Seed7 Runtime Library.                 */
+/*                                                                  */
+/*  The Seed7 Runtime Library is free software; you can             */
+/*  redistribute it and/or modify it under the terms of the GNU     */
+/*  Lesser General Public License as published by the Free Software */
+/*  Foundation; either version 2.1 of the License, or (at your      */
+/*  option) any later version.                                      */
+/*                                                                  */
+/*  The Seed7 Runtime Library is distributed in the hope that it    */
+/*  will be useful, but WITHOUT ANY WARRANTY; without even the      */
+/*  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR */
+/*  PURPOSE.  See the GNU Lesser General Public License for more    */
+/*  details.                                                        */
+/*                                                                  */
+/*  You should have received a copy of the GNU Lesser General       */
+/*  Public License along with this program; if not, write to the    */
+/*  Free Software Foundation, Inc., 51 Franklin Street,             */
+/*  Fifth Floor, Boston, MA  02110-1301, USA.                       */
+/*                                                                  */
+/*  Module: Seed7 Runtime Library                                   */
+/*  File: seed7/src/pol_epl.c                                       */
+/*  Changes: 2011, 2013, 2026  Thomas Mertes                        */
+/*  Content: Poll type and function using Linux epoll.              */
+/*                                                                  */
+/********************************************************************/
+
+#define LOG_FUNCTIONS 0
+#define VERBOSE_EXCEPTIONS 0
+
+#include "version.h"
+
+#if HAS_EPOLL
+#include "stdlib.h"
+#include "stdio.h"
+#include "string.h"
+#include "limits.h"
+#include "poll.h"
+#include "sys/epoll.h"
+#include "unistd.h"
+#include "errno.h"
+
+#include "common.h"
+#include "os_decls.h"
+#include "data_rtl.h"
+#include "heaputl.h"
+#include "hsh_rtl.h"
+#include "soc_rtl.h"
+#include "rtl_err.h"
+
+#undef EXTERN
+#define EXTERN
+#define DO_INIT
+#include "pol_drv.h"
+
+
+#include "data.h"
+typedef enum {
+    ITER_EMPTY,
+    ITER_CHECKS_IN, ITER_CHECKS_OUT, ITER_CHECKS_INOUT,
+    ITER_FINDINGS_IN, ITER_FINDINGS_OUT, ITER_FINDINGS_INOUT
+  } iteratorType;
+
+/**
+ *  The checked sockets are registered in the kernel with epoll_ctl().
+ *  The pollFds table holds the checked events (events) and the
+ *  findings (revents) of every socket. Its order is the order of
+ *  the checks iterator. The readyEvents table holds the sockets
+ *  returned by the last epoll_wait(). The findings iterator uses
+ *  just readyEvents, so it does not depend on the number of idle
+ *  sockets. The indexHash maps a socket to its pollFds position.
+ */
+typedef struct {
+    memSizeType size;
+    memSizeType capacity;
+    iteratorType iteratorMode;
+    memSizeType iterPos;
+    memSizeType numOfEvents;
+    int epollFd;
+    struct pollfd *pollFds;
+    rtlValueUnion *pollFiles;
+    rtlHashType indexHash;
+    struct epoll_event *readyEvents;
+  } epoll_based_pollRecord, *epoll_based_pollType;
+
+typedef const epoll_based_pollRecord *const_epoll_based_pollType;
+
+#if DO_HEAP_STATISTIC
+size_t sizeof_pollRecord = sizeof(epoll_based_pollRecord);
+#endif
+
+#define conv(genericPollData) ((const_epoll_based_pollType) (genericPollData))
+#define var_conv(genericPollData) ((epoll_based_pollType) (genericPollData))
+
+
+#define TABLE_START_SIZE    256
+#define TABLE_INCREMENT    1024
+#define READY_TABLE_SIZE    256
+#define DUMP_POLL 0
+
+
+
+#if DUMP_POLL
+static void dumpPoll (const const_pollType pollData)
+  {
+    memSizeType pos;
+
+  /* dumpPoll */
+    printf("size=" FMT_U_MEM "\n", conv(pollData)->size);
+    printf("capacity=" FMT_U_MEM "\n", conv(pollData)->capacity);
+    printf("iteratorMode=%d\n", conv(pollData)->iteratorMode);
+    printf("iterPos=" FMT_U_MEM "\n", conv(pollData)->iterPos);
+    printf("numOfEvents=" FMT_U_MEM "\n", conv(pollData)->numOfEvents);
+    printf("epollFd=%d\n", conv(pollData)->epollFd);
+    for (pos = 0; pos < conv(pollData)->size; pos++) {
+      printf("pollfd[" FMT_U_MEM "]: fd=%d, events=%o, revents=%o, pollFile="
+             FMT_U_GEN "\n",
+             pos,
+             conv(pollData)->pollFds[pos].fd,
+             conv(pollData)->pollFds[pos].events,
+             conv(pollData)->pollFds[pos].revents,
+             conv(pollData)->pollFiles[pos].genericValue);
+    } /* for */
+    for (pos = 0; pos < conv(pollData)->numOfEvents; pos++) {
+      printf("ready[" FMT_U_MEM "]: fd=%d, events=%o\n",
+             pos,
+             conv(pollData)->readyEvents[pos].data.fd,
+             conv(pollData)->readyEvents[pos].events);
+    } /* for */
+  } /* dumpPoll */
+
+#else
+#define dumpPoll(pollData)
+#endif
+
+
+
+void initPollOperations (const createFuncType incrUsageCount,
+    const destrFuncType decrUsageCount)
+
+  { /* initPollOperations */
+    fileObjectOps.incrUsageCount = incrUsageCount;
+    fileObjectOps.decrUsageCount = decrUsageCount;
+  } /* initPollOperations */
+
+
+
+static inline memSizeType findPos (const const_epoll_based_pollType pollData,
+    const int fd)
+
+  { /* findPos */
+    return (memSizeType) hshIdxWithDefaultGeneric(pollData->indexHash,
+        (genericType) (usocketType) fd, (genericType) pollData->size,
+        (intType) fd);
+  } /* findPos */
+
+
+
+static uint32Type toEpollEvents (short events)
+
+  {
+    uint32Type epollEvents = 0;
+
+  /* toEpollEvents */
+    if ((events & POLLIN) != 0) {
+      epollEvents |= EPOLLIN;
+    } /* if */
+    if ((events & POLLOUT) != 0) {
+      epollEvents |= EPOLLOUT;
+    } /* if */
+    return epollEvents;
+  } /* toEpollEvents */
+
+
+
+static short fromEpollEvents (uint32Type epollEvents)
+
+  {
+    short events = 0;
+
+  /* fromEpollEvents */
+    if ((epollEvents & EPOLLIN) != 0) {
+      events |= (short) POLLIN;
+    } /* if */
+    if ((epollEvents & EPOLLOUT) != 0) {
+      events |= (short) POLLOUT;
+    } /* if */
+    if ((epollEvents & EPOLLERR) != 0) {
+      events |= (short) POLLERR;
+    } /* if */
+    if ((epollEvents & EPOLLHUP) != 0) {
+      events |= (short) POLLHUP;
+    } /* if */
+    return events;
+  } /* fromEpollEvents */
+
+
+
+/**
+ *  Register the events of 'fd' in the kernel.
+ *  A socket, that is closed without removing its checks, is
+ *  dropped from the epoll set by the kernel. If the file
+ *  descriptor number is reused later EPOLL_CTL_MOD fails with
+ *  ENOENT. Therefore ADD and MOD fall back to each other.
+ *  @return TRUE if the registration succeeded, FALSE otherwise.
+ */
+static boolType registerEvents (int epollFd, int operation, int fd,
+    short events)
+
+  {
+    struct epoll_event epollEvent;
+    int ctl_result;
+
+  /* registerEvents */
+    memset(&epollEvent, 0, sizeof(struct epoll_event));
+    epollEvent.events = toEpollEvents(events);
+    epollEvent.data.fd = fd;
+    ctl_result = epoll_ctl(epollFd, operation, fd, &epollEvent);
+    if (ctl_result != 0) {
+      if (operation == EPOLL_CTL_MOD && errno == ENOENT) {
+        ctl_result = epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &epollEvent);
+      } else if (operation == EPOLL_CTL_ADD && errno == EEXIST) {
+        ctl_result = epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &epollEvent);
+      } /* if */
+    } /* if */
+    if (unlikely(ctl_result != 0)) {
+      logError(printf("registerEvents: epoll_ctl(%d, %d, %d, *) failed:\n"
+                      "%s=%d\nerror: %s\n",
+                      epollFd, operation, fd, ERROR_INFORMATION););
+    } /* if */
+    return ctl_result == 0;
+  } /* registerEvents */
+
+
+
+/**
+ *  Create a new epoll instance and register all sockets of 'pollData'.
+ *  @return the new epoll file descriptor, or -1 if it fails.
+ */
+static int createEpollFd (const const_epoll_based_pollType pollData)
+
+  {
+    memSizeType pos;
+    int epollFd;
+
+  /* createEpollFd */
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (unlikely(epollFd == -1)) {
+      logError(printf("createEpollFd: epoll_create1(EPOLL_CLOEXEC) failed:\n"
+                      "%s=%d\nerror: %s\n",
+                      ERROR_INFORMATION););
+    } else if (pollData != NULL) {
+      for (pos = 0; pos < pollData->size; pos++) {
+        if (unlikely(!registerEvents(epollFd, EPOLL_CTL_ADD,
+                                     pollData->pollFds[pos].fd,
+                                     pollData->pollFds[pos].events))) {
+          close(epollFd);
+          return -1;
+        } /* if */
+      } /* for */
+    } /* if */
+    return epollFd;
+  } /* createEpollFd */
+
+
+
+static void addCheck (const epoll_based_pollType pollData, short eventsToCheck,
+    const socketNumberType aSocket, const rtlValueUnion fileObj)
+
+  {
+    memSizeType pos;
+    struct pollfd *resizedPollFds;
+    rtlValueUnion *resizedPollFiles;
+    struct pollfd *aPollFd;
+    short newEvents;
+
+  /* addCheck */
+    pos = findPos(pollData, (int) aSocket);
+    if (pos == pollData->size) {
+      if (pollData->size >= pollData->capacity) {
+        resizedPollFds = REALLOC_TABLE(pollData->pollFds, struct pollfd,
+            pollData->capacity, pollData->capacity + TABLE_INCREMENT);
+        if (resizedPollFds == NULL) {
+          raise_error(MEMORY_ERROR);
+          return;
+        } else {
+          pollData->pollFds = resizedPollFds;
+          resizedPollFiles = REALLOC_TABLE(pollData->pollFiles, rtlValueUnion,
+              pollData->capacity, pollData->capacity + TABLE_INCREMENT);
+          if (resizedPollFiles == NULL) {
+            raise_error(MEMORY_ERROR);
+            return;
+          } else {
+            pollData->pollFiles = resizedPollFiles;
+            COUNT3_TABLE(struct pollfd, pollData->capacity, pollData->capacity + TABLE_INCREMENT);
+            COUNT3_TABLE(rtlValueUnion, pollData->capacity, pollData->capacity + TABLE_INCREMENT);
+            pollData->capacity += TABLE_INCREMENT;
+          } /* if */
+        } /* if */
+      } /* if */
+      if (unlikely(!registerEvents(pollData->epollFd, EPOLL_CTL_ADD,
+                                   (int) aSocket, eventsToCheck))) {
+        raise_error(FILE_ERROR);
+        return;
+      } /* if */
+      hshIdxEnterGeneric(pollData->indexHash,
+          (genericType) (usocketType) aSocket, (genericType) pos,
+          (intType) aSocket);
+      pollData->size++;
+      aPollFd = &pollData->pollFds[pos];
+      memset(aPollFd, 0, sizeof(struct pollfd));
+      aPollFd->fd = (int) aSocket;
+      aPollFd->events = eventsToCheck;
+      logMessage(printf("addCheck: incrUsageCount(" FMT_U_GEN ")\n",
+                         fileObj.genericValue););
+      pollData->pollFiles[pos] = fileObjectOps.incrUsageCount(fileObj);
+    } else {
+      aPollFd = &pollData->pollFds[pos];
+      newEvents = (short) (aPollFd->events | eventsToCheck);
+      if (newEvents != aPollFd->events) {
+        if (unlikely(!registerEvents(pollData->epollFd, EPOLL_CTL_MOD,
+                                     (int) aSocket, newEvents))) {
+          raise_error(FILE_ERROR);
+          return;
+        } /* if */
+        aPollFd->events = newEvents;
+      } /* if */
+    } /* if */
+    logFunction(printf("addCheck -->\n");
+                dumpPoll((const_pollType) pollData););
+  } /* addCheck */
+
+
+
+static void removeCheck (const epoll_based_pollType pollData, short eventsToCheck,
+    const socketNumberType aSocket)
+
+  {
+    memSizeType pos;
+    struct pollfd *aPollFd;
+    short newEvents;
+    struct epoll_event epollEvent;
+
+  /* removeCheck */
+    pos = findPos(pollData, (int) aSocket);
+    if (pos != pollData->size) {
+      aPollFd = &pollData->pollFds[pos];
+      newEvents = (short) (aPollFd->events & ~eventsToCheck);
+      if (newEvents == 0) {
+        /* The socket might be closed already. In this case the  */
+        /* kernel has removed it and the error can be ignored.   */
+        epoll_ctl(pollData->epollFd, EPOLL_CTL_DEL, (int) aSocket, &epollEvent);
+        logMessage(printf("removeCheck: decrUsageCount(" FMT_U_GEN ")\n",
+                           pollData->pollFiles[pos].genericValue););
+        fileObjectOps.decrUsageCount(pollData->pollFiles[pos]);
+        if (pollData->iteratorMode >= ITER_CHECKS_IN &&
+            pollData->iteratorMode <= ITER_CHECKS_INOUT &&
+            pos + 1 <= pollData->iterPos) {
+          pollData->iterPos--;
+          if (pos < pollData->iterPos) {
+            memcpy(&pollData->pollFds[pos],
+                   &pollData->pollFds[pollData->iterPos], sizeof(struct pollfd));
+            pollData->pollFiles[pos] = pollData->pollFiles[pollData->iterPos];
+            hshSetGeneric(pollData->indexHash,
+                          (genericType) (usocketType) pollData->pollFds[pos].fd,
+                          (intType) (socketNumberType) pollData->pollFds[pos].fd,
+                          (genericType) pos);
+            pos = pollData->iterPos;
+          } /* if */
+        } /* if */
+        pollData->size--;
+        if (pos < pollData->size) {
+          memcpy(&pollData->pollFds[pos],
+                 &pollData->pollFds[pollData->size], sizeof(struct pollfd));
+          pollData->pollFiles[pos] = pollData->pollFiles[pollData->size];
+          hshSetGeneric(pollData->indexHash,
+                        (genericType) (usocketType) pollData->pollFds[pos].fd,
+                        (intType) (socketNumberType) pollData->pollFds[pos].fd,
+                        (genericType) pos);
+        } /* if */
+        hshExclGeneric(pollData->indexHash,
+                       (genericType) (usocketType) aSocket,
+                       (intType) aSocket);
+      } else if (newEvents != aPollFd->events) {
+        if (unlikely(!registerEvents(pollData->epollFd, EPOLL_CTL_MOD,
+                                     (int) aSocket, newEvents))) {
+          raise_error(FILE_ERROR);
+        } else {
+          aPollFd->events = newEvents;
+          aPollFd->revents &= (short) ~eventsToCheck;
+        } /* if */
+      } /* if */
+    } /* if */
+  } /* removeCheck */
+
+
+
+static boolType hasNextCheck (const epoll_based_pollType pollData, short eventsToCheck)
+
+  {
+    register memSizeType pos;
+    boolType hasNext;
+
+  /* hasNextCheck */
+    pos = pollData->iterPos;
+    while (pos < pollData->size &&
+           (pollData->pollFds[pos].events & eventsToCheck) == 0) {
+      pos++;
+    } /* while */
+    hasNext = pos < pollData->size;
+    pollData->iterPos = pos;
+    return hasNext;
+  } /* hasNextCheck */
+
+
+
+/**
+ *  Advance the findings iterator to the next ready socket with
+ *  'eventsToCheck'. Sockets removed after the last polPoll are
+ *  skipped.
+ *  @return the pollFds position of the socket, or pollData->size
+ *          if there is no further finding.
+ */
+static memSizeType skipToFinding (const epoll_based_pollType pollData,
+    short eventsToCheck)
+
+  {
+    register memSizeType readyPos;
+    memSizeType pos = pollData->size;
+
+  /* skipToFinding */
+    readyPos = pollData->iterPos;
+    while (readyPos < pollData->numOfEvents &&
+           ((pos = findPos(pollData, pollData->readyEvents[readyPos].data.fd)) ==
+               pollData->size ||
+           (pollData->pollFds[pos].revents & eventsToCheck) == 0)) {
+      readyPos++;
+    } /* while */
+    pollData->iterPos = readyPos;
+    if (readyPos >= pollData->numOfEvents) {
+      pos = pollData->size;
+    } /* if */
+    return pos;
+  } /* skipToFinding */
+
+
+
+static boolType hasNextFinding (const epoll_based_pollType pollData, short eventsToCheck)
+
+  { /* hasNextFinding */
+    return skipToFinding(pollData, eventsToCheck) != pollData->size;
+  } /* hasNextFinding */
+
+
+
+static rtlValueUnion nextCheck (const epoll_based_pollType pollData,
+    short eventsToCheck, const rtlValueUnion nullFile)
+
+  {
+    rtlValueUnion checkFile;
+
+  /* nextCheck */
+    if (hasNextCheck(pollData, eventsToCheck)) {
+      checkFile = pollData->pollFiles[pollData->iterPos];
+      pollData->iterPos++;
+    } else {
+      checkFile = nullFile;
+    } /* if */
+    logFunction(printf("nextCheck -> " FMT_U_GEN "\n",
+                       checkFile.genericValue);
+                dumpPoll((const_pollType) pollData););
+    return checkFile;
+  } /* nextCheck */
+
+
+
+static rtlValueUnion nextFinding (const epoll_based_pollType pollData,
+    short eventsToCheck, const rtlValueUnion nullFile)
+
+  {
+    memSizeType pos;
+    rtlValueUnion resultFile;
+
+  /* nextFinding */
+    logFunction(printf("nextFinding\n");
+                dumpPoll((const_pollType) pollData););
+    pos = skipToFinding(pollData, eventsToCheck);
+    if (pos != pollData->size) {
+      resultFile = pollData->pollFiles[pos];
+      pollData->iterPos++;
+    } else {
+      resultFile = nullFile;
+    } /* if */
+    logFunction(printf("nextFinding -> " FMT_U_GEN " " FMT_U_MEM "\n",
+                       resultFile.genericValue, pos);
+                dumpPoll((const_pollType) pollData););
+    return resultFile;
+  } /* nextFinding */
+
+
+
+static void doPoll (const epoll_based_pollType pollData, int timeout)
+
+  {
+    memSizeType readyPos;
+    memSizeType pos;
+    int wait_result;
+
+  /* doPoll */
+    logFunction(printf("doPoll(*, %d)\n", timeout);
+                dumpPoll((const_pollType) pollData););
+    /* Only the sockets found by the previous call have findings. */
+    for (readyPos = 0; readyPos < pollData->numOfEvents; readyPos++) {
+      pos = findPos(pollData, pollData->readyEvents[readyPos].data.fd);
+      if (pos != pollData->size) {
+        pollData->pollFds[pos].revents = 0;
+      } /* if */
+    } /* for */
+    pollData->numOfEvents = 0;
+    pollData->iteratorMode = ITER_EMPTY;
+    pollData->iterPos = 0;
+    do {
+      wait_result = epoll_wait(pollData->epollFd, pollData->readyEvents,
+                               READY_TABLE_SIZE, timeout);
+    } while (unlikely(wait_result == -1 && errno == EINTR));
+    if (unlikely(wait_result < 0)) {
+      logError(printf("doPoll: epoll_wait(%d, *, %d, %d) failed:\n"
+                      "%s=%d\nerror: %s\n",
+                      pollData->epollFd, READY_TABLE_SIZE, timeout,
+                      ERROR_INFORMATION););
+      raise_error(FILE_ERROR);
+    } else {
+      pollData->numOfEvents = (memSizeType) wait_result;
+      for (readyPos = 0; readyPos < pollData->numOfEvents; readyPos++) {
+        pos = findPos(pollData, pollData->readyEvents[readyPos].data.fd);
+        if (pos != pollData->size) {
+          pollData->pollFds[pos].revents =
+              fromEpollEvents(pollData->readyEvents[readyPos].events);
+        } /* if */
+      } /* for */
+    } /* if */
+    logFunction(printf("doPoll -->\n");
+                dumpPoll((const_pollType) pollData););
+  } /* doPoll */
+
+
+
+/**
+ *  Add 'eventsToCheck' for 'aSocket' to 'pollData'.
+ *  'EventsToCheck' can have one of the following values:
+ *  - POLLIN check if data can be read from the corresponding socket.
+ *  - POLLOUT check if data can be written to the corresponding socket.
+ *  - POLLINOUT check if data can be read or written (POLLIN or POLLOUT).
+ *
+ *  @param pollData Poll data to which the event checks are added.
+ *  @param aSocket Socket for which the events should be checked.
+ *  @param eventsToCheck Events to be added to the checkedEvents
+ *         field of 'pollData'.
+ *  @param fileObj File to be returned, if the iterator returns
+ *         files in 'pollData'.
+ *  @exception RANGE_ERROR Illegal value for 'eventsToCheck'.
+ *  @exception MEMORY_ERROR An out of memory situation occurred.
+ *  @exception FILE_ERROR The socket cannot be registered by epoll.
+ */
+void polAddCheck (const pollType pollData, const socketType aSocket,
+    intType eventsToCheck, const rtlValueUnion fileObj)
+
+  { /* polAddCheck */
+    logFunction(printf("polAddCheck(" FMT_U_MEM ", %d, " FMT_X ", "
+                       FMT_U_GEN ")\n",
+                       (memSizeType) pollData,
+                       aSocket != NULL ? aSocket->socketNumber : 0,
+                       eventsToCheck, fileObj.genericValue););
+    if (unlikely(aSocket->socketNumber == EMPTY_SOCKET)) {
+      logError(printf("polAddCheck(" FMT_U_MEM ", %d, " FMT_X ", "
+                      FMT_U_GEN "): Attempt to use a closed socket.\n",
+                      (memSizeType) pollData, aSocket->socketNumber,
+                      eventsToCheck, fileObj.genericValue););
+      raise_error(FILE_ERROR);
+    } else {
+      switch (eventsToCheck) {
+        case POLL_IN:
+          addCheck(var_conv(pollData), POLLIN,
+                   aSocket->socketNumber, fileObj);
+          break;
+        case POLL_OUT:
+          addCheck(var_conv(pollData), POLLOUT,
+                   aSocket->socketNumber, fileObj);
+          break;
+        case POLL_INOUT:
+          addCheck(var_conv(pollData), POLLIN | POLLOUT,
+                   aSocket->socketNumber, fileObj);
+          break;
+        default:
+          raise_error(RANGE_ERROR);
+          break;
+      } /* switch */
+    } /* if */
+  } /* polAddCheck */
+
+
+
+/**
+ *  Clears 'pollData'.
+ *  All sockets and all events are removed from 'pollData' and
+ *  the iterator is reset, such that polHasNext() returns FALSE.
+ *  @exception FILE_ERROR A new epoll instance cannot be created.
+ */
+void polClear (const pollType pollData)
+
+  {
+    memSizeType pos;
+    int epollFd;
+
+  /* polClear */
+    for (pos = 0; pos < conv(pollData)->size; pos++) {
+      logMessage(printf("polClear: decrUsageCount(" FMT_U_GEN ")\n",
+                         conv(pollData)->pollFiles[pos].genericValue););
+      fileObjectOps.decrUsageCount(conv(pollData)->pollFiles[pos]);
+    } /* for */
+    if (conv(pollData)->size != 0) {
+      /* Closing the epoll instance is cheaper than deregistering */
+      /* every socket with a separate epoll_ctl() call.           */
+      epollFd = createEpollFd(NULL);
+      if (unlikely(epollFd == -1)) {
+        raise_error(FILE_ERROR);
+      } else {
+        close(conv(pollData)->epollFd);
+        var_conv(pollData)->epollFd = epollFd;
+      } /* if */
+    } /* if */
+    var_conv(pollData)->size = 0;
+    var_conv(pollData)->iteratorMode = ITER_EMPTY;
+    var_conv(pollData)->iterPos = 0;
+    var_conv(pollData)->numOfEvents = 0;
+    hshDestr(conv(pollData)->indexHash, (destrFuncType) &valueDestr,
+             (destrFuncType) &valueDestr);
+    var_conv(pollData)->indexHash = hshEmpty();
+  } /* polClear */
+
+
+
+/**
+ *  Assign source to dest.
+ *  A copy function assumes that dest contains a legal value.
+ *  The sockets of source are registered in a new epoll instance.
+ *  @exception MEMORY_ERROR Not enough memory to create dest.
+ *  @exception FILE_ERROR A new epoll instance cannot be created.
+ */
+void polCpy (const pollType dest, const const_pollType source)
+
+  {
+    epoll_based_pollType pollData;
+    rtlHashType newIndexHash;
+    struct pollfd *newPollFds;
+    memSizeType newPollFilesCapacity;
+    rtlValueUnion *newPollFiles;
+    rtlValueUnion *oldPollFiles;
+    memSizeType oldPollFilesSize;
+    memSizeType oldPollFilesCapacity;
+    int newEpollFd;
+    memSizeType pos;
+
+  /* polCpy */
+    logFunction(printf("polCpy(" FMT_U_MEM ", " FMT_U_MEM ")\n",
+                       (memSizeType) dest, (memSizeType) source););
+    if (dest != source) {
+      newEpollFd = createEpollFd(conv(source));
+      if (unlikely(newEpollFd == -1)) {
+        raise_error(FILE_ERROR);
+        return;
+      } /* if */
+      pollData = var_conv(dest);
+      oldPollFiles = pollData->pollFiles;
+      oldPollFilesSize = pollData->size;
+      oldPollFilesCapacity = pollData->capacity;
+      if (conv(source)->size > pollData->capacity) {
+        newPollFilesCapacity = conv(source)->capacity;
+      } else {
+        newPollFilesCapacity = pollData->capacity;
+      } /* if */
+      if (unlikely(!ALLOC_TABLE(newPollFiles, rtlValueUnion, newPollFilesCapacity))) {
+        close(newEpollFd);
+        raise_error(MEMORY_ERROR);
+        return;
+      } else {
+        if (conv(source)->size > pollData->capacity) {
+          if (unlikely(!ALLOC_TABLE(newPollFds, struct pollfd, conv(source)->capacity))) {
+            FREE_TABLE(newPollFiles, rtlValueUnion, newPollFilesCapacity);
+            close(newEpollFd);
+            raise_error(MEMORY_ERROR);
+            return;
+          } else {
+            FREE_TABLE(pollData->pollFds, struct pollfd, pollData->capacity);
+            pollData->capacity = conv(source)->capacity;
+            pollData->pollFds = newPollFds;
+          } /* if */
+        } /* if */
+      } /* if */
+      newIndexHash = hshCreate(conv(source)->indexHash,
+          (createFuncType) &valueCreate, (destrFuncType) &valueDestr,
+          (createFuncType) &valueCreate, (destrFuncType) &valueDestr);
+      hshDestr(pollData->indexHash, (destrFuncType) &valueDestr,
+               (destrFuncType) &valueDestr);
+      close(pollData->epollFd);
+      pollData->epollFd = newEpollFd;
+      pollData->size = conv(source)->size;
+      pollData->iteratorMode = conv(source)->iteratorMode;
+      pollData->iterPos = conv(source)->iterPos;
+      pollData->numOfEvents = conv(source)->numOfEvents;
+      pollData->pollFiles = newPollFiles;
+      memcpy(pollData->pollFds, conv(source)->pollFds,
+             pollData->size * sizeof(struct pollfd));
+      memcpy(pollData->readyEvents, conv(source)->readyEvents,
+             pollData->numOfEvents * sizeof(struct epoll_event));
+      pollData->indexHash = newIndexHash;
+      for (pos = 0; pos < pollData->size; pos++) {
+        logMessage(printf("polCpy: incrUsageCount(" FMT_U_GEN ")\n",
+                           conv(source)->pollFiles[pos].genericValue););
+        newPollFiles[pos] = fileObjectOps.incrUsageCount(conv(source)->pollFiles[pos]);
+      } /* for */
+      for (pos = 0; pos < oldPollFilesSize; pos++) {
+        logMessage(printf("polCpy: decrUsageCount(" FMT_U_GEN ")\n",
+                           oldPollFiles[pos].genericValue););
+        fileObjectOps.decrUsageCount(oldPollFiles[pos]);
+      } /* for */
+      FREE_TABLE(oldPollFiles, rtlValueUnion, oldPollFilesCapacity);
+    } /* if */
+    logFunction(printf("polCpy -->\n");
+                dumpPoll(dest););
+  } /* polCpy */
+
+
+
+/**
+ *  Return a copy of source, that can be assigned to a new destination.
+ *  It is assumed that the destination of the assignment is undefined.
+ *  Create functions can be used to initialize Seed7 constants.
+ *  The sockets of source are registered in a new epoll instance.
+ *  @return a copy of source.
+ *  @exception MEMORY_ERROR Not enough memory to represent the result.
+ *  @exception FILE_ERROR A new epoll instance cannot be created.
+ */
+pollType polCreate (const const_pollType source)
+
+  {
+    memSizeType pos;
+    epoll_based_pollType result;
+
+  /* polCreate */
+    logFunction(printf("polCreate(" FMT_U_MEM ")\n",
+                       (memSizeType) source););
+    if (unlikely(!ALLOC_RECORD(result, epoll_based_pollRecord, count.polldata))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      if (unlikely(!ALLOC_TABLE(result->pollFds, struct pollfd, conv(source)->capacity))) {
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else if (unlikely(!ALLOC_TABLE(result->pollFiles, rtlValueUnion,
+                                       conv(source)->capacity))) {
+        FREE_TABLE(result->pollFds, struct pollfd, conv(source)->capacity);
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else if (unlikely(!ALLOC_TABLE(result->readyEvents, struct epoll_event,
+                                       READY_TABLE_SIZE))) {
+        FREE_TABLE(result->pollFiles, rtlValueUnion, conv(source)->capacity);
+        FREE_TABLE(result->pollFds, struct pollfd, conv(source)->capacity);
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else {
+        result->epollFd = createEpollFd(conv(source));
+        if (unlikely(result->epollFd == -1)) {
+          FREE_TABLE(result->readyEvents, struct epoll_event, READY_TABLE_SIZE);
+          FREE_TABLE(result->pollFiles, rtlValueUnion, conv(source)->capacity);
+          FREE_TABLE(result->pollFds, struct pollfd, conv(source)->capacity);
+          FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+          raise_error(FILE_ERROR);
+          result = NULL;
+        } else {
+          result->indexHash = hshCreate(conv(source)->indexHash,
+              (createFuncType) &valueCreate, (destrFuncType) &valueDestr,
+              (createFuncType) &valueCreate, (destrFuncType) &valueDestr);
+          result->size = conv(source)->size;
+          result->capacity = conv(source)->capacity;
+          result->iteratorMode = conv(source)->iteratorMode;
+          result->iterPos = conv(source)->iterPos;
+          result->numOfEvents = conv(source)->numOfEvents;
+          memcpy(result->pollFds, conv(source)->pollFds,
+                 conv(source)->size * sizeof(struct pollfd));
+          memcpy(result->readyEvents, conv(source)->readyEvents,
+                 conv(source)->numOfEvents * sizeof(struct epoll_event));
+          for (pos = 0; pos < conv(source)->size; pos++) {
+            logMessage(printf("polCreate: incrUsageCount(" FMT_U_GEN ")\n",
+                               conv(source)->pollFiles[pos].genericValue););
+            result->pollFiles[pos] = fileObjectOps.incrUsageCount(conv(source)->pollFiles[pos]);
+          } /* for */
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("polCreate --> " FMT_U_MEM "\n",
+                       (memSizeType) result);
+                dumpPoll((pollType) result););
+    return (pollType) result;
+  } /* polCreate */
+
+
+
+/**
+ *  Free the memory referred by 'oldPollData'.
+ *  After polDestr is left 'oldPollData' refers to not existing memory.
+ *  The memory where 'oldPollData' is stored can be freed afterwards.
+ */
+void polDestr (const pollType oldPollData)
+
+  {
+    memSizeType pos;
+
+  /* polDestr */
+    if (oldPollData != NULL) {
+      for (pos = 0; pos < conv(oldPollData)->size; pos++) {
+        logMessage(printf("polDestr: decrUsageCount(" FMT_U_GEN ")\n",
+                           conv(oldPollData)->pollFiles[pos].genericValue););
+        fileObjectOps.decrUsageCount(conv(oldPollData)->pollFiles[pos]);
+      } /* for */
+      close(conv(oldPollData)->epollFd);
+      FREE_TABLE(conv(oldPollData)->pollFds, struct pollfd, conv(oldPollData)->capacity);
+      FREE_TABLE(conv(oldPollData)->pollFiles, rtlValueUnion, conv(oldPollData)->capacity);
+      FREE_TABLE(conv(oldPollData)->readyEvents, struct epoll_event, READY_TABLE_SIZE);
+      hshDestr(conv(oldPollData)->indexHash, (destrFuncType) &valueDestr,
+               (destrFuncType) &valueDestr);
+      FREE_RECORD(var_conv(oldPollData), epoll_based_pollRecord, count.polldata);
+    } /* if */
+  } /* polDestr */
+
+
+
+/**
+ *  Create an empty poll data value.
+ *  @return an empty poll data value.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ *  @exception FILE_ERROR The epoll instance cannot be created.
+ */
+pollType polEmpty (void)
+
+  {
+    epoll_based_pollType result;
+
+  /* polEmpty */
+    if (unlikely(!ALLOC_RECORD(result, epoll_based_pollRecord, count.polldata))) {
+      raise_error(MEMORY_ERROR);
+    } else {
+      if (unlikely(!ALLOC_TABLE(result->pollFds, struct pollfd, TABLE_START_SIZE))) {
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else if (unlikely(!ALLOC_TABLE(result->pollFiles, rtlValueUnion,
+                                       TABLE_START_SIZE))) {
+        FREE_TABLE(result->pollFds, struct pollfd, TABLE_START_SIZE);
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else if (unlikely(!ALLOC_TABLE(result->readyEvents, struct epoll_event,
+                                       READY_TABLE_SIZE))) {
+        FREE_TABLE(result->pollFiles, rtlValueUnion, TABLE_START_SIZE);
+        FREE_TABLE(result->pollFds, struct pollfd, TABLE_START_SIZE);
+        FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+        raise_error(MEMORY_ERROR);
+        result = NULL;
+      } else {
+        result->epollFd = createEpollFd(NULL);
+        if (unlikely(result->epollFd == -1)) {
+          FREE_TABLE(result->readyEvents, struct epoll_event, READY_TABLE_SIZE);
+          FREE_TABLE(result->pollFiles, rtlValueUnion, TABLE_START_SIZE);
+          FREE_TABLE(result->pollFds, struct pollfd, TABLE_START_SIZE);
+          FREE_RECORD(result, epoll_based_pollRecord, count.polldata);
+          raise_error(FILE_ERROR);
+          result = NULL;
+        } else {
+          result->indexHash = hshEmpty();
+          result->size = 0;
+          result->capacity = TABLE_START_SIZE;
+          result->iteratorMode = ITER_EMPTY;
+          result->iterPos = 0;
+          result->numOfEvents = 0;
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("polEmpty --> " FMT_U_MEM "\n",
+                       (memSizeType) result);
+                dumpPoll((pollType) result););
+    return (pollType) result;
+  } /* polEmpty */
+
+
+
+/**
+ *  Return the checkedEvents field from 'pollData' for 'aSocket'.
+ *  The polPoll function uses the checkedEvents as input.
+ *  The following checkedEvents can be returned:
+ *  - POLLNOTHING no data can be read or written.
+ *  - POLLIN data can be read from the corresponding socket.
+ *  - POLLOUT data can be written to the corresponding socket.
+ *  - POLLINOUT data can be read and written (POLLIN and POLLOUT).
+ *
+ *  @param pollData Poll data from which the checkedEvents are
+ *         retrieved.
+ *  @param aSocket Socket for which the checkedEvents are retrieved.
+ *  @return POLLNOTHING, POLLIN, POLLOUT or POLLINOUT, depending on
+ *          the events added and removed for 'aSocket' with
+ *          'addCheck' and 'removeCheck'.
+ */
+intType polGetCheck (const const_pollType pollData, const socketType aSocket)
+
+  {
+    memSizeType pos;
+    short events;
+    intType result;
+
+  /* polGetCheck */
+    logFunction(printf("polGetCheck(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) pollData,
+                       aSocket != NULL ?
+                           aSocket->socketNumber : 0););
+    if (unlikely(aSocket->socketNumber == EMPTY_SOCKET)) {
+      logError(printf("polGetCheck(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) pollData,
+                       aSocket->socketNumber););
+      raise_error(FILE_ERROR);
+      result = 0;
+    } else {
+      pos = findPos(conv(pollData), (int) aSocket->socketNumber);
+      if (pos == conv(pollData)->size) {
+        result = POLL_NOTHING;
+      } else {
+        events = conv(pollData)->pollFds[pos].events;
+        if ((events & POLLIN) != 0) {
+          if ((events & POLLOUT) != 0) {
+            result = POLL_INOUT;
+          } else {
+            result = POLL_IN;
+          } /* if */
+        } else if ((events & POLLOUT) != 0) {
+          result = POLL_OUT;
+        } else {
+          result = POLL_NOTHING;
+        } /* if */
+      } /* if */
+    } /* if */
+    return result;
+  } /* polGetCheck */
+
+
+
+/**
+ *  Return the eventFindings field from 'pollData' for 'aSocket'.
+ *  The polPoll function assigns the
+ *  eventFindings for 'aSocket' to 'pollData'. The following
+ *  eventFindings can be returned:
+ *  - POLLNOTHING no data can be read or written.
+ *  - POLLIN data can be read from the corresponding socket.
+ *  - POLLOUT data can be written to the corresponding socket.
+ *  - POLLINOUT data can be read and written (POLLIN and POLLOUT).
+ *
+ *  @return POLLNOTHING, POLLIN, POLLOUT or POLLINOUT, depending on
+ *          the findings of polPoll concerning 'aSocket'.
+ */
+intType polGetFinding (const const_pollType pollData, const socketType aSocket)
+
+  {
+    memSizeType pos;
+    short revents;
+    intType result;
+
+  /* polGetFinding */
+    logFunction(printf("polGetFinding(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) pollData,
+                       aSocket != NULL ?
+                           aSocket->socketNumber : 0););
+    if (unlikely(aSocket->socketNumber == EMPTY_SOCKET)) {
+      logError(printf("polGetFinding(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) pollData,
+                       aSocket->socketNumber););
+      raise_error(FILE_ERROR);
+      result = 0;
+    } else {
+      pos = findPos(conv(pollData), (int) aSocket->socketNumber);
+      if (pos == conv(pollData)->size) {
+        result = POLL_NOTHING;
+      } else {
+        revents = conv(pollData)->pollFds[pos].revents;
+        if ((revents & POLLIN) != 0) {
+          if ((revents & POLLOUT) != 0) {
+            result = POLL_INOUT;
+          } else {
+            result = POLL_IN;
+          } /* if */
+        } else if ((revents & POLLOUT) != 0) {
+          result = POLL_OUT;
+        } else {
+          result = POLL_NOTHING;
+        } /* if */
+      } /* if */
+    } /* if */
+    return result;
+  } /* polGetFinding */
+
+
+
+/**
+ *  Determine if the 'pollData' iterator can deliver another file.
+ *  @return TRUE if 'nextFile' would return another file from the
+ *          'pollData' iterator, FALSE otherwise.
+ */
+boolType polHasNext (const pollType pollData)
+
+  { /* polHasNext */
+    switch (conv(pollData)->iteratorMode) {
+      case ITER_CHECKS_IN:
+        return hasNextCheck(var_conv(pollData), POLLIN);
+      case ITER_CHECKS_OUT:
+        return hasNextCheck(var_conv(pollData), POLLOUT);
+      case ITER_CHECKS_INOUT:
+        return hasNextCheck(var_conv(pollData), POLLIN | POLLOUT);
+      case ITER_FINDINGS_IN:
+        return hasNextFinding(var_conv(pollData), POLLIN);
+      case ITER_FINDINGS_OUT:
+        return hasNextFinding(var_conv(pollData), POLLOUT);
+      case ITER_FINDINGS_INOUT:
+        return hasNextFinding(var_conv(pollData), POLLIN | POLLOUT);
+      case ITER_EMPTY:
+      default:
+        return FALSE;
+    } /* switch */
+  } /* polHasNext */
+
+
+
+/**
+ *  Reset the 'pollData' iterator to process checkedEvents.
+ *  The following calls of 'hasNext' and 'nextFile' refer to
+ *  the checkedEvents of the given 'pollMode'. 'PollMode'
+ *  can have one of the following values:
+ *  - POLLNOTHING don't iterate ('hasNext' returns FALSE).
+ *  - POLLIN data can be read from the corresponding socket.
+ *  - POLLOUT data can be written to the corresponding socket.
+ *  - POLLINOUT data can be read or written (POLLIN and POLLOUT).
+ *
+ *  @exception RANGE_ERROR Illegal value for 'pollMode'.
+ */
+void polIterChecks (const pollType pollData, intType pollMode)
+
+  { /* polIterChecks */
+    switch (pollMode) {
+      case POLL_NOTHING:
+        var_conv(pollData)->iteratorMode = ITER_EMPTY;
+        break;
+      case POLL_IN:
+        var_conv(pollData)->iteratorMode = ITER_CHECKS_IN;
+        break;
+      case POLL_OUT:
+        var_conv(pollData)->iteratorMode = ITER_CHECKS_OUT;
+        break;
+      case POLL_INOUT:
+        var_conv(pollData)->iteratorMode = ITER_CHECKS_INOUT;
+        break;
+      default:
+        raise_error(RANGE_ERROR);
+        break;
+    } /* switch */
+    var_conv(pollData)->iterPos = 0;
+  } /* polIterChecks */
+
+
+
+/**
+ *  Reset the 'pollData' iterator to process eventFindings.
+ *  The following calls of 'hasNext' and 'nextFile' refer to
+ *  the eventFindings of the given 'pollMode'. 'PollMode'
+ *  can have one of the following values:
+ *  - POLLNOTHING don't iterate ('hasNext' returns FALSE).
+ *  - POLLIN data can be read from the corresponding socket.
+ *  - POLLOUT data can be written to the corresponding socket.
+ *  - POLLINOUT data can be read or written (POLLIN and POLLOUT).
+ *
+ *  @exception RANGE_ERROR Illegal value for 'pollMode'.
+ */
+void polIterFindings (const pollType pollData, intType pollMode)
+
+  { /* polIterFindings */
+    switch (pollMode) {
+      case POLL_NOTHING:
+        var_conv(pollData)->iteratorMode = ITER_EMPTY;
+        break;
+      case POLL_IN:
+        var_conv(pollData)->iteratorMode = ITER_FINDINGS_IN;
+        break;
+      case POLL_OUT:
+        var_conv(pollData)->iteratorMode = ITER_FINDINGS_OUT;
+        break;
+      case POLL_INOUT:
+        var_conv(pollData)->iteratorMode = ITER_FINDINGS_INOUT;
+        break;
+      default:
+        raise_error(RANGE_ERROR);
+        break;
+    } /* switch */
+    var_conv(pollData)->iterPos = 0;
+  } /* polIterFindings */
+
+
+
+/**
+ *  Get the next file from the 'pollData' iterator.
+ *  Successive calls of 'nextFile' return all files from the 'pollData'
+ *  iterator. The file returned by 'nextFile' is determined with the
+ *  function 'addCheck'. The files covered by the 'pollData' iterator
+ *  are determined with 'iterChecks' or 'iterFindings'.
+ *  @return the next file from the 'pollData' iterator, or
+ *          STD_NULL if no file from the 'pollData' iterator is available.
+ */
+rtlValueUnion polNextFile (const pollType pollData, const rtlValueUnion nullFile)
+
+  {
+    rtlValueUnion nextFile;
+
+  /* polNextFile */
+    switch (conv(pollData)->iteratorMode) {
+      case ITER_CHECKS_IN:
+        nextFile = nextCheck(var_conv(pollData), POLLIN, nullFile);
+        break;
+      case ITER_CHECKS_OUT:
+        nextFile = nextCheck(var_conv(pollData), POLLOUT, nullFile);
+        break;
+      case ITER_CHECKS_INOUT:
+        nextFile = nextCheck(var_conv(pollData), POLLIN | POLLOUT, nullFile);
+        break;
+      case ITER_FINDINGS_IN:
+        nextFile = nextFinding(var_conv(pollData), POLLIN, nullFile);
+        break;
+      case ITER_FINDINGS_OUT:
+        nextFile = nextFinding(var_conv(pollData), POLLOUT, nullFile);
+        break;
+      case ITER_FINDINGS_INOUT:
+        nextFile = nextFinding(var_conv(pollData), POLLIN | POLLOUT, nullFile);
+        break;
+      case ITER_EMPTY:
+      default:
+        nextFile = nullFile;
+        break;
+    } /* switch */
+    return nextFile;
+  } /* polNextFile */
+
+
+
+/**
+ *  Waits for one or more of the checkedEvents from 'pollData'.
+ *  polPoll waits until one of the checkedEvents for a
+ *  corresponding socket occurs. If a checked event occurs
+ *  the eventFindings field is assigned a value. The following
+ *  eventFindings values are assigned:
+ *  - POLLIN data can be read from the corresponding socket.
+ *  - POLLOUT data can be written to the corresponding socket.
+ *  - POLLINOUT data can be read and written (POLLIN and POLLOUT).
+ *
+ *  @exception FILE_ERROR The system function returns an error.
+ */
+void polPoll (const pollType pollData)
+
+  { /* polPoll */
+    doPoll(var_conv(pollData), -1);
+  } /* polPoll */
+
+
+
+/**
+ *  Waits for one or more of the checkedEvents from 'pollData'
+ *  or until the timeout is reached.
+ *  If the timeout is reached before a checked event occurs
+ *  all eventFindings are POLLNOTHING and the findings iterator
+ *  is empty. Otherwise polPollTimeout works like polPoll.
+ *  @param seconds Seconds part of the timeout.
+ *  @param micro_seconds Micro seconds part of the timeout.
+ *  @exception RANGE_ERROR The timeout is negative or too big.
+ *  @exception FILE_ERROR The system function returns an error.
+ */
+void polPollTimeout (const pollType pollData, intType seconds,
+    intType micro_seconds)
+
+  { /* polPollTimeout */
+    logFunction(printf("polPollTimeout(" FMT_U_MEM ", " FMT_D ", " FMT_D ")\n",
+                       (memSizeType) pollData, seconds, micro_seconds););
+    if (unlikely(seconds < 0 || seconds >= INT_MAX / 1000 ||
+                 micro_seconds < 0 || micro_seconds >= 1000000)) {
+      logError(printf("polPollTimeout(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "seconds or micro_seconds not in allowed range.\n",
+                      (memSizeType) pollData, seconds, micro_seconds););
+      raise_error(RANGE_ERROR);
+    } else {
+      /* Round up, such that a short timeout does not busy wait. */
+      doPoll(var_conv(pollData),
+             (int) seconds * 1000 + (int) ((micro_seconds + 999) / 1000));
+    } /* if */
+  } /* polPollTimeout */
+
+
+
+/**
+ *  Remove 'eventsToCheck' for 'aSocket' from 'pollData'.
+ *  'EventsToCheck' can have one of the following values:
+ *  - POLLIN check if data can be read from the corresponding socket.
+ *  - POLLOUT check if data can be written to the corresponding socket.
+ *  - POLLINOUT check if data can be read or written (POLLIN or POLLOUT).
+ *
+ *  @param pollData Poll data from which the event checks are removed.
+ *  @param aSocket Socket for which the events should not be checked.
+ *  @param eventsToCheck Events to be removed from the checkedEvents
+ *         field of 'pollData'.
+ *  @exception RANGE_ERROR Illegal value for 'eventsToCheck'.
+ */
+void polRemoveCheck (const pollType pollData, const socketType aSocket,
+    intType eventsToCheck)
+
+  { /* polRemoveCheck */
+    logFunction(printf("polRemoveCheck(" FMT_U_MEM ", %d, " FMT_X ")\n",
+                       (memSizeType) pollData,
+                       aSocket != NULL ? aSocket->socketNumber : 0,
+                       eventsToCheck););
+    if (unlikely(aSocket->socketNumber == EMPTY_SOCKET)) {
+      logError(printf("polRemoveCheck(" FMT_U_MEM ", %d, " FMT_X ")\n",
+                       (memSizeType) pollData, aSocket->socketNumber,
+                       eventsToCheck););
+      raise_error(FILE_ERROR);
+    } else {
+      switch (eventsToCheck) {
+        case POLL_IN:
+          removeCheck(var_conv(pollData), POLLIN,
+                      aSocket->socketNumber);
+          break;
+        case POLL_OUT:
+          removeCheck(var_conv(pollData), POLLOUT,
+                      aSocket->socketNumber);
+          break;
+        case POLL_INOUT:
+          removeCheck(var_conv(pollData), POLLIN | POLLOUT,
+                      aSocket->socketNumber);
+          break;
+        default:
+          raise_error(RANGE_ERROR);
+          break;
+      } /* switch */
+    } /* if */
+  } /* polRemoveCheck */
+
+#endif
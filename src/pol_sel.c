@@ -37,6 +37,7 @@
 #include "stdlib.h"
 #include "stdio.h"
 #include "string.h"
+#include "limits.h"
 #if SOCKET_LIB == WINSOCK_SOCKETS
 #define FD_SETSIZE 65536
 #include "winsock2.h"
@@ -1454,6 +1455,39 @@ void polPoll (const pollType pollData)
 
 
 
+/**
+ *  Waits for one or more of the checkedEvents from 'pollData'
+ *  or until the timeout is reached.
+ *  If the timeout is reached before a checked event occurs
+ *  all eventFindings are POLLNOTHING and the findings iterator
+ *  is empty. Otherwise polPollTimeout works like polPoll.
+ *  @param seconds Seconds part of the timeout.
+ *  @param micro_seconds Micro seconds part of the timeout.
+ *  @exception RANGE_ERROR The timeout is negative or too big.
+ *  @exception FILE_ERROR The system function returns an error.
+ */
+void polPollTimeout (const pollType pollData, intType seconds,
+    intType micro_seconds)
+
+  {
+    struct timeval timeout;
+
+  /* polPollTimeout */
+    if (unlikely(seconds < 0 || seconds >= INT_MAX / 1000 ||
+                 micro_seconds < 0 || micro_seconds >= 1000000)) {
+      logError(printf("polPollTimeout(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "seconds or micro_seconds not in allowed range.\n",
+                      (memSizeType) pollData, seconds, micro_seconds););
+      raise_error(RANGE_ERROR);
+    } else {
+      timeout.tv_sec = (long) seconds;
+      timeout.tv_usec = (long) micro_seconds;
+      doPoll(pollData, &timeout);
+    } /* if */
+  } /* polPollTimeout */
+
+
+
 /**
  *  Remove 'eventsToCheck' for 'aSocket' from 'pollData'.
  *  'EventsToCheck' can have one of the following values:
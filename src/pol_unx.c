@@ -34,9 +34,11 @@
 
 #include "version.h"
 
+#if !HAS_EPOLL
 #include "stdlib.h"
 #include "stdio.h"
 #include "string.h"
+#include "limits.h"
 #if SOCKET_LIB == WINSOCK_SOCKETS
 #include "winsock2.h"
 /* #define os_poll WSAPoll  - available with Vista */
@@ -357,6 +359,32 @@ static rtlValueUnion nextFinding (const poll_based_pollType pollData,
 
 
 
+static void doPoll (const pollType pollData, int timeout)
+
+  {
+    int poll_result;
+
+  /* doPoll */
+    logFunction(printf("doPoll(*, %d)\n", timeout);
+                dumpPoll(pollData););
+    do {
+      poll_result = os_poll(conv(pollData)->pollFds, conv(pollData)->size, timeout);
+    } while (unlikely(poll_result == -1 && errno == EINTR));
+    if (unlikely(poll_result < 0)) {
+      logError(printf("doPoll: poll(*, " FMT_U_MEM ", %d) failed:\n"
+                      "%s=%d\nerror: %s\n",
+                      conv(pollData)->size, timeout, ERROR_INFORMATION););
+      raise_error(FILE_ERROR);
+    } else {
+      var_conv(pollData)->iteratorMode = ITER_EMPTY;
+      var_conv(pollData)->iterPos = 0;
+      var_conv(pollData)->numOfEvents = (memSizeType) poll_result;
+    } /* if */
+    logFunction(printf("doPoll -->\n"););
+  } /* doPoll */
+
+
+
 /**
  *  Add 'eventsToCheck' for 'aSocket' to 'pollData'.
  *  'EventsToCheck' can have one of the following values:
@@ -933,27 +961,39 @@ rtlValueUnion polNextFile (const pollType pollData, const rtlValueUnion nullFile
  */
 void polPoll (const pollType pollData)
 
-  {
-    int poll_result;
+  { /* polPoll */
+    doPoll(pollData, -1);
+  } /* polPoll */
 
-  /* polPoll */
-    logFunction(printf("polPoll\n");
-                dumpPoll(pollData););
-    do {
-      poll_result = os_poll(conv(pollData)->pollFds, conv(pollData)->size, -1); /* &timeout); */
-    } while (unlikely(poll_result == -1 && errno == EINTR));
-    if (unlikely(poll_result < 0)) {
-      logError(printf("polPoll: poll(*, " FMT_U_MEM ", -1) failed:\n"
-                      "%s=%d\nerror: %s\n",
-                      conv(pollData)->size, ERROR_INFORMATION););
-      raise_error(FILE_ERROR);
+
+
+/**
+ *  Waits for one or more of the checkedEvents from 'pollData'
+ *  or until the timeout is reached.
+ *  If the timeout is reached before a checked event occurs
+ *  all eventFindings are POLLNOTHING and the findings iterator
+ *  is empty. Otherwise polPollTimeout works like polPoll.
+ *  @param seconds Seconds part of the timeout.
+ *  @param micro_seconds Micro seconds part of the timeout.
+ *  @exception RANGE_ERROR The timeout is negative or too big.
+ *  @exception FILE_ERROR The system function returns an error.
+ */
+void polPollTimeout (const pollType pollData, intType seconds,
+    intType micro_seconds)
+
+  { /* polPollTimeout */
+    if (unlikely(seconds < 0 || seconds >= INT_MAX / 1000 ||
+                 micro_seconds < 0 || micro_seconds >= 1000000)) {
+      logError(printf("polPollTimeout(" FMT_U_MEM ", " FMT_D ", " FMT_D "): "
+                      "seconds or micro_seconds not in allowed range.\n",
+                      (memSizeType) pollData, seconds, micro_seconds););
+      raise_error(RANGE_ERROR);
     } else {
-      var_conv(pollData)->iteratorMode = ITER_EMPTY;
-      var_conv(pollData)->iterPos = 0;
-      var_conv(pollData)->numOfEvents = (memSizeType) poll_result;
+      /* Round up, such that a short timeout does not busy wait. */
+      doPoll(pollData,
+             (int) seconds * 1000 + (int) ((micro_seconds + 999) / 1000));
     } /* if */
-    logFunction(printf("polPoll -->\n"););
-  } /* polPoll */
+  } /* polPollTimeout */
 
 
 
@@ -1003,3 +1043,5 @@ void polRemoveCheck (const pollType pollData, const socketType aSocket,
       } /* switch */
     } /* if */
   } /* polRemoveCheck */
+
+#endif
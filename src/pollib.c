@@ -389,6 +389,20 @@ objectType pol_poll (listType arguments)
 
 
 
+objectType pol_poll_timeout (listType arguments)
+
+  { /* pol_poll_timeout */
+    isit_poll(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_int(arg_3(arguments));
+    polPollTimeout(take_poll(arg_1(arguments)),
+                   take_int(arg_2(arguments)),
+                   take_int(arg_3(arguments)));
+    return SYS_EMPTY_OBJECT;
+  } /* pol_poll_timeout */
+
+
+
 /**
  *  Remove eventsToCheck/arg_3 for aSocket/arg_2 from pollData/arg_1.
  *  EventsToCheck/arg_3 can have one of the following values:
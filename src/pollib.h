@@ -38,5 +38,6 @@ objectType pol_iter_checks   (listType arguments);
 objectType pol_iter_findings (listType arguments);
 objectType pol_next_file     (listType arguments);
 objectType pol_poll          (listType arguments);
+objectType pol_poll_timeout  (listType arguments);
 objectType pol_remove_check  (listType arguments);
 objectType pol_value         (listType arguments);
@@ -160,11 +160,11 @@ static objectType evaluate_local_decls (objectType local_decls,
             semicol_params->next->next != NULL &&
             semicol_params->next->next->next != NULL &&
             semicol_params->next->next->next->next == NULL &&
-            CATEGORY_OF_OBJ(arg_1(semicol_params)) == ACTOBJECT &&
-            take_action(arg_1(semicol_params)) == &prc_semicolon) {
-          result = process_local_decl(arg_2(semicol_params),
+            CATEGORY_OF_OBJ(list_elem_1(semicol_params)) == ACTOBJECT &&
+            take_action(list_elem_1(semicol_params)) == &prc_semicolon) {
+          result = process_local_decl(list_elem_2(semicol_params),
               local_object_list, err_info);
-          local_decls = arg_4(semicol_params);
+          local_decls = list_elem_4(semicol_params);
         } else {
           result = process_local_decl(local_decls,
               local_object_list, err_info);
@@ -330,15 +330,15 @@ objectType prc_block (listType arguments)
       while (current_catch != NULL && searching &&
           CATEGORY_OF_OBJ(current_catch) == MATCHOBJECT &&
           current_catch->value.listValue->next->next->next->next != NULL) {
-        catch_value = arg_3(current_catch->value.listValue);
+        catch_value = list_elem_3(current_catch->value.listValue);
         if (catch_value == fail_value) {
-          catch_statement = arg_5(current_catch->value.listValue);
+          catch_statement = list_elem_5(current_catch->value.listValue);
           leaveExceptionHandling();
           evaluate(catch_statement);
           searching = FALSE;
         } else {
           if (current_catch->value.listValue->next->next->next->next->next != NULL) {
-            current_catch = arg_6(current_catch->value.listValue);
+            current_catch = list_elem_6(current_catch->value.listValue);
           } else {
             current_catch = NULL;
           } /* if */
@@ -422,15 +422,15 @@ objectType prc_block_otherwise (listType arguments)
       while (current_catch != NULL && searching &&
           CATEGORY_OF_OBJ(current_catch) == MATCHOBJECT &&
           current_catch->value.listValue->next->next->next->next != NULL) {
-        catch_value = arg_3(current_catch->value.listValue);
+        catch_value = list_elem_3(current_catch->value.listValue);
         if (catch_value == fail_value) {
-          catch_statement = arg_5(current_catch->value.listValue);
+          catch_statement = list_elem_5(current_catch->value.listValue);
           leaveExceptionHandling();
           evaluate(catch_statement);
           searching = FALSE;
         } else {
           if (current_catch->value.listValue->next->next->next->next->next != NULL) {
-            current_catch = arg_6(current_catch->value.listValue);
+            current_catch = list_elem_6(current_catch->value.listValue);
           } else {
             current_catch = NULL;
           } /* if */
@@ -474,7 +474,7 @@ objectType prc_case (listType arguments)
         CATEGORY_OF_OBJ(current_when) == MATCHOBJECT &&
         current_when->value.listValue->next->next->next->next != NULL) {
       current_when_list = current_when->value.listValue;
-      when_values = arg_3(current_when_list);
+      when_values = list_elem_3(current_when_list);
       if (CATEGORY_OF_OBJ(when_values) != SETOBJECT) {
         when_set = exec_object(when_values);
         isit_not_null(when_set);
@@ -503,11 +503,11 @@ objectType prc_case (listType arguments)
           err_info = ACTION_ERROR;
           err_arguments = current_when_list->next;
         } else {
-          when_statement = arg_5(current_when_list);
+          when_statement = list_elem_5(current_when_list);
         } /* if */
       } /* if */
       if (current_when_list->next->next->next->next->next != NULL) {
-        current_when = arg_6(current_when_list);
+        current_when = list_elem_6(current_when_list);
       } else {
         current_when = NULL;
       } /* if */
@@ -550,7 +550,7 @@ objectType prc_case_def (listType arguments)
         CATEGORY_OF_OBJ(current_when) == MATCHOBJECT &&
         current_when->value.listValue->next->next->next->next != NULL) {
       current_when_list = current_when->value.listValue;
-      when_values = arg_3(current_when_list);
+      when_values = list_elem_3(current_when_list);
       if (CATEGORY_OF_OBJ(when_values) != SETOBJECT) {
         when_set = exec_object(when_values);
         isit_not_null(when_set);
@@ -579,11 +579,11 @@ objectType prc_case_def (listType arguments)
           err_info = ACTION_ERROR;
           err_arguments = current_when_list->next;
         } else {
-          when_statement = arg_5(current_when_list);
+          when_statement = list_elem_5(current_when_list);
         } /* if */
       } /* if */
       if (current_when_list->next->next->next->next->next != NULL) {
-        current_when = arg_6(current_when_list);
+        current_when = list_elem_6(current_when_list);
       } else {
         current_when = NULL;
       } /* if */
@@ -626,7 +626,7 @@ objectType prc_case_hashset (listType arguments)
         CATEGORY_OF_OBJ(current_when) == MATCHOBJECT &&
         current_when->value.listValue->next->next->next->next != NULL) {
       current_when_list = current_when->value.listValue;
-      when_values = arg_3(current_when_list);
+      when_values = list_elem_3(current_when_list);
       if (CATEGORY_OF_OBJ(when_values) != HASHOBJECT) {
         when_set = exec_object(when_values);
         isit_not_null(when_set);
@@ -652,11 +652,11 @@ objectType prc_case_hashset (listType arguments)
           err_info = ACTION_ERROR;
           err_arguments = current_when_list->next;
         } else {
-          when_statement = arg_5(current_when_list);
+          when_statement = list_elem_5(current_when_list);
         } /* if */
       } /* if */
       if (current_when_list->next->next->next->next->next != NULL) {
-        current_when = arg_6(current_when_list);
+        current_when = list_elem_6(current_when_list);
       } else {
         current_when = NULL;
       } /* if */
@@ -697,7 +697,7 @@ objectType prc_case_hashset_def (listType arguments)
         CATEGORY_OF_OBJ(current_when) == MATCHOBJECT &&
         current_when->value.listValue->next->next->next->next != NULL) {
       current_when_list = current_when->value.listValue;
-      when_values = arg_3(current_when_list);
+      when_values = list_elem_3(current_when_list);
       if (CATEGORY_OF_OBJ(when_values) != HASHOBJECT) {
         when_set = exec_object(when_values);
         isit_not_null(when_set);
@@ -723,11 +723,11 @@ objectType prc_case_hashset_def (listType arguments)
           err_info = ACTION_ERROR;
           err_arguments = current_when_list->next;
         } else {
-          when_statement = arg_5(current_when_list);
+          when_statement = list_elem_5(current_when_list);
         } /* if */
       } /* if */
       if (current_when_list->next->next->next->next->next != NULL) {
-        current_when = arg_6(current_when_list);
+        current_when = list_elem_6(current_when_list);
       } else {
         current_when = NULL;
       } /* if */
@@ -50,6 +50,7 @@
 #include "intlib.h"
 #include "itflib.h"
 #include "kbdlib.h"
+#include "mdglib.h"
 #include "pcslib.h"
 #include "pollib.h"
 #include "prclib.h"
@@ -80,6 +81,7 @@ static const objectCategory p_any[]                  = {ILLEGALOBJECT};
 static const objectCategory p_op_any[]               = {SYMBOLOBJECT, ILLEGALOBJECT};
 static const objectCategory p_op_any_op_any[]        = {SYMBOLOBJECT, ILLEGALOBJECT, SYMBOLOBJECT, ILLEGALOBJECT};
 static const objectCategory p_arr[]                  = {ARRAYOBJECT};
+static const objectCategory p_arr_arr[]              = {ARRAYOBJECT, ARRAYOBJECT};
 static const objectCategory p_arr_int[]              = {ARRAYOBJECT, INTOBJECT};
 static const objectCategory p_arr_int_arr[]          = {ARRAYOBJECT, INTOBJECT, ARRAYOBJECT};
 static const objectCategory p_arr_int_int[]          = {ARRAYOBJECT, INTOBJECT, INTOBJECT};
@@ -97,6 +99,7 @@ static const objectCategory p_op_op_any[]            = {SYMBOLOBJECT, SYMBOLOBJE
 static const objectCategory p_op_int_op_any[]        = {SYMBOLOBJECT, INTOBJECT, SYMBOLOBJECT, ILLEGALOBJECT};
 static const objectCategory p_big[]                  = {BIGINTOBJECT};
 static const objectCategory p_big_big[]              = {BIGINTOBJECT, BIGINTOBJECT};
+static const objectCategory p_big_big_big[]          = {BIGINTOBJECT, BIGINTOBJECT, BIGINTOBJECT};
 static const objectCategory p_big_bln[]              = {BIGINTOBJECT, BOOLOBJECT};
 static const objectCategory p_big_op_big[]           = {BIGINTOBJECT, SYMBOLOBJECT, BIGINTOBJECT};
 static const objectCategory p_big_op_int[]           = {BIGINTOBJECT, SYMBOLOBJECT, INTOBJECT};
@@ -115,7 +118,12 @@ static const objectCategory p_blo[]                  = {BLOCKOBJECT};
 static const objectCategory p_bst[]                  = {BSTRIOBJECT};
 static const objectCategory p_bst_bst[]              = {BSTRIOBJECT, BSTRIOBJECT};
 static const objectCategory p_bst_bln[]              = {BSTRIOBJECT, BOOLOBJECT};
+static const objectCategory p_bst_int_int[]          = {BSTRIOBJECT, INTOBJECT, INTOBJECT};
+static const objectCategory p_bst_int_int_3_bln[]    = {BSTRIOBJECT, INTOBJECT, INTOBJECT, BOOLOBJECT, BOOLOBJECT, BOOLOBJECT};
+static const objectCategory p_bst_int_str_5_int_arr_4_int[] = {BSTRIOBJECT, INTOBJECT, STRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, ARRAYOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_bst_4_int[]            = {BSTRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
+static const objectCategory p_bst_5_int[]            = {BSTRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
+static const objectCategory p_bst_6_int_3_arr[]      = {BSTRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, ARRAYOBJECT, ARRAYOBJECT, ARRAYOBJECT};
 static const objectCategory p_bst_set_arr_fil[]      = {BSTRIOBJECT, SETOBJECT, ARRAYOBJECT, FILEOBJECT};
 static const objectCategory p_bst_op_bst[]           = {BSTRIOBJECT, SYMBOLOBJECT, BSTRIOBJECT};
 static const objectCategory p_bst_op_int[]           = {BSTRIOBJECT, SYMBOLOBJECT, INTOBJECT};
@@ -126,6 +134,7 @@ static const objectCategory p_op_chr[]               = {SYMBOLOBJECT, CHAROBJECT
 static const objectCategory p_dbs[]                  = {DATABASEOBJECT};
 static const objectCategory p_dbs_dbs[]              = {DATABASEOBJECT, DATABASEOBJECT};
 static const objectCategory p_dbs_bln[]              = {DATABASEOBJECT, BOOLOBJECT};
+static const objectCategory p_dbs_int[]              = {DATABASEOBJECT, INTOBJECT};
 static const objectCategory p_dbs_str[]              = {DATABASEOBJECT, STRIOBJECT};
 static const objectCategory p_dbs_op_dbs[]           = {DATABASEOBJECT, SYMBOLOBJECT, DATABASEOBJECT};
 static const objectCategory p_enu[]                  = {ENUMOBJECT};
@@ -191,6 +200,7 @@ static const objectCategory p_plt_plt[]              = {POINTLISTOBJECT, POINTLI
 static const objectCategory p_plt_op_plt[]           = {POINTLISTOBJECT, SYMBOLOBJECT, POINTLISTOBJECT};
 static const objectCategory p_pol[]                  = {POLLOBJECT};
 static const objectCategory p_pol_int[]              = {POLLOBJECT, INTOBJECT};
+static const objectCategory p_pol_int_int[]          = {POLLOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_pol_itf[]              = {POLLOBJECT, INTERFACEOBJECT};
 static const objectCategory p_pol_soc[]              = {POLLOBJECT, SOCKETOBJECT};
 static const objectCategory p_pol_soc_int[]          = {POLLOBJECT, SOCKETOBJECT, INTOBJECT};
@@ -261,6 +271,7 @@ static const objectCategory p_soc_str_int_int_bst[]  = {SOCKETOBJECT, STRIOBJECT
 static const objectCategory p_soc_op_soc[]           = {SOCKETOBJECT, SYMBOLOBJECT, SOCKETOBJECT};
 static const objectCategory p_sqs[]                  = {SQLSTMTOBJECT};
 static const objectCategory p_sqs_sqs[]              = {SQLSTMTOBJECT, SQLSTMTOBJECT};
+static const objectCategory p_sqs_bln[]              = {SQLSTMTOBJECT, BOOLOBJECT};
 static const objectCategory p_sqs_int[]              = {SQLSTMTOBJECT, INTOBJECT};
 static const objectCategory p_sqs_int_big[]          = {SQLSTMTOBJECT, INTOBJECT, BIGINTOBJECT};
 static const objectCategory p_sqs_int_big_big[]      = {SQLSTMTOBJECT, INTOBJECT, BIGINTOBJECT, BIGINTOBJECT};
@@ -270,6 +281,7 @@ static const objectCategory p_sqs_8_int[]            = {SQLSTMTOBJECT, INTOBJECT
 static const objectCategory p_sqs_9_int[]            = {SQLSTMTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_sqs_9_int_bln[]        = {SQLSTMTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, BOOLOBJECT};
 static const objectCategory p_sqs_int_flt[]          = {SQLSTMTOBJECT, INTOBJECT, FLOATOBJECT};
+static const objectCategory p_sqs_int_arr[]          = {SQLSTMTOBJECT, INTOBJECT, ARRAYOBJECT};
 static const objectCategory p_sqs_int_int[]          = {SQLSTMTOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_sqs_int_str[]          = {SQLSTMTOBJECT, INTOBJECT, STRIOBJECT};
 static const objectCategory p_sqs_op_sqs[]           = {SQLSTMTOBJECT, SYMBOLOBJECT, SQLSTMTOBJECT};
@@ -283,12 +295,15 @@ static const objectCategory p_str_arr_str_str_str[]  = {STRIOBJECT, ARRAYOBJECT,
 static const objectCategory p_str_chr[]              = {STRIOBJECT, CHAROBJECT};
 static const objectCategory p_str_chr_int[]          = {STRIOBJECT, CHAROBJECT, INTOBJECT};
 static const objectCategory p_str_int[]              = {STRIOBJECT, INTOBJECT};
+static const objectCategory p_str_int_str_str_bln_str_int[] = {STRIOBJECT, INTOBJECT, STRIOBJECT, STRIOBJECT, BOOLOBJECT, STRIOBJECT, INTOBJECT};
+static const objectCategory p_str_4_int[]            = {STRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_str_8_int[]            = {STRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_str_8_int_bln[]        = {STRIOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, INTOBJECT, BOOLOBJECT};
 static const objectCategory p_str_set[]              = {STRIOBJECT, SETOBJECT};
 static const objectCategory p_str_set_arr_fil[]      = {STRIOBJECT, SETOBJECT, ARRAYOBJECT, FILEOBJECT};
 static const objectCategory p_str_str_str[]          = {STRIOBJECT, STRIOBJECT, STRIOBJECT};
 static const objectCategory p_str_str_int[]          = {STRIOBJECT, STRIOBJECT, INTOBJECT};
+static const objectCategory p_str_str_int_int[]      = {STRIOBJECT, STRIOBJECT, INTOBJECT, INTOBJECT};
 static const objectCategory p_str_op_str[]           = {STRIOBJECT, SYMBOLOBJECT, STRIOBJECT};
 static const objectCategory p_str_op_chr[]           = {STRIOBJECT, SYMBOLOBJECT, CHAROBJECT};
 static const objectCategory p_str_op_int[]           = {STRIOBJECT, SYMBOLOBJECT, INTOBJECT};
@@ -363,6 +378,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_op_any               argCountAndArgs(p_op_any)
 #define par_op_any_op_any        argCountAndArgs(p_op_any_op_any)
 #define par_arr                  argCountAndArgs(p_arr)
+#define par_arr_arr              argCountAndArgs(p_arr_arr)
 #define par_arr_int              argCountAndArgs(p_arr_int)
 #define par_arr_int_arr          argCountAndArgs(p_arr_int_arr)
 #define par_arr_int_int          argCountAndArgs(p_arr_int_int)
@@ -380,6 +396,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_op_int_op_any        argCountAndArgs(p_op_int_op_any)
 #define par_big                  argCountAndArgs(p_big)
 #define par_big_big              argCountAndArgs(p_big_big)
+#define par_big_big_big          argCountAndArgs(p_big_big_big)
 #define par_big_bln              argCountAndArgs(p_big_bln)
 #define par_big_op_big           argCountAndArgs(p_big_op_big)
 #define par_big_op_int           argCountAndArgs(p_big_op_int)
@@ -398,7 +415,12 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_bst                  argCountAndArgs(p_bst)
 #define par_bst_bst              argCountAndArgs(p_bst_bst)
 #define par_bst_bln              argCountAndArgs(p_bst_bln)
+#define par_bst_int_int          argCountAndArgs(p_bst_int_int)
+#define par_bst_int_int_3_bln    argCountAndArgs(p_bst_int_int_3_bln)
+#define par_bst_int_str_5_int_arr_4_int argCountAndArgs(p_bst_int_str_5_int_arr_4_int)
 #define par_bst_4_int            argCountAndArgs(p_bst_4_int)
+#define par_bst_5_int            argCountAndArgs(p_bst_5_int)
+#define par_bst_6_int_3_arr      argCountAndArgs(p_bst_6_int_3_arr)
 #define par_bst_set_arr_fil      argCountAndArgs(p_bst_set_arr_fil)
 #define par_bst_op_bst           argCountAndArgs(p_bst_op_bst)
 #define par_bst_op_int           argCountAndArgs(p_bst_op_int)
@@ -409,6 +431,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_dbs                  argCountAndArgs(p_dbs)
 #define par_dbs_dbs              argCountAndArgs(p_dbs_dbs)
 #define par_dbs_bln              argCountAndArgs(p_dbs_bln)
+#define par_dbs_int              argCountAndArgs(p_dbs_int)
 #define par_dbs_str              argCountAndArgs(p_dbs_str)
 #define par_dbs_op_dbs           argCountAndArgs(p_dbs_op_dbs)
 #define par_enu                  argCountAndArgs(p_enu)
@@ -474,6 +497,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_plt_op_plt           argCountAndArgs(p_plt_op_plt)
 #define par_pol                  argCountAndArgs(p_pol)
 #define par_pol_int              argCountAndArgs(p_pol_int)
+#define par_pol_int_int          argCountAndArgs(p_pol_int_int)
 #define par_pol_itf              argCountAndArgs(p_pol_itf)
 #define par_pol_soc              argCountAndArgs(p_pol_soc)
 #define par_pol_soc_int          argCountAndArgs(p_pol_soc_int)
@@ -544,6 +568,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_soc_op_soc           argCountAndArgs(p_soc_op_soc)
 #define par_sqs                  argCountAndArgs(p_sqs)
 #define par_sqs_sqs              argCountAndArgs(p_sqs_sqs)
+#define par_sqs_bln              argCountAndArgs(p_sqs_bln)
 #define par_sqs_int              argCountAndArgs(p_sqs_int)
 #define par_sqs_int_big          argCountAndArgs(p_sqs_int_big)
 #define par_sqs_int_big_big      argCountAndArgs(p_sqs_int_big_big)
@@ -553,6 +578,7 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_sqs_9_int            argCountAndArgs(p_sqs_9_int)
 #define par_sqs_9_int_bln        argCountAndArgs(p_sqs_9_int_bln)
 #define par_sqs_int_flt          argCountAndArgs(p_sqs_int_flt)
+#define par_sqs_int_arr          argCountAndArgs(p_sqs_int_arr)
 #define par_sqs_int_int          argCountAndArgs(p_sqs_int_int)
 #define par_sqs_int_str          argCountAndArgs(p_sqs_int_str)
 #define par_sqs_op_sqs           argCountAndArgs(p_sqs_op_sqs)
@@ -566,12 +592,15 @@ static const objectCategory p_op_op_op_typ_op_exp_op_any_op_prc_op_exp[] = {SYMB
 #define par_str_chr              argCountAndArgs(p_str_chr)
 #define par_str_chr_int          argCountAndArgs(p_str_chr_int)
 #define par_str_int              argCountAndArgs(p_str_int)
+#define par_str_int_str_str_bln_str_int argCountAndArgs(p_str_int_str_str_bln_str_int)
+#define par_str_4_int            argCountAndArgs(p_str_4_int)
 #define par_str_8_int            argCountAndArgs(p_str_8_int)
 #define par_str_8_int_bln        argCountAndArgs(p_str_8_int_bln)
 #define par_str_set              argCountAndArgs(p_str_set)
 #define par_str_set_arr_fil      argCountAndArgs(p_str_set_arr_fil)
 #define par_str_str_str          argCountAndArgs(p_str_str_str)
 #define par_str_str_int          argCountAndArgs(p_str_str_int)
+#define par_str_str_int_int      argCountAndArgs(p_str_str_int_int)
 #define par_str_op_str           argCountAndArgs(p_str_op_str)
 #define par_str_op_chr           argCountAndArgs(p_str_op_chr)
 #define par_str_op_int           argCountAndArgs(p_str_op_int)
@@ -676,6 +705,8 @@ static const actEntryRecord actEntryTable[] = {
     { "ARR_RANGE",                    arr_range,                    ARRAYOBJECT,       par_arr_op_int_op_int},
     { "ARR_REMOVE",                   arr_remove,                   ILLEGALOBJECT,     par_arr_int},
     { "ARR_REMOVE_ARRAY",             arr_remove_array,             ARRAYOBJECT,       par_arr_int_int},
+    { "ARR_RESERVE",                  arr_reserve,                  VOIDOBJECT,        par_arr_int},
+    { "ARR_SHRINK_TO_FIT",            arr_shrink_to_fit,            VOIDOBJECT,        par_arr},
     { "ARR_SORT",                     arr_sort,                     ARRAYOBJECT,       par_arr},
     { "ARR_SORT_REVERSE",             arr_sort_reverse,             ARRAYOBJECT,       par_arr},
     { "ARR_SUBARR",                   arr_subarr,                   ARRAYOBJECT,       par_arr_op_int_op_int},
@@ -714,6 +745,7 @@ static const actEntryRecord actEntryTable[] = {
     { "BIG_LT",                       big_lt,                       BOOLOBJECT,        par_big_op_big},
     { "BIG_MDIV",                     big_mdiv,                     BIGINTOBJECT,      par_big_op_big},
     { "BIG_MOD",                      big_mod,                      BIGINTOBJECT,      par_big_op_big},
+    { "BIG_MOD_POW",                  big_mod_pow,                  BIGINTOBJECT,      par_big_big_big},
     { "BIG_MULT",                     big_mult,                     BIGINTOBJECT,      par_big_op_big},
     { "BIG_MULT_ASSIGN",              big_mult_assign,              VOIDOBJECT,        par_big_op_big},
     { "BIG_NE",                       big_ne,                       BOOLOBJECT,        par_big_op_big},
@@ -932,10 +964,14 @@ static const actEntryRecord actEntryTable[] = {
     { "DRW_GET_PIXEL_DATA",           drw_get_pixel_data,           BSTRIOBJECT,       par_win},
     { "DRW_GET_PIXEL_DATA_FROM_ARRAY",drw_get_pixel_data_from_array,BSTRIOBJECT,       par_arr},
     { "DRW_GET_PIXMAP",               drw_get_pixmap,               WINOBJECT,         par_win_4_int},
+    { "DRW_GET_PIXMAP_FROM_IMAGE",    drw_get_pixmap_from_image,    WINOBJECT,         par_bst_int_int},
     { "DRW_GET_PIXMAP_FROM_PIXELS",   drw_get_pixmap_from_pixels,   WINOBJECT,         par_arr},
     { "DRW_HASHCODE",                 drw_hashcode,                 INTOBJECT,         par_win},
     { "DRW_HEIGHT",                   drw_height,                   INTOBJECT,         par_win},
+    { "DRW_JPEG_COLOR",               drw_jpeg_color,               VOIDOBJECT,        par_bst_6_int_3_arr},
+    { "DRW_JPEG_IDCT",                drw_jpeg_idct,                VOIDOBJECT,        par_arr_arr},
     { "DRW_NE",                       drw_ne,                       BOOLOBJECT,        par_win_op_win},
+    { "DRW_NEW_IMAGE",                drw_new_image,                BSTRIOBJECT,       par_int_int_int},
     { "DRW_NEW_PIXMAP",               drw_new_pixmap,               WINOBJECT,         par_int_int},
     { "DRW_OPEN",                     drw_open,                     WINOBJECT,         par_4_int_str},
     { "DRW_OPEN_SUB_WINDOW",          drw_open_sub_window,          WINOBJECT,         par_win_4_int},
@@ -948,6 +984,8 @@ static const actEntryRecord actEntryTable[] = {
     { "DRW_PFELLIPSE",                drw_pfellipse,                VOIDOBJECT,        par_win_5_int},
     { "DRW_PIXEL_TO_RGB",             drw_pixel_to_rgb,             VOIDOBJECT,        par_4_int},
     { "DRW_PLINE",                    drw_pline,                    VOIDOBJECT,        par_win_5_int},
+    { "DRW_PNG_PIXELS",               drw_png_pixels,               VOIDOBJECT,        par_bst_int_str_5_int_arr_4_int},
+    { "DRW_PNG_UNFILTER",             drw_png_unfilter,             VOIDOBJECT,        par_str_4_int},
     { "DRW_POINTER_XPOS",             drw_pointer_xpos,             INTOBJECT,         par_win},
     { "DRW_POINTER_YPOS",             drw_pointer_ypos,             INTOBJECT,         par_win},
     { "DRW_POLY_LINE",                drw_poly_line,                VOIDOBJECT,        par_win_int_int_plt_int},
@@ -960,6 +998,7 @@ static const actEntryRecord actEntryTable[] = {
     { "DRW_SCREEN_WIDTH",             drw_screen_width,             INTOBJECT,         par_no_args},
     { "DRW_SET_CONTENT",              drw_set_content,              VOIDOBJECT,        par_win_win},
     { "DRW_SET_CURSOR_VISIBLE",       drw_set_cursor_visible,       VOIDOBJECT,        par_win_bln},
+    { "DRW_SET_IMAGE_PIXEL",          drw_set_image_pixel,          VOIDOBJECT,        par_bst_5_int},
     { "DRW_SET_POINTER_POS",          drw_set_pointer_pos,          VOIDOBJECT,        par_win_int_int},
     { "DRW_SET_POS",                  drw_set_pos,                  VOIDOBJECT,        par_win_int_int},
     { "DRW_SET_SIZE",                 drw_set_size,                 VOIDOBJECT,        par_win_int_int},
@@ -968,6 +1007,7 @@ static const actEntryRecord actEntryTable[] = {
     { "DRW_TEXT",                     drw_text,                     VOIDOBJECT,        par_win_int_int_str_int_int},
     { "DRW_TO_BOTTOM",                drw_to_bottom,                VOIDOBJECT,        par_win},
     { "DRW_TO_TOP",                   drw_to_top,                   VOIDOBJECT,        par_win},
+    { "DRW_TRANSFORM_IMAGE",          drw_transform_image,          BSTRIOBJECT,       par_bst_int_int_3_bln},
     { "DRW_VALUE",                    drw_value,                    WINOBJECT,         par_ref},
     { "DRW_WIDTH",                    drw_width,                    INTOBJECT,         par_win},
     { "DRW_XPOS",                     drw_xpos,                     INTOBJECT,         par_win},
@@ -1209,6 +1249,12 @@ static const actEntryRecord actEntryTable[] = {
     { "KBD_RAW_GETC",                 kbd_raw_getc,                 CHAROBJECT,        par_no_args},
     { "KBD_WORD_READ",                kbd_word_read,                STRIOBJECT,        par_op_chr},
 
+    { "MDG_KECCAK",                   mdg_keccak,                   STRIOBJECT,        par_str_str_int_int},
+    { "MDG_MD5",                      mdg_md5,                      STRIOBJECT,        par_str_str_int},
+    { "MDG_SHA1",                     mdg_sha1,                     STRIOBJECT,        par_str_str_int},
+    { "MDG_SHA256",                   mdg_sha256,                   STRIOBJECT,        par_str_str_int},
+    { "MDG_SHA512",                   mdg_sha512,                   STRIOBJECT,        par_str_str_int},
+
     { "PCS_CHILD_STDERR",             pcs_child_stderr,             FILEOBJECT,        par_pcs},
     { "PCS_CHILD_STDIN",              pcs_child_stdin,              FILEOBJECT,        par_pcs},
     { "PCS_CHILD_STDOUT",             pcs_child_stdout,             FILEOBJECT,        par_pcs},
@@ -1219,6 +1265,7 @@ static const actEntryRecord actEntryTable[] = {
     { "PCS_EMPTY",                    pcs_empty,                    PROCESSOBJECT,     par_no_args},
     { "PCS_EQ",                       pcs_eq,                       BOOLOBJECT,        par_pcs_op_pcs},
     { "PCS_EXIT_VALUE",               pcs_exit_value,               INTOBJECT,         par_pcs},
+    { "PCS_FORK_WORKERS",             pcs_fork_workers,             INTOBJECT,         par_int},
     { "PCS_HASHCODE",                 pcs_hashcode,                 INTOBJECT,         par_pcs},
     { "PCS_IS_ALIVE",                 pcs_is_alive,                 BOOLOBJECT,        par_pcs},
     { "PCS_KILL",                     pcs_kill,                     VOIDOBJECT,        par_pcs},
@@ -1258,6 +1305,7 @@ static const actEntryRecord actEntryTable[] = {
     { "POL_ITER_FINDINGS",            pol_iter_findings,            VOIDOBJECT,        par_pol_int},
     { "POL_NEXT_FILE",                pol_next_file,                INTERFACEOBJECT,   par_pol_itf},
     { "POL_POLL",                     pol_poll,                     VOIDOBJECT,        par_pol},
+    { "POL_POLL_TIMEOUT",             pol_poll_timeout,             VOIDOBJECT,        par_pol_int_int},
     { "POL_REMOVE_CHECK",             pol_remove_check,             VOIDOBJECT,        par_pol_soc_int},
     { "POL_VALUE",                    pol_value,                    POLLOBJECT,        par_ref},
 
@@ -1515,9 +1563,12 @@ static const actEntryRecord actEntryTable[] = {
     { "SQL_BIND_BSTRI",               sql_bind_bstri,               VOIDOBJECT,        par_sqs_int_bst},
     { "SQL_BIND_DURATION",            sql_bind_duration,            VOIDOBJECT,        par_sqs_8_int},
     { "SQL_BIND_FLOAT",               sql_bind_float,               VOIDOBJECT,        par_sqs_int_flt},
+    { "SQL_BIND_FLOAT_ARRAY",         sql_bind_float_array,         VOIDOBJECT,        par_sqs_int_arr},
     { "SQL_BIND_INT",                 sql_bind_int,                 VOIDOBJECT,        par_sqs_int_int},
+    { "SQL_BIND_INT_ARRAY",           sql_bind_int_array,           VOIDOBJECT,        par_sqs_int_arr},
     { "SQL_BIND_NULL",                sql_bind_null,                VOIDOBJECT,        par_sqs_int},
     { "SQL_BIND_STRI",                sql_bind_stri,                VOIDOBJECT,        par_sqs_int_str},
+    { "SQL_BIND_STRI_ARRAY",          sql_bind_stri_array,          VOIDOBJECT,        par_sqs_int_arr},
     { "SQL_BIND_TIME",                sql_bind_time,                VOIDOBJECT,        par_sqs_9_int},
     { "SQL_CLOSE",                    sql_close,                    VOIDOBJECT,        par_dbs},
     { "SQL_CMP_DB",                   sql_cmp_db,                   INTOBJECT,         par_dbs_dbs},
@@ -1528,8 +1579,11 @@ static const actEntryRecord actEntryTable[] = {
     { "SQL_COLUMN_BSTRI",             sql_column_bstri,             BSTRIOBJECT,       par_sqs_int},
     { "SQL_COLUMN_DURATION",          sql_column_duration,          VOIDOBJECT,        par_sqs_8_int},
     { "SQL_COLUMN_FLOAT",             sql_column_float,             FLOATOBJECT,       par_sqs_int},
+    { "SQL_COLUMN_FLOAT_BLOCK",       sql_column_float_block,       ARRAYOBJECT,       par_sqs_int},
     { "SQL_COLUMN_INT",               sql_column_int,               INTOBJECT,         par_sqs_int},
+    { "SQL_COLUMN_INT_BLOCK",         sql_column_int_block,         ARRAYOBJECT,       par_sqs_int},
     { "SQL_COLUMN_STRI",              sql_column_stri,              STRIOBJECT,        par_sqs_int},
+    { "SQL_COLUMN_STRI_BLOCK",        sql_column_stri_block,        ARRAYOBJECT,       par_sqs_int},
     { "SQL_COLUMN_TIME",              sql_column_time,              VOIDOBJECT,        par_sqs_9_int_bln},
     { "SQL_COMMIT",                   sql_commit,                   VOIDOBJECT,        par_dbs},
     { "SQL_CPY_DB",                   sql_cpy_db,                   VOIDOBJECT,        par_dbs_op_dbs},
@@ -1549,7 +1603,9 @@ static const actEntryRecord actEntryTable[] = {
     { "SQL_ERR_LIB_FUNC",             sql_err_lib_func,             STRIOBJECT,        par_no_args},
     { "SQL_ERR_MESSAGE",              sql_err_message,              STRIOBJECT,        par_no_args},
     { "SQL_EXECUTE",                  sql_execute,                  VOIDOBJECT,        par_sqs},
+    { "SQL_EXECUTE_BATCH",            sql_execute_batch,            VOIDOBJECT,        par_sqs},
     { "SQL_FETCH",                    sql_fetch,                    BOOLOBJECT,        par_sqs},
+    { "SQL_FETCH_BLOCK",              sql_fetch_block,              INTOBJECT,         par_sqs_int},
     { "SQL_GET_AUTO_COMMIT",          sql_get_auto_commit,          BOOLOBJECT,        par_dbs},
     { "SQL_IS_NULL",                  sql_is_null,                  BOOLOBJECT,        par_sqs_int},
     { "SQL_NE_DB",                    sql_ne_db,                    BOOLOBJECT,        par_dbs_op_dbs},
@@ -1567,6 +1623,10 @@ static const actEntryRecord actEntryTable[] = {
     { "SQL_PREPARE",                  sql_prepare,                  SQLSTMTOBJECT,     par_dbs_str},
     { "SQL_ROLLBACK",                 sql_rollback,                 VOIDOBJECT,        par_dbs},
     { "SQL_SET_AUTO_COMMIT",          sql_set_auto_commit,          VOIDOBJECT,        par_dbs_bln},
+    { "SQL_SET_STMT_CACHE",           sql_set_stmt_cache,           VOIDOBJECT,        par_dbs_int},
+    { "SQL_SET_STREAMING",            sql_set_streaming,            VOIDOBJECT,        par_sqs_bln},
+    { "SQL_STMT_CACHE_HITS",          sql_stmt_cache_hits,          INTOBJECT,         par_dbs},
+    { "SQL_STMT_CACHE_MISSES",        sql_stmt_cache_misses,        INTOBJECT,         par_dbs},
     { "SQL_STMT_COLUMN_COUNT",        sql_stmt_column_count,        INTOBJECT,         par_sqs},
     { "SQL_STMT_COLUMN_NAME",         sql_stmt_column_name,         STRIOBJECT,        par_sqs_int},
 #endif
@@ -1592,6 +1652,7 @@ static const actEntryRecord actEntryTable[] = {
     { "STR_HASHCODE",                 str_hashcode,                 INTOBJECT,         par_str},
     { "STR_HEAD",                     str_head,                     STRIOBJECT,        par_str_op_op_int},
     { "STR_IDX",                      str_idx,                      CHAROBJECT,        par_str_op_int},
+    { "STR_INFLATE_CODES",            str_inflate_codes,            INTOBJECT,         par_str_int_str_str_bln_str_int},
     { "STR_IPOS",                     str_ipos,                     INTOBJECT,         par_str_str_int},
     { "STR_LE",                       str_le,                       BOOLOBJECT,        par_str_op_str},
     { "STR_LITERAL",                  str_literal,                  STRIOBJECT,        par_str},
@@ -55,6 +55,7 @@
 #include "hsh_rtl.h"
 #include "int_rtl.h"
 #include "str_rtl.h"
+#include "set_rtl.h"
 #include "big_drv.h"
 #include "pol_drv.h"
 #include "rtl_err.h"
@@ -1760,6 +1761,8 @@ setType setValue (const const_objectType aReference)
                printf("): Not a legal SETOBJECT.\n"););
       raise_error(RANGE_ERROR);
       result = NULL;
+    } else if (unlikely(isSparseSet(set1))) {
+      result = setCreate(set1);
     } else {
       set_size = bitsetSize(set1);
       if (unlikely(!ALLOC_SET(result, set_size))) {
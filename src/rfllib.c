@@ -388,7 +388,7 @@ objectType rfl_expr (listType arguments)
     result = NULL;
     if (list1 != NULL &&
         list1->next == NULL) {
-      arg1_object = arg_1(list1);
+      arg1_object = list_elem_1(list1);
       incl_list(&result, arg1_object, &err_info);
     } else {
       arg1_object = arg_1(arguments);
@@ -402,8 +402,8 @@ objectType rfl_expr (listType arguments)
             file_number = POSINFO_FILE_NUM(arg1_object);
             line = POSINFO_LINE_NUM(arg1_object);
           } /* if */
-          arg1_object = arg_1(list1);
-          arg3_object = arg_3(list1);
+          arg1_object = list_elem_1(list1);
+          arg3_object = list_elem_3(list1);
           if (HAS_PROPERTY(arg3_object)) {
             arg3_object->descriptor.property->file_number = file_number;
             arg3_object->descriptor.property->line = line;
@@ -108,6 +108,8 @@ static void writeHelp (void)
     printf("Options:\n");
     printf("  -? or -h  Write Seed7 interpreter usage.\n");
     printf("  -a   Analyze only and suppress the execution phase.\n");
+    printf("  -b   Execute the program with threaded code instead of walking\n");
+    printf("       the call tree. The threaded code is created on the fly.\n");
     printf("  -dx  Set compile time trace level to x. Where x is a string consisting of:\n");
     printf("         a Trace primitive actions\n");
     printf("         c Do action check\n");
@@ -228,6 +230,9 @@ static void processOptions (rtlArrayType arg_v, const optionType option)
             case 'a':
               option->analyzeOnly = TRUE;
               break;
+            case 'b':
+              option->execOptions |= EXECUTE_THREADED_CODE;
+              break;
             case 'd':
               if (ALLOC_STRI_SIZE_OK(traceLevel, 1)) {
                 traceLevel->mem[0] = 'a';
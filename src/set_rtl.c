@@ -61,7 +61,9 @@ void printSet (const_setType setValue)
     boolType first_elem;
 
   /* printSet */
-    if (setValue != NULL) {
+    if (setValue != NULL && isSparseSet(setValue)) {
+      printf("set[chunked, card=" FMT_D "]", setCard(setValue));
+    } else if (setValue != NULL) {
       printf("set[" FMT_D "/" FMT_D "]{",
              setValue->min_position, setValue->max_position);
       first_elem = TRUE;
@@ -169,6 +171,1094 @@ static inline const bitSetType *bitsetNonZero (register const bitSetType *bitset
   } /* bitsetNonZero */
 
 
+/* Sets with elements scattered over a big range use a chunked      */
+/* representation. The integers are divided into chunks of 65536    */
+/* consecutive values. Only chunks that contain elements are        */
+/* stored. A chunk with few elements is stored as sorted array of   */
+/* 16-bit offsets, while a chunk with many elements is stored as    */
+/* bitmap. A chunked set is marked with min_position greater than   */
+/* max_position (see isSparseSet). The chunk table is sorted by     */
+/* chunk key. Empty chunks are removed.                             */
+
+#define CHUNK_BITS 16
+#define CHUNK_SHIFT (CHUNK_BITS - bitset_shift)
+#define CHUNK_SIZE ((memSizeType) 1 << CHUNK_SHIFT)
+#define ARRAY_CHUNK_LIMIT 4096
+
+#if RSHIFT_DOES_SIGN_EXTEND
+#define chunkKey(position) ((position) >> CHUNK_SHIFT)
+#else
+#define chunkKey(position) ((position)<0?~(~(position)>>CHUNK_SHIFT):(position)>>CHUNK_SHIFT)
+#endif
+#define chunkIndex(position)     ((memSizeType) ((uintType) (position) & (CHUNK_SIZE - 1)))
+#define chunkStart(key)          ((intType) ((uintType) (key) << CHUNK_SHIFT))
+#define chunkOffset(number)      ((unsigned int) ((uintType) (number) & ((1 << CHUNK_BITS) - 1)))
+#define chunkElement(key,offset) ((intType) ((uintType) (key) << CHUNK_BITS | (uintType) (offset)))
+
+typedef struct {
+    intType key;
+    memSizeType card;
+    memSizeType capacity;
+    uint16Type *array;
+    bitSetType *bitmap;
+  } setChunkRecord, *setChunkType;
+
+typedef const setChunkRecord *const_setChunkType;
+
+typedef struct {
+    intType min_position;
+    intType max_position;
+    memSizeType size;
+    memSizeType capacity;
+    setChunkType chunk;
+  } sparseSetRecord, *sparseSetType;
+
+typedef const sparseSetRecord *const_sparseSetType;
+
+typedef struct {
+    const_setType set;
+    memSizeType chunk_pos;
+    memSizeType index;
+  } wordIterRecord;
+
+typedef struct {
+    wordIterRecord iter1;
+    wordIterRecord iter2;
+    boolType more1;
+    boolType more2;
+    intType position1;
+    intType position2;
+    bitSetType word1;
+    bitSetType word2;
+  } mergeRecord;
+
+typedef struct {
+    sparseSetType set;
+    intType key;
+    memSizeType card;
+    bitSetType buffer[CHUNK_SIZE];
+  } builderRecord;
+
+typedef enum {
+    SET_UNION, SET_INTERSECT, SET_DIFF, SET_SYMDIFF
+  } setOperationType;
+
+
+
+static void freeChunk (const const_setChunkType aChunk)
+
+  { /* freeChunk */
+    if (aChunk->bitmap != NULL) {
+      FREE_TABLE(aChunk->bitmap, bitSetType, CHUNK_SIZE);
+    } else if (aChunk->array != NULL) {
+      FREE_TABLE(aChunk->array, uint16Type, aChunk->capacity);
+    } /* if */
+  } /* freeChunk */
+
+
+
+static void freeSparseSet (const const_sparseSetType sparseSet)
+
+  {
+    memSizeType pos;
+
+  /* freeSparseSet */
+    for (pos = 0; pos < sparseSet->size; pos++) {
+      freeChunk(&sparseSet->chunk[pos]);
+    } /* for */
+    if (sparseSet->chunk != NULL) {
+      FREE_TABLE(sparseSet->chunk, setChunkRecord, sparseSet->capacity);
+    } /* if */
+    FREE_TABLE(sparseSet, sparseSetRecord, 1);
+  } /* freeSparseSet */
+
+
+
+static sparseSetType newSparseSet (const memSizeType capacity)
+
+  {
+    sparseSetType sparseSet;
+
+  /* newSparseSet */
+    if (ALLOC_TABLE(sparseSet, sparseSetRecord, 1)) {
+      sparseSet->min_position = 1;
+      sparseSet->max_position = 0;
+      sparseSet->size = 0;
+      sparseSet->capacity = 0;
+      sparseSet->chunk = NULL;
+      if (capacity != 0) {
+        if (unlikely(!ALLOC_TABLE(sparseSet->chunk, setChunkRecord, capacity))) {
+          FREE_TABLE(sparseSet, sparseSetRecord, 1);
+          sparseSet = NULL;
+        } else {
+          sparseSet->capacity = capacity;
+        } /* if */
+      } /* if */
+    } /* if */
+    return sparseSet;
+  } /* newSparseSet */
+
+
+
+/**
+ *  Search the chunk with the given 'key' in 'sparseSet'.
+ *  @param pos Gets the index of the chunk or the index where a
+ *             chunk with 'key' would be inserted.
+ *  @return TRUE if a chunk with 'key' exists, FALSE otherwise.
+ */
+static boolType findChunk (const const_sparseSetType sparseSet, const intType key,
+    memSizeType *const pos)
+
+  {
+    memSizeType low = 0;
+    memSizeType high;
+    memSizeType middle;
+
+  /* findChunk */
+    high = sparseSet->size;
+    while (low < high) {
+      middle = low + (high - low) / 2;
+      if (sparseSet->chunk[middle].key < key) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      } /* if */
+    } /* while */
+    *pos = low;
+    return low < sparseSet->size && sparseSet->chunk[low].key == key;
+  } /* findChunk */
+
+
+
+/**
+ *  Search 'offset' in the array of an array chunk.
+ *  @param pos Gets the index of 'offset' or the index where
+ *             'offset' would be inserted.
+ *  @return TRUE if 'offset' is in the aChunk, FALSE otherwise.
+ */
+static boolType findOffset (const const_setChunkType aChunk, const unsigned int offset,
+    memSizeType *const pos)
+
+  {
+    memSizeType low = 0;
+    memSizeType high;
+    memSizeType middle;
+
+  /* findOffset */
+    high = aChunk->card;
+    while (low < high) {
+      middle = low + (high - low) / 2;
+      if (aChunk->array[middle] < offset) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      } /* if */
+    } /* while */
+    *pos = low;
+    return low < aChunk->card && aChunk->array[low] == offset;
+  } /* findOffset */
+
+
+
+static setChunkType insertChunk (const sparseSetType sparseSet, const memSizeType pos,
+    const intType key)
+
+  {
+    memSizeType new_capacity;
+    setChunkType resized_table;
+    setChunkType aChunk;
+
+  /* insertChunk */
+    if (sparseSet->size == sparseSet->capacity) {
+      if (sparseSet->capacity == 0) {
+        new_capacity = 4;
+      } else {
+        new_capacity = 2 * sparseSet->capacity;
+      } /* if */
+      resized_table = REALLOC_TABLE(sparseSet->chunk, setChunkRecord,
+                                    sparseSet->capacity, new_capacity);
+      if (unlikely(resized_table == NULL)) {
+        return NULL;
+      } else {
+        COUNT3_TABLE(setChunkRecord, sparseSet->capacity, new_capacity);
+        sparseSet->chunk = resized_table;
+        sparseSet->capacity = new_capacity;
+      } /* if */
+    } /* if */
+    memmove(&sparseSet->chunk[pos + 1], &sparseSet->chunk[pos],
+            (sparseSet->size - pos) * sizeof(setChunkRecord));
+    sparseSet->size++;
+    aChunk = &sparseSet->chunk[pos];
+    aChunk->key = key;
+    aChunk->card = 0;
+    aChunk->capacity = 0;
+    aChunk->array = NULL;
+    aChunk->bitmap = NULL;
+    return aChunk;
+  } /* insertChunk */
+
+
+
+static void removeChunk (const sparseSetType sparseSet, const memSizeType pos)
+
+  { /* removeChunk */
+    freeChunk(&sparseSet->chunk[pos]);
+    sparseSet->size--;
+    memmove(&sparseSet->chunk[pos], &sparseSet->chunk[pos + 1],
+            (sparseSet->size - pos) * sizeof(setChunkRecord));
+  } /* removeChunk */
+
+
+
+/**
+ *  Determine the smallest offset of a (non-empty) chunk.
+ */
+static unsigned int chunkMin (const const_setChunkType aChunk)
+
+  {
+    memSizeType index = 0;
+
+  /* chunkMin */
+    if (aChunk->bitmap == NULL) {
+      return aChunk->array[0];
+    } else {
+      while (aChunk->bitmap[index] == 0) {
+        index++;
+      } /* while */
+      return (unsigned int) (index << bitset_shift) |
+             (unsigned int) bitsetLeastSignificantBit(aChunk->bitmap[index]);
+    } /* if */
+  } /* chunkMin */
+
+
+
+/**
+ *  Determine the biggest offset of a (non-empty) chunk.
+ */
+static unsigned int chunkMax (const const_setChunkType aChunk)
+
+  {
+    memSizeType index = CHUNK_SIZE - 1;
+
+  /* chunkMax */
+    if (aChunk->bitmap == NULL) {
+      return aChunk->array[aChunk->card - 1];
+    } else {
+      while (aChunk->bitmap[index] == 0) {
+        index--;
+      } /* while */
+      return (unsigned int) (index << bitset_shift) |
+             (unsigned int) bitsetMostSignificantBit(aChunk->bitmap[index]);
+    } /* if */
+  } /* chunkMax */
+
+
+
+static boolType chunkElem (const const_setChunkType aChunk, const unsigned int offset)
+
+  {
+    memSizeType pos;
+
+  /* chunkElem */
+    if (aChunk->bitmap != NULL) {
+      return (boolType) ((aChunk->bitmap[offset >> bitset_shift] >> (offset & bitset_mask)) & 1);
+    } else {
+      return findOffset(aChunk, offset, &pos);
+    } /* if */
+  } /* chunkElem */
+
+
+
+static boolType arrayToBitmap (const setChunkType aChunk)
+
+  {
+    bitSetType *bitmap;
+    memSizeType pos;
+
+  /* arrayToBitmap */
+    if (unlikely(!ALLOC_TABLE(bitmap, bitSetType, CHUNK_SIZE))) {
+      return FALSE;
+    } else {
+      memset(bitmap, 0, CHUNK_SIZE * sizeof(bitSetType));
+      for (pos = 0; pos < aChunk->card; pos++) {
+        bitmap[aChunk->array[pos] >> bitset_shift] |=
+            (bitSetType) 1 << (aChunk->array[pos] & bitset_mask);
+      } /* for */
+      FREE_TABLE(aChunk->array, uint16Type, aChunk->capacity);
+      aChunk->array = NULL;
+      aChunk->capacity = 0;
+      aChunk->bitmap = bitmap;
+      return TRUE;
+    } /* if */
+  } /* arrayToBitmap */
+
+
+
+static void bitmapToArray (const setChunkType aChunk)
+
+  {
+    uint16Type *array;
+    memSizeType index;
+    memSizeType pos = 0;
+    bitSetType curr_bitset;
+
+  /* bitmapToArray */
+    if (ALLOC_TABLE(array, uint16Type, aChunk->card)) {
+      for (index = 0; index < CHUNK_SIZE; index++) {
+        curr_bitset = aChunk->bitmap[index];
+        while (curr_bitset != 0) {
+          array[pos] = (uint16Type) (index << bitset_shift |
+              (memSizeType) bitsetLeastSignificantBit(curr_bitset));
+          pos++;
+          /* Turn off the rightmost one bit of curr_bitset: */
+          curr_bitset &= curr_bitset - 1;
+        } /* while */
+      } /* for */
+      FREE_TABLE(aChunk->bitmap, bitSetType, CHUNK_SIZE);
+      aChunk->bitmap = NULL;
+      aChunk->array = array;
+      aChunk->capacity = aChunk->card;
+    } /* if */
+    /* If the allocation fails the chunk stays a bitmap. */
+  } /* bitmapToArray */
+
+
+
+static boolType chunkIncl (const setChunkType aChunk, const unsigned int offset)
+
+  {
+    bitSetType *bitset_ptr;
+    bitSetType mask;
+    memSizeType pos;
+    memSizeType new_capacity;
+    uint16Type *resized_array;
+
+  /* chunkIncl */
+    if (aChunk->bitmap == NULL && !findOffset(aChunk, offset, &pos)) {
+      if (aChunk->card < ARRAY_CHUNK_LIMIT) {
+        if (aChunk->card == aChunk->capacity) {
+          if (aChunk->capacity == 0) {
+            new_capacity = 4;
+          } else if (2 * aChunk->capacity > ARRAY_CHUNK_LIMIT) {
+            new_capacity = ARRAY_CHUNK_LIMIT;
+          } else {
+            new_capacity = 2 * aChunk->capacity;
+          } /* if */
+          resized_array = REALLOC_TABLE(aChunk->array, uint16Type,
+                                        aChunk->capacity, new_capacity);
+          if (unlikely(resized_array == NULL)) {
+            return FALSE;
+          } /* if */
+          COUNT3_TABLE(uint16Type, aChunk->capacity, new_capacity);
+          aChunk->array = resized_array;
+          aChunk->capacity = new_capacity;
+        } /* if */
+        memmove(&aChunk->array[pos + 1], &aChunk->array[pos],
+                (aChunk->card - pos) * sizeof(uint16Type));
+        aChunk->array[pos] = (uint16Type) offset;
+        aChunk->card++;
+        return TRUE;
+      } else if (unlikely(!arrayToBitmap(aChunk))) {
+        return FALSE;
+      } /* if */
+    } /* if */
+    if (aChunk->bitmap != NULL) {
+      bitset_ptr = &aChunk->bitmap[offset >> bitset_shift];
+      mask = (bitSetType) 1 << (offset & bitset_mask);
+      if ((*bitset_ptr & mask) == 0) {
+        *bitset_ptr |= mask;
+        aChunk->card++;
+      } /* if */
+    } /* if */
+    return TRUE;
+  } /* chunkIncl */
+
+
+
+static void chunkExcl (const setChunkType aChunk, const unsigned int offset)
+
+  {
+    bitSetType *bitset_ptr;
+    bitSetType mask;
+    memSizeType pos;
+
+  /* chunkExcl */
+    if (aChunk->bitmap != NULL) {
+      bitset_ptr = &aChunk->bitmap[offset >> bitset_shift];
+      mask = (bitSetType) 1 << (offset & bitset_mask);
+      if ((*bitset_ptr & mask) != 0) {
+        *bitset_ptr &= ~mask;
+        aChunk->card--;
+        if (aChunk->card == ARRAY_CHUNK_LIMIT / 2) {
+          bitmapToArray(aChunk);
+        } /* if */
+      } /* if */
+    } else if (findOffset(aChunk, offset, &pos)) {
+      aChunk->card--;
+      memmove(&aChunk->array[pos], &aChunk->array[pos + 1],
+              (aChunk->card - pos) * sizeof(uint16Type));
+    } /* if */
+  } /* chunkExcl */
+
+
+
+/**
+ *  Get the bitset element at 'position' from a chunked set.
+ */
+static bitSetType sparseBitset (const const_sparseSetType sparseSet,
+    const intType position)
+
+  {
+    memSizeType chunk_pos;
+    const_setChunkType aChunk;
+    memSizeType index;
+    memSizeType pos;
+    bitSetType curr_bitset = 0;
+
+  /* sparseBitset */
+    if (findChunk(sparseSet, chunkKey(position), &chunk_pos)) {
+      aChunk = &sparseSet->chunk[chunk_pos];
+      index = chunkIndex(position);
+      if (aChunk->bitmap != NULL) {
+        curr_bitset = aChunk->bitmap[index];
+      } else {
+        findOffset(aChunk, (unsigned int) (index << bitset_shift), &pos);
+        while (pos < aChunk->card && aChunk->array[pos] >> bitset_shift == index) {
+          curr_bitset |= (bitSetType) 1 << (aChunk->array[pos] & bitset_mask);
+          pos++;
+        } /* while */
+      } /* if */
+    } /* if */
+    return curr_bitset;
+  } /* sparseBitset */
+
+
+
+static boolType sparseElem (const const_sparseSetType sparseSet, const intType number)
+
+  {
+    memSizeType chunk_pos;
+
+  /* sparseElem */
+    return findChunk(sparseSet, chunkKey(bitset_pos(number)), &chunk_pos) &&
+           chunkElem(&sparseSet->chunk[chunk_pos], chunkOffset(number));
+  } /* sparseElem */
+
+
+
+static boolType sparseIncl (const sparseSetType sparseSet, const intType number)
+
+  {
+    intType key;
+    memSizeType chunk_pos;
+    setChunkType aChunk;
+
+  /* sparseIncl */
+    key = chunkKey(bitset_pos(number));
+    if (findChunk(sparseSet, key, &chunk_pos)) {
+      aChunk = &sparseSet->chunk[chunk_pos];
+    } else {
+      aChunk = insertChunk(sparseSet, chunk_pos, key);
+      if (unlikely(aChunk == NULL)) {
+        return FALSE;
+      } /* if */
+    } /* if */
+    if (unlikely(!chunkIncl(aChunk, chunkOffset(number)))) {
+      if (aChunk->card == 0) {
+        removeChunk(sparseSet, chunk_pos);
+      } /* if */
+      return FALSE;
+    } /* if */
+    return TRUE;
+  } /* sparseIncl */
+
+
+
+static void sparseExcl (const sparseSetType sparseSet, const intType number)
+
+  {
+    memSizeType chunk_pos;
+
+  /* sparseExcl */
+    if (findChunk(sparseSet, chunkKey(bitset_pos(number)), &chunk_pos)) {
+      chunkExcl(&sparseSet->chunk[chunk_pos], chunkOffset(number));
+      if (sparseSet->chunk[chunk_pos].card == 0) {
+        removeChunk(sparseSet, chunk_pos);
+      } /* if */
+    } /* if */
+  } /* sparseExcl */
+
+
+
+/**
+ *  Search the smallest element of a chunked set that is >= 'number'.
+ *  @param next Gets the element that has been found.
+ *  @return TRUE if such an element exists, FALSE otherwise.
+ */
+static boolType sparseNext (const const_sparseSetType sparseSet, const intType number,
+    intType *const next)
+
+  {
+    intType key;
+    memSizeType chunk_pos;
+    const_setChunkType aChunk;
+    unsigned int offset;
+    memSizeType index;
+    memSizeType pos;
+    bitSetType curr_bitset;
+    const bitSetType *bitset_ptr;
+
+  /* sparseNext */
+    key = chunkKey(bitset_pos(number));
+    if (findChunk(sparseSet, key, &chunk_pos)) {
+      aChunk = &sparseSet->chunk[chunk_pos];
+      offset = chunkOffset(number);
+      if (aChunk->bitmap == NULL) {
+        findOffset(aChunk, offset, &pos);
+        if (pos < aChunk->card) {
+          *next = chunkElement(key, aChunk->array[pos]);
+          return TRUE;
+        } /* if */
+      } else {
+        index = offset >> bitset_shift;
+        curr_bitset = (aChunk->bitmap[index] >> (offset & bitset_mask)) <<
+                      (offset & bitset_mask);
+        if (curr_bitset == 0) {
+          bitset_ptr = bitsetNonZero(&aChunk->bitmap[index + 1], CHUNK_SIZE - index - 1);
+          if (bitset_ptr != NULL) {
+            index = (memSizeType) (bitset_ptr - aChunk->bitmap);
+            curr_bitset = *bitset_ptr;
+          } /* if */
+        } /* if */
+        if (curr_bitset != 0) {
+          *next = chunkElement(key, index << bitset_shift |
+              (memSizeType) bitsetLeastSignificantBit(curr_bitset));
+          return TRUE;
+        } /* if */
+      } /* if */
+      chunk_pos++;
+    } /* if */
+    if (chunk_pos < sparseSet->size) {
+      aChunk = &sparseSet->chunk[chunk_pos];
+      *next = chunkElement(aChunk->key, chunkMin(aChunk));
+      return TRUE;
+    } /* if */
+    return FALSE;
+  } /* sparseNext */
+
+
+
+/**
+ *  Get the element with the index 'elem_index' from a chunked set.
+ *  The elements are counted in ascending order starting with 1.
+ */
+static intType sparseElemAtIndex (const const_sparseSetType sparseSet,
+    intType elem_index)
+
+  {
+    memSizeType chunk_pos;
+    const_setChunkType aChunk;
+    memSizeType index;
+    bitSetType curr_bitset;
+
+  /* sparseElemAtIndex */
+    for (chunk_pos = 0; chunk_pos < sparseSet->size; chunk_pos++) {
+      aChunk = &sparseSet->chunk[chunk_pos];
+      if (elem_index > (intType) aChunk->card) {
+        elem_index -= (intType) aChunk->card;
+      } else if (aChunk->bitmap == NULL) {
+        return chunkElement(aChunk->key, aChunk->array[elem_index - 1]);
+      } else {
+        for (index = 0; index < CHUNK_SIZE; index++) {
+          curr_bitset = aChunk->bitmap[index];
+          if (elem_index > (intType) bitsetPopulation(curr_bitset)) {
+            elem_index -= (intType) bitsetPopulation(curr_bitset);
+          } else {
+            while (elem_index > 1) {
+              /* Turn off the rightmost one bit of curr_bitset: */
+              curr_bitset &= curr_bitset - 1;
+              elem_index--;
+            } /* while */
+            return chunkElement(aChunk->key, index << bitset_shift |
+                (memSizeType) bitsetLeastSignificantBit(curr_bitset));
+          } /* if */
+        } /* for */
+      } /* if */
+    } /* for */
+    return 0;
+  } /* sparseElemAtIndex */
+
+
+
+static sparseSetType copySparseSet (const const_sparseSetType source)
+
+  {
+    memSizeType pos;
+    const_setChunkType aChunk;
+    setChunkType dest;
+    sparseSetType sparseSet;
+
+  /* copySparseSet */
+    sparseSet = newSparseSet(source->size);
+    if (sparseSet != NULL) {
+      for (pos = 0; pos < source->size; pos++) {
+        aChunk = &source->chunk[pos];
+        dest = &sparseSet->chunk[pos];
+        dest->key = aChunk->key;
+        dest->card = aChunk->card;
+        dest->array = NULL;
+        dest->bitmap = NULL;
+        if (aChunk->bitmap != NULL) {
+          dest->capacity = 0;
+          if (unlikely(!ALLOC_TABLE(dest->bitmap, bitSetType, CHUNK_SIZE))) {
+            freeSparseSet(sparseSet);
+            return NULL;
+          } /* if */
+          memcpy(dest->bitmap, aChunk->bitmap, CHUNK_SIZE * sizeof(bitSetType));
+        } else {
+          dest->capacity = aChunk->card;
+          if (unlikely(!ALLOC_TABLE(dest->array, uint16Type, aChunk->card))) {
+            freeSparseSet(sparseSet);
+            return NULL;
+          } /* if */
+          memcpy(dest->array, aChunk->array, aChunk->card * sizeof(uint16Type));
+        } /* if */
+        sparseSet->size = pos + 1;
+      } /* for */
+    } /* if */
+    return sparseSet;
+  } /* copySparseSet */
+
+
+
+static void initWordIter (wordIterRecord *const iter, const const_setType aSet)
+
+  { /* initWordIter */
+    iter->set = aSet;
+    iter->chunk_pos = 0;
+    iter->index = 0;
+  } /* initWordIter */
+
+
+
+/**
+ *  Get the next non-zero bitset element of a dense or chunked set.
+ *  The bitset elements are delivered in ascending order.
+ *  @return TRUE if a bitset element was found, FALSE at the end.
+ */
+static boolType nextWord (wordIterRecord *const iter, intType *const position,
+    bitSetType *const curr_bitset)
+
+  {
+    const_sparseSetType sparseSet;
+    const_setChunkType aChunk;
+    memSizeType size;
+    memSizeType index;
+
+  /* nextWord */
+    if (!isSparseSet(iter->set)) {
+      size = bitsetSize(iter->set);
+      while (iter->index < size) {
+        iter->index++;
+        if (iter->set->bitset[iter->index - 1] != 0) {
+          *position = iter->set->min_position + (intType) (iter->index - 1);
+          *curr_bitset = iter->set->bitset[iter->index - 1];
+          return TRUE;
+        } /* if */
+      } /* while */
+    } else {
+      sparseSet = (const_sparseSetType) iter->set;
+      while (iter->chunk_pos < sparseSet->size) {
+        aChunk = &sparseSet->chunk[iter->chunk_pos];
+        if (aChunk->bitmap != NULL) {
+          while (iter->index < CHUNK_SIZE) {
+            iter->index++;
+            if (aChunk->bitmap[iter->index - 1] != 0) {
+              *position = chunkStart(aChunk->key) + (intType) (iter->index - 1);
+              *curr_bitset = aChunk->bitmap[iter->index - 1];
+              return TRUE;
+            } /* if */
+          } /* while */
+        } else if (iter->index < aChunk->card) {
+          index = aChunk->array[iter->index] >> bitset_shift;
+          *curr_bitset = 0;
+          do {
+            *curr_bitset |= (bitSetType) 1 << (aChunk->array[iter->index] & bitset_mask);
+            iter->index++;
+          } while (iter->index < aChunk->card &&
+                   aChunk->array[iter->index] >> bitset_shift == index);
+          *position = chunkStart(aChunk->key) + (intType) index;
+          return TRUE;
+        } /* if */
+        iter->chunk_pos++;
+        iter->index = 0;
+      } /* while */
+    } /* if */
+    return FALSE;
+  } /* nextWord */
+
+
+
+static void initMerge (mergeRecord *const merge, const const_setType set1,
+    const const_setType set2)
+
+  { /* initMerge */
+    initWordIter(&merge->iter1, set1);
+    initWordIter(&merge->iter2, set2);
+    merge->more1 = nextWord(&merge->iter1, &merge->position1, &merge->word1);
+    merge->more2 = nextWord(&merge->iter2, &merge->position2, &merge->word2);
+  } /* initMerge */
+
+
+
+/**
+ *  Get the next position where 'set1' or 'set2' has a non-zero
+ *  bitset element. The positions are delivered in ascending order.
+ *  A set without bitset element at 'position' delivers 0.
+ *  @return TRUE if a position was found, FALSE at the end.
+ */
+static boolType nextMerge (mergeRecord *const merge, intType *const position,
+    bitSetType *const bitset1, bitSetType *const bitset2)
+
+  { /* nextMerge */
+    if (merge->more1 && (!merge->more2 || merge->position1 <= merge->position2)) {
+      *position = merge->position1;
+      *bitset1 = merge->word1;
+      if (merge->more2 && merge->position2 == merge->position1) {
+        *bitset2 = merge->word2;
+        merge->more2 = nextWord(&merge->iter2, &merge->position2, &merge->word2);
+      } else {
+        *bitset2 = 0;
+      } /* if */
+      merge->more1 = nextWord(&merge->iter1, &merge->position1, &merge->word1);
+      return TRUE;
+    } else if (merge->more2) {
+      *position = merge->position2;
+      *bitset1 = 0;
+      *bitset2 = merge->word2;
+      merge->more2 = nextWord(&merge->iter2, &merge->position2, &merge->word2);
+      return TRUE;
+    } else {
+      return FALSE;
+    } /* if */
+  } /* nextMerge */
+
+
+
+static void initBuilder (builderRecord *const builder)
+
+  { /* initBuilder */
+    builder->set = newSparseSet(0);
+    builder->key = 0;
+    builder->card = 0;
+    memset(builder->buffer, 0, CHUNK_SIZE * sizeof(bitSetType));
+  } /* initBuilder */
+
+
+
+/**
+ *  Append the chunk in the buffer of 'builder' to the chunked set.
+ *  The chunk is stored as array or as bitmap depending on the
+ *  number of elements. Afterwards the buffer is empty.
+ */
+static void flushBuilder (builderRecord *const builder)
+
+  {
+    setChunkType aChunk;
+    memSizeType index;
+    memSizeType pos = 0;
+    bitSetType curr_bitset;
+
+  /* flushBuilder */
+    if (builder->card != 0) {
+      if (builder->set != NULL) {
+        aChunk = insertChunk(builder->set, builder->set->size, builder->key);
+        if (unlikely(aChunk == NULL)) {
+          freeSparseSet(builder->set);
+          builder->set = NULL;
+        } else if (builder->card <= ARRAY_CHUNK_LIMIT) {
+          if (unlikely(!ALLOC_TABLE(aChunk->array, uint16Type, builder->card))) {
+            builder->set->size--;
+            freeSparseSet(builder->set);
+            builder->set = NULL;
+          } else {
+            aChunk->card = builder->card;
+            aChunk->capacity = builder->card;
+            for (index = 0; index < CHUNK_SIZE; index++) {
+              curr_bitset = builder->buffer[index];
+              while (curr_bitset != 0) {
+                aChunk->array[pos] = (uint16Type) (index << bitset_shift |
+                    (memSizeType) bitsetLeastSignificantBit(curr_bitset));
+                pos++;
+                curr_bitset &= curr_bitset - 1;
+              } /* while */
+            } /* for */
+          } /* if */
+        } else {
+          if (unlikely(!ALLOC_TABLE(aChunk->bitmap, bitSetType, CHUNK_SIZE))) {
+            builder->set->size--;
+            freeSparseSet(builder->set);
+            builder->set = NULL;
+          } else {
+            aChunk->card = builder->card;
+            memcpy(aChunk->bitmap, builder->buffer, CHUNK_SIZE * sizeof(bitSetType));
+          } /* if */
+        } /* if */
+      } /* if */
+      memset(builder->buffer, 0, CHUNK_SIZE * sizeof(bitSetType));
+      builder->card = 0;
+    } /* if */
+  } /* flushBuilder */
+
+
+
+/**
+ *  Add a non-zero bitset element to the set that is built.
+ *  The bitset elements must be added in ascending order.
+ */
+static void addToBuilder (builderRecord *const builder, const intType position,
+    const bitSetType curr_bitset)
+
+  {
+    intType key;
+
+  /* addToBuilder */
+    key = chunkKey(position);
+    if (key != builder->key) {
+      flushBuilder(builder);
+      builder->key = key;
+    } /* if */
+    builder->buffer[chunkIndex(position)] = curr_bitset;
+    builder->card += (memSizeType) bitsetPopulation(curr_bitset);
+  } /* addToBuilder */
+
+
+
+/**
+ *  Convert a chunked set to a dense set if this does not waste memory.
+ *  If the conversion takes place 'sparseSet' is freed.
+ *  @return the dense set or 'sparseSet' converted to setType.
+ */
+static setType normalizeSparseSet (const sparseSetType sparseSet)
+
+  {
+    intType min_position;
+    intType max_position;
+    memSizeType used_size;
+    memSizeType pos;
+    wordIterRecord iter;
+    intType position;
+    bitSetType curr_bitset;
+    setType result;
+
+  /* normalizeSparseSet */
+    if (sparseSet->size == 0) {
+      if (ALLOC_SET(result, 1)) {
+        result->min_position = 0;
+        result->max_position = 0;
+        result->bitset[0] = (bitSetType) 0;
+        freeSparseSet(sparseSet);
+        return result;
+      } /* if */
+    } else {
+      min_position = chunkStart(sparseSet->chunk[0].key) +
+          (intType) (chunkMin(&sparseSet->chunk[0]) >> bitset_shift);
+      max_position = chunkStart(sparseSet->chunk[sparseSet->size - 1].key) +
+          (intType) (chunkMax(&sparseSet->chunk[sparseSet->size - 1]) >> bitset_shift);
+      used_size = sparseSet->size * sizeof(setChunkRecord) / sizeof(bitSetType);
+      for (pos = 0; pos < sparseSet->size; pos++) {
+        if (sparseSet->chunk[pos].bitmap != NULL) {
+          used_size += CHUNK_SIZE;
+        } else {
+          used_size += sparseSet->chunk[pos].capacity *
+              sizeof(uint16Type) / sizeof(bitSetType) + 1;
+        } /* if */
+      } /* for */
+      if (setStaysDense(bitsetSize2(min_position, max_position), used_size) &&
+          ALLOC_SET(result, bitsetSize2(min_position, max_position))) {
+        result->min_position = min_position;
+        result->max_position = max_position;
+        memset(result->bitset, 0,
+               bitsetSize2(min_position, max_position) * sizeof(bitSetType));
+        initWordIter(&iter, (const_setType) sparseSet);
+        while (nextWord(&iter, &position, &curr_bitset)) {
+          result->bitset[position - min_position] = curr_bitset;
+        } /* while */
+        freeSparseSet(sparseSet);
+        return result;
+      } /* if */
+    } /* if */
+    return (setType) sparseSet;
+  } /* normalizeSparseSet */
+
+
+
+/**
+ *  Convert a dense set to a chunked set.
+ *  @return the chunked set or NULL if there is not enough memory.
+ */
+static sparseSetType denseToSparseSet (const const_setType aSet)
+
+  {
+    wordIterRecord iter;
+    intType position;
+    bitSetType curr_bitset;
+    builderRecord builder;
+
+  /* denseToSparseSet */
+    initBuilder(&builder);
+    initWordIter(&iter, aSet);
+    while (nextWord(&iter, &position, &curr_bitset)) {
+      addToBuilder(&builder, position, curr_bitset);
+    } /* while */
+    flushBuilder(&builder);
+    return builder.set;
+  } /* denseToSparseSet */
+
+
+
+/**
+ *  Compute union, intersection, difference or symmetric difference
+ *  of two sets. At least one of the sets is chunked or the result
+ *  would waste too much memory as dense set.
+ *  @return the result of the set operation.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ */
+static setType mergeSets (const const_setType set1, const const_setType set2,
+    const setOperationType operation)
+
+  {
+    mergeRecord merge;
+    intType position;
+    bitSetType bitset1;
+    bitSetType bitset2;
+    bitSetType curr_bitset;
+    builderRecord builder;
+
+  /* mergeSets */
+    initBuilder(&builder);
+    initMerge(&merge, set1, set2);
+    while (nextMerge(&merge, &position, &bitset1, &bitset2)) {
+      switch (operation) {
+        case SET_UNION:     curr_bitset = bitset1 | bitset2;   break;
+        case SET_INTERSECT: curr_bitset = bitset1 & bitset2;   break;
+        case SET_DIFF:      curr_bitset = bitset1 & ~bitset2;  break;
+        default:            curr_bitset = bitset1 ^ bitset2;   break;
+      } /* switch */
+      if (curr_bitset != 0) {
+        addToBuilder(&builder, position, curr_bitset);
+      } /* if */
+    } /* while */
+    flushBuilder(&builder);
+    if (unlikely(builder.set == NULL)) {
+      raise_error(MEMORY_ERROR);
+      return NULL;
+    } else {
+      return normalizeSparseSet(builder.set);
+    } /* if */
+  } /* mergeSets */
+
+
+
+/**
+ *  Replace *dest by the result of a set operation with 'delta'.
+ *  @exception MEMORY_ERROR Not enough memory for the result.
+ */
+static void mergeSetsAssign (setType *const dest, const const_setType delta,
+    const setOperationType operation)
+
+  {
+    setType result;
+
+  /* mergeSetsAssign */
+    result = mergeSets(*dest, delta, operation);
+    if (result != NULL) {
+      setDestr(*dest);
+      *dest = result;
+    } /* if */
+  } /* mergeSetsAssign */
+
+
+
+/**
+ *  Compare two sets where at least one is chunked.
+ *  The last (biggest) position with different bitset elements
+ *  decides, like in setCmp.
+ */
+static intType mergeCmp (const const_setType set1, const const_setType set2)
+
+  {
+    mergeRecord merge;
+    intType position;
+    bitSetType bitset1;
+    bitSetType bitset2;
+    intType signumValue = 0;
+
+  /* mergeCmp */
+    initMerge(&merge, set1, set2);
+    while (nextMerge(&merge, &position, &bitset1, &bitset2)) {
+      if (bitset1 != bitset2) {
+        signumValue = bitset1 > bitset2 ? 1 : -1;
+      } /* if */
+    } /* while */
+    return signumValue;
+  } /* mergeCmp */
+
+
+
+/**
+ *  Check subset relation and equality of two sets where at least
+ *  one is chunked.
+ *  @param equal Gets TRUE if the sets are equal.
+ *  @return TRUE if 'set1' is a subset of 'set2'.
+ */
+static boolType mergeSubset (const const_setType set1, const const_setType set2,
+    boolType *const equal)
+
+  {
+    mergeRecord merge;
+    intType position;
+    bitSetType bitset1;
+    bitSetType bitset2;
+
+  /* mergeSubset */
+    *equal = TRUE;
+    initMerge(&merge, set1, set2);
+    while (nextMerge(&merge, &position, &bitset1, &bitset2)) {
+      if ((bitset1 & ~bitset2) != 0) {
+        *equal = FALSE;
+        return FALSE;
+      } else if (bitset1 != bitset2) {
+        *equal = FALSE;
+      } /* if */
+    } /* while */
+    return TRUE;
+  } /* mergeSubset */
+
+
+
+/**
+ *  Check if two sets, where at least one is chunked, are equal.
+ */
+static boolType mergeEq (const const_setType set1, const const_setType set2)
+
+  {
+    mergeRecord merge;
+    intType position;
+    bitSetType bitset1;
+    bitSetType bitset2;
+
+  /* mergeEq */
+    initMerge(&merge, set1, set2);
+    while (nextMerge(&merge, &position, &bitset1, &bitset2)) {
+      if (bitset1 != bitset2) {
+        return FALSE;
+      } /* if */
+    } /* while */
+    return TRUE;
+  } /* mergeEq */
+
+
 
 setType setArrlit (const_rtlArrayType arr1)
 
@@ -201,7 +1291,7 @@ setType setArrlit (const_rtlArrayType arr1)
           setIncl(&result, arr1->arr[array_index].value.intValue);
 #ifdef OUT_OF_ORDER
           if (fail_flag) {
-            FREE_SET(result, bitsetSize(result));
+            setDestr(result);
             return fail_value;
           } /* if */
 #endif
@@ -254,11 +1344,18 @@ intType setCard (const const_setType aSet)
     intType cardinality;
 
   /* setCard */
-    index_beyond = bitsetSize(aSet);
-    for (bitset_index = index_beyond; bitset_index > 0; bitset_index--) {
-      bitset = aSet->bitset[bitset_index - 1];
-      card += bitsetPopulation(bitset);
-    } /* for */
+    if (unlikely(isSparseSet(aSet))) {
+      for (bitset_index = 0; bitset_index < ((const_sparseSetType) aSet)->size;
+           bitset_index++) {
+        card += ((const_sparseSetType) aSet)->chunk[bitset_index].card;
+      } /* for */
+    } else {
+      index_beyond = bitsetSize(aSet);
+      for (bitset_index = index_beyond; bitset_index > 0; bitset_index--) {
+        bitset = aSet->bitset[bitset_index - 1];
+        card += bitsetPopulation(bitset);
+      } /* for */
+    } /* if */
     if (unlikely(card > INTTYPE_MAX)) {
       logError(printf("setCard(): Result does not fit into an integer.\n"););
       raise_error(RANGE_ERROR);
@@ -301,7 +1398,9 @@ intType setCmp (const const_setType set1, const const_setType set2)
                 printf(", ");
                 printSet(set2);
                 printf(")\n"););
-    if (set1->max_position >= set2->max_position) {
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      return mergeCmp(set1, set2);
+    } else if (set1->max_position >= set2->max_position) {
       if (set1->min_position > set2->max_position) {
         bitset_index = 0;
         size = 0;
@@ -413,6 +1512,16 @@ void setCpy (setType *const dest, const const_setType source)
 
   /* setCpy */
     set_dest = *dest;
+    if (unlikely(isSparseSet(set_dest) || isSparseSet(source))) {
+      /* The copy is created before *dest is freed, */
+      /* because *dest == source is possible.       */
+      set_dest = setCreate(source);
+      if (set_dest != NULL) {
+        setDestr(*dest);
+        *dest = set_dest;
+      } /* if */
+      return;
+    } /* if */
     set_source_size = bitsetSize(source);
     if (set_dest->min_position != source->min_position ||
         set_dest->max_position != source->max_position) {
@@ -466,6 +1575,13 @@ setType setCreate (const const_setType source)
     setType result;
 
   /* setCreate */
+    if (unlikely(isSparseSet(source))) {
+      result = (setType) copySparseSet((const_sparseSetType) source);
+      if (unlikely(result == NULL)) {
+        raise_error(MEMORY_ERROR);
+      } /* if */
+      return result;
+    } /* if */
     new_size = bitsetSize(source);
     if (unlikely(!ALLOC_SET(result, new_size))) {
       raise_error(MEMORY_ERROR);
@@ -507,7 +1623,11 @@ void setDestr (const const_setType old_set)
 
   { /* setDestr */
     if (old_set != NULL) {
-      FREE_SET(old_set, bitsetSize(old_set));
+      if (unlikely(isSparseSet(old_set))) {
+        freeSparseSet((const_sparseSetType) old_set);
+      } else {
+        FREE_SET(old_set, bitsetSize(old_set));
+      } /* if */
     } /* if */
   } /* setDestr */
 
@@ -545,7 +1665,9 @@ setType setDiff (const const_setType set1, const const_setType set2)
                 printf(", ");
                 printSet(set2);
                 printf(")\n"););
-    if (unlikely(!ALLOC_SET(difference, bitsetSize(set1)))) {
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      difference = mergeSets(set1, set2, SET_DIFF);
+    } else if (unlikely(!ALLOC_SET(difference, bitsetSize(set1)))) {
       raise_error(MEMORY_ERROR);
     } else {
       difference->min_position = set1->min_position;
@@ -604,6 +1726,10 @@ void setDiffAssign (setType *const dest, const const_setType delta)
                 printSet(delta);
                 printf(")\n"););
     set1 = *dest;
+    if (unlikely(isSparseSet(set1) || isSparseSet(delta))) {
+      mergeSetsAssign(dest, delta, SET_DIFF);
+      return;
+    } /* if */
     min_position = set1->min_position;
     max_position = set1->max_position;
     while (min_position <= max_position &&
@@ -717,6 +1843,8 @@ boolType setElem (const intType number, const const_setType aSet)
       } else {
         return FALSE;
       } /* if */
+    } else if (unlikely(isSparseSet(aSet))) {
+      return sparseElem((const_sparseSetType) aSet, number);
     } else {
       return FALSE;
     } /* if */
@@ -744,7 +1872,9 @@ boolType setEq (const const_setType set1, const const_setType set2)
                 printf(", ");
                 printSet(set2);
                 printf(")\n"););
-    if (set1->min_position == set2->min_position &&
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      return mergeEq(set1, set2);
+    } else if (set1->min_position == set2->min_position &&
         set1->max_position == set2->max_position) {
       return memcmp(set1->bitset, set2->bitset,
           bitsetSize(set1) * sizeof(bitSetType)) == 0;
@@ -828,6 +1958,8 @@ boolType setEq (const const_setType set1, const const_setType set2)
 /**
  *  Remove 'number' from the set 'set_to'.
  *  If 'number' is not element of 'set_to' then 'set_to' stays unchanged.
+ *  A chunked set is changed in place, such that *set_to keeps its
+ *  value. Compiled programs rely on this.
  */
 void setExcl (setType *const set_to, const intType number)
 
@@ -903,6 +2035,9 @@ void setExcl (setType *const set_to, const intType number)
           } /* if */
         } /* if */
       } /* if */
+    } else if (unlikely(isSparseSet(set_dest))) {
+      /* A chunked set is changed in place. */
+      sparseExcl((sparseSetType) set_dest, number);
     } /* if */
     logFunction(printf("setExcl(");
                 printSet(*set_to);
@@ -920,14 +2055,27 @@ intType setHashCode (const const_setType set1)
   {
     memSizeType bitset_size;
     memSizeType bitset_index;
+    wordIterRecord iter;
+    intType position;
+    bitSetType curr_bitset;
     intType hashCode;
 
   /* setHashCode */
     hashCode = 0;
-    bitset_size = bitsetSize(set1);
-    for (bitset_index = 0; bitset_index < bitset_size; bitset_index++) {
-      hashCode ^= (intType) set1->bitset[bitset_index];
-    } /* for */
+    if (unlikely(isSparseSet(set1))) {
+      /* Zero elements do not change the hash code. Therefore */
+      /* dense and chunked sets with equal value get the same */
+      /* hash code.                                           */
+      initWordIter(&iter, set1);
+      while (nextWord(&iter, &position, &curr_bitset)) {
+        hashCode ^= (intType) curr_bitset;
+      } /* while */
+    } else {
+      bitset_size = bitsetSize(set1);
+      for (bitset_index = 0; bitset_index < bitset_size; bitset_index++) {
+        hashCode ^= (intType) set1->bitset[bitset_index];
+      } /* for */
+    } /* if */
     return hashCode;
   } /* setHashCode */
 
@@ -993,9 +2141,55 @@ setType setIConv (intType number)
 
 
 
+/**
+ *  Add 'number' to a dense set that would waste too much memory
+ *  if it is enlarged. An empty set is moved to the position of
+ *  'number'. Other sets are converted to chunked sets.
+ *  @exception MEMORY_ERROR If there is not enough memory.
+ */
+static void inclFarAway (setType *const set_to, const intType number)
+
+  {
+    setType set_dest;
+    memSizeType old_size;
+    setType resized_set;
+    sparseSetType sparseSet;
+
+  /* inclFarAway */
+    set_dest = *set_to;
+    old_size = bitsetSize(set_dest);
+    if (bitsetNonZero(set_dest->bitset, old_size) == NULL) {
+      resized_set = REALLOC_SET(set_dest, old_size, 1);
+      if (unlikely(resized_set == NULL)) {
+        raise_error(MEMORY_ERROR);
+      } else {
+        COUNT3_SET(old_size, 1);
+        resized_set->min_position = bitset_pos(number);
+        resized_set->max_position = resized_set->min_position;
+        resized_set->bitset[0] = (bitSetType) 1 << (((unsigned int) number) & bitset_mask);
+        *set_to = resized_set;
+      } /* if */
+    } else {
+      sparseSet = denseToSparseSet(set_dest);
+      if (unlikely(sparseSet == NULL)) {
+        raise_error(MEMORY_ERROR);
+      } else if (unlikely(!sparseIncl(sparseSet, number))) {
+        freeSparseSet(sparseSet);
+        raise_error(MEMORY_ERROR);
+      } else {
+        FREE_SET(set_dest, old_size);
+        *set_to = (setType) sparseSet;
+      } /* if */
+    } /* if */
+  } /* inclFarAway */
+
+
+
 /**
  *  Add 'number' to the set 'set_to'.
  *  If 'number' is already in 'set_to' then 'set_to' stays unchanged.
+ *  A dense set, that would waste too much memory, is converted to
+ *  a chunked set.
  *  @exception MEMORY_ERROR If there is not enough memory.
  */
 void setIncl (setType *const set_to, const intType number)
@@ -1014,10 +2208,19 @@ void setIncl (setType *const set_to, const intType number)
                 printSet(*set_to);
                 printf(", " FMT_D ")\n", number););
     set_dest = *set_to;
+    if (unlikely(isSparseSet(set_dest))) {
+      if (unlikely(!sparseIncl((sparseSetType) set_dest, number))) {
+        raise_error(MEMORY_ERROR);
+      } /* if */
+      return;
+    } /* if */
     position = bitset_pos(number);
     if (position > set_dest->max_position) {
       old_size = bitsetSize(set_dest);
-      if (unlikely((uintType) (position - set_dest->min_position + 1) > MAX_SET_LEN)) {
+      if (!setStaysDense((uintType) (position - set_dest->min_position + 1), old_size)) {
+        inclFarAway(set_to, number);
+        return;
+      } else if (unlikely((uintType) (position - set_dest->min_position + 1) > MAX_SET_LEN)) {
         raise_error(MEMORY_ERROR);
         return;
       } else {
@@ -1035,7 +2238,10 @@ void setIncl (setType *const set_to, const intType number)
       } /* if */
     } else if (position < set_dest->min_position) {
       old_size = bitsetSize(set_dest);
-      if (unlikely((uintType) (set_dest->max_position - position + 1) > MAX_SET_LEN)) {
+      if (!setStaysDense((uintType) (set_dest->max_position - position + 1), old_size)) {
+        inclFarAway(set_to, number);
+        return;
+      } else if (unlikely((uintType) (set_dest->max_position - position + 1) > MAX_SET_LEN)) {
         raise_error(MEMORY_ERROR);
         return;
       } else {
@@ -1084,6 +2290,9 @@ setType setIntersect (const const_setType set1, const const_setType set2)
                 printf(",\n");
                 printSet(set2);
                 printf(")\n"););
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      return mergeSets(set1, set2, SET_INTERSECT);
+    } /* if */
     if (set1->min_position > set2->min_position) {
       min_position = set1->min_position;
     } else {
@@ -1153,6 +2362,10 @@ void setIntersectAssign (setType *const dest, const const_setType delta)
                 printSet(delta);
                 printf(")\n"););
     set1 = *dest;
+    if (unlikely(isSparseSet(set1) || isSparseSet(delta))) {
+      mergeSetsAssign(dest, delta, SET_INTERSECT);
+      return;
+    } /* if */
     if (set1->min_position > delta->min_position) {
       min_position = set1->min_position;
     } else {
@@ -1247,6 +2460,9 @@ boolType setIsEmpty (const const_setType set1)
     register memSizeType bitset_index;
 
   /* setIsEmpty */
+    if (unlikely(isSparseSet(set1))) {
+      return ((const_sparseSetType) set1)->size == 0;
+    } /* if */
     bitset_index = bitsetSize(set1);
     do {
       bitset_index--;
@@ -1283,6 +2499,9 @@ boolType setIsProperSubset (const const_setType set1, const const_setType set2)
                 printf(", ");
                 printSet(set2);
                 printf(")\n"););
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      return mergeSubset(set1, set2, &equal) && !equal;
+    } /* if */
     equal = TRUE;
     if (set1->min_position < set2->min_position) {
       if (set1->max_position < set2->min_position) {
@@ -1381,6 +2600,7 @@ boolType setIsSubset (const const_setType set1, const const_setType set2)
     memSizeType size;
     const bitSetType *bitset1;
     const bitSetType *bitset2;
+    boolType equal;
 
   /* setIsSubset */
     logFunction(printf("setIsSubset(");
@@ -1388,6 +2608,9 @@ boolType setIsSubset (const const_setType set1, const const_setType set2)
                 printf(", ");
                 printSet(set2);
                 printf(")\n"););
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2))) {
+      return mergeSubset(set1, set2, &equal);
+    } /* if */
     if (set1->min_position < set2->min_position) {
       if (set1->max_position < set2->min_position) {
         size = 0;
@@ -1460,10 +2683,19 @@ intType setMax (const const_setType aSet)
   {
     memSizeType bitset_index;
     bitSetType curr_bitset;
+    const_setChunkType aChunk;
     intType result;
 
   /* setMax */
-    bitset_index = bitsetSize(aSet);
+    if (unlikely(isSparseSet(aSet))) {
+      if (((const_sparseSetType) aSet)->size != 0) {
+        aChunk = &((const_sparseSetType) aSet)->chunk[((const_sparseSetType) aSet)->size - 1];
+        return chunkElement(aChunk->key, chunkMax(aChunk));
+      } /* if */
+      bitset_index = 0;
+    } else {
+      bitset_index = bitsetSize(aSet);
+    } /* if */
     while (bitset_index > 0) {
       bitset_index--;
       curr_bitset = aSet->bitset[bitset_index];
@@ -1494,10 +2726,19 @@ intType setMin (const const_setType aSet)
     memSizeType bitset_size;
     memSizeType bitset_index;
     bitSetType curr_bitset;
+    const_setChunkType aChunk;
     intType result;
 
   /* setMin */
-    bitset_size = bitsetSize(aSet);
+    if (unlikely(isSparseSet(aSet))) {
+      if (((const_sparseSetType) aSet)->size != 0) {
+        aChunk = &((const_sparseSetType) aSet)->chunk[0];
+        return chunkElement(aChunk->key, chunkMin(aChunk));
+      } /* if */
+      bitset_size = 0;
+    } else {
+      bitset_size = bitsetSize(aSet);
+    } /* if */
     bitset_index = 0;
     while (bitset_index < bitset_size) {
       curr_bitset = aSet->bitset[bitset_index];
@@ -1541,6 +2782,14 @@ intType setNext (const const_setType aSet, const intType number)
                       number););
       raise_error(RANGE_ERROR);
       nextNumber = 0;
+    } else if (unlikely(isSparseSet(aSet))) {
+      if (unlikely(!sparseNext((const_sparseSetType) aSet, number + 1, &nextNumber))) {
+        logError(printf("setNext(aSet, " FMT_D "): "
+                        "The maximum element of a set has no next element.\n",
+                        number););
+        raise_error(RANGE_ERROR);
+        nextNumber = 0;
+      } /* if */
     } else {
       position = bitset_pos(number + 1);
       if (position < aSet->min_position) {
@@ -1608,6 +2857,9 @@ intType setRand (const const_setType aSet)
       return 0;
     } else {
       elem_index = intRand(1, num_elements);
+      if (unlikely(isSparseSet(aSet))) {
+        return sparseElemAtIndex((const_sparseSetType) aSet, elem_index);
+      } /* if */
       for (bitset_index = bitsetSize(aSet);
            bitset_index > 0 && elem_index > BITSETTYPE_SIZE; bitset_index--) {
         curr_bitset = aSet->bitset[bitset_index - 1];
@@ -1723,6 +2975,10 @@ intType setSConv (const const_setType aSet)
         return 0;
       } /* if */
 #endif
+    } else if (isSparseSet(aSet) &&
+               (setIsEmpty(aSet) ||
+                (setMin(aSet) >= 0 && setMax(aSet) < INTTYPE_SIZE - 1))) {
+      number = (intType) setToUInt(aSet, 0);
     } else {
       logError(printf("setSConv(): "
                       "Set contains negative values or does not fit into an integer.\n"););
@@ -1769,7 +3025,11 @@ setType setSymdiff (const const_setType set1, const const_setType set2)
       max_position = set2->max_position;
       stop_position = set1->max_position;
     } /* if */
-    if (unlikely((uintType) (max_position - min_position + 1) > MAX_SET_LEN ||
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2) ||
+                 !setStaysDense((uintType) (max_position - min_position + 1),
+                                bitsetSize(set1) + bitsetSize(set2)))) {
+      symDiff = mergeSets(set1, set2, SET_SYMDIFF);
+    } else if (unlikely((uintType) (max_position - min_position + 1) > MAX_SET_LEN ||
         !ALLOC_SET(symDiff, (uintType) (max_position - min_position + 1)))) {
       raise_error(MEMORY_ERROR);
       symDiff = NULL;
@@ -1839,7 +3099,15 @@ uintType setToUInt (const const_setType set1, const intType lowestBitNum)
                 printSet(set1);
                 printf(", " FMT_D ")\n", lowestBitNum););
     position = bitset_pos(lowestBitNum);
-    if (position >= set1->min_position && position <= set1->max_position) {
+    if (unlikely(isSparseSet(set1))) {
+      bit_index = ((unsigned int) lowestBitNum) & bitset_mask;
+      bitPattern = (uintType) sparseBitset((const_sparseSetType) set1, position);
+      if (bit_index != 0) {
+        bitPattern = (uintType) ((bitSetType) bitPattern >> bit_index |
+            sparseBitset((const_sparseSetType) set1, position + 1) <<
+            (CHAR_BIT * sizeof(bitSetType) - bit_index));
+      } /* if */
+    } else if (position >= set1->min_position && position <= set1->max_position) {
       bitset_index = bitsetIndex(set1, position);
       bit_index = ((unsigned int) lowestBitNum) & bitset_mask;
       if (bit_index == 0) {
@@ -1903,7 +3171,11 @@ setType setUnion (const const_setType set1, const const_setType set2)
       max_position = set2->max_position;
       stop_position = set1->max_position;
     } /* if */
-    if (unlikely((uintType) (max_position - min_position + 1) > MAX_SET_LEN ||
+    if (unlikely(isSparseSet(set1) || isSparseSet(set2) ||
+                 !setStaysDense((uintType) (max_position - min_position + 1),
+                                bitsetSize(set1) + bitsetSize(set2)))) {
+      unionOfSets = mergeSets(set1, set2, SET_UNION);
+    } else if (unlikely((uintType) (max_position - min_position + 1) > MAX_SET_LEN ||
         !ALLOC_SET(unionOfSets, (uintType) (max_position - min_position + 1)))) {
       raise_error(MEMORY_ERROR);
       unionOfSets = NULL;
@@ -1991,7 +3263,11 @@ void setUnionAssign (setType *const dest, const const_setType delta)
       max_position = delta->max_position;
       stop_position = set1->max_position;
     } /* if */
-    if (set1->min_position == min_position &&
+    if (unlikely(isSparseSet(set1) || isSparseSet(delta) ||
+                 !setStaysDense((uintType) (max_position - min_position + 1),
+                                bitsetSize(set1) + bitsetSize(delta)))) {
+      mergeSetsAssign(dest, delta, SET_UNION);
+    } else if (set1->min_position == min_position &&
         set1->max_position == max_position) {
       for (position = start_position; position <= stop_position; position++) {
         set1->bitset[position - min_position] |=
@@ -39,6 +39,12 @@
 #define bitset_pos(number) ((number)<0?~(~(number)>>bitset_shift):(number)>>bitset_shift)
 #endif
 
+/* A dense set with more than SET_DENSE_LIMIT bitset elements */
+/* is converted to a chunked set if less than half of its      */
+/* bitset elements would be needed to store the elements.      */
+#define SET_DENSE_LIMIT 1024
+#define setStaysDense(size,usedSize) ((size) <= SET_DENSE_LIMIT || (size) / 2 <= (usedSize))
+
 #if TWOS_COMPLEMENT_INTTYPE
 #define lowestBitsetPosAsInteger(bitset_pos) ((bitset_pos) << bitset_shift)
 #else
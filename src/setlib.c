@@ -92,7 +92,7 @@ objectType set_arrlit (listType arguments)
             logError(printf("set_arrlit: setIncl(*, " FMT_D
                             ") failed.\n",
                             take_int(&arr1->arr[array_index])););
-            FREE_SET(resultSet, bitsetSize(resultSet));
+            setDestr(resultSet);
             return fail_value;
           } /* if */
         } /* for */
@@ -246,10 +246,11 @@ objectType set_cpy (listType arguments)
     set_dest = take_set(dest);
     set_source = take_set(source);
     if (TEMP_OBJECT(source)) {
-      set_dest_size = bitsetSize(set_dest);
-      FREE_SET(set_dest, set_dest_size);
+      setDestr(set_dest);
       dest->value.setValue = set_source;
       source->value.setValue = NULL;
+    } else if (unlikely(isSparseSet(set_dest) || isSparseSet(set_source))) {
+      setCpy(&dest->value.setValue, set_source);
     } else {
       set_source_size = bitsetSize(set_source);
       if (set_dest->min_position != set_source->min_position ||
@@ -311,6 +312,11 @@ objectType set_create (listType arguments)
     if (TEMP_OBJECT(source)) {
       dest->value.setValue = set_source;
       source->value.setValue = NULL;
+    } else if (unlikely(isSparseSet(set_source))) {
+      dest->value.setValue = setCreate(set_source);
+      if (unlikely(dest->value.setValue == NULL)) {
+        return fail_value;
+      } /* if */
     } else {
       new_size = bitsetSize(set_source);
       if (!ALLOC_SET(new_set, new_size)) {
@@ -352,7 +358,7 @@ objectType set_destr (listType arguments)
     isit_set(arg_1(arguments));
     old_set = take_set(arg_1(arguments));
     if (old_set != NULL) {
-      FREE_SET(old_set, bitsetSize(old_set));
+      setDestr(old_set);
       arg_1(arguments)->value.setValue = NULL;
     } /* if */
     SET_UNUSED_FLAG(arg_1(arguments));
@@ -429,6 +435,8 @@ objectType set_elem (listType arguments)
       } else {
         return SYS_FALSE_OBJECT;
       } /* if */
+    } else if (unlikely(isSparseSet(aSet)) && setElem(number, aSet)) {
+      return SYS_TRUE_OBJECT;
     } else {
       return SYS_FALSE_OBJECT;
     } /* if */
@@ -561,6 +569,8 @@ objectType set_excl (listType arguments)
           } /* if */
         } /* if */
       } /* if */
+    } else if (unlikely(isSparseSet(set_dest))) {
+      setExcl(&set_to->value.setValue, number);
     } /* if */
     return SYS_EMPTY_OBJECT;
   } /* set_excl */
@@ -686,10 +696,17 @@ objectType set_incl (listType arguments)
     logFunction(printf("set_incl(");
                 trace1(set_to);
                 printf(", " FMT_D ")\n", number););
+    if (unlikely(isSparseSet(set_dest))) {
+      setIncl(&set_to->value.setValue, number);
+      return SYS_EMPTY_OBJECT;
+    } /* if */
     position = bitset_pos(number);
     if (position > set_dest->max_position) {
       old_size = bitsetSize(set_dest);
-      if (unlikely((uintType) (position - set_dest->min_position + 1) > MAX_SET_LEN)) {
+      if (!setStaysDense((uintType) (position - set_dest->min_position + 1), old_size)) {
+        setIncl(&set_to->value.setValue, number);
+        return SYS_EMPTY_OBJECT;
+      } else if (unlikely((uintType) (position - set_dest->min_position + 1) > MAX_SET_LEN)) {
         return raise_exception(SYS_MEM_EXCEPTION);
       } else {
         new_size = bitsetSize2(set_dest->min_position, position);
@@ -720,7 +737,10 @@ objectType set_incl (listType arguments)
       } /* if */
     } else if (position < set_dest->min_position) {
       old_size = bitsetSize(set_dest);
-      if (unlikely((uintType) (set_dest->max_position - position + 1) > MAX_SET_LEN)) {
+      if (!setStaysDense((uintType) (set_dest->max_position - position + 1), old_size)) {
+        setIncl(&set_to->value.setValue, number);
+        return SYS_EMPTY_OBJECT;
+      } else if (unlikely((uintType) (set_dest->max_position - position + 1) > MAX_SET_LEN)) {
         return raise_exception(SYS_MEM_EXCEPTION);
       } else {
         new_size = bitsetSize2(position, set_dest->max_position);
@@ -941,6 +961,8 @@ objectType set_not_elem (listType arguments)
       } else {
         return SYS_TRUE_OBJECT;
       } /* if */
+    } else if (unlikely(isSparseSet(aSet)) && setElem(number, aSet)) {
+      return SYS_FALSE_OBJECT;
     } else {
       return SYS_TRUE_OBJECT;
     } /* if */
@@ -1084,6 +1106,12 @@ objectType set_value (listType arguments)
                trace1(obj_arg);
                printf("): Not a legal SETOBJECT.\n"););
       return raise_exception(SYS_RNG_EXCEPTION);
+    } else if (unlikely(isSparseSet(aSet))) {
+      result = setCreate(aSet);
+      if (unlikely(result == NULL)) {
+        return fail_value;
+      } /* if */
+      return bld_set_temp(result);
     } else {
       set_size = bitsetSize(aSet);
       if (!ALLOC_SET(result, set_size)) {
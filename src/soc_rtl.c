@@ -2592,6 +2592,25 @@ void socSetOptBool (const const_socketType aSocket, intType optname,
             } /* if */
           }
           break;
+#ifdef SO_REUSEPORT
+        case SOC_OPT_REUSEPORT: {
+            int so_reuseport = optval;
+            if (unlikely(setsockopt((os_socketType) aSocket->socketNumber,
+                                    SOL_SOCKET, SO_REUSEPORT,
+                                    (const char *) &so_reuseport,
+                                    sizeof(so_reuseport)) != 0)) {
+              logError(printf("socSetOptBool(%d, " FMT_D ", %s): "
+                              "setsockopt(%d, ...) failed:\n"
+                              "%s=%d\nerror: %s\n",
+                              aSocket->socketNumber, optname,
+                              optval ? "TRUE" : "FALSE",
+                              aSocket->socketNumber,
+                              ERROR_INFORMATION););
+              raise_error(FILE_ERROR);
+            } /* if */
+          }
+          break;
+#endif
         default:
           logError(printf("socSetOptBool(%d, " FMT_D ", %s): "
                           "Unsupported option.\n",
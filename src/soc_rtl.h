@@ -37,6 +37,7 @@ EXTERN socketRecord emptySocketRecord;
 
 #define SOC_OPT_NONE      0
 #define SOC_OPT_REUSEADDR 1
+#define SOC_OPT_REUSEPORT 2
 
 #if SOCKET_LIB == UNIX_SOCKETS
 #define ERROR_INFORMATION "errno", errno, strerror(errno)
@@ -40,7 +40,10 @@
 #include "stdarg.h"
 
 #include "common.h"
+#include "data_rtl.h"
 #include "heaputl.h"
+#include "int_rtl.h"
+#include "flt_rtl.h"
 
 #undef EXTERN
 #define EXTERN
@@ -118,3 +121,608 @@ void dllErrorMessage (const char *funcName, const char *dbFuncName,
       UNALLOC_CSTRI(dllNames, dllNamesSize);
     } /* if */
   } /* dllErrorMessage */
+
+
+
+static void freeBulkData (bulkDataType bulkData)
+
+  {
+    memSizeType pos;
+
+  /* freeBulkData */
+    switch (bulkData->kind) {
+      case BULK_INT:
+        if (bulkData->data.intValues != NULL) {
+          FREE_TABLE(bulkData->data.intValues, intType, bulkData->length);
+        } /* if */
+        break;
+      case BULK_FLOAT:
+        if (bulkData->data.floatValues != NULL) {
+          FREE_TABLE(bulkData->data.floatValues, floatType, bulkData->length);
+        } /* if */
+        break;
+      case BULK_STRI:
+        if (bulkData->data.striValues != NULL) {
+          for (pos = 0; pos < bulkData->length; pos++) {
+            if (bulkData->data.striValues[pos] != NULL) {
+              FREE_STRI(bulkData->data.striValues[pos]);
+            } /* if */
+          } /* for */
+          FREE_TABLE(bulkData->data.striValues, striType, bulkData->length);
+        } /* if */
+        break;
+    } /* switch */
+    bulkData->kind = BULK_NONE;
+    bulkData->length = 0;
+    bulkData->data.intValues = NULL;
+  } /* freeBulkData */
+
+
+
+/**
+ *  Free the bound arrays and the fetched block of a prepared statement.
+ *  The bulk record itself is part of the prepared statement and
+ *  is not freed.
+ */
+void freeBulk (bulkType bulk)
+
+  {
+    memSizeType pos;
+
+  /* freeBulk */
+    if (bulk->param_array != NULL) {
+      for (pos = 0; pos < bulk->param_array_size; pos++) {
+        freeBulkData(&bulk->param_array[pos]);
+      } /* for */
+      FREE_TABLE(bulk->param_array, bulkDataRecord, bulk->param_array_size);
+      bulk->param_array = NULL;
+      bulk->param_array_size = 0;
+    } /* if */
+    if (bulk->column_array != NULL) {
+      for (pos = 0; pos < bulk->column_array_size; pos++) {
+        freeBulkData(&bulk->column_array[pos]);
+      } /* for */
+      FREE_TABLE(bulk->column_array, bulkDataRecord, bulk->column_array_size);
+      bulk->column_array = NULL;
+      bulk->column_array_size = 0;
+    } /* if */
+    bulk->row_count = 0;
+  } /* freeBulk */
+
+
+
+static striType copyStri (const const_striType stri)
+
+  {
+    striType copy;
+
+  /* copyStri */
+    if (likely(ALLOC_STRI_SIZE_OK(copy, stri->size))) {
+      copy->size = stri->size;
+      memcpy(copy->mem, stri->mem, stri->size * sizeof(strElemType));
+    } /* if */
+    return copy;
+  } /* copyStri */
+
+
+
+/**
+ *  Bind the array 'values' to the parameter 'pos' of a statement.
+ *  The elements of 'values' are copied, such that later changes of
+ *  'values' do not influence the bound data.
+ *  @param paramCount Number of parameters of the prepared statement.
+ *  @param kind BULK_INT, BULK_FLOAT or BULK_STRI.
+ *  @return RANGE_ERROR if 'pos' is not a parameter position,
+ *          MEMORY_ERROR if there is not enough memory, or
+ *          OKAY_NO_ERROR otherwise.
+ */
+errInfoType bulkBindArray (bulkType bulk, memSizeType paramCount, intType pos,
+    int kind, const const_rtlArrayType values)
+
+  {
+    bulkDataType param;
+    memSizeType length;
+    memSizeType idx;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bulkBindArray */
+    logFunction(printf("bulkBindArray(*, " FMT_U_MEM ", " FMT_D ", %d, *)\n",
+                       paramCount, pos, kind););
+    if (unlikely(pos < 1 || (uintType) pos > paramCount)) {
+      logError(printf("bulkBindArray: pos: " FMT_D ", max pos: " FMT_U_MEM ".\n",
+                      pos, paramCount););
+      err_info = RANGE_ERROR;
+    } else {
+      if (bulk->param_array == NULL) {
+        if (unlikely(!ALLOC_TABLE(bulk->param_array, bulkDataRecord, paramCount))) {
+          err_info = MEMORY_ERROR;
+        } else {
+          bulk->param_array_size = paramCount;
+          memset(bulk->param_array, 0, paramCount * sizeof(bulkDataRecord));
+        } /* if */
+      } /* if */
+      if (likely(err_info == OKAY_NO_ERROR)) {
+        param = &bulk->param_array[pos - 1];
+        freeBulkData(param);
+        length = arraySize(values);
+        if (length != 0) {
+          switch (kind) {
+            case BULK_INT:
+              if (unlikely(!ALLOC_TABLE(param->data.intValues, intType, length))) {
+                err_info = MEMORY_ERROR;
+              } else {
+                for (idx = 0; idx < length; idx++) {
+                  param->data.intValues[idx] = values->arr[idx].value.intValue;
+                } /* for */
+              } /* if */
+              break;
+            case BULK_FLOAT:
+              if (unlikely(!ALLOC_TABLE(param->data.floatValues, floatType, length))) {
+                err_info = MEMORY_ERROR;
+              } else {
+                for (idx = 0; idx < length; idx++) {
+                  param->data.floatValues[idx] = values->arr[idx].value.floatValue;
+                } /* for */
+              } /* if */
+              break;
+            case BULK_STRI:
+              if (unlikely(!ALLOC_TABLE(param->data.striValues, striType, length))) {
+                err_info = MEMORY_ERROR;
+              } else {
+                for (idx = 0; idx < length; idx++) {
+                  param->data.striValues[idx] = copyStri(values->arr[idx].value.striValue);
+                  if (unlikely(param->data.striValues[idx] == NULL)) {
+                    while (idx != 0) {
+                      idx--;
+                      FREE_STRI(param->data.striValues[idx]);
+                    } /* while */
+                    FREE_TABLE(param->data.striValues, striType, length);
+                    param->data.striValues = NULL;
+                    err_info = MEMORY_ERROR;
+                    idx = length;
+                  } /* if */
+                } /* for */
+              } /* if */
+              break;
+          } /* switch */
+        } /* if */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          param->kind = kind;
+          param->length = length;
+        } else {
+          param->data.intValues = NULL;
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("bulkBindArray --> %d\n", err_info););
+    return err_info;
+  } /* bulkBindArray */
+
+
+
+/**
+ *  Determine the number of rows of a batch execution.
+ *  All parameters must be bound to arrays of the same length.
+ *  @return the common length of the bound arrays.
+ */
+memSizeType bulkBatchSize (const_bulkType bulk, memSizeType paramCount,
+    errInfoType *err_info)
+
+  {
+    memSizeType pos;
+    memSizeType batchSize = 0;
+
+  /* bulkBatchSize */
+    if (unlikely(paramCount == 0 || bulk->param_array == NULL)) {
+      dbLibError("sqlExecuteBatch", "sqlExecuteBatch",
+                 "No arrays bound to the statement parameters.\n");
+      logError(printf("bulkBatchSize: No arrays bound.\n"););
+      *err_info = DATABASE_ERROR;
+    } else {
+      for (pos = 0; pos < paramCount && *err_info == OKAY_NO_ERROR; pos++) {
+        if (unlikely(bulk->param_array[pos].kind == BULK_NONE)) {
+          dbLibError("sqlExecuteBatch", "sqlExecuteBatch",
+                     "Parameter " FMT_U_MEM " is not bound to an array.\n",
+                     pos + 1);
+          logError(printf("bulkBatchSize: Parameter " FMT_U_MEM
+                          " is not bound to an array.\n", pos + 1););
+          *err_info = DATABASE_ERROR;
+        } else if (pos == 0) {
+          batchSize = bulk->param_array[pos].length;
+        } else if (unlikely(bulk->param_array[pos].length != batchSize)) {
+          dbLibError("sqlExecuteBatch", "sqlExecuteBatch",
+                     "The arrays bound to the parameters differ in length.\n");
+          logError(printf("bulkBatchSize: Parameter " FMT_U_MEM
+                          " has the length " FMT_U_MEM " instead of " FMT_U_MEM ".\n",
+                          pos + 1, bulk->param_array[pos].length, batchSize););
+          *err_info = DATABASE_ERROR;
+        } /* if */
+      } /* for */
+    } /* if */
+    return batchSize;
+  } /* bulkBatchSize */
+
+
+
+/**
+ *  Discard the previous block and prepare the storage for a new one.
+ *  The rows of the new block are stored with bulkStoreInt(),
+ *  bulkStoreFloat() and bulkStoreStri(). Columns without a stored
+ *  value (NULL) get the default value (0, 0.0 or "").
+ */
+errInfoType bulkStartBlock (bulkType bulk, memSizeType columnCount)
+
+  {
+    memSizeType column;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bulkStartBlock */
+    if (bulk->column_array != NULL) {
+      for (column = 0; column < bulk->column_array_size; column++) {
+        freeBulkData(&bulk->column_array[column]);
+      } /* for */
+      if (bulk->column_array_size != columnCount) {
+        FREE_TABLE(bulk->column_array, bulkDataRecord, bulk->column_array_size);
+        bulk->column_array = NULL;
+        bulk->column_array_size = 0;
+      } /* if */
+    } /* if */
+    bulk->row_count = 0;
+    if (bulk->column_array == NULL && columnCount != 0) {
+      if (unlikely(!ALLOC_TABLE(bulk->column_array, bulkDataRecord, columnCount))) {
+        err_info = MEMORY_ERROR;
+      } else {
+        bulk->column_array_size = columnCount;
+        memset(bulk->column_array, 0, columnCount * sizeof(bulkDataRecord));
+      } /* if */
+    } /* if */
+    return err_info;
+  } /* bulkStartBlock */
+
+
+
+/**
+ *  Change the kind of a column to the more general kind 'kind'.
+ *  Integers are converted to floats and integers and floats
+ *  are converted to strings. SQLite allows values of different
+ *  types in one column, so this can happen in the middle of a block.
+ */
+static errInfoType widenBulkColumn (bulkDataType bulkData, int kind)
+
+  {
+    floatType *floatValues;
+    striType *striValues;
+    memSizeType idx;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* widenBulkColumn */
+    if (bulkData->length == 0) {
+      bulkData->data.intValues = NULL;
+    } else if (kind == BULK_FLOAT) {
+      if (unlikely(!ALLOC_TABLE(floatValues, floatType, bulkData->length))) {
+        err_info = MEMORY_ERROR;
+      } else {
+        for (idx = 0; idx < bulkData->length; idx++) {
+          floatValues[idx] = (floatType) bulkData->data.intValues[idx];
+        } /* for */
+        FREE_TABLE(bulkData->data.intValues, intType, bulkData->length);
+        bulkData->data.floatValues = floatValues;
+      } /* if */
+    } else if (unlikely(!ALLOC_TABLE(striValues, striType, bulkData->length))) {
+      err_info = MEMORY_ERROR;
+    } else {
+      for (idx = 0; idx < bulkData->length && err_info == OKAY_NO_ERROR; idx++) {
+        if (bulkData->kind == BULK_INT) {
+          striValues[idx] = intStr(bulkData->data.intValues[idx]);
+        } else {
+          striValues[idx] = fltStr(bulkData->data.floatValues[idx]);
+        } /* if */
+        if (unlikely(striValues[idx] == NULL)) {
+          while (idx != 0) {
+            idx--;
+            FREE_STRI(striValues[idx]);
+          } /* while */
+          FREE_TABLE(striValues, striType, bulkData->length);
+          err_info = MEMORY_ERROR;
+        } /* if */
+      } /* for */
+      if (likely(err_info == OKAY_NO_ERROR)) {
+        if (bulkData->kind == BULK_INT) {
+          FREE_TABLE(bulkData->data.intValues, intType, bulkData->length);
+        } else {
+          FREE_TABLE(bulkData->data.floatValues, floatType, bulkData->length);
+        } /* if */
+        bulkData->data.striValues = striValues;
+      } /* if */
+    } /* if */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      bulkData->kind = kind;
+    } /* if */
+    return err_info;
+  } /* widenBulkColumn */
+
+
+
+/**
+ *  Make sure that 'bulkData' has space for the element 'row'.
+ *  The capacity is doubled and the new elements are set to zero,
+ *  which represents NULL values.
+ */
+static errInfoType growBulkColumn (bulkDataType bulkData, memSizeType row)
+
+  {
+    memSizeType newLength;
+    intType *intValues;
+    floatType *floatValues;
+    striType *striValues;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* growBulkColumn */
+    newLength = bulkData->length == 0 ? 256 : bulkData->length;
+    while (newLength <= row) {
+      newLength *= 2;
+    } /* while */
+    switch (bulkData->kind) {
+      case BULK_INT:
+        if (bulkData->data.intValues == NULL) {
+          if (unlikely(!ALLOC_TABLE(intValues, intType, newLength))) {
+            err_info = MEMORY_ERROR;
+          } /* if */
+        } else if (unlikely((intValues = REALLOC_TABLE(bulkData->data.intValues,
+                                 intType, bulkData->length, newLength)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else {
+          COUNT3_TABLE(intType, bulkData->length, newLength);
+        } /* if */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          memset(&intValues[bulkData->length], 0,
+                 (newLength - bulkData->length) * sizeof(intType));
+          bulkData->data.intValues = intValues;
+        } /* if */
+        break;
+      case BULK_FLOAT:
+        if (bulkData->data.floatValues == NULL) {
+          if (unlikely(!ALLOC_TABLE(floatValues, floatType, newLength))) {
+            err_info = MEMORY_ERROR;
+          } /* if */
+        } else if (unlikely((floatValues = REALLOC_TABLE(bulkData->data.floatValues,
+                                 floatType, bulkData->length, newLength)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else {
+          COUNT3_TABLE(floatType, bulkData->length, newLength);
+        } /* if */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          memset(&floatValues[bulkData->length], 0,
+                 (newLength - bulkData->length) * sizeof(floatType));
+          bulkData->data.floatValues = floatValues;
+        } /* if */
+        break;
+      default:
+        if (bulkData->data.striValues == NULL) {
+          if (unlikely(!ALLOC_TABLE(striValues, striType, newLength))) {
+            err_info = MEMORY_ERROR;
+          } /* if */
+        } else if (unlikely((striValues = REALLOC_TABLE(bulkData->data.striValues,
+                                 striType, bulkData->length, newLength)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else {
+          COUNT3_TABLE(striType, bulkData->length, newLength);
+        } /* if */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          memset(&striValues[bulkData->length], 0,
+                 (newLength - bulkData->length) * sizeof(striType));
+          bulkData->data.striValues = striValues;
+        } /* if */
+        break;
+    } /* switch */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      bulkData->length = newLength;
+    } /* if */
+    return err_info;
+  } /* growBulkColumn */
+
+
+
+/**
+ *  Get the column data where the current row (row_count) is stored.
+ *  The column is widened to at least 'kind' and grown if necessary.
+ */
+static bulkDataType bulkCell (bulkType bulk, memSizeType column, int kind,
+    errInfoType *err_info)
+
+  {
+    bulkDataType bulkData;
+
+  /* bulkCell */
+    if (unlikely(column >= bulk->column_array_size)) {
+      logError(printf("bulkCell: column: " FMT_U_MEM ", max column: " FMT_U_MEM ".\n",
+                      column + 1, bulk->column_array_size););
+      *err_info = RANGE_ERROR;
+      bulkData = NULL;
+    } else {
+      bulkData = &bulk->column_array[column];
+      if (bulkData->kind < kind) {
+        *err_info = widenBulkColumn(bulkData, kind);
+      } /* if */
+      if (likely(*err_info == OKAY_NO_ERROR) &&
+          bulk->row_count >= bulkData->length) {
+        *err_info = growBulkColumn(bulkData, bulk->row_count);
+      } /* if */
+      if (unlikely(*err_info != OKAY_NO_ERROR)) {
+        bulkData = NULL;
+      } /* if */
+    } /* if */
+    return bulkData;
+  } /* bulkCell */
+
+
+
+/**
+ *  Store an integer in the current row of the block.
+ *  @param column Zero based column index.
+ */
+errInfoType bulkStoreInt (bulkType bulk, memSizeType column, intType value)
+
+  {
+    bulkDataType bulkData;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bulkStoreInt */
+    bulkData = bulkCell(bulk, column, BULK_INT, &err_info);
+    if (likely(bulkData != NULL)) {
+      switch (bulkData->kind) {
+        case BULK_INT:
+          bulkData->data.intValues[bulk->row_count] = value;
+          break;
+        case BULK_FLOAT:
+          bulkData->data.floatValues[bulk->row_count] = (floatType) value;
+          break;
+        default:
+          bulkData->data.striValues[bulk->row_count] = intStr(value);
+          if (unlikely(bulkData->data.striValues[bulk->row_count] == NULL)) {
+            err_info = MEMORY_ERROR;
+          } /* if */
+          break;
+      } /* switch */
+    } /* if */
+    return err_info;
+  } /* bulkStoreInt */
+
+
+
+/**
+ *  Store a float in the current row of the block.
+ *  @param column Zero based column index.
+ */
+errInfoType bulkStoreFloat (bulkType bulk, memSizeType column, floatType value)
+
+  {
+    bulkDataType bulkData;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bulkStoreFloat */
+    bulkData = bulkCell(bulk, column, BULK_FLOAT, &err_info);
+    if (likely(bulkData != NULL)) {
+      if (bulkData->kind == BULK_FLOAT) {
+        bulkData->data.floatValues[bulk->row_count] = value;
+      } else {
+        bulkData->data.striValues[bulk->row_count] = fltStr(value);
+        if (unlikely(bulkData->data.striValues[bulk->row_count] == NULL)) {
+          err_info = MEMORY_ERROR;
+        } /* if */
+      } /* if */
+    } /* if */
+    return err_info;
+  } /* bulkStoreFloat */
+
+
+
+/**
+ *  Store a string in the current row of the block.
+ *  The block takes over the ownership of 'value'. It is freed
+ *  even if the function fails.
+ *  @param column Zero based column index.
+ */
+errInfoType bulkStoreStri (bulkType bulk, memSizeType column, striType value)
+
+  {
+    bulkDataType bulkData;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bulkStoreStri */
+    bulkData = bulkCell(bulk, column, BULK_STRI, &err_info);
+    if (likely(bulkData != NULL)) {
+      bulkData->data.striValues[bulk->row_count] = value;
+    } else {
+      FREE_STRI(value);
+    } /* if */
+    return err_info;
+  } /* bulkStoreStri */
+
+
+
+/**
+ *  Create an array with the values of 'column' in the fetched block.
+ *  Integer columns can be retrieved as float or string and float
+ *  columns can be retrieved as string. NULL values are retrieved as
+ *  0, 0.0 or "".
+ *  @param kind BULK_INT, BULK_FLOAT or BULK_STRI.
+ *  @return an array with the index range 1 .. number of rows, or
+ *          NULL if 'err_info' has been set.
+ */
+rtlArrayType bulkColumn (const_bulkType bulk, intType column, int kind,
+    errInfoType *err_info)
+
+  {
+    const_bulkDataType bulkData;
+    memSizeType rowCount;
+    memSizeType idx;
+    striType stri;
+    rtlArrayType columnArray;
+
+  /* bulkColumn */
+    logFunction(printf("bulkColumn(*, " FMT_D ", %d)\n", column, kind););
+    rowCount = bulk->row_count;
+    if (unlikely(column < 1 || (uintType) column > bulk->column_array_size)) {
+      logError(printf("bulkColumn: column: " FMT_D ", max column: " FMT_U_MEM ".\n",
+                      column, bulk->column_array_size););
+      *err_info = RANGE_ERROR;
+      columnArray = NULL;
+    } else if (unlikely(bulk->column_array[column - 1].kind > kind)) {
+      logError(printf("bulkColumn: Column " FMT_D " has the kind %d, "
+                      "which cannot be converted to %d.\n",
+                      column, bulk->column_array[column - 1].kind, kind););
+      *err_info = RANGE_ERROR;
+      columnArray = NULL;
+    } else if (unlikely(!ALLOC_RTL_ARRAY(columnArray, rowCount))) {
+      *err_info = MEMORY_ERROR;
+    } else {
+      columnArray->min_position = 1;
+      columnArray->max_position = (intType) rowCount;
+      bulkData = &bulk->column_array[column - 1];
+      for (idx = 0; idx < rowCount && *err_info == OKAY_NO_ERROR; idx++) {
+        if (kind == BULK_INT) {
+          columnArray->arr[idx].value.intValue =
+              bulkData->kind == BULK_NONE || idx >= bulkData->length ? 0 :
+              bulkData->data.intValues[idx];
+        } else if (kind == BULK_FLOAT) {
+          if (bulkData->kind == BULK_NONE || idx >= bulkData->length) {
+            columnArray->arr[idx].value.floatValue = 0.0;
+          } else if (bulkData->kind == BULK_INT) {
+            columnArray->arr[idx].value.floatValue =
+                (floatType) bulkData->data.intValues[idx];
+          } else {
+            columnArray->arr[idx].value.floatValue = bulkData->data.floatValues[idx];
+          } /* if */
+        } else {
+          if (bulkData->kind == BULK_NONE || idx >= bulkData->length ||
+              (bulkData->kind == BULK_STRI && bulkData->data.striValues[idx] == NULL)) {
+            if (ALLOC_STRI_SIZE_OK(stri, 0)) {
+              stri->size = 0;
+            } /* if */
+          } else if (bulkData->kind == BULK_INT) {
+            stri = intStr(bulkData->data.intValues[idx]);
+          } else if (bulkData->kind == BULK_FLOAT) {
+            stri = fltStr(bulkData->data.floatValues[idx]);
+          } else {
+            stri = copyStri(bulkData->data.striValues[idx]);
+          } /* if */
+          if (unlikely(stri == NULL)) {
+            while (idx != 0) {
+              idx--;
+              FREE_STRI(columnArray->arr[idx].value.striValue);
+            } /* while */
+            *err_info = MEMORY_ERROR;
+          } else {
+            columnArray->arr[idx].value.striValue = stri;
+          } /* if */
+        } /* if */
+      } /* for */
+      if (unlikely(*err_info != OKAY_NO_ERROR)) {
+        FREE_RTL_ARRAY(columnArray, rowCount);
+        columnArray = NULL;
+      } /* if */
+    } /* if */
+    logFunction(printf("bulkColumn --> " FMT_U_MEM "\n", (memSizeType) columnArray););
+    return columnArray;
+  } /* bulkColumn */
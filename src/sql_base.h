@@ -57,3 +57,50 @@ void dbInconsistentMsg (const char *funcName, const char *dbFuncName,
                         const char *file, int line);
 void dllErrorMessage (const char *funcName, const char *dbFuncName,
                       const char *dllList[], memSizeType dllListLength);
+
+#define BULK_NONE  0
+#define BULK_INT   1
+#define BULK_FLOAT 2
+#define BULK_STRI  3
+
+/* The values of a bulk parameter or of a bulk result column. The  */
+/* kind (BULK_INT, BULK_FLOAT or BULK_STRI) determines which array */
+/* of the union is used. For result columns the kind BULK_NONE is  */
+/* used as long as only NULL values have been fetched. A NULL      */
+/* element of striValues stands for an empty string.               */
+typedef struct {
+    int          kind;
+    memSizeType  length;
+    union {
+      intType   *intValues;
+      floatType *floatValues;
+      striType  *striValues;
+    } data;
+  } bulkDataRecord, *bulkDataType;
+
+typedef const bulkDataRecord *const_bulkDataType;
+
+/* Bulk data of a prepared statement. The param_array holds arrays */
+/* bound with sqlBindArray(). The column_array holds the block of  */
+/* row_count rows fetched with sqlFetchBlock().                    */
+typedef struct {
+    memSizeType  param_array_size;
+    bulkDataType param_array;
+    memSizeType  column_array_size;
+    bulkDataType column_array;
+    memSizeType  row_count;
+  } bulkRecord, *bulkType;
+
+typedef const bulkRecord *const_bulkType;
+
+void freeBulk (bulkType bulk);
+errInfoType bulkBindArray (bulkType bulk, memSizeType paramCount, intType pos,
+                           int kind, const const_rtlArrayType values);
+memSizeType bulkBatchSize (const_bulkType bulk, memSizeType paramCount,
+                           errInfoType *err_info);
+errInfoType bulkStartBlock (bulkType bulk, memSizeType columnCount);
+errInfoType bulkStoreInt (bulkType bulk, memSizeType column, intType value);
+errInfoType bulkStoreFloat (bulkType bulk, memSizeType column, floatType value);
+errInfoType bulkStoreStri (bulkType bulk, memSizeType column, striType value);
+rtlArrayType bulkColumn (const_bulkType bulk, intType column, int kind,
+                         errInfoType *err_info);
@@ -37,6 +37,7 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     SQLHENV      sql_environment;
     SQLHDBC      connection;
     boolType     wideCharsSupported;
@@ -48,6 +48,7 @@
 #endif
 
 #include "common.h"
+#include "data_rtl.h"
 #include "striutl.h"
 #include "heaputl.h"
 #include "numutl.h"
@@ -29,9 +29,15 @@
 /*                                                                  */
 /********************************************************************/
 
+/* The statement cache of a database is maintained by sql_rtl.c.  */
+/* Drivers just keep the field stmtCache after dbCategory.         */
+typedef struct stmtCacheStruct *stmtCacheType;
+
 typedef struct {
     void (*freeDatabase) (databaseType database);
     void (*freePreparedStmt) (sqlStmtType sqlStatement);
+    void (*sqlBindArray) (sqlStmtType sqlStatement, intType pos, int kind,
+                          const const_rtlArrayType values);
     void (*sqlBindBigInt) (sqlStmtType sqlStatement, intType pos,
                            const const_bigIntType value);
     void (*sqlBindBigRat) (sqlStmtType sqlStatement, intType pos,
@@ -56,6 +62,8 @@ typedef struct {
     bigIntType (*sqlColumnBigInt) (sqlStmtType sqlStatement, intType column);
     void (*sqlColumnBigRat) (sqlStmtType sqlStatement, intType column,
                           bigIntType *numerator, bigIntType *denominator);
+    rtlArrayType (*sqlColumnBlock) (sqlStmtType sqlStatement, intType column,
+                                    int kind);
     boolType (*sqlColumnBool) (sqlStmtType sqlStatement, intType column);
     bstriType (*sqlColumnBStri) (sqlStmtType sqlStatement, intType column);
     void (*sqlColumnDuration) (sqlStmtType sqlStatement, intType column,
@@ -70,13 +78,16 @@ typedef struct {
                            intType *time_zone, boolType *is_dst);
     void (*sqlCommit) (databaseType database);
     void (*sqlExecute) (sqlStmtType sqlStatement);
+    void (*sqlExecuteBatch) (sqlStmtType sqlStatement);
     boolType (*sqlFetch) (sqlStmtType sqlStatement);
+    intType (*sqlFetchBlock) (sqlStmtType sqlStatement, intType maxRows);
     boolType (*sqlGetAutoCommit) (databaseType database);
     boolType (*sqlIsNull) (sqlStmtType sqlStatement, intType column);
     sqlStmtType (*sqlPrepare) (databaseType database,
                                const const_striType sqlStatementStri);
     void (*sqlRollback) (databaseType database);
     void (*sqlSetAutoCommit) (databaseType database, boolType autoCommit);
+    void (*sqlSetStreaming) (sqlStmtType sqlStatement, boolType streaming);
     intType (*sqlStmtColumnCount) (sqlStmtType sqlStatement);
     striType (*sqlStmtColumnName) (sqlStmtType sqlStatement, intType column);
   } sqlFuncRecord, *sqlFuncType;
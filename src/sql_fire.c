@@ -67,6 +67,7 @@ typedef struct {
     sqlFuncType   sqlFunc;
     int           driver;
     int           dbCategory;
+    stmtCacheType stmtCache;
     isc_db_handle connection;
     isc_tr_handle trans_handle;
     boolType      autoCommit;
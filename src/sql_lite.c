@@ -68,6 +68,7 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     sqlite3     *connection;
   } dbRecordLite, *dbType;
 
@@ -88,6 +89,7 @@ typedef struct {
     boolType      storedFetchResult;
     boolType      fetchOkay;
     boolType      fetchFinished;
+    bulkRecord    bulk;
   } preparedStmtRecordLite, *preparedStmtType;
 
 static sqlFuncType sqlFunc = NULL;
@@ -337,6 +339,7 @@ static void freePreparedStmt (sqlStmtType sqlStatement)
     if (preparedStmt->param_array != NULL) {
       FREE_TABLE(preparedStmt->param_array, bindDataRecordLite, preparedStmt->param_array_size);
     } /* if */
+    freeBulk(&preparedStmt->bulk);
     sqlite3_finalize(preparedStmt->ppStmt);
     if (preparedStmt->db != NULL &&
         preparedStmt->db->usage_count != 0) {
@@ -486,6 +489,26 @@ static memSizeType decimalPrecision (const const_ustriType decimal,
 
 
 
+static void sqlBindArray (sqlStmtType sqlStatement, intType pos, int kind,
+    const const_rtlArrayType values)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
+
+  /* sqlBindArray */
+    logFunction(printf("sqlBindArray(" FMT_U_MEM ", " FMT_D ", %d, arr)\n",
+                       (memSizeType) sqlStatement, pos, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    err_info = bulkBindArray(&preparedStmt->bulk, preparedStmt->param_array_size,
+                             pos, kind, values);
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+  } /* sqlBindArray */
+
+
+
 static void sqlBindBigInt (sqlStmtType sqlStatement, intType pos,
     const const_bigIntType value)
 
@@ -1359,6 +1382,29 @@ static void sqlColumnBigRat (sqlStmtType sqlStatement, intType column,
 
 
 
+static rtlArrayType sqlColumnBlock (sqlStmtType sqlStatement, intType column,
+    int kind)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info = OKAY_NO_ERROR;
+    rtlArrayType columnValues;
+
+  /* sqlColumnBlock */
+    logFunction(printf("sqlColumnBlock(" FMT_U_MEM ", " FMT_D ", %d)\n",
+                       (memSizeType) sqlStatement, column, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    columnValues = bulkColumn(&preparedStmt->bulk, column, kind, &err_info);
+    if (unlikely(columnValues == NULL)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlColumnBlock --> " FMT_U_MEM "\n",
+                       (memSizeType) columnValues););
+    return columnValues;
+  } /* sqlColumnBlock */
+
+
+
 static boolType sqlColumnBool (sqlStmtType sqlStatement, intType column)
 
   {
@@ -1970,6 +2016,142 @@ static void sqlExecute (sqlStmtType sqlStatement)
 
 
 
+/**
+ *  Bind the values of 'row' from the arrays bound with sqlBindArray().
+ */
+static errInfoType bindBulkRow (preparedStmtType preparedStmt, memSizeType row)
+
+  {
+    const_bulkDataType param;
+    memSizeType pos;
+    cstriType stri8;
+    memSizeType length;
+    int bind_result = SQLITE_OK;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* bindBulkRow */
+    for (pos = 0; pos < preparedStmt->param_array_size &&
+         bind_result == SQLITE_OK && err_info == OKAY_NO_ERROR; pos++) {
+      param = &preparedStmt->bulk.param_array[pos];
+      switch (param->kind) {
+        case BULK_INT:
+#if INTTYPE_SIZE == 32
+          bind_result = sqlite3_bind_int(preparedStmt->ppStmt, (int) pos + 1,
+                                         (int) param->data.intValues[row]);
+#elif INTTYPE_SIZE == 64
+          bind_result = sqlite3_bind_int64(preparedStmt->ppStmt, (int) pos + 1,
+                                           (sqlite3_int64) param->data.intValues[row]);
+#endif
+          break;
+        case BULK_FLOAT:
+          bind_result = sqlite3_bind_double(preparedStmt->ppStmt, (int) pos + 1,
+                                            (double) param->data.floatValues[row]);
+          break;
+        default:
+          stri8 = stri_to_cstri8_buf(param->data.striValues[row], &length);
+          if (unlikely(stri8 == NULL)) {
+            err_info = MEMORY_ERROR;
+          } else if (unlikely(length > INT_MAX)) {
+            /* It is not possible to cast length to int. */
+            free_cstri8(stri8, param->data.striValues[row]);
+            err_info = MEMORY_ERROR;
+          } else {
+            /* The destructor (freeText) is called even if */
+            /* sqlite3_bind_text() fails.                  */
+            bind_result = sqlite3_bind_text(preparedStmt->ppStmt, (int) pos + 1,
+                                            stri8, (int) length, &freeText);
+          } /* if */
+          break;
+      } /* switch */
+    } /* for */
+    if (unlikely(bind_result != SQLITE_OK)) {
+      setDbErrorMsg("sqlExecuteBatch", "sqlite3_bind",
+                    sqlite3_db_handle(preparedStmt->ppStmt));
+      logError(printf("sqlExecuteBatch: sqlite3_bind error: %s\n",
+                      sqlite3_errmsg(sqlite3_db_handle(preparedStmt->ppStmt))););
+      err_info = DATABASE_ERROR;
+    } /* if */
+    return err_info;
+  } /* bindBulkRow */
+
+
+
+static void sqlExecuteBatch (sqlStmtType sqlStatement)
+
+  {
+    preparedStmtType preparedStmt;
+    sqlite3 *connection;
+    memSizeType batchSize;
+    memSizeType row;
+    memSizeType pos;
+    boolType ownTransaction;
+    int step_result;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* sqlExecuteBatch */
+    logFunction(printf("sqlExecuteBatch(" FMT_U_MEM ")\n",
+                       (memSizeType) sqlStatement););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    batchSize = bulkBatchSize(&preparedStmt->bulk,
+                              preparedStmt->param_array_size, &err_info);
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      connection = sqlite3_db_handle(preparedStmt->ppStmt);
+      preparedStmt->fetchOkay = FALSE;
+      /* Without a surrounding transaction SQLite would */
+      /* commit (and sync) after every single row.      */
+      ownTransaction = sqlite3_get_autocommit(connection) != 0;
+      if (ownTransaction &&
+          unlikely(sqlite3_exec(connection, "BEGIN", NULL, NULL, NULL) != SQLITE_OK)) {
+        setDbErrorMsg("sqlExecuteBatch", "sqlite3_exec", connection);
+        logError(printf("sqlExecuteBatch: sqlite3_exec(BEGIN) error: %s\n",
+                        sqlite3_errmsg(connection)););
+        err_info = DATABASE_ERROR;
+        ownTransaction = FALSE;
+      } /* if */
+      for (row = 0; row < batchSize && err_info == OKAY_NO_ERROR; row++) {
+        /* The result of sqlite3_reset() refers to the previous */
+        /* sqlite3_step(), which has already been checked.       */
+        sqlite3_reset(preparedStmt->ppStmt);
+        err_info = bindBulkRow(preparedStmt, row);
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          step_result = sqlite3_step(preparedStmt->ppStmt);
+          if (unlikely(step_result != SQLITE_DONE && step_result != SQLITE_ROW)) {
+            setDbErrorMsg("sqlExecuteBatch", "sqlite3_step", connection);
+            logError(printf("sqlExecuteBatch: sqlite3_step error in row "
+                            FMT_U_MEM ": %s\n",
+                            row + 1, sqlite3_errmsg(connection)););
+            err_info = DATABASE_ERROR;
+          } /* if */
+        } /* if */
+      } /* for */
+      sqlite3_reset(preparedStmt->ppStmt);
+      if (ownTransaction) {
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          if (unlikely(sqlite3_exec(connection, "COMMIT", NULL, NULL, NULL) != SQLITE_OK)) {
+            setDbErrorMsg("sqlExecuteBatch", "sqlite3_exec", connection);
+            logError(printf("sqlExecuteBatch: sqlite3_exec(COMMIT) error: %s\n",
+                            sqlite3_errmsg(connection)););
+            err_info = DATABASE_ERROR;
+            sqlite3_exec(connection, "ROLLBACK", NULL, NULL, NULL);
+          } /* if */
+        } else {
+          sqlite3_exec(connection, "ROLLBACK", NULL, NULL, NULL);
+        } /* if */
+      } /* if */
+      for (pos = 0; pos < preparedStmt->param_array_size; pos++) {
+        preparedStmt->param_array[pos].bound = TRUE;
+      } /* for */
+      preparedStmt->executeSuccessful = FALSE;
+      preparedStmt->fetchFinished = TRUE;
+    } /* if */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlExecuteBatch -->\n"););
+  } /* sqlExecuteBatch */
+
+
+
 static boolType sqlFetch (sqlStmtType sqlStatement)
 
   {
@@ -2013,6 +2195,61 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
 
 
 
+static intType sqlFetchBlock (sqlStmtType sqlStatement, intType maxRows)
+
+  {
+    preparedStmtType preparedStmt;
+    bulkType bulk;
+    unsigned int column;
+    striType stri;
+    boolType raised = FALSE;
+    errInfoType err_info;
+
+  /* sqlFetchBlock */
+    logFunction(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) sqlStatement, maxRows););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    bulk = &preparedStmt->bulk;
+    err_info = bulkStartBlock(bulk, preparedStmt->result_column_count);
+    while (err_info == OKAY_NO_ERROR && !raised &&
+           bulk->row_count < (uintType) maxRows && sqlFetch(sqlStatement)) {
+      for (column = 0; column < preparedStmt->result_column_count &&
+           err_info == OKAY_NO_ERROR && !raised; column++) {
+        switch (sqlite3_column_type(preparedStmt->ppStmt, (int) column)) {
+          case SQLITE_NULL:
+            break;
+          case SQLITE_INTEGER:
+            err_info = bulkStoreInt(bulk, column,
+                sqlColumnInt(sqlStatement, (intType) column + 1));
+            break;
+          case SQLITE_FLOAT:
+            err_info = bulkStoreFloat(bulk, column,
+                sqlColumnFloat(sqlStatement, (intType) column + 1));
+            break;
+          default:
+            stri = sqlColumnStri(sqlStatement, (intType) column + 1);
+            if (unlikely(stri == NULL)) {
+              /* An exception has already been raised. */
+              raised = TRUE;
+            } else {
+              err_info = bulkStoreStri(bulk, column, stri);
+            } /* if */
+            break;
+        } /* switch */
+      } /* for */
+      if (likely(err_info == OKAY_NO_ERROR && !raised)) {
+        bulk->row_count++;
+      } /* if */
+    } /* while */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlFetchBlock --> " FMT_U_MEM "\n", bulk->row_count););
+    return (intType) bulk->row_count;
+  } /* sqlFetchBlock */
+
+
+
 static boolType sqlGetAutoCommit (databaseType database)
 
   {
@@ -2280,6 +2517,7 @@ static boolType setupFuncTable (void)
         memset(sqlFunc, 0, sizeof(sqlFuncRecord));
         sqlFunc->freeDatabase       = &freeDatabase;
         sqlFunc->freePreparedStmt   = &freePreparedStmt;
+        sqlFunc->sqlBindArray       = &sqlBindArray;
         sqlFunc->sqlBindBigInt      = &sqlBindBigInt;
         sqlFunc->sqlBindBigRat      = &sqlBindBigRat;
         sqlFunc->sqlBindBool        = &sqlBindBool;
@@ -2293,6 +2531,7 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlClose           = &sqlClose;
         sqlFunc->sqlColumnBigInt    = &sqlColumnBigInt;
         sqlFunc->sqlColumnBigRat    = &sqlColumnBigRat;
+        sqlFunc->sqlColumnBlock     = &sqlColumnBlock;
         sqlFunc->sqlColumnBool      = &sqlColumnBool;
         sqlFunc->sqlColumnBStri     = &sqlColumnBStri;
         sqlFunc->sqlColumnDuration  = &sqlColumnDuration;
@@ -2302,7 +2541,9 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlColumnTime      = &sqlColumnTime;
         sqlFunc->sqlCommit          = &sqlCommit;
         sqlFunc->sqlExecute         = &sqlExecute;
+        sqlFunc->sqlExecuteBatch    = &sqlExecuteBatch;
         sqlFunc->sqlFetch           = &sqlFetch;
+        sqlFunc->sqlFetchBlock      = &sqlFetchBlock;
         sqlFunc->sqlGetAutoCommit   = &sqlGetAutoCommit;
         sqlFunc->sqlIsNull          = &sqlIsNull;
         sqlFunc->sqlPrepare         = &sqlPrepare;
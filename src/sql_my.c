@@ -67,9 +67,11 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     MYSQL       *connection;
     boolType     autoCommit;
     boolType     backslashEscapes;
+    sqlStmtType  streamingStmt;
   } dbRecordMy, *dbType;
 
 typedef struct {
@@ -96,6 +98,8 @@ typedef struct {
     boolType       executeSuccessful;
     boolType       fetchOkay;
     boolType       fetchFinished;
+    boolType       streaming;
+    bulkRecord     bulk;
   } preparedStmtRecordMy, *preparedStmtType;
 
 static sqlFuncType sqlFunc = NULL;
@@ -163,6 +167,7 @@ typedef int (STDCALL *tp_mysql_stmt_fetch_column) (MYSQL_STMT *stmt,
                                                    MYSQL_BIND *bnd,
                                                    unsigned int column,
                                                    unsigned long offset);
+typedef my_bool (STDCALL *tp_mysql_stmt_free_result) (MYSQL_STMT *stmt);
 typedef MYSQL_STMT *(STDCALL *tp_mysql_stmt_init) (MYSQL *mysql);
 typedef unsigned long (STDCALL *tp_mysql_stmt_param_count) (MYSQL_STMT *stmt);
 typedef int (STDCALL *tp_mysql_stmt_prepare) (MYSQL_STMT *stmt,
@@ -192,6 +197,7 @@ static tp_mysql_stmt_error           ptr_mysql_stmt_error;
 static tp_mysql_stmt_execute         ptr_mysql_stmt_execute;
 static tp_mysql_stmt_fetch           ptr_mysql_stmt_fetch;
 static tp_mysql_stmt_fetch_column    ptr_mysql_stmt_fetch_column;
+static tp_mysql_stmt_free_result     ptr_mysql_stmt_free_result;
 static tp_mysql_stmt_init            ptr_mysql_stmt_init;
 static tp_mysql_stmt_param_count     ptr_mysql_stmt_param_count;
 static tp_mysql_stmt_prepare         ptr_mysql_stmt_prepare;
@@ -219,6 +225,7 @@ static tp_mysql_stmt_store_result    ptr_mysql_stmt_store_result;
 #define mysql_stmt_execute         ptr_mysql_stmt_execute
 #define mysql_stmt_fetch           ptr_mysql_stmt_fetch
 #define mysql_stmt_fetch_column    ptr_mysql_stmt_fetch_column
+#define mysql_stmt_free_result     ptr_mysql_stmt_free_result
 #define mysql_stmt_init            ptr_mysql_stmt_init
 #define mysql_stmt_param_count     ptr_mysql_stmt_param_count
 #define mysql_stmt_prepare         ptr_mysql_stmt_prepare
@@ -258,6 +265,7 @@ static boolType setupDll (const char *dllName)
             (mysql_stmt_execute         = (tp_mysql_stmt_execute)         dllFunc(dbDll, "mysql_stmt_execute"))         == NULL ||
             (mysql_stmt_fetch           = (tp_mysql_stmt_fetch)           dllFunc(dbDll, "mysql_stmt_fetch"))           == NULL ||
             (mysql_stmt_fetch_column    = (tp_mysql_stmt_fetch_column)    dllFunc(dbDll, "mysql_stmt_fetch_column"))    == NULL ||
+            (mysql_stmt_free_result     = (tp_mysql_stmt_free_result)     dllFunc(dbDll, "mysql_stmt_free_result"))     == NULL ||
             (mysql_stmt_init            = (tp_mysql_stmt_init)            dllFunc(dbDll, "mysql_stmt_init"))            == NULL ||
             (mysql_stmt_param_count     = (tp_mysql_stmt_param_count)     dllFunc(dbDll, "mysql_stmt_param_count"))     == NULL ||
             (mysql_stmt_prepare         = (tp_mysql_stmt_prepare)         dllFunc(dbDll, "mysql_stmt_prepare"))         == NULL ||
@@ -336,6 +344,32 @@ static void freeDatabase (databaseType database)
 
 
 
+/**
+ *  End the unbuffered result of the streaming statement of db.
+ *  Rows, which have not been fetched, are read and discarded.
+ *  Afterwards the connection can be used by other statements.
+ */
+static void finishStream (dbType db)
+
+  {
+    preparedStmtType streamingStmt;
+
+  /* finishStream */
+    logFunction(printf("finishStream(" FMT_U_MEM ")\n",
+                       (memSizeType) db););
+    if (db->streamingStmt != NULL) {
+      streamingStmt = (preparedStmtType) db->streamingStmt;
+      if (db->connection != NULL) {
+        (void) mysql_stmt_free_result(streamingStmt->ppStmt);
+      } /* if */
+      streamingStmt->fetchFinished = TRUE;
+      db->streamingStmt = NULL;
+    } /* if */
+    logFunction(printf("finishStream -->\n"););
+  } /* finishStream */
+
+
+
 /**
  *  Closes a prepared statement and frees the memory used by it.
  */
@@ -365,6 +399,10 @@ static void freePreparedStmt (sqlStmtType sqlStatement)
     if (preparedStmt->result_data_array != NULL) {
       FREE_TABLE(preparedStmt->result_data_array, resultDataRecordMy, preparedStmt->result_array_size);
     } /* if */
+    freeBulk(&preparedStmt->bulk);
+    if (preparedStmt->db != NULL) {
+      finishStream(preparedStmt->db);
+    } /* if */
     mysql_stmt_close(preparedStmt->ppStmt);
     if (preparedStmt->db != NULL &&
         preparedStmt->db->usage_count != 0) {
@@ -947,6 +985,26 @@ static unsigned int setBigRat (void *const buffer, const const_bigIntType numera
 
 
 
+static void sqlBindArray (sqlStmtType sqlStatement, intType pos, int kind,
+    const const_rtlArrayType values)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
+
+  /* sqlBindArray */
+    logFunction(printf("sqlBindArray(" FMT_U_MEM ", " FMT_D ", %d, arr)\n",
+                       (memSizeType) sqlStatement, pos, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    err_info = bulkBindArray(&preparedStmt->bulk, preparedStmt->param_array_size,
+                             pos, kind, values);
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+  } /* sqlBindArray */
+
+
+
 static void sqlBindBigInt (sqlStmtType sqlStatement, intType pos,
     const const_bigIntType value)
 
@@ -1260,13 +1318,47 @@ static void sqlBindDuration (sqlStmtType sqlStatement, intType pos,
 
 
 
-static void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value)
+static errInfoType setFloatParam (preparedStmtType preparedStmt, intType pos,
+    floatType value)
 
   {
-    preparedStmtType preparedStmt;
     MYSQL_BIND *param;
     errInfoType err_info = OKAY_NO_ERROR;
 
+  /* setFloatParam */
+    param = &preparedStmt->param_array[pos - 1];
+    if (preparedStmt->param_data_array[pos - 1].buffer_capacity < sizeof(floatType)) {
+      free(param->buffer);
+      if (unlikely((param->buffer = malloc(sizeof(floatType))) == NULL)) {
+        preparedStmt->param_data_array[pos - 1].buffer_capacity = 0;
+        err_info = MEMORY_ERROR;
+      } else {
+        preparedStmt->param_data_array[pos - 1].buffer_capacity = sizeof(floatType);
+      } /* if */
+    } /* if */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+#if FLOATTYPE_SIZE == 32
+      param->buffer_type = MYSQL_TYPE_FLOAT;
+#elif FLOATTYPE_SIZE == 64
+      param->buffer_type = MYSQL_TYPE_DOUBLE;
+#endif
+      param->is_unsigned = 0;
+      param->is_null     = NULL;
+      param->length      = NULL;
+      *(floatType *) param->buffer = value;
+      preparedStmt->param_data_array[pos - 1].bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setFloatParam */
+
+
+
+static void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
+
   /* sqlBindFloat */
     logFunction(printf("sqlBindFloat(" FMT_U_MEM ", " FMT_D ", " FMT_E ")\n",
                        (memSizeType) sqlStatement, pos, value););
@@ -1276,44 +1368,59 @@ static void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      if (preparedStmt->param_data_array[pos - 1].buffer_capacity < sizeof(floatType)) {
-        free(param->buffer);
-        if (unlikely((param->buffer = malloc(sizeof(floatType))) == NULL)) {
-          preparedStmt->param_data_array[pos - 1].buffer_capacity = 0;
-          err_info = MEMORY_ERROR;
-        } else {
-          preparedStmt->param_data_array[pos - 1].buffer_capacity = sizeof(floatType);
-        } /* if */
-      } /* if */
+      err_info = setFloatParam(preparedStmt, pos, value);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         raise_error(err_info);
       } else {
-#if FLOATTYPE_SIZE == 32
-        param->buffer_type = MYSQL_TYPE_FLOAT;
-#elif FLOATTYPE_SIZE == 64
-        param->buffer_type = MYSQL_TYPE_DOUBLE;
-#endif
-        param->is_unsigned = 0;
-        param->is_null     = NULL;
-        param->length      = NULL;
-        *(floatType *) param->buffer = value;
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        preparedStmt->param_data_array[pos - 1].bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindFloat */
 
 
 
-static void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
+static errInfoType setIntParam (preparedStmtType preparedStmt, intType pos,
+    intType value)
 
   {
-    preparedStmtType preparedStmt;
     MYSQL_BIND *param;
     errInfoType err_info = OKAY_NO_ERROR;
 
+  /* setIntParam */
+    param = &preparedStmt->param_array[pos - 1];
+    if (preparedStmt->param_data_array[pos - 1].buffer_capacity < sizeof(intType)) {
+      free(param->buffer);
+      if (unlikely((param->buffer = malloc(sizeof(intType))) == NULL)) {
+        preparedStmt->param_data_array[pos - 1].buffer_capacity = 0;
+        err_info = MEMORY_ERROR;
+      } else {
+        preparedStmt->param_data_array[pos - 1].buffer_capacity = sizeof(intType);
+      } /* if */
+    } /* if */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+#if INTTYPE_SIZE == 32
+      param->buffer_type = MYSQL_TYPE_LONG;
+#elif INTTYPE_SIZE == 64
+      param->buffer_type = MYSQL_TYPE_LONGLONG;
+#endif
+      param->is_unsigned = 0;
+      param->is_null     = NULL;
+      param->length      = NULL;
+      *(intType *) param->buffer = value;
+      preparedStmt->param_data_array[pos - 1].bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setIntParam */
+
+
+
+static void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
+
   /* sqlBindInt */
     logFunction(printf("sqlBindInt(" FMT_U_MEM ", " FMT_D ", " FMT_D ")\n",
                        (memSizeType) sqlStatement, pos, value););
@@ -1323,31 +1430,12 @@ static void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      if (preparedStmt->param_data_array[pos - 1].buffer_capacity < sizeof(intType)) {
-        free(param->buffer);
-        if (unlikely((param->buffer = malloc(sizeof(intType))) == NULL)) {
-          preparedStmt->param_data_array[pos - 1].buffer_capacity = 0;
-          err_info = MEMORY_ERROR;
-        } else {
-          preparedStmt->param_data_array[pos - 1].buffer_capacity = sizeof(intType);
-        } /* if */
-      } /* if */
+      err_info = setIntParam(preparedStmt, pos, value);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         raise_error(err_info);
       } else {
-#if INTTYPE_SIZE == 32
-        param->buffer_type = MYSQL_TYPE_LONG;
-#elif INTTYPE_SIZE == 64
-        param->buffer_type = MYSQL_TYPE_LONGLONG;
-#endif
-        param->is_unsigned = 0;
-        param->is_null     = NULL;
-        param->length      = NULL;
-        *(intType *) param->buffer = value;
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        preparedStmt->param_data_array[pos - 1].bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindInt */
@@ -1380,15 +1468,51 @@ static void sqlBindNull (sqlStmtType sqlStatement, intType pos)
 
 
 
-static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
+static errInfoType setStriParam (preparedStmtType preparedStmt, intType pos,
     const const_striType stri)
 
   {
-    preparedStmtType preparedStmt;
     MYSQL_BIND *param;
     cstriType stri8;
     cstriType resized_stri8;
     memSizeType length;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* setStriParam */
+    param = &preparedStmt->param_array[pos - 1];
+    stri8 = stri_to_cstri8_buf(stri, &length);
+    if (unlikely(stri8 == NULL)) {
+      err_info = MEMORY_ERROR;
+    } else if (unlikely(length > ULONG_MAX)) {
+      /* It is not possible to cast length to unsigned long. */
+      free(stri8);
+      err_info = MEMORY_ERROR;
+    } else {
+      resized_stri8 = REALLOC_CSTRI(stri8, length);
+      if (likely(resized_stri8 != NULL)) {
+        stri8 = resized_stri8;
+      } /* if */
+      free(param->buffer);
+      param->buffer_type   = MYSQL_TYPE_STRING;
+      param->is_unsigned   = 0;
+      param->is_null       = NULL;
+      param->length        = NULL;
+      param->buffer        = stri8;
+      param->buffer_length = (unsigned long) length;
+      preparedStmt->param_data_array[pos - 1].buffer_capacity = length;
+      preparedStmt->param_data_array[pos - 1].bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setStriParam */
+
+
+
+static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
+    const const_striType stri)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
 
   /* sqlBindStri */
     logFunction(printf("sqlBindStri(" FMT_U_MEM ", " FMT_D ", \"%s\")\n",
@@ -1399,30 +1523,12 @@ static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      stri8 = stri_to_cstri8_buf(stri, &length);
-      if (unlikely(stri8 == NULL)) {
-        raise_error(MEMORY_ERROR);
-      } else if (unlikely(length > ULONG_MAX)) {
-        /* It is not possible to cast length to unsigned long. */
-        free(stri8);
-        raise_error(MEMORY_ERROR);
+      err_info = setStriParam(preparedStmt, pos, stri);
+      if (unlikely(err_info != OKAY_NO_ERROR)) {
+        raise_error(err_info);
       } else {
-        resized_stri8 = REALLOC_CSTRI(stri8, length);
-        if (likely(resized_stri8 != NULL)) {
-          stri8 = resized_stri8;
-        } /* if */
-        free(param->buffer);
-        param->buffer_type   = MYSQL_TYPE_STRING;
-        param->is_unsigned   = 0;
-        param->is_null       = NULL;
-        param->length        = NULL;
-        param->buffer        = stri8;
-        param->buffer_length = (unsigned long) length;
-        preparedStmt->param_data_array[pos - 1].buffer_capacity = length;
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        preparedStmt->param_data_array[pos - 1].bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindStri */
@@ -1517,6 +1623,7 @@ static void sqlClose (databaseType database)
       mysql_close(db->connection);
       db->connection = NULL;
     } /* if */
+    finishStream(db);
     db->isOpen = FALSE;
     logFunction(printf("sqlClose -->\n"););
   } /* sqlClose */
@@ -1693,6 +1800,29 @@ static void sqlColumnBigRat (sqlStmtType sqlStatement, intType column,
 
 
 
+static rtlArrayType sqlColumnBlock (sqlStmtType sqlStatement, intType column,
+    int kind)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info = OKAY_NO_ERROR;
+    rtlArrayType columnValues;
+
+  /* sqlColumnBlock */
+    logFunction(printf("sqlColumnBlock(" FMT_U_MEM ", " FMT_D ", %d)\n",
+                       (memSizeType) sqlStatement, column, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    columnValues = bulkColumn(&preparedStmt->bulk, column, kind, &err_info);
+    if (unlikely(columnValues == NULL)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlColumnBlock --> " FMT_U_MEM "\n",
+                       (memSizeType) columnValues););
+    return columnValues;
+  } /* sqlColumnBlock */
+
+
+
 static boolType sqlColumnBool (sqlStmtType sqlStatement, intType column)
 
   {
@@ -2382,13 +2512,16 @@ static void sqlCommit (databaseType database)
       dbNotOpen("sqlCommit");
       logError(printf("sqlCommit: Database is not open.\n"););
       raise_error(DATABASE_ERROR);
-    } else if (unlikely(mysql_commit(db->connection) != 0)) {
-      setDbErrorMsg("sqlCommit", "mysql_commit",
-                    mysql_errno(db->connection),
-                    mysql_error(db->connection));
-      logError(printf("sqlCommit: mysql_commit error: %s\n",
-                      mysql_error(db->connection)););
-      raise_error(DATABASE_ERROR);
+    } else {
+      finishStream(db);
+      if (unlikely(mysql_commit(db->connection) != 0)) {
+        setDbErrorMsg("sqlCommit", "mysql_commit",
+                      mysql_errno(db->connection),
+                      mysql_error(db->connection));
+        logError(printf("sqlCommit: mysql_commit error: %s\n",
+                        mysql_error(db->connection)););
+        raise_error(DATABASE_ERROR);
+      } /* if */
     } /* if */
     logFunction(printf("sqlCommit -->\n"););
   } /* sqlCommit */
@@ -2411,6 +2544,7 @@ static void sqlExecute (sqlStmtType sqlStatement)
     } else {
       /* printf("ppStmt: " FMT_U_MEM "\n", (memSizeType) preparedStmt->ppStmt); */
       preparedStmt->fetchOkay = FALSE;
+      finishStream(preparedStmt->db);
       if (unlikely(mysql_stmt_bind_param(preparedStmt->ppStmt,
                                          preparedStmt->param_array) != 0)) {
         setDbErrorMsg("sqlExecute", "mysql_stmt_bind_param",
@@ -2438,7 +2572,8 @@ static void sqlExecute (sqlStmtType sqlStatement)
                         mysql_stmt_error(preparedStmt->ppStmt)););
         preparedStmt->executeSuccessful = FALSE;
         raise_error(DATABASE_ERROR);
-      } else if (unlikely(mysql_stmt_store_result(preparedStmt->ppStmt) != 0)) {
+      } else if (unlikely(!preparedStmt->streaming &&
+                          mysql_stmt_store_result(preparedStmt->ppStmt) != 0)) {
         setDbErrorMsg("sqlExecute", "mysql_stmt_store_result",
                       mysql_stmt_errno(preparedStmt->ppStmt),
                       mysql_stmt_error(preparedStmt->ppStmt));
@@ -2449,6 +2584,10 @@ static void sqlExecute (sqlStmtType sqlStatement)
       } else {
         preparedStmt->executeSuccessful = TRUE;
         preparedStmt->fetchFinished = FALSE;
+        if (preparedStmt->streaming && preparedStmt->result_array_size != 0) {
+          /* Unbuffered rows are read by sqlFetch(). */
+          preparedStmt->db->streamingStmt = (sqlStmtType) preparedStmt;
+        } /* if */
       } /* if */
     } /* if */
     logFunction(printf("sqlExecute -->\n"););
@@ -2456,6 +2595,106 @@ static void sqlExecute (sqlStmtType sqlStatement)
 
 
 
+static void sqlExecuteBatch (sqlStmtType sqlStatement)
+
+  {
+    preparedStmtType preparedStmt;
+    MYSQL *connection;
+    const_bulkDataType param;
+    memSizeType batchSize;
+    memSizeType row;
+    memSizeType pos;
+    boolType ownTransaction = FALSE;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* sqlExecuteBatch */
+    logFunction(printf("sqlExecuteBatch(" FMT_U_MEM ")\n",
+                       (memSizeType) sqlStatement););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    batchSize = bulkBatchSize(&preparedStmt->bulk,
+                              preparedStmt->param_array_size, &err_info);
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      finishStream(preparedStmt->db);
+      connection = preparedStmt->db->connection;
+      preparedStmt->executeSuccessful = FALSE;
+      preparedStmt->fetchOkay = FALSE;
+      /* In auto-commit mode every row would be a transaction of its own. */
+      if (preparedStmt->db->autoCommit) {
+        if (unlikely(mysql_autocommit(connection, 0) != 0)) {
+          setDbErrorMsg("sqlExecuteBatch", "mysql_autocommit",
+                        mysql_errno(connection),
+                        mysql_error(connection));
+          logError(printf("sqlExecuteBatch: mysql_autocommit error: %s\n",
+                          mysql_error(connection)););
+          err_info = DATABASE_ERROR;
+        } else {
+          ownTransaction = TRUE;
+        } /* if */
+      } /* if */
+      for (row = 0; row < batchSize && err_info == OKAY_NO_ERROR; row++) {
+        for (pos = 0; pos < preparedStmt->param_array_size &&
+             err_info == OKAY_NO_ERROR; pos++) {
+          param = &preparedStmt->bulk.param_array[pos];
+          switch (param->kind) {
+            case BULK_INT:
+              err_info = setIntParam(preparedStmt, (intType) pos + 1,
+                                     param->data.intValues[row]);
+              break;
+            case BULK_FLOAT:
+              err_info = setFloatParam(preparedStmt, (intType) pos + 1,
+                                       param->data.floatValues[row]);
+              break;
+            default:
+              err_info = setStriParam(preparedStmt, (intType) pos + 1,
+                                      param->data.striValues[row]);
+              break;
+          } /* switch */
+        } /* for */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          if (unlikely(mysql_stmt_bind_param(preparedStmt->ppStmt,
+                                             preparedStmt->param_array) != 0)) {
+            setDbErrorMsg("sqlExecuteBatch", "mysql_stmt_bind_param",
+                          mysql_stmt_errno(preparedStmt->ppStmt),
+                          mysql_stmt_error(preparedStmt->ppStmt));
+            logError(printf("sqlExecuteBatch: mysql_stmt_bind_param error: %s\n",
+                            mysql_stmt_error(preparedStmt->ppStmt)););
+            err_info = DATABASE_ERROR;
+          } else if (unlikely(mysql_stmt_execute(preparedStmt->ppStmt) != 0)) {
+            setDbErrorMsg("sqlExecuteBatch", "mysql_stmt_execute",
+                          mysql_stmt_errno(preparedStmt->ppStmt),
+                          mysql_stmt_error(preparedStmt->ppStmt));
+            logError(printf("sqlExecuteBatch: mysql_stmt_execute error "
+                            "in row " FMT_U_MEM ": %s\n", row + 1,
+                            mysql_stmt_error(preparedStmt->ppStmt)););
+            err_info = DATABASE_ERROR;
+          } /* if */
+        } /* if */
+      } /* for */
+      if (ownTransaction) {
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          if (unlikely(mysql_commit(connection) != 0)) {
+            setDbErrorMsg("sqlExecuteBatch", "mysql_commit",
+                          mysql_errno(connection),
+                          mysql_error(connection));
+            logError(printf("sqlExecuteBatch: mysql_commit error: %s\n",
+                            mysql_error(connection)););
+            err_info = DATABASE_ERROR;
+          } /* if */
+        } else {
+          /* Keep the error of the failed row. */
+          (void) mysql_rollback(connection);
+        } /* if */
+        (void) mysql_autocommit(connection, 1);
+      } /* if */
+    } /* if */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlExecuteBatch -->\n"););
+  } /* sqlExecuteBatch */
+
+
+
 static boolType sqlFetch (sqlStmtType sqlStatement)
 
   {
@@ -2487,6 +2726,9 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
       } else if (fetch_result == MYSQL_NO_DATA) {
         preparedStmt->fetchOkay = FALSE;
         preparedStmt->fetchFinished = TRUE;
+        if (preparedStmt->db->streamingStmt == sqlStatement) {
+          preparedStmt->db->streamingStmt = NULL;
+        } /* if */
       } else {
         setDbErrorMsg("sqlFetch", "mysql_stmt_fetch",
                       mysql_stmt_errno(preparedStmt->ppStmt),
@@ -2495,6 +2737,9 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
                         fetch_result, dbError.message););
         preparedStmt->fetchOkay = FALSE;
         preparedStmt->fetchFinished = TRUE;
+        if (preparedStmt->db->streamingStmt == sqlStatement) {
+          finishStream(preparedStmt->db);
+        } /* if */
         raise_error(DATABASE_ERROR);
       } /* if */
     } /* if */
@@ -2504,6 +2749,70 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
 
 
 
+static intType sqlFetchBlock (sqlStmtType sqlStatement, intType maxRows)
+
+  {
+    preparedStmtType preparedStmt;
+    bulkType bulk;
+    memSizeType column;
+    striType stri;
+    boolType raised = FALSE;
+    errInfoType err_info;
+
+  /* sqlFetchBlock */
+    logFunction(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) sqlStatement, maxRows););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    bulk = &preparedStmt->bulk;
+    err_info = bulkStartBlock(bulk, preparedStmt->result_array_size);
+    while (err_info == OKAY_NO_ERROR && !raised &&
+           bulk->row_count < (uintType) maxRows && sqlFetch(sqlStatement)) {
+      for (column = 0; column < preparedStmt->result_array_size &&
+           err_info == OKAY_NO_ERROR && !raised; column++) {
+        if (preparedStmt->result_array[column].is_null_value != 0) {
+          /* The block stores NULL values as default values. */
+        } else {
+          switch (preparedStmt->result_array[column].buffer_type) {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+              err_info = bulkStoreInt(bulk, column,
+                  sqlColumnInt(sqlStatement, (intType) column + 1));
+              break;
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+              err_info = bulkStoreFloat(bulk, column,
+                  sqlColumnFloat(sqlStatement, (intType) column + 1));
+              break;
+            default:
+              /* Types that cannot be converted to a string */
+              /* raise RANGE_ERROR in sqlColumnStri().      */
+              stri = sqlColumnStri(sqlStatement, (intType) column + 1);
+              if (unlikely(stri == NULL)) {
+                /* An exception has already been raised. */
+                raised = TRUE;
+              } else {
+                err_info = bulkStoreStri(bulk, column, stri);
+              } /* if */
+              break;
+          } /* switch */
+        } /* if */
+      } /* for */
+      if (likely(err_info == OKAY_NO_ERROR && !raised)) {
+        bulk->row_count++;
+      } /* if */
+    } /* while */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlFetchBlock --> " FMT_U_MEM "\n", bulk->row_count););
+    return (intType) bulk->row_count;
+  } /* sqlFetchBlock */
+
+
+
 static boolType sqlGetAutoCommit (databaseType database)
 
   {
@@ -2580,6 +2889,7 @@ static sqlStmtType sqlPrepare (databaseType database,
       err_info = DATABASE_ERROR;
       preparedStmt = NULL;
     } else {
+      finishStream(db);
       statementStri = processStatementStri(sqlStatementStri, db->backslashEscapes);
       if (unlikely(statementStri == NULL)) {
         err_info = MEMORY_ERROR;
@@ -2678,13 +2988,16 @@ static void sqlRollback (databaseType database)
       dbNotOpen("sqlRollback");
       logError(printf("sqlRollback: Database is not open.\n"););
       raise_error(DATABASE_ERROR);
-    } else if (unlikely(mysql_rollback(db->connection) != 0)) {
-      setDbErrorMsg("sqlRollback", "mysql_rollback",
-                    mysql_errno(db->connection),
-                    mysql_error(db->connection));
-      logError(printf("sqlRollback: mysql_rollback error: %s\n",
-                      mysql_error(db->connection)););
-      raise_error(DATABASE_ERROR);
+    } else {
+      finishStream(db);
+      if (unlikely(mysql_rollback(db->connection) != 0)) {
+        setDbErrorMsg("sqlRollback", "mysql_rollback",
+                      mysql_errno(db->connection),
+                      mysql_error(db->connection));
+        logError(printf("sqlRollback: mysql_rollback error: %s\n",
+                        mysql_error(db->connection)););
+        raise_error(DATABASE_ERROR);
+      } /* if */
     } /* if */
     logFunction(printf("sqlRollback -->\n"););
   } /* sqlRollback */
@@ -2704,23 +3017,46 @@ static void sqlSetAutoCommit (databaseType database, boolType autoCommit)
       dbNotOpen("sqlSetAutoCommit");
       logError(printf("sqlSetAutoCommit: Database is not open.\n"););
       raise_error(DATABASE_ERROR);
-    } else if (unlikely(mysql_autocommit(db->connection, autoCommit) != 0)) {
-      setDbErrorMsg("sqlSetAutoCommit", "mysql_autocommit",
-                    mysql_errno(db->connection),
-                    mysql_error(db->connection));
-      logError(printf("sqlSetAutoCommit: mysql_autocommit: %s\n",
-                      mysql_error(db->connection)););
-      raise_error(DATABASE_ERROR);
     } else {
-      /* There seems to be no function to retrieve the current    */
-      /* autocommit mode. Therefore the mode is stored in the db. */
-      db->autoCommit = autoCommit;
+      finishStream(db);
+      if (unlikely(mysql_autocommit(db->connection, autoCommit) != 0)) {
+        setDbErrorMsg("sqlSetAutoCommit", "mysql_autocommit",
+                      mysql_errno(db->connection),
+                      mysql_error(db->connection));
+        logError(printf("sqlSetAutoCommit: mysql_autocommit: %s\n",
+                        mysql_error(db->connection)););
+        raise_error(DATABASE_ERROR);
+      } else {
+        /* There seems to be no function to retrieve the current    */
+        /* autocommit mode. Therefore the mode is stored in the db. */
+        db->autoCommit = autoCommit;
+      } /* if */
     } /* if */
     logFunction(printf("sqlSetAutoCommit -->\n"););
   } /* sqlSetAutoCommit */
 
 
 
+/**
+ *  Switch between buffered and unbuffered results of sqlStatement.
+ *  For unbuffered results mysql_stmt_store_result() is not called.
+ *  The rows are transferred by mysql_stmt_fetch() instead.
+ */
+static void sqlSetStreaming (sqlStmtType sqlStatement, boolType streaming)
+
+  {
+    preparedStmtType preparedStmt;
+
+  /* sqlSetStreaming */
+    logFunction(printf("sqlSetStreaming(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) sqlStatement, streaming););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    preparedStmt->streaming = streaming;
+    logFunction(printf("sqlSetStreaming -->\n"););
+  } /* sqlSetStreaming */
+
+
+
 static intType sqlStmtColumnCount (sqlStmtType sqlStatement)
 
   {
@@ -2872,6 +3208,7 @@ static boolType setupFuncTable (void)
         memset(sqlFunc, 0, sizeof(sqlFuncRecord));
         sqlFunc->freeDatabase       = &freeDatabase;
         sqlFunc->freePreparedStmt   = &freePreparedStmt;
+        sqlFunc->sqlBindArray       = &sqlBindArray;
         sqlFunc->sqlBindBigInt      = &sqlBindBigInt;
         sqlFunc->sqlBindBigRat      = &sqlBindBigRat;
         sqlFunc->sqlBindBool        = &sqlBindBool;
@@ -2885,6 +3222,7 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlClose           = &sqlClose;
         sqlFunc->sqlColumnBigInt    = &sqlColumnBigInt;
         sqlFunc->sqlColumnBigRat    = &sqlColumnBigRat;
+        sqlFunc->sqlColumnBlock     = &sqlColumnBlock;
         sqlFunc->sqlColumnBool      = &sqlColumnBool;
         sqlFunc->sqlColumnBStri     = &sqlColumnBStri;
         sqlFunc->sqlColumnDuration  = &sqlColumnDuration;
@@ -2894,12 +3232,15 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlColumnTime      = &sqlColumnTime;
         sqlFunc->sqlCommit          = &sqlCommit;
         sqlFunc->sqlExecute         = &sqlExecute;
+        sqlFunc->sqlExecuteBatch    = &sqlExecuteBatch;
         sqlFunc->sqlFetch           = &sqlFetch;
+        sqlFunc->sqlFetchBlock      = &sqlFetchBlock;
         sqlFunc->sqlGetAutoCommit   = &sqlGetAutoCommit;
         sqlFunc->sqlIsNull          = &sqlIsNull;
         sqlFunc->sqlPrepare         = &sqlPrepare;
         sqlFunc->sqlRollback        = &sqlRollback;
         sqlFunc->sqlSetAutoCommit   = &sqlSetAutoCommit;
+        sqlFunc->sqlSetStreaming    = &sqlSetStreaming;
         sqlFunc->sqlStmtColumnCount = &sqlStmtColumnCount;
         sqlFunc->sqlStmtColumnName  = &sqlStmtColumnName;
       } /* if */
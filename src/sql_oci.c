@@ -70,6 +70,7 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     OCIEnv      *oci_environment;
     OCIServer   *oci_server;
     OCIError    *oci_error;
@@ -87,11 +87,13 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     PGconn      *connection;
     boolType     integerDatetimes;
     uintType     nextStmtNum;
     boolType     autoCommit;
     int64Type    moneyDenominator;
+    sqlStmtType  streamingStmt;
   } dbRecordPost, *dbType;
 
 typedef struct {
@@ -127,6 +129,9 @@ typedef struct {
     int            num_tuples;
     int            fetch_index;
     boolType       increment_index;
+    boolType       streaming;
+    boolType       streamActive;
+    bulkRecord     bulk;
   } preparedStmtRecordPost, *preparedStmtType;
 
 static sqlFuncType sqlFunc = NULL;
@@ -167,6 +172,7 @@ typedef char *(CDECL *tp_PQfname) (const PGresult *res, int field_num);
 typedef Oid (CDECL *tp_PQftype) (const PGresult *res, int field_num);
 typedef int (CDECL *tp_PQgetisnull) (const PGresult *res, int tup_num, int field_num);
 typedef int (CDECL *tp_PQgetlength) (const PGresult *res, int tup_num, int field_num);
+typedef PGresult *(CDECL *tp_PQgetResult) (PGconn *conn);
 typedef char *(CDECL *tp_PQgetvalue) (const PGresult *res, int tup_num, int field_num);
 typedef int (CDECL *tp_PQnfields) (const PGresult *res);
 typedef int (CDECL *tp_PQnparams) (const PGresult *res);
@@ -179,11 +185,19 @@ typedef PGresult *(CDECL *tp_PQprepare) (PGconn *conn, const char *stmtName,
 typedef char *(CDECL *tp_PQresStatus) (ExecStatusType status);
 typedef char *(CDECL *tp_PQresultErrorMessage) (const PGresult *res);
 typedef ExecStatusType (CDECL *tp_PQresultStatus) (const PGresult *res);
+typedef int (CDECL *tp_PQsendQueryPrepared) (PGconn *conn,
+                                            const char *stmtName,
+                                            int nParams,
+                                            const char *const * paramValues,
+                                            const int *paramLengths,
+                                            const int *paramFormats,
+                                            int resultFormat);
 typedef int (CDECL *tp_PQsetClientEncoding) (PGconn *conn, const char *encoding);
 typedef PGconn *(CDECL *tp_PQsetdbLogin) (const char *pghost, const char *pgport,
                                           const char *pgoptions, const char *pgtty,
                                           const char *dbName,
                                           const char *login, const char *pwd);
+typedef int (CDECL *tp_PQsetSingleRowMode) (PGconn *conn);
 typedef ConnStatusType (CDECL *tp_PQstatus) (const PGconn *conn);
 
 static tp_PQclear              ptr_PQclear;
@@ -196,6 +210,7 @@ static tp_PQfname              ptr_PQfname;
 static tp_PQftype              ptr_PQftype;
 static tp_PQgetisnull          ptr_PQgetisnull;
 static tp_PQgetlength          ptr_PQgetlength;
+static tp_PQgetResult          ptr_PQgetResult;
 static tp_PQgetvalue           ptr_PQgetvalue;
 static tp_PQnfields            ptr_PQnfields;
 static tp_PQnparams            ptr_PQnparams;
@@ -206,8 +221,10 @@ static tp_PQprepare            ptr_PQprepare;
 static tp_PQresStatus          ptr_PQresStatus;
 static tp_PQresultErrorMessage ptr_PQresultErrorMessage;
 static tp_PQresultStatus       ptr_PQresultStatus;
+static tp_PQsendQueryPrepared  ptr_PQsendQueryPrepared;
 static tp_PQsetClientEncoding  ptr_PQsetClientEncoding;
 static tp_PQsetdbLogin         ptr_PQsetdbLogin;
+static tp_PQsetSingleRowMode   ptr_PQsetSingleRowMode;
 static tp_PQstatus             ptr_PQstatus;
 
 #define PQclear              ptr_PQclear
@@ -220,6 +237,7 @@ static tp_PQstatus             ptr_PQstatus;
 #define PQftype              ptr_PQftype
 #define PQgetisnull          ptr_PQgetisnull
 #define PQgetlength          ptr_PQgetlength
+#define PQgetResult          ptr_PQgetResult
 #define PQgetvalue           ptr_PQgetvalue
 #define PQnfields            ptr_PQnfields
 #define PQnparams            ptr_PQnparams
@@ -230,8 +248,10 @@ static tp_PQstatus             ptr_PQstatus;
 #define PQresStatus          ptr_PQresStatus
 #define PQresultErrorMessage ptr_PQresultErrorMessage
 #define PQresultStatus       ptr_PQresultStatus
+#define PQsendQueryPrepared  ptr_PQsendQueryPrepared
 #define PQsetClientEncoding  ptr_PQsetClientEncoding
 #define PQsetdbLogin         ptr_PQsetdbLogin
+#define PQsetSingleRowMode   ptr_PQsetSingleRowMode
 #define PQstatus             ptr_PQstatus
 
 
@@ -308,6 +328,7 @@ static boolType setupDll (const char *dllName)
             (PQftype              = (tp_PQftype)              dllFunc(dbDll, "PQftype"))              == NULL ||
             (PQgetisnull          = (tp_PQgetisnull)          dllFunc(dbDll, "PQgetisnull"))          == NULL ||
             (PQgetlength          = (tp_PQgetlength)          dllFunc(dbDll, "PQgetlength"))          == NULL ||
+            (PQgetResult          = (tp_PQgetResult)          dllFunc(dbDll, "PQgetResult"))          == NULL ||
             (PQgetvalue           = (tp_PQgetvalue)           dllFunc(dbDll, "PQgetvalue"))           == NULL ||
             (PQnfields            = (tp_PQnfields)            dllFunc(dbDll, "PQnfields"))            == NULL ||
             (PQnparams            = (tp_PQnparams)            dllFunc(dbDll, "PQnparams"))            == NULL ||
@@ -318,8 +339,10 @@ static boolType setupDll (const char *dllName)
             (PQresStatus          = (tp_PQresStatus)          dllFunc(dbDll, "PQresStatus"))          == NULL ||
             (PQresultErrorMessage = (tp_PQresultErrorMessage) dllFunc(dbDll, "PQresultErrorMessage")) == NULL ||
             (PQresultStatus       = (tp_PQresultStatus)       dllFunc(dbDll, "PQresultStatus"))       == NULL ||
+            (PQsendQueryPrepared  = (tp_PQsendQueryPrepared)  dllFunc(dbDll, "PQsendQueryPrepared"))  == NULL ||
             (PQsetClientEncoding  = (tp_PQsetClientEncoding)  dllFunc(dbDll, "PQsetClientEncoding"))  == NULL ||
             (PQsetdbLogin         = (tp_PQsetdbLogin)         dllFunc(dbDll, "PQsetdbLogin"))         == NULL ||
+            (PQsetSingleRowMode   = (tp_PQsetSingleRowMode)   dllFunc(dbDll, "PQsetSingleRowMode"))   == NULL ||
             (PQstatus             = (tp_PQstatus)             dllFunc(dbDll, "PQstatus"))             == NULL) {
           dbDll = NULL;
         } /* if */
@@ -565,6 +588,141 @@ static PGresult *PQdeallocate (PGconn *conn, const char *stmtName)
 
 
 
+/**
+ *  Read and discard the remaining results of the current query.
+ *  This must be done before another query can be sent.
+ */
+static void discardResults (PGconn *connection)
+
+  {
+    PGresult *result;
+
+  /* discardResults */
+    logFunction(printf("discardResults(" FMT_U_MEM ")\n",
+                       (memSizeType) connection););
+    while ((result = PQgetResult(connection)) != NULL) {
+      PQclear(result);
+    } /* while */
+    logFunction(printf("discardResults -->\n"););
+  } /* discardResults */
+
+
+
+/**
+ *  End a stream of single row results on the connection of db.
+ *  Rows of the stream, which have not been fetched, are discarded.
+ *  The streaming statement keeps the row that is currently fetched.
+ */
+static void finishStream (dbType db)
+
+  {
+    preparedStmtType streamingStmt;
+
+  /* finishStream */
+    logFunction(printf("finishStream(" FMT_U_MEM ")\n",
+                       (memSizeType) db););
+    if (db->streamingStmt != NULL) {
+      streamingStmt = (preparedStmtType) db->streamingStmt;
+      if (db->connection != NULL) {
+        discardResults(db->connection);
+      } /* if */
+      streamingStmt->streamActive = FALSE;
+      db->streamingStmt = NULL;
+    } /* if */
+    logFunction(printf("finishStream -->\n"););
+  } /* finishStream */
+
+
+
+/**
+ *  Send the prepared statement and request single row results.
+ *  @return the first result of the statement or NULL if sending failed.
+ */
+static PGresult *startStream (preparedStmtType preparedStmt)
+
+  {
+    PGconn *connection;
+    PGresult *result;
+
+  /* startStream */
+    logFunction(printf("startStream(" FMT_U_MEM ")\n",
+                       (memSizeType) preparedStmt););
+    connection = preparedStmt->db->connection;
+    if (unlikely(PQsendQueryPrepared(connection,
+                                     preparedStmt->stmtName,
+                                     (int) preparedStmt->param_array_size,
+                                     (const const_cstriType *) preparedStmt->paramValues,
+                                     preparedStmt->paramLengths,
+                                     preparedStmt->paramFormats,
+                                     1) == 0)) {
+      setDbErrorMsg("sqlExecute", "PQsendQueryPrepared", connection);
+      logError(printf("startStream: PQsendQueryPrepared failed:\n%s",
+                      dbError.message););
+      result = NULL;
+    } else {
+      /* If single row mode cannot be set the whole */
+      /* result is delivered by the first result.   */
+      (void) PQsetSingleRowMode(connection);
+      result = PQgetResult(connection);
+      if (result != NULL && PQresultStatus(result) == PGRES_SINGLE_TUPLE) {
+        preparedStmt->streamActive = TRUE;
+        preparedStmt->db->streamingStmt = (sqlStmtType) preparedStmt;
+      } else {
+        discardResults(connection);
+      } /* if */
+    } /* if */
+    logFunction(printf("startStream --> " FMT_U_MEM "\n",
+                       (memSizeType) result););
+    return result;
+  } /* startStream */
+
+
+
+/**
+ *  Replace the current row of a stream with the next one.
+ *  At the end of the stream the result has no rows (num_tuples is 0).
+ */
+static errInfoType fetchStreamRow (preparedStmtType preparedStmt)
+
+  {
+    PGresult *result;
+    ExecStatusType status;
+    boolType moreRows = FALSE;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* fetchStreamRow */
+    logFunction(printf("fetchStreamRow(" FMT_U_MEM ")\n",
+                       (memSizeType) preparedStmt););
+    PQclear(preparedStmt->execute_result);
+    preparedStmt->execute_result = NULL;
+    preparedStmt->num_tuples = 0;
+    preparedStmt->fetch_index = 0;
+    result = PQgetResult(preparedStmt->db->connection);
+    if (result != NULL) {
+      status = PQresultStatus(result);
+      if (status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_OK) {
+        preparedStmt->execute_result = result;
+        preparedStmt->num_tuples = PQntuples(result);
+        moreRows = status == PGRES_SINGLE_TUPLE;
+      } else {
+        setDbErrorMsg("sqlFetch", "PQgetResult", preparedStmt->db->connection);
+        logError(printf("fetchStreamRow: PQgetResult returns a status of %s:\n%s",
+                        PQresStatus(status), dbError.message););
+        PQclear(result);
+        preparedStmt->executeSuccessful = FALSE;
+        err_info = DATABASE_ERROR;
+      } /* if */
+    } /* if */
+    if (!moreRows) {
+      finishStream(preparedStmt->db);
+    } /* if */
+    logFunction(printf("fetchStreamRow --> %d (num_tuples: %d)\n",
+                       err_info, preparedStmt->num_tuples););
+    return err_info;
+  } /* fetchStreamRow */
+
+
+
 /**
  *  Closes a database and frees the memory used by it.
  */
@@ -621,6 +779,8 @@ static void freePreparedStmt (sqlStmtType sqlStatement)
     if (preparedStmt->execute_result != NULL) {
       PQclear(preparedStmt->execute_result);
     } /* if */
+    freeBulk(&preparedStmt->bulk);
+    finishStream(preparedStmt->db);
     deallocate_result = PQdeallocate(preparedStmt->db->connection, preparedStmt->stmtName);
     if (unlikely(deallocate_result != NULL)) {
       /* Ignore possible errors. */
@@ -1458,6 +1618,26 @@ static timeStampType getTimestamp1970 (timeStampType timestamp,
 
 
 
+static void sqlBindArray (sqlStmtType sqlStatement, intType pos, int kind,
+    const const_rtlArrayType values)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info;
+
+  /* sqlBindArray */
+    logFunction(printf("sqlBindArray(" FMT_U_MEM ", " FMT_D ", %d, arr)\n",
+                       (memSizeType) sqlStatement, pos, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    err_info = bulkBindArray(&preparedStmt->bulk, preparedStmt->param_array_size,
+                             pos, kind, values);
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+  } /* sqlBindArray */
+
+
+
 static void sqlBindBigInt (sqlStmtType sqlStatement, intType pos,
     const const_bigIntType value)
 
@@ -1818,11 +1998,56 @@ static void sqlBindDuration (sqlStmtType sqlStatement, intType pos,
 
 
 
+static errInfoType setFloatParam (preparedStmtType preparedStmt, intType pos,
+    floatType value)
+
+  {
+    bindDataType param;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* setFloatParam */
+    param = &preparedStmt->param_array[pos - 1];
+    logMessage(printf("paramType: %s\n",
+                      nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+    switch (preparedStmt->paramTypes[pos - 1]) {
+      case FLOAT4OID:
+        preparedStmt->paramValues[pos - 1] = param->buffer;
+        *(float *) param->buffer = htonf((float) value);
+        break;
+      case FLOAT8OID:
+        preparedStmt->paramValues[pos - 1] = param->buffer;
+        *(double *) param->buffer = htond(value);
+        break;
+      case CASHOID:
+        free(param->buffer);
+        if (unlikely((param->buffer = (cstriType) malloc(
+                          DOUBLE_TO_CHAR_BUFFER_SIZE)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else {
+          preparedStmt->paramValues[pos - 1] = param->buffer;
+          preparedStmt->paramLengths[pos - 1] =
+              (int) sprintf(param->buffer, "%f", value);
+          preparedStmt->paramFormats[pos - 1] = 0;
+        } /* if */
+        break;
+      default:
+        logError(printf("sqlBindFloat: Parameter " FMT_D " has the unknown type %s.\n",
+                        pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+        err_info = RANGE_ERROR;
+        break;
+    } /* switch */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      param->bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setFloatParam */
+
+
+
 static void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value)
 
   {
     preparedStmtType preparedStmt;
-    bindDataType param;
     errInfoType err_info = OKAY_NO_ERROR;
 
   /* sqlBindFloat */
@@ -1834,53 +2059,100 @@ static void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      logMessage(printf("paramType: %s\n",
-                        nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-      switch (preparedStmt->paramTypes[pos - 1]) {
-        case FLOAT4OID:
-          preparedStmt->paramValues[pos - 1] = param->buffer;
-          *(float *) param->buffer = htonf((float) value);
-          break;
-        case FLOAT8OID:
-          preparedStmt->paramValues[pos - 1] = param->buffer;
-          *(double *) param->buffer = htond(value);
-          break;
-        case CASHOID:
-          free(param->buffer);
-          if (unlikely((param->buffer = (cstriType) malloc(
-                            DOUBLE_TO_CHAR_BUFFER_SIZE)) == NULL)) {
-            err_info = MEMORY_ERROR;
-          } else {
-            preparedStmt->paramValues[pos - 1] = param->buffer;
-            preparedStmt->paramLengths[pos - 1] =
-                (int) sprintf(param->buffer, "%f", value);
-            preparedStmt->paramFormats[pos - 1] = 0;
-          } /* if */
-          break;
-        default:
-          logError(printf("sqlBindFloat: Parameter " FMT_D " has the unknown type %s.\n",
-                          pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-          err_info = RANGE_ERROR;
-          break;
-      } /* switch */
+      err_info = setFloatParam(preparedStmt, pos, value);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         raise_error(err_info);
       } else {
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        param->bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindFloat */
 
 
 
+static errInfoType setIntParam (preparedStmtType preparedStmt, intType pos,
+    intType value)
+
+  {
+    bindDataType param;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* setIntParam */
+    param = &preparedStmt->param_array[pos - 1];
+    logMessage(printf("paramType: %s\n",
+                      nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+    switch (preparedStmt->paramTypes[pos - 1]) {
+      case INT2OID:
+        if (unlikely(value < INT16TYPE_MIN || value > INT16TYPE_MAX)) {
+          logError(printf("sqlBindInt: Parameter " FMT_D ": "
+                          FMT_D " does not fit into a 16-bit integer.\n",
+                          pos, value));
+          err_info = RANGE_ERROR;
+        } else {
+          preparedStmt->paramValues[pos - 1] = param->buffer;
+          *(int16Type *) param->buffer =
+              (int16Type) htons((uint16Type) value);
+        } /* if */
+        break;
+      case INT4OID:
+        if (unlikely(value < INT32TYPE_MIN || value > INT32TYPE_MAX)) {
+          logError(printf("sqlBindInt: Parameter " FMT_D ": "
+                          FMT_D " does not fit into a 32-bit integer.\n",
+                          pos, value));
+          err_info = RANGE_ERROR;
+        } else {
+          preparedStmt->paramValues[pos - 1] = param->buffer;
+          *(int32Type *) param->buffer =
+              (int32Type) htonl((uint32Type) value);
+        } /* if */
+        break;
+      case INT8OID:
+        preparedStmt->paramValues[pos - 1] = param->buffer;
+        *(int64Type *) param->buffer =
+            (int64Type) htonll((uint64Type) value);
+        break;
+      case FLOAT4OID:
+        preparedStmt->paramValues[pos - 1] = param->buffer;
+        *(float *) param->buffer = htonf((float) value);
+        break;
+      case FLOAT8OID:
+        preparedStmt->paramValues[pos - 1] = param->buffer;
+        *(double *) param->buffer = htond((double) value);
+        break;
+      case CASHOID:
+      case NUMERICOID:
+      case BPCHAROID:
+      case VARCHAROID:
+        free(param->buffer);
+        if (unlikely((param->buffer = (cstriType) malloc(
+                          INTTYPE_DECIMAL_SIZE + NULL_TERMINATION_LEN)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else {
+          preparedStmt->paramValues[pos - 1] = param->buffer;
+          preparedStmt->paramLengths[pos - 1] =
+              (int) sprintf(param->buffer, FMT_D, value);
+          preparedStmt->paramFormats[pos - 1] = 0;
+        } /* if */
+        break;
+      default:
+        logError(printf("sqlBindInt: Parameter " FMT_D " has the unknown type %s.\n",
+                        pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+        err_info = RANGE_ERROR;
+        break;
+    } /* switch */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      param->bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setIntParam */
+
+
+
 static void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
 
   {
     preparedStmtType preparedStmt;
-    bindDataType param;
     errInfoType err_info = OKAY_NO_ERROR;
 
   /* sqlBindInt */
@@ -1892,74 +2164,12 @@ static void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      logMessage(printf("paramType: %s\n",
-                        nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-      switch (preparedStmt->paramTypes[pos - 1]) {
-        case INT2OID:
-          if (unlikely(value < INT16TYPE_MIN || value > INT16TYPE_MAX)) {
-            logError(printf("sqlBindInt: Parameter " FMT_D ": "
-                            FMT_D " does not fit into a 16-bit integer.\n",
-                            pos, value));
-            err_info = RANGE_ERROR;
-          } else {
-            preparedStmt->paramValues[pos - 1] = param->buffer;
-            *(int16Type *) param->buffer =
-                (int16Type) htons((uint16Type) value);
-          } /* if */
-          break;
-        case INT4OID:
-          if (unlikely(value < INT32TYPE_MIN || value > INT32TYPE_MAX)) {
-            logError(printf("sqlBindInt: Parameter " FMT_D ": "
-                            FMT_D " does not fit into a 32-bit integer.\n",
-                            pos, value));
-            err_info = RANGE_ERROR;
-          } else {
-            preparedStmt->paramValues[pos - 1] = param->buffer;
-            *(int32Type *) param->buffer =
-                (int32Type) htonl((uint32Type) value);
-          } /* if */
-          break;
-        case INT8OID:
-          preparedStmt->paramValues[pos - 1] = param->buffer;
-          *(int64Type *) param->buffer =
-              (int64Type) htonll((uint64Type) value);
-          break;
-        case FLOAT4OID:
-          preparedStmt->paramValues[pos - 1] = param->buffer;
-          *(float *) param->buffer = htonf((float) value);
-          break;
-        case FLOAT8OID:
-          preparedStmt->paramValues[pos - 1] = param->buffer;
-          *(double *) param->buffer = htond((double) value);
-          break;
-        case CASHOID:
-        case NUMERICOID:
-        case BPCHAROID:
-        case VARCHAROID:
-          free(param->buffer);
-          if (unlikely((param->buffer = (cstriType) malloc(
-                            INTTYPE_DECIMAL_SIZE + NULL_TERMINATION_LEN)) == NULL)) {
-            err_info = MEMORY_ERROR;
-          } else {
-            preparedStmt->paramValues[pos - 1] = param->buffer;
-            preparedStmt->paramLengths[pos - 1] =
-                (int) sprintf(param->buffer, FMT_D, value);
-            preparedStmt->paramFormats[pos - 1] = 0;
-          } /* if */
-          break;
-        default:
-          logError(printf("sqlBindInt: Parameter " FMT_D " has the unknown type %s.\n",
-                          pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-          err_info = RANGE_ERROR;
-          break;
-      } /* switch */
+      err_info = setIntParam(preparedStmt, pos, value);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         raise_error(err_info);
       } else {
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        param->bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindInt */
@@ -1991,11 +2201,10 @@ static void sqlBindNull (sqlStmtType sqlStatement, intType pos)
 
 
 
-static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
+static errInfoType setStriParam (preparedStmtType preparedStmt, intType pos,
     const const_striType stri)
 
   {
-    preparedStmtType preparedStmt;
     bindDataType param;
     cstriType stri8;
     cstriType resized_stri8;
@@ -2003,6 +2212,77 @@ static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
     cstriType cstri;
     errInfoType err_info = OKAY_NO_ERROR;
 
+  /* setStriParam */
+    param = &preparedStmt->param_array[pos - 1];
+    logMessage(printf("paramType: %s\n",
+                      nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+    switch (preparedStmt->paramTypes[pos - 1]) {
+      case BPCHAROID:
+      case VARCHAROID:
+      case TEXTOID:
+        /* PostgreSQL doesn't support storing Null characters     */
+        /* ('\0;') in text fields. PQexecPrepared() returns a     */
+        /* status of PGRES_FATAL_ERROR, because 0x00 and 0xc080   */
+        /* (the overlong UTF-8 encoding for the Null character)   */
+        /* are seen as invalid byte sequence for encoding "UTF8". */
+        /* Therefore binding of strings with a Null character     */
+        /* ('\0;') inside will fail later with sqlExecute().      */
+        stri8 = stri_to_cstri8_buf(stri, &length);
+        if (unlikely(stri8 == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else if (unlikely(length > INT_MAX)) {
+          /* It is not possible to cast length to int. */
+          free(stri8);
+          err_info = MEMORY_ERROR;
+        } else {
+          resized_stri8 = REALLOC_CSTRI(stri8, length);
+          if (likely(resized_stri8 != NULL)) {
+            stri8 = resized_stri8;
+          } /* if */
+          free(param->buffer);
+          param->buffer = stri8;
+          preparedStmt->paramValues[pos - 1] = stri8;
+          preparedStmt->paramLengths[pos - 1] = (int) length;
+          preparedStmt->paramFormats[pos - 1] = 1;
+        } /* if */
+        break;
+      case BYTEAOID:
+        if (unlikely(stri->size > INT_MAX ||
+                     (cstri = (cstriType) malloc(stri->size)) == NULL)) {
+          err_info = MEMORY_ERROR;
+        } else if (unlikely(memcpy_from_strelem((ustriType) cstri,
+                                                stri->mem, stri->size))) {
+          free(cstri);
+          err_info = RANGE_ERROR;
+        } else {
+          free(param->buffer);
+          param->buffer = cstri;
+          preparedStmt->paramValues[pos - 1] = cstri;
+          preparedStmt->paramLengths[pos - 1] = (int) stri->size;
+          preparedStmt->paramFormats[pos - 1] = 1;
+        } /* if */
+        break;
+      default:
+        logError(printf("sqlBindStri: Parameter " FMT_D " has the unknown type %s.\n",
+                        pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
+        err_info = RANGE_ERROR;
+        break;
+    } /* switch */
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      param->bound = TRUE;
+    } /* if */
+    return err_info;
+  } /* setStriParam */
+
+
+
+static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
+    const const_striType stri)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info = OKAY_NO_ERROR;
+
   /* sqlBindStri */
     logFunction(printf("sqlBindStri(" FMT_U_MEM ", " FMT_D ", \"%s\")\n",
                        (memSizeType) sqlStatement, pos, striAsUnquotedCStri(stri)););
@@ -2012,67 +2292,12 @@ static void sqlBindStri (sqlStmtType sqlStatement, intType pos,
                       pos, preparedStmt->param_array_size););
       raise_error(RANGE_ERROR);
     } else {
-      param = &preparedStmt->param_array[pos - 1];
-      logMessage(printf("paramType: %s\n",
-                        nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-      switch (preparedStmt->paramTypes[pos - 1]) {
-        case BPCHAROID:
-        case VARCHAROID:
-        case TEXTOID:
-          /* PostgreSQL doesn't support storing Null characters     */
-          /* ('\0;') in text fields. PQexecPrepared() returns a     */
-          /* status of PGRES_FATAL_ERROR, because 0x00 and 0xc080   */
-          /* (the overlong UTF-8 encoding for the Null character)   */
-          /* are seen as invalid byte sequence for encoding "UTF8". */
-          /* Therefore binding of strings with a Null character     */
-          /* ('\0;') inside will fail later with sqlExecute().      */
-          stri8 = stri_to_cstri8_buf(stri, &length);
-          if (unlikely(stri8 == NULL)) {
-            err_info = MEMORY_ERROR;
-          } else if (unlikely(length > INT_MAX)) {
-            /* It is not possible to cast length to int. */
-            free(stri8);
-            err_info = MEMORY_ERROR;
-          } else {
-            resized_stri8 = REALLOC_CSTRI(stri8, length);
-            if (likely(resized_stri8 != NULL)) {
-              stri8 = resized_stri8;
-            } /* if */
-            free(param->buffer);
-            param->buffer = stri8;
-            preparedStmt->paramValues[pos - 1] = stri8;
-            preparedStmt->paramLengths[pos - 1] = (int) length;
-            preparedStmt->paramFormats[pos - 1] = 1;
-          } /* if */
-          break;
-        case BYTEAOID:
-          if (unlikely(stri->size > INT_MAX ||
-                       (cstri = (cstriType) malloc(stri->size)) == NULL)) {
-            err_info = MEMORY_ERROR;
-          } else if (unlikely(memcpy_from_strelem((ustriType) cstri,
-                                                  stri->mem, stri->size))) {
-            free(cstri);
-            err_info = RANGE_ERROR;
-          } else {
-            free(param->buffer);
-            param->buffer = cstri;
-            preparedStmt->paramValues[pos - 1] = cstri;
-            preparedStmt->paramLengths[pos - 1] = (int) stri->size;
-            preparedStmt->paramFormats[pos - 1] = 1;
-          } /* if */
-          break;
-        default:
-          logError(printf("sqlBindStri: Parameter " FMT_D " has the unknown type %s.\n",
-                          pos, nameOfBufferType(preparedStmt->paramTypes[pos - 1])););
-          err_info = RANGE_ERROR;
-          break;
-      } /* switch */
+      err_info = setStriParam(preparedStmt, pos, stri);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
         raise_error(err_info);
       } else {
         preparedStmt->executeSuccessful = FALSE;
         preparedStmt->fetchOkay = FALSE;
-        param->bound = TRUE;
       } /* if */
     } /* if */
   } /* sqlBindStri */
@@ -2238,6 +2463,7 @@ static void sqlClose (databaseType database)
       PQfinish(db->connection);
       db->connection = NULL;
     } /* if */
+    finishStream(db);
     db->isOpen = FALSE;
     logFunction(printf("sqlClose -->\n"););
   } /* sqlClose */
@@ -2412,6 +2638,29 @@ static void sqlColumnBigRat (sqlStmtType sqlStatement, intType column,
 
 
 
+static rtlArrayType sqlColumnBlock (sqlStmtType sqlStatement, intType column,
+    int kind)
+
+  {
+    preparedStmtType preparedStmt;
+    errInfoType err_info = OKAY_NO_ERROR;
+    rtlArrayType columnValues;
+
+  /* sqlColumnBlock */
+    logFunction(printf("sqlColumnBlock(" FMT_U_MEM ", " FMT_D ", %d)\n",
+                       (memSizeType) sqlStatement, column, kind););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    columnValues = bulkColumn(&preparedStmt->bulk, column, kind, &err_info);
+    if (unlikely(columnValues == NULL)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlColumnBlock --> " FMT_U_MEM "\n",
+                       (memSizeType) columnValues););
+    return columnValues;
+  } /* sqlColumnBlock */
+
+
+
 static boolType sqlColumnBool (sqlStmtType sqlStatement, intType column)
 
   {
@@ -3261,6 +3510,7 @@ static void sqlCommit (databaseType database)
       logError(printf("sqlCommit: Database is not open.\n"););
       raise_error(DATABASE_ERROR);
     } else if (!db->autoCommit) {
+      finishStream(db);
       err_info = doExecSql(db->connection, "COMMIT", err_info);
       err_info = doExecSql(db->connection, "BEGIN TRANSACTION", err_info);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
@@ -3289,22 +3539,37 @@ static void sqlExecute (sqlStmtType sqlStatement)
       raise_error(DATABASE_ERROR);
     } else {
       preparedStmt->fetchOkay = FALSE;
+      finishStream(preparedStmt->db);
       if (preparedStmt->execute_result != NULL) {
         PQclear(preparedStmt->execute_result);
+        preparedStmt->execute_result = NULL;
+      } /* if */
+      if (preparedStmt->streaming) {
+        preparedStmt->execute_result = startStream(preparedStmt);
+      } else {
+        preparedStmt->execute_result = PQexecPrepared(preparedStmt->db->connection,
+                                                      preparedStmt->stmtName,
+                                                      (int) preparedStmt->param_array_size,
+                                                      (const const_cstriType *) preparedStmt->paramValues,
+                                                      preparedStmt->paramLengths,
+                                                      preparedStmt->paramFormats,
+                                                      1);
       } /* if */
-      preparedStmt->execute_result = PQexecPrepared(preparedStmt->db->connection,
-                                                    preparedStmt->stmtName,
-                                                    (int) preparedStmt->param_array_size,
-                                                    (const const_cstriType *) preparedStmt->paramValues,
-                                                    preparedStmt->paramLengths,
-                                                    preparedStmt->paramFormats,
-                                                    1);
       if (unlikely(preparedStmt->execute_result == NULL)) {
-        logError(printf("sqlExecute: PQexecPrepared returns NULL\n"););
         preparedStmt->executeSuccessful = FALSE;
-        raise_error(MEMORY_ERROR);
+        if (preparedStmt->streaming) {
+          /* The error message has been set by startStream(). */
+          raise_error(DATABASE_ERROR);
+        } else {
+          logError(printf("sqlExecute: PQexecPrepared returns NULL\n"););
+          raise_error(MEMORY_ERROR);
+        } /* if */
       } else {
         preparedStmt->execute_status = PQresultStatus(preparedStmt->execute_result);
+        if (preparedStmt->execute_status == PGRES_SINGLE_TUPLE) {
+          /* The first row of a stream. Further rows are read by sqlFetch(). */
+          preparedStmt->execute_status = PGRES_TUPLES_OK;
+        } /* if */
         if (preparedStmt->execute_status == PGRES_COMMAND_OK) {
           preparedStmt->executeSuccessful = TRUE;
 #if USE_IMPLICIT_COMMIT_MECHANISM
@@ -3354,10 +3619,107 @@ static void sqlExecute (sqlStmtType sqlStatement)
 
 
 
+static void sqlExecuteBatch (sqlStmtType sqlStatement)
+
+  {
+    preparedStmtType preparedStmt;
+    PGconn *connection;
+    const_bulkDataType param;
+    memSizeType batchSize;
+    memSizeType row;
+    memSizeType pos;
+    boolType ownTransaction;
+    PGresult *execute_result;
+    ExecStatusType execute_status;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* sqlExecuteBatch */
+    logFunction(printf("sqlExecuteBatch(" FMT_U_MEM ")\n",
+                       (memSizeType) sqlStatement););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    batchSize = bulkBatchSize(&preparedStmt->bulk,
+                              preparedStmt->param_array_size, &err_info);
+    if (likely(err_info == OKAY_NO_ERROR)) {
+      finishStream(preparedStmt->db);
+      connection = preparedStmt->db->connection;
+      preparedStmt->executeSuccessful = FALSE;
+      preparedStmt->fetchOkay = FALSE;
+      if (preparedStmt->execute_result != NULL) {
+        PQclear(preparedStmt->execute_result);
+        preparedStmt->execute_result = NULL;
+      } /* if */
+      /* In auto-commit mode every row would be a transaction of its own. */
+      ownTransaction = preparedStmt->db->autoCommit;
+      if (ownTransaction) {
+        err_info = doExecSql(connection, "BEGIN TRANSACTION", err_info);
+      } /* if */
+      for (row = 0; row < batchSize && err_info == OKAY_NO_ERROR; row++) {
+        for (pos = 0; pos < preparedStmt->param_array_size &&
+             err_info == OKAY_NO_ERROR; pos++) {
+          param = &preparedStmt->bulk.param_array[pos];
+          switch (param->kind) {
+            case BULK_INT:
+              err_info = setIntParam(preparedStmt, (intType) pos + 1,
+                                     param->data.intValues[row]);
+              break;
+            case BULK_FLOAT:
+              err_info = setFloatParam(preparedStmt, (intType) pos + 1,
+                                       param->data.floatValues[row]);
+              break;
+            default:
+              err_info = setStriParam(preparedStmt, (intType) pos + 1,
+                                      param->data.striValues[row]);
+              break;
+          } /* switch */
+        } /* for */
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          execute_result = PQexecPrepared(connection,
+                                          preparedStmt->stmtName,
+                                          (int) preparedStmt->param_array_size,
+                                          (const const_cstriType *) preparedStmt->paramValues,
+                                          preparedStmt->paramLengths,
+                                          preparedStmt->paramFormats,
+                                          1);
+          if (unlikely(execute_result == NULL)) {
+            logError(printf("sqlExecuteBatch: PQexecPrepared returns NULL\n"););
+            err_info = MEMORY_ERROR;
+          } else {
+            execute_status = PQresultStatus(execute_result);
+            if (unlikely(execute_status != PGRES_COMMAND_OK &&
+                         execute_status != PGRES_TUPLES_OK)) {
+              setDbErrorMsg("sqlExecuteBatch", "PQexecPrepared", connection);
+              logError(printf("sqlExecuteBatch: PQexecPrepared returns a status "
+                              "of %s in row " FMT_U_MEM ":\n%s",
+                              PQresStatus(execute_status), row + 1,
+                              dbError.message););
+              err_info = DATABASE_ERROR;
+            } /* if */
+            PQclear(execute_result);
+          } /* if */
+        } /* if */
+      } /* for */
+      if (ownTransaction) {
+        if (likely(err_info == OKAY_NO_ERROR)) {
+          err_info = doExecSql(connection, "COMMIT", err_info);
+        } else {
+          /* Keep the error of the failed row. */
+          (void) doExecSql(connection, "ROLLBACK", OKAY_NO_ERROR);
+        } /* if */
+      } /* if */
+    } /* if */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlExecuteBatch -->\n"););
+  } /* sqlExecuteBatch */
+
+
+
 static boolType sqlFetch (sqlStmtType sqlStatement)
 
   {
     preparedStmtType preparedStmt;
+    errInfoType err_info = OKAY_NO_ERROR;
 
   /* sqlFetch */
     logFunction(printf("sqlFetch(" FMT_U_MEM ")\n",
@@ -3375,11 +3737,18 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
     } else if (preparedStmt->execute_status == PGRES_TUPLES_OK) {
       if (!preparedStmt->increment_index) {
         preparedStmt->increment_index = TRUE;
+      } else if (preparedStmt->streamActive) {
+        err_info = fetchStreamRow(preparedStmt);
       } else {
         preparedStmt->fetch_index++;
       } /* if */
-      preparedStmt->fetchOkay =
-          preparedStmt->fetch_index < preparedStmt->num_tuples;
+      if (unlikely(err_info != OKAY_NO_ERROR)) {
+        preparedStmt->fetchOkay = FALSE;
+        raise_error(err_info);
+      } else {
+        preparedStmt->fetchOkay =
+            preparedStmt->fetch_index < preparedStmt->num_tuples;
+      } /* if */
     } else {
       preparedStmt->fetchOkay = FALSE;
     } /* if */
@@ -3389,6 +3758,73 @@ static boolType sqlFetch (sqlStmtType sqlStatement)
 
 
 
+static intType sqlFetchBlock (sqlStmtType sqlStatement, intType maxRows)
+
+  {
+    preparedStmtType preparedStmt;
+    bulkType bulk;
+    memSizeType column;
+    int isNull;
+    striType stri;
+    boolType raised = FALSE;
+    errInfoType err_info;
+
+  /* sqlFetchBlock */
+    logFunction(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) sqlStatement, maxRows););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    bulk = &preparedStmt->bulk;
+    err_info = bulkStartBlock(bulk, preparedStmt->result_column_count);
+    while (err_info == OKAY_NO_ERROR && !raised &&
+           bulk->row_count < (uintType) maxRows && sqlFetch(sqlStatement)) {
+      for (column = 0; column < preparedStmt->result_column_count &&
+           err_info == OKAY_NO_ERROR && !raised; column++) {
+        isNull = PQgetisnull(preparedStmt->execute_result,
+                             preparedStmt->fetch_index,
+                             (int) column);
+        if (isNull == 1) {
+          /* The block stores NULL values as default values. */
+        } else {
+          switch (PQftype(preparedStmt->execute_result, (int) column)) {
+            case INT2OID:
+            case INT4OID:
+            case INT8OID:
+            case OIDOID:
+              err_info = bulkStoreInt(bulk, column,
+                  sqlColumnInt(sqlStatement, (intType) column + 1));
+              break;
+            case FLOAT4OID:
+            case FLOAT8OID:
+              err_info = bulkStoreFloat(bulk, column,
+                  sqlColumnFloat(sqlStatement, (intType) column + 1));
+              break;
+            default:
+              /* Types that cannot be converted to a string */
+              /* raise RANGE_ERROR in sqlColumnStri().      */
+              stri = sqlColumnStri(sqlStatement, (intType) column + 1);
+              if (unlikely(stri == NULL)) {
+                /* An exception has already been raised. */
+                raised = TRUE;
+              } else {
+                err_info = bulkStoreStri(bulk, column, stri);
+              } /* if */
+              break;
+          } /* switch */
+        } /* if */
+      } /* for */
+      if (likely(err_info == OKAY_NO_ERROR && !raised)) {
+        bulk->row_count++;
+      } /* if */
+    } /* while */
+    if (unlikely(err_info != OKAY_NO_ERROR)) {
+      raise_error(err_info);
+    } /* if */
+    logFunction(printf("sqlFetchBlock --> " FMT_U_MEM "\n", bulk->row_count););
+    return (intType) bulk->row_count;
+  } /* sqlFetchBlock */
+
+
+
 static boolType sqlGetAutoCommit (databaseType database)
 
   {
@@ -3464,6 +3900,7 @@ static sqlStmtType sqlPrepare (databaseType database,
       err_info = DATABASE_ERROR;
       preparedStmt = NULL;
     } else {
+      finishStream(db);
       statementStri = processStatementStri(sqlStatementStri, &err_info);
       if (statementStri == NULL) {
         preparedStmt = NULL;
@@ -3548,6 +3985,7 @@ static void sqlRollback (databaseType database)
       logError(printf("sqlRollback: Database is not open.\n"););
       raise_error(DATABASE_ERROR);
     } else if (!db->autoCommit) {
+      finishStream(db);
       err_info = doExecSql(db->connection, "ROLLBACK", err_info);
       err_info = doExecSql(db->connection, "BEGIN TRANSACTION", err_info);
       if (unlikely(err_info != OKAY_NO_ERROR)) {
@@ -3575,6 +4013,7 @@ static void sqlSetAutoCommit (databaseType database, boolType autoCommit)
       raise_error(DATABASE_ERROR);
     } else {
       if (db->autoCommit != autoCommit) {
+        finishStream(db);
         if (autoCommit) {
           err_info = doExecSql(db->connection, "COMMIT", err_info);
         } else {
@@ -3592,6 +4031,26 @@ static void sqlSetAutoCommit (databaseType database, boolType autoCommit)
 
 
 
+/**
+ *  Switch between buffered and streamed results of sqlStatement.
+ *  A streamed statement is sent with PQsendQueryPrepared() and the
+ *  result rows are read one by one in single row mode.
+ */
+static void sqlSetStreaming (sqlStmtType sqlStatement, boolType streaming)
+
+  {
+    preparedStmtType preparedStmt;
+
+  /* sqlSetStreaming */
+    logFunction(printf("sqlSetStreaming(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) sqlStatement, streaming););
+    preparedStmt = (preparedStmtType) sqlStatement;
+    preparedStmt->streaming = streaming;
+    logFunction(printf("sqlSetStreaming -->\n"););
+  } /* sqlSetStreaming */
+
+
+
 static intType sqlStmtColumnCount (sqlStmtType sqlStatement)
 
   {
@@ -3666,6 +4125,7 @@ static boolType setupFuncTable (void)
         memset(sqlFunc, 0, sizeof(sqlFuncRecord));
         sqlFunc->freeDatabase       = &freeDatabase;
         sqlFunc->freePreparedStmt   = &freePreparedStmt;
+        sqlFunc->sqlBindArray       = &sqlBindArray;
         sqlFunc->sqlBindBigInt      = &sqlBindBigInt;
         sqlFunc->sqlBindBigRat      = &sqlBindBigRat;
         sqlFunc->sqlBindBool        = &sqlBindBool;
@@ -3679,6 +4139,7 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlClose           = &sqlClose;
         sqlFunc->sqlColumnBigInt    = &sqlColumnBigInt;
         sqlFunc->sqlColumnBigRat    = &sqlColumnBigRat;
+        sqlFunc->sqlColumnBlock     = &sqlColumnBlock;
         sqlFunc->sqlColumnBool      = &sqlColumnBool;
         sqlFunc->sqlColumnBStri     = &sqlColumnBStri;
         sqlFunc->sqlColumnDuration  = &sqlColumnDuration;
@@ -3688,12 +4149,15 @@ static boolType setupFuncTable (void)
         sqlFunc->sqlColumnTime      = &sqlColumnTime;
         sqlFunc->sqlCommit          = &sqlCommit;
         sqlFunc->sqlExecute         = &sqlExecute;
+        sqlFunc->sqlExecuteBatch    = &sqlExecuteBatch;
         sqlFunc->sqlFetch           = &sqlFetch;
+        sqlFunc->sqlFetchBlock      = &sqlFetchBlock;
         sqlFunc->sqlGetAutoCommit   = &sqlGetAutoCommit;
         sqlFunc->sqlIsNull          = &sqlIsNull;
         sqlFunc->sqlPrepare         = &sqlPrepare;
         sqlFunc->sqlRollback        = &sqlRollback;
         sqlFunc->sqlSetAutoCommit   = &sqlSetAutoCommit;
+        sqlFunc->sqlSetStreaming    = &sqlSetStreaming;
         sqlFunc->sqlStmtColumnCount = &sqlStmtColumnCount;
         sqlFunc->sqlStmtColumnName  = &sqlStmtColumnName;
       } /* if */
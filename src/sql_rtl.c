@@ -36,6 +36,7 @@
 
 #include "stdlib.h"
 #include "stdio.h"
+#include "string.h"
 #include "math.h"
 #include "float.h"
 #include "time.h"
@@ -43,6 +44,7 @@
 #include "common.h"
 #include "data_rtl.h"
 #include "striutl.h"
+#include "heaputl.h"
 #include "flt_rtl.h"
 #include "tim_rtl.h"
 #include "big_drv.h"
@@ -65,6 +67,7 @@ typedef struct dbStruct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
   } dbRecord, *dbType;
 
 typedef struct preparedStmtStruct {
@@ -73,6 +76,223 @@ typedef struct preparedStmtStruct {
     sqlFuncType  sqlFunc;
   } preparedStmtRecord, *preparedStmtType;
 
+typedef struct {
+    striType     sqlStatementStri;
+    sqlStmtType  sqlStatement;
+    uintType     lastUse;
+  } stmtCacheEntryRecord, *stmtCacheEntryType;
+
+/* The cache keeps one reference to each cached statement. A cached */
+/* statement with a usage_count of 1 is idle and can be handed out. */
+typedef struct stmtCacheStruct {
+    memSizeType        capacity;
+    memSizeType        size;
+    uintType           useCounter;
+    intType            hits;
+    intType            misses;
+    stmtCacheEntryType entries;
+  } stmtCacheRecord;
+
+
+
+static void freeStmtCache (dbType db)
+
+  {
+    stmtCacheType cache;
+    memSizeType pos;
+
+  /* freeStmtCache */
+    logFunction(printf("freeStmtCache(" FMT_U_MEM ")\n",
+                       (memSizeType) db););
+    cache = db->stmtCache;
+    if (cache != NULL) {
+      /* Releasing the statements might free db. */
+      db->stmtCache = NULL;
+      for (pos = 0; pos < cache->size; pos++) {
+        FREE_STRI(cache->entries[pos].sqlStatementStri);
+        sqlDestrStmt(cache->entries[pos].sqlStatement);
+      } /* for */
+      FREE_TABLE(cache->entries, stmtCacheEntryRecord, cache->capacity);
+      FREE_TABLE(cache, stmtCacheRecord, 1);
+    } /* if */
+    logFunction(printf("freeStmtCache -->\n"););
+  } /* freeStmtCache */
+
+
+
+/**
+ *  Free the statement cache of db, if only cached statements refer to db.
+ *  Every statement holds a reference to its database. If all references
+ *  to db come from cached statements db is not reachable anymore.
+ *  @return TRUE if the cache has been freed (db might be freed as well).
+ */
+static boolType releaseUnreachableCache (dbType db)
+
+  {
+    boolType released;
+
+  /* releaseUnreachableCache */
+    released = db->stmtCache != NULL && db->usage_count == db->stmtCache->size;
+    if (released) {
+      freeStmtCache(db);
+    } /* if */
+    return released;
+  } /* releaseUnreachableCache */
+
+
+
+/**
+ *  Prepare a statement with the help of the statement cache of db.
+ *  An idle cached statement with the same SQL text is reused. Otherwise
+ *  the statement is prepared by the driver and added to the cache. If
+ *  the cache is full the least recently used idle statement is evicted.
+ *  A statement, which is in use, is never handed out twice.
+ */
+static sqlStmtType prepareCached (dbType db,
+    const const_striType sqlStatementStri)
+
+  {
+    stmtCacheType cache;
+    stmtCacheEntryType entry = NULL;
+    stmtCacheEntryType victim;
+    memSizeType pos;
+    striType statementStri;
+    sqlStmtType sqlStatement;
+
+  /* prepareCached */
+    cache = db->stmtCache;
+    cache->useCounter++;
+    for (pos = 0; pos < cache->size && entry == NULL; pos++) {
+      if (cache->entries[pos].sqlStatementStri->size == sqlStatementStri->size &&
+          memcmp(cache->entries[pos].sqlStatementStri->mem, sqlStatementStri->mem,
+                 sqlStatementStri->size * sizeof(strElemType)) == 0) {
+        entry = &cache->entries[pos];
+      } /* if */
+    } /* for */
+    if (entry != NULL && entry->sqlStatement->usage_count == 1) {
+      cache->hits++;
+      entry->lastUse = cache->useCounter;
+      sqlStatement = entry->sqlStatement;
+      sqlStatement->usage_count++;
+      if (db->sqlFunc->sqlSetStreaming != NULL) {
+        db->sqlFunc->sqlSetStreaming(sqlStatement, FALSE);
+      } /* if */
+    } else {
+      cache->misses++;
+      sqlStatement = db->sqlFunc->sqlPrepare((databaseType) db, sqlStatementStri);
+      /* A statement that is in use keeps its cache entry. */
+      if (sqlStatement != NULL && entry == NULL) {
+        if (cache->size < cache->capacity) {
+          entry = &cache->entries[cache->size];
+        } else {
+          victim = NULL;
+          for (pos = 0; pos < cache->size; pos++) {
+            if (cache->entries[pos].sqlStatement->usage_count == 1 &&
+                (victim == NULL ||
+                 cache->entries[pos].lastUse < victim->lastUse)) {
+              victim = &cache->entries[pos];
+            } /* if */
+          } /* for */
+          if (victim != NULL) {
+            FREE_STRI(victim->sqlStatementStri);
+            sqlDestrStmt(victim->sqlStatement);
+            /* Move the last entry into the gap. */
+            cache->size--;
+            *victim = cache->entries[cache->size];
+            entry = &cache->entries[cache->size];
+          } /* if */
+        } /* if */
+        if (entry != NULL &&
+            ALLOC_STRI_SIZE_OK(statementStri, sqlStatementStri->size)) {
+          statementStri->size = sqlStatementStri->size;
+          memcpy(statementStri->mem, sqlStatementStri->mem,
+                 sqlStatementStri->size * sizeof(strElemType));
+          entry->sqlStatementStri = statementStri;
+          entry->sqlStatement = sqlStatement;
+          entry->lastUse = cache->useCounter;
+          sqlStatement->usage_count++;
+          cache->size++;
+        } /* if */
+      } /* if */
+    } /* if */
+    return sqlStatement;
+  } /* prepareCached */
+
+
+
+static void bindArray (sqlStmtType sqlStatement, intType pos, int kind,
+    const const_rtlArrayType values, const char *funcName)
+
+  { /* bindArray */
+    logFunction(printf("%s(" FMT_U_MEM ", " FMT_D ", arr)\n",
+                       funcName, (memSizeType) sqlStatement, pos););
+    if (unlikely(sqlStatement == NULL)) {
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D ", arr): "
+                      "SQL statement is empty.\n",
+                      funcName, (memSizeType) sqlStatement, pos););
+      raise_error(RANGE_ERROR);
+    } else if (unlikely(sqlStatement->db == NULL ||
+                        !sqlStatement->db->isOpen)) {
+      dbNotOpen(funcName);
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D ", arr): "
+                      "Database is not open.\n",
+                      funcName, (memSizeType) sqlStatement, pos););
+      raise_error(DATABASE_ERROR);
+    } else if (unlikely(((preparedStmtType) sqlStatement)->sqlFunc == NULL ||
+                        ((preparedStmtType) sqlStatement)->sqlFunc->sqlBindArray == NULL)) {
+      dbNoFuncPtr(funcName);
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D ", arr): "
+                      "Function pointer missing.\n",
+                      funcName, (memSizeType) sqlStatement, pos););
+      raise_error(DATABASE_ERROR);
+    } else {
+      ((preparedStmtType) sqlStatement)->sqlFunc->sqlBindArray(sqlStatement,
+          pos, kind, values);
+    } /* if */
+  } /* bindArray */
+
+
+
+static rtlArrayType columnBlock (sqlStmtType sqlStatement, intType column,
+    int kind, const char *funcName)
+
+  {
+    rtlArrayType columnValues;
+
+  /* columnBlock */
+    logFunction(printf("%s(" FMT_U_MEM ", " FMT_D ")\n",
+                       funcName, (memSizeType) sqlStatement, column););
+    if (unlikely(sqlStatement == NULL)) {
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D "): "
+                      "SQL statement is empty.\n",
+                      funcName, (memSizeType) sqlStatement, column););
+      raise_error(RANGE_ERROR);
+      columnValues = NULL;
+    } else if (unlikely(sqlStatement->db == NULL ||
+                        !sqlStatement->db->isOpen)) {
+      dbNotOpen(funcName);
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D "): "
+                      "Database is not open.\n",
+                      funcName, (memSizeType) sqlStatement, column););
+      raise_error(DATABASE_ERROR);
+      columnValues = NULL;
+    } else if (unlikely(((preparedStmtType) sqlStatement)->sqlFunc == NULL ||
+                        ((preparedStmtType) sqlStatement)->sqlFunc->sqlColumnBlock == NULL)) {
+      dbNoFuncPtr(funcName);
+      logError(printf("%s(" FMT_U_MEM ", " FMT_D "): "
+                      "Function pointer missing.\n",
+                      funcName, (memSizeType) sqlStatement, column););
+      raise_error(DATABASE_ERROR);
+      columnValues = NULL;
+    } else {
+      columnValues = ((preparedStmtType) sqlStatement)->sqlFunc->sqlColumnBlock(
+          sqlStatement, column, kind);
+    } /* if */
+    logFunction(printf("%s --> " FMT_U_MEM "\n",
+                       funcName, (memSizeType) columnValues););
+    return columnValues;
+  } /* columnBlock */
+
 
 
 /**
@@ -385,6 +605,27 @@ void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value)
 
 
 
+/**
+ *  Bind an array of floats to the parameter 'pos' of a statement.
+ *  The array is used by sqlExecuteBatch, which executes the statement
+ *  once for every element. The elements are copied, such that
+ *  'values' can be changed afterwards.
+ *  @param sqlStatement Prepared statement.
+ *  @param pos Position of the bind variable (starting with 1).
+ *  @param values Values for the batch execution.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if 'pos' is negative or too big.
+ *  @exception DATABASE_ERROR If the driver does not support batches.
+ */
+void sqlBindFloatArray (sqlStmtType sqlStatement, intType pos,
+    const const_rtlArrayType values)
+
+  { /* sqlBindFloatArray */
+    bindArray(sqlStatement, pos, BULK_FLOAT, values, "sqlBindFloatArray");
+  } /* sqlBindFloatArray */
+
+
+
 /**
  *  Bind an integer parameter to a prepared SQL statement.
  *  @param sqlStatement Prepared statement.
@@ -426,6 +667,27 @@ void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value)
 
 
 
+/**
+ *  Bind an array of integers to the parameter 'pos' of a statement.
+ *  The array is used by sqlExecuteBatch, which executes the statement
+ *  once for every element. The elements are copied, such that
+ *  'values' can be changed afterwards.
+ *  @param sqlStatement Prepared statement.
+ *  @param pos Position of the bind variable (starting with 1).
+ *  @param values Values for the batch execution.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if 'pos' is negative or too big.
+ *  @exception DATABASE_ERROR If the driver does not support batches.
+ */
+void sqlBindIntArray (sqlStmtType sqlStatement, intType pos,
+    const const_rtlArrayType values)
+
+  { /* sqlBindIntArray */
+    bindArray(sqlStatement, pos, BULK_INT, values, "sqlBindIntArray");
+  } /* sqlBindIntArray */
+
+
+
 /**
  *  Bind a NULL parameter to a prepared SQL statement.
  *  @param sqlStatement Prepared statement.
@@ -511,6 +773,27 @@ void sqlBindStri (sqlStmtType sqlStatement, intType pos,
 
 
 
+/**
+ *  Bind an array of strings to the parameter 'pos' of a statement.
+ *  The array is used by sqlExecuteBatch, which executes the statement
+ *  once for every element. The elements are copied, such that
+ *  'values' can be changed afterwards.
+ *  @param sqlStatement Prepared statement.
+ *  @param pos Position of the bind variable (starting with 1).
+ *  @param values Values for the batch execution.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if 'pos' is negative or too big.
+ *  @exception DATABASE_ERROR If the driver does not support batches.
+ */
+void sqlBindStriArray (sqlStmtType sqlStatement, intType pos,
+    const const_rtlArrayType values)
+
+  { /* sqlBindStriArray */
+    bindArray(sqlStatement, pos, BULK_STRI, values, "sqlBindStriArray");
+  } /* sqlBindStriArray */
+
+
+
 /**
  *  Bind a time parameter to a prepared SQL statement.
  *  @param sqlStatement Prepared statement.
@@ -621,6 +904,7 @@ void sqlClose (databaseType database)
                       (memSizeType) database););
       raise_error(DATABASE_ERROR);
     } else {
+      freeStmtCache((dbType) database);
       ((dbType) database)->sqlFunc->sqlClose(database);
     } /* if */
     logFunction(printf("sqlClose -->\n"););
@@ -963,6 +1247,26 @@ floatType sqlColumnFloat (sqlStmtType sqlStatement, intType column)
 
 
 
+/**
+ *  Get the floats of 'column' for all rows of the fetched block.
+ *  The block must have been fetched with sqlFetchBlock before.
+ *  NULL values are returned as 0.0.
+ *  @param sqlStatement Prepared statement for which a block was fetched.
+ *  @param column Number of the column (starting with 1).
+ *  @return an array with one element per fetched row.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if the specified column does not exist or
+ *                         if the column cannot be converted.
+ *  @exception DATABASE_ERROR If the driver does not support blocks.
+ */
+rtlArrayType sqlColumnFloatBlock (sqlStmtType sqlStatement, intType column)
+
+  { /* sqlColumnFloatBlock */
+    return columnBlock(sqlStatement, column, BULK_FLOAT, "sqlColumnFloatBlock");
+  } /* sqlColumnFloatBlock */
+
+
+
 /**
  *  Get the specified column of fetched data as integer.
  *  If the column data is NULL it is interpreted as 0.
@@ -1017,6 +1321,26 @@ intType sqlColumnInt (sqlStmtType sqlStatement, intType column)
 
 
 
+/**
+ *  Get the integers of 'column' for all rows of the fetched block.
+ *  The block must have been fetched with sqlFetchBlock before.
+ *  NULL values are returned as 0.
+ *  @param sqlStatement Prepared statement for which a block was fetched.
+ *  @param column Number of the column (starting with 1).
+ *  @return an array with one element per fetched row.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if the specified column does not exist or
+ *                         if the column cannot be converted.
+ *  @exception DATABASE_ERROR If the driver does not support blocks.
+ */
+rtlArrayType sqlColumnIntBlock (sqlStmtType sqlStatement, intType column)
+
+  { /* sqlColumnIntBlock */
+    return columnBlock(sqlStatement, column, BULK_INT, "sqlColumnIntBlock");
+  } /* sqlColumnIntBlock */
+
+
+
 /**
  *  Get the specified column of fetched data as string.
  *  If the column data is NULL it is interpreted as "".
@@ -1071,6 +1395,26 @@ striType sqlColumnStri (sqlStmtType sqlStatement, intType column)
 
 
 
+/**
+ *  Get the strings of 'column' for all rows of the fetched block.
+ *  The block must have been fetched with sqlFetchBlock before.
+ *  NULL values are returned as "".
+ *  @param sqlStatement Prepared statement for which a block was fetched.
+ *  @param column Number of the column (starting with 1).
+ *  @return an array with one element per fetched row.
+ *  @exception RANGE_ERROR If the statement was not prepared or
+ *                         if the specified column does not exist or
+ *                         if the column cannot be converted.
+ *  @exception DATABASE_ERROR If the driver does not support blocks.
+ */
+rtlArrayType sqlColumnStriBlock (sqlStmtType sqlStatement, intType column)
+
+  { /* sqlColumnStriBlock */
+    return columnBlock(sqlStatement, column, BULK_STRI, "sqlColumnStriBlock");
+  } /* sqlColumnStriBlock */
+
+
+
 /**
  *  Get the specified column of fetched data as time.
  *  If the column data is NULL it is interpreted as 0-01-01 00:00:00.
@@ -1192,6 +1536,8 @@ void sqlCpyDb (databaseType *const dest, const databaseType source)
           db_dest->sqlFunc->freeDatabase != NULL) {
         logMessage(printf("FREE " FMT_U_MEM "\n", (memSizeType) db_dest););
         db_dest->sqlFunc->freeDatabase((databaseType) db_dest);
+      } else {
+        (void) releaseUnreachableCache(db_dest);
       } /* if */
     } /* if */
     *dest = (databaseType) db_source;
@@ -1250,6 +1596,9 @@ void sqlCpyStmt (sqlStmtType *const dest, const sqlStmtType source)
           statement_dest->sqlFunc->freePreparedStmt != NULL) {
         logMessage(printf("FREE " FMT_U_MEM "\n", (memSizeType) statement_dest););
         statement_dest->sqlFunc->freePreparedStmt((sqlStmtType) statement_dest);
+      } else if (statement_dest->usage_count == 1 &&
+                 statement_dest->db != NULL) {
+        (void) releaseUnreachableCache(statement_dest->db);
       } /* if */
     } /* if */
     *dest = (sqlStmtType) statement_source;
@@ -1404,6 +1753,8 @@ void sqlDestrDb (const databaseType old_db)
         logMessage(printf("FREE " FMT_U_MEM "\n", (memSizeType) old_database););
         old_database->sqlFunc->freeDatabase((databaseType) old_database);
         old_database = NULL;
+      } else if (releaseUnreachableCache(old_database)) {
+        old_database = NULL;
       } /* if */
     } /* if */
     logFunction(printf("sqlDestrDb(" FMT_U_MEM " (usage=" FMT_U ")) -->\n",
@@ -1450,6 +1801,10 @@ void sqlDestrStmt (const sqlStmtType old_stmt)
         logMessage(printf("FREE " FMT_U_MEM "\n", (memSizeType) old_statement););
         old_statement->sqlFunc->freePreparedStmt((sqlStmtType) old_statement);
         old_statement = NULL;
+      } else if (old_statement->usage_count == 1 &&
+                 old_statement->db != NULL &&
+                 releaseUnreachableCache(old_statement->db)) {
+        old_statement = NULL;
       } /* if */
     } /* if */
     logFunction(printf("sqlDestrStmt(" FMT_U_MEM " (usage=" FMT_U ")) -->\n",
@@ -1578,6 +1933,38 @@ void sqlExecute (sqlStmtType sqlStatement)
 
 
 
+/**
+ *  Execute the specified prepared SQL statement once for every
+ *  element of the arrays bound with the sqlBind...Array functions.
+ *  All parameters must be bound to arrays of the same length.
+ *  In auto-commit mode the whole batch is executed as one transaction.
+ *  @param sqlStatement Prepared statement, which should be executed.
+ *  @exception DATABASE_ERROR If a database function fails or
+ *                            if the bound arrays are missing or differ
+ *                            in length.
+ */
+void sqlExecuteBatch (sqlStmtType sqlStatement)
+
+  { /* sqlExecuteBatch */
+    logFunction(printf("sqlExecuteBatch(" FMT_U_MEM ")\n",
+                       (memSizeType) sqlStatement););
+    if (sqlStatement == NULL) {
+      /* Do nothing */
+    } else if (unlikely(((preparedStmtType) sqlStatement)->sqlFunc == NULL ||
+                        ((preparedStmtType) sqlStatement)->sqlFunc->sqlExecuteBatch == NULL)) {
+      dbNoFuncPtr("sqlExecuteBatch");
+      logError(printf("sqlExecuteBatch(" FMT_U_MEM "): "
+                      "Function pointer missing.\n",
+                      (memSizeType) sqlStatement););
+      raise_error(DATABASE_ERROR);
+    } else {
+      ((preparedStmtType) sqlStatement)->sqlFunc->sqlExecuteBatch(sqlStatement);
+    } /* if */
+    logFunction(printf("sqlExecuteBatch -->\n"););
+  } /* sqlExecuteBatch */
+
+
+
 /**
  *  Fetch a row from the result data of an executed 'sqlStatement'.
  *  After the 'sqlStatement' has been executed successfully the
@@ -1616,6 +2003,53 @@ boolType sqlFetch (sqlStmtType sqlStatement)
 
 
 
+/**
+ *  Fetch a block of up to 'maxRows' rows from the result data of an
+ *  executed 'sqlStatement'. The columns of the block can be obtained
+ *  with the sqlColumn...Block functions. This avoids a function call
+ *  per row and column.
+ *  @param sqlStatement Prepared statement, which has been executed.
+ *  @param maxRows Maximum number of rows to fetch.
+ *  @return the number of fetched rows, and
+ *          0 if no more result data is available.
+ *  @exception RANGE_ERROR If 'maxRows' is negative or if a column
+ *                         has a type that is not supported in blocks.
+ *  @exception DATABASE_ERROR If a database function fails.
+ */
+intType sqlFetchBlock (sqlStmtType sqlStatement, intType maxRows)
+
+  {
+    intType rowCount;
+
+  /* sqlFetchBlock */
+    logFunction(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) sqlStatement, maxRows););
+    if (sqlStatement == NULL) {
+      rowCount = 0;
+    } else if (unlikely(maxRows < 0)) {
+      logError(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D "): "
+                      "Negative maxRows.\n",
+                      (memSizeType) sqlStatement, maxRows););
+      raise_error(RANGE_ERROR);
+      rowCount = 0;
+    } else if (unlikely(((preparedStmtType) sqlStatement)->sqlFunc == NULL ||
+                        ((preparedStmtType) sqlStatement)->sqlFunc->sqlFetchBlock == NULL)) {
+      dbNoFuncPtr("sqlFetchBlock");
+      logError(printf("sqlFetchBlock(" FMT_U_MEM ", " FMT_D "): "
+                      "Function pointer missing.\n",
+                      (memSizeType) sqlStatement, maxRows););
+      raise_error(DATABASE_ERROR);
+      rowCount = 0;
+    } else {
+      rowCount = ((preparedStmtType) sqlStatement)->sqlFunc->sqlFetchBlock(
+          sqlStatement, maxRows);
+    } /* if */
+    logFunction(printf("sqlFetchBlock --> " FMT_D "\n", rowCount););
+    return rowCount;
+  } /* sqlFetchBlock */
+
+
+
 /**
  *  Get the current auto-commit mode for the specified database 'database'.
  */
@@ -1749,6 +2183,8 @@ sqlStmtType sqlPrepare (databaseType database,
                       striAsUnquotedCStri(sqlStatementStri)););
       raise_error(DATABASE_ERROR);
       preparedStmt = NULL;
+    } else if (((dbType) database)->stmtCache != NULL) {
+      preparedStmt = prepareCached((dbType) database, sqlStatementStri);
     } else {
       preparedStmt = ((dbType) database)->sqlFunc->sqlPrepare(database, sqlStatementStri);
     } /* if */
@@ -1827,6 +2263,157 @@ void sqlSetAutoCommit (databaseType database, boolType autoCommit)
 
 
 
+/**
+ *  Set the capacity of the prepared statement cache of 'database'.
+ *  With a cache sqlPrepare reuses an idle statement with the same
+ *  SQL text instead of preparing it again. A statement is idle if it
+ *  is referred only by the cache. If the cache is full the least
+ *  recently used idle statement is closed. Setting a capacity
+ *  replaces the old cache and resets the hit and miss counters.
+ *  @param capacity Maximum number of cached statements.
+ *                  The capacity 0 switches the cache off.
+ *  @exception RANGE_ERROR If 'capacity' is negative.
+ *  @exception MEMORY_ERROR Not enough memory to create the cache.
+ */
+void sqlSetStmtCache (databaseType database, intType capacity)
+
+  {
+    dbType db;
+    stmtCacheType cache;
+
+  /* sqlSetStmtCache */
+    logFunction(printf("sqlSetStmtCache(" FMT_U_MEM ", " FMT_D ")\n",
+                       (memSizeType) database, capacity););
+    db = (dbType) database;
+    if (unlikely(database == NULL || capacity < 0)) {
+      logError(printf("sqlSetStmtCache(" FMT_U_MEM ", " FMT_D "): "
+                      "Database is empty or capacity is negative.\n",
+                      (memSizeType) database, capacity););
+      raise_error(RANGE_ERROR);
+    } else if (unlikely((uintType) capacity >
+                        MAX_MEMSIZETYPE / sizeof(stmtCacheEntryRecord))) {
+      raise_error(MEMORY_ERROR);
+    } else if (unlikely(!database->isOpen)) {
+      dbNotOpen("sqlSetStmtCache");
+      logError(printf("sqlSetStmtCache(" FMT_U_MEM ", " FMT_D "): "
+                      "Database is not open.\n",
+                      (memSizeType) database, capacity););
+      raise_error(DATABASE_ERROR);
+    } else {
+      freeStmtCache(db);
+      if (capacity != 0) {
+        if (unlikely(!ALLOC_TABLE(cache, stmtCacheRecord, 1))) {
+          raise_error(MEMORY_ERROR);
+        } else if (unlikely(!ALLOC_TABLE(cache->entries, stmtCacheEntryRecord,
+                                         (memSizeType) capacity))) {
+          FREE_TABLE(cache, stmtCacheRecord, 1);
+          raise_error(MEMORY_ERROR);
+        } else {
+          cache->capacity = (memSizeType) capacity;
+          cache->size = 0;
+          cache->useCounter = 0;
+          cache->hits = 0;
+          cache->misses = 0;
+          db->stmtCache = cache;
+        } /* if */
+      } /* if */
+    } /* if */
+    logFunction(printf("sqlSetStmtCache -->\n"););
+  } /* sqlSetStmtCache */
+
+
+
+/**
+ *  Determine if the result of 'sqlStatement' is streamed.
+ *  By default the complete result of a query is transferred to
+ *  the client when the statement is executed. A streamed statement
+ *  transfers the result rows while they are fetched. This keeps
+ *  the memory usage low when a large result is processed row by
+ *  row. Before another statement uses the same database connection
+ *  the rows of a stream, which have not been fetched, are discarded.
+ *  Drivers, which always fetch the rows incrementally, ignore this
+ *  setting.
+ *  @param sqlStatement Prepared statement.
+ *  @param streaming TRUE if the result should be streamed,
+ *                   FALSE if the result should be buffered.
+ */
+void sqlSetStreaming (sqlStmtType sqlStatement, boolType streaming)
+
+  { /* sqlSetStreaming */
+    logFunction(printf("sqlSetStreaming(" FMT_U_MEM ", %d)\n",
+                       (memSizeType) sqlStatement, streaming););
+    if (unlikely(sqlStatement == NULL)) {
+      logError(printf("sqlSetStreaming(" FMT_U_MEM ", %d): "
+                      "SQL statement is empty.\n",
+                      (memSizeType) sqlStatement, streaming););
+      raise_error(RANGE_ERROR);
+    } else if (((preparedStmtType) sqlStatement)->sqlFunc != NULL &&
+               ((preparedStmtType) sqlStatement)->sqlFunc->sqlSetStreaming != NULL) {
+      ((preparedStmtType) sqlStatement)->sqlFunc->sqlSetStreaming(sqlStatement,
+                                                                  streaming);
+    } /* if */
+    logFunction(printf("sqlSetStreaming -->\n"););
+  } /* sqlSetStreaming */
+
+
+
+/**
+ *  Number of sqlPrepare calls answered by the statement cache.
+ *  @return the number of cache hits, or 0 if 'database' has no cache.
+ */
+intType sqlStmtCacheHits (databaseType database)
+
+  {
+    intType hits;
+
+  /* sqlStmtCacheHits */
+    if (unlikely(database == NULL)) {
+      logError(printf("sqlStmtCacheHits(" FMT_U_MEM "): "
+                      "Database is empty.\n",
+                      (memSizeType) database););
+      raise_error(RANGE_ERROR);
+      hits = 0;
+    } else if (((dbType) database)->stmtCache == NULL) {
+      hits = 0;
+    } else {
+      hits = ((dbType) database)->stmtCache->hits;
+    } /* if */
+    logFunction(printf("sqlStmtCacheHits(" FMT_U_MEM ") --> " FMT_D "\n",
+                       (memSizeType) database, hits););
+    return hits;
+  } /* sqlStmtCacheHits */
+
+
+
+/**
+ *  Number of sqlPrepare calls, which needed to prepare a statement,
+ *  although the statement cache was switched on.
+ *  @return the number of cache misses, or 0 if 'database' has no cache.
+ */
+intType sqlStmtCacheMisses (databaseType database)
+
+  {
+    intType misses;
+
+  /* sqlStmtCacheMisses */
+    if (unlikely(database == NULL)) {
+      logError(printf("sqlStmtCacheMisses(" FMT_U_MEM "): "
+                      "Database is empty.\n",
+                      (memSizeType) database););
+      raise_error(RANGE_ERROR);
+      misses = 0;
+    } else if (((dbType) database)->stmtCache == NULL) {
+      misses = 0;
+    } else {
+      misses = ((dbType) database)->stmtCache->misses;
+    } /* if */
+    logFunction(printf("sqlStmtCacheMisses(" FMT_U_MEM ") --> " FMT_D "\n",
+                       (memSizeType) database, misses););
+    return misses;
+  } /* sqlStmtCacheMisses */
+
+
+
 /**
  *  Return the number of columns in the result data of a ''statement''.
  *  It is not necessary to ''execute'' the prepared statement, before
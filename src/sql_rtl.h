@@ -41,10 +41,16 @@ void sqlBindDuration (sqlStmtType sqlStatement, intType pos,
                       intType year, intType month, intType day, intType hour,
                       intType minute, intType second, intType micro_second);
 void sqlBindFloat (sqlStmtType sqlStatement, intType pos, floatType value);
+void sqlBindFloatArray (sqlStmtType sqlStatement, intType pos,
+                        const const_rtlArrayType values);
 void sqlBindInt (sqlStmtType sqlStatement, intType pos, intType value);
+void sqlBindIntArray (sqlStmtType sqlStatement, intType pos,
+                      const const_rtlArrayType values);
 void sqlBindNull (sqlStmtType sqlStatement, intType pos);
 void sqlBindStri (sqlStmtType sqlStatement, intType pos,
                   const const_striType stri);
+void sqlBindStriArray (sqlStmtType sqlStatement, intType pos,
+                       const const_rtlArrayType values);
 void sqlBindTime (sqlStmtType sqlStatement, intType pos,
                   intType year, intType month, intType day, intType hour,
                   intType min, intType sec, intType micro_sec,
@@ -59,8 +65,11 @@ void sqlColumnDuration (sqlStmtType sqlStatement, intType column,
                         intType *year, intType *month, intType *day, intType *hour,
                         intType *minute, intType *second, intType *micro_second);
 floatType sqlColumnFloat (sqlStmtType sqlStatement, intType column);
+rtlArrayType sqlColumnFloatBlock (sqlStmtType sqlStatement, intType column);
 intType sqlColumnInt (sqlStmtType sqlStatement, intType column);
+rtlArrayType sqlColumnIntBlock (sqlStmtType sqlStatement, intType column);
 striType sqlColumnStri (sqlStmtType sqlStatement, intType column);
+rtlArrayType sqlColumnStriBlock (sqlStmtType sqlStatement, intType column);
 void sqlColumnTime (sqlStmtType sqlStatement, intType column,
                     intType *year, intType *month, intType *day, intType *hour,
                     intType *minute, intType *second, intType *micro_second,
@@ -79,12 +88,18 @@ striType sqlErrDbFunc (void);
 striType sqlErrLibFunc (void);
 striType sqlErrMessage (void);
 void sqlExecute (sqlStmtType sqlStatement);
+void sqlExecuteBatch (sqlStmtType sqlStatement);
 boolType sqlFetch (sqlStmtType sqlStatement);
+intType sqlFetchBlock (sqlStmtType sqlStatement, intType maxRows);
 boolType sqlGetAutoCommit (databaseType database);
 boolType sqlIsNull (sqlStmtType sqlStatement, intType column);
 sqlStmtType sqlPrepare (databaseType database,
                         const const_striType sqlStatementStri);
 void sqlRollback (databaseType database);
 void sqlSetAutoCommit (databaseType database, boolType autoCommit);
+void sqlSetStmtCache (databaseType database, intType capacity);
+void sqlSetStreaming (sqlStmtType sqlStatement, boolType streaming);
+intType sqlStmtCacheHits (databaseType database);
+intType sqlStmtCacheMisses (databaseType database);
 intType sqlStmtColumnCount (sqlStmtType sqlStatement);
 striType sqlStmtColumnName (sqlStmtType sqlStatement, intType column);
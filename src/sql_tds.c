@@ -70,6 +70,7 @@ typedef struct {
     sqlFuncType  sqlFunc;
     int          driver;
     int          dbCategory;
+    stmtCacheType stmtCache;
     DBPROCESS   *dbproc;
     boolType     autoCommit;
   } dbRecordTds, *dbType;
@@ -30,18 +30,167 @@
 
 #include "version.h"
 
+#include "stdlib.h"
 #include "stdio.h"
 
 #include "common.h"
 #include "data.h"
+#include "data_rtl.h"
+#include "heaputl.h"
 #include "syvarutl.h"
 #include "objutl.h"
 #include "runerr.h"
+#include "str_rtl.h"
 #include "sql_rtl.h"
 #include "sql_drv.h"
 
 
 
+/**
+ *  Create an rtlArrayType with the values of 'anArray'.
+ *  The strings of 'anArray' are not copied. The rtlArrayType must
+ *  be freed with FREE_RTL_ARRAY, before 'anArray' is changed.
+ *  @param category Category of the elements (INTOBJECT, FLOATOBJECT
+ *         or STRIOBJECT).
+ *  @return the new rtlArrayType, or NULL if there is not enough memory.
+ */
+static rtlArrayType toRtlArray (const_arrayType anArray,
+    objectCategory category)
+
+  {
+    memSizeType arraySize;
+    memSizeType pos;
+    rtlArrayType rtlArray;
+
+  /* toRtlArray */
+    arraySize = arraySize(anArray);
+    if (likely(ALLOC_RTL_ARRAY(rtlArray, arraySize))) {
+      rtlArray->min_position = anArray->min_position;
+      rtlArray->max_position = anArray->max_position;
+      for (pos = 0; pos < arraySize; pos++) {
+        switch (category) {
+          case INTOBJECT:
+            rtlArray->arr[pos].value.intValue = anArray->arr[pos].value.intValue;
+            break;
+          case FLOATOBJECT:
+            rtlArray->arr[pos].value.floatValue = anArray->arr[pos].value.floatValue;
+            break;
+          default:
+            rtlArray->arr[pos].value.striValue = anArray->arr[pos].value.striValue;
+            break;
+        } /* switch */
+      } /* for */
+    } /* if */
+    return rtlArray;
+  } /* toRtlArray */
+
+
+
+/**
+ *  Convert an rtlArrayType with column values to an arrayType object.
+ *  The strings in 'aRtlArray' are reused in the created arrayType
+ *  object. The memory of 'aRtlArray' itself is freed.
+ *  @param category Category of the elements (INTOBJECT, FLOATOBJECT
+ *         or STRIOBJECT).
+ *  @return the new created arrayType object.
+ */
+static objectType toBlockArray (rtlArrayType aRtlArray,
+    objectCategory category)
+
+  {
+    memSizeType arraySize;
+    memSizeType pos;
+    arrayType anArray;
+    typeType typeOfElement;
+    objectType result;
+
+  /* toBlockArray */
+    if (aRtlArray == NULL) {
+      /* Assume that an exception was already raised */
+      result = NULL;
+    } else {
+      arraySize = arraySize(aRtlArray);
+      if (unlikely(!ALLOC_ARRAY(anArray, arraySize))) {
+        if (category == STRIOBJECT) {
+          for (pos = 0; pos < arraySize; pos++) {
+            strDestr(aRtlArray->arr[pos].value.striValue);
+          } /* for */
+        } /* if */
+        FREE_RTL_ARRAY(aRtlArray, arraySize);
+        result = raise_exception(SYS_MEM_EXCEPTION);
+      } else {
+        anArray->min_position = aRtlArray->min_position;
+        anArray->max_position = aRtlArray->max_position;
+        if (category == INTOBJECT) {
+          typeOfElement = take_type(SYS_INT_TYPE);
+        } else if (category == FLOATOBJECT) {
+          typeOfElement = take_type(SYS_FLT_TYPE);
+        } else {
+          typeOfElement = take_type(SYS_STRI_TYPE);
+        } /* if */
+        for (pos = 0; pos < arraySize; pos++) {
+          anArray->arr[pos].type_of = typeOfElement;
+          anArray->arr[pos].descriptor.property = NULL;
+          switch (category) {
+            case INTOBJECT:
+              anArray->arr[pos].value.intValue = aRtlArray->arr[pos].value.intValue;
+              break;
+            case FLOATOBJECT:
+              anArray->arr[pos].value.floatValue = aRtlArray->arr[pos].value.floatValue;
+              break;
+            default:
+              anArray->arr[pos].value.striValue = aRtlArray->arr[pos].value.striValue;
+              break;
+          } /* switch */
+          INIT_CATEGORY_OF_VAR(&anArray->arr[pos], category);
+        } /* for */
+        FREE_RTL_ARRAY(aRtlArray, arraySize);
+        result = bld_array_temp(anArray);
+      } /* if */
+    } /* if */
+    return result;
+  } /* toBlockArray */
+
+
+
+/**
+ *  Bind an array of values to a parameter of a prepared statement.
+ *  The values are used by a subsequent sqlExecuteBatch().
+ */
+static objectType bindArray (listType arguments, objectCategory category)
+
+  {
+    rtlArrayType values;
+
+  /* bindArray */
+    isit_sqlstmt(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_array(arg_3(arguments));
+    values = toRtlArray(take_array(arg_3(arguments)), category);
+    if (unlikely(values == NULL)) {
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } else {
+      switch (category) {
+        case INTOBJECT:
+          sqlBindIntArray(take_sqlstmt(arg_1(arguments)),
+                          take_int(arg_2(arguments)), values);
+          break;
+        case FLOATOBJECT:
+          sqlBindFloatArray(take_sqlstmt(arg_1(arguments)),
+                            take_int(arg_2(arguments)), values);
+          break;
+        default:
+          sqlBindStriArray(take_sqlstmt(arg_1(arguments)),
+                           take_int(arg_2(arguments)), values);
+          break;
+      } /* switch */
+      FREE_RTL_ARRAY(values, arraySize(values));
+    } /* if */
+    return SYS_EMPTY_OBJECT;
+  } /* bindArray */
+
+
+
 objectType sql_bind_bigint (listType arguments)
 
   { /* sql_bind_bigint */
@@ -152,6 +301,14 @@ objectType sql_bind_float (listType arguments)
 
 
 
+objectType sql_bind_float_array (listType arguments)
+
+  { /* sql_bind_float_array */
+    return bindArray(arguments, FLOATOBJECT);
+  } /* sql_bind_float_array */
+
+
+
 objectType sql_bind_int (listType arguments)
 
   { /* sql_bind_int */
@@ -166,6 +323,14 @@ objectType sql_bind_int (listType arguments)
 
 
 
+objectType sql_bind_int_array (listType arguments)
+
+  { /* sql_bind_int_array */
+    return bindArray(arguments, INTOBJECT);
+  } /* sql_bind_int_array */
+
+
+
 objectType sql_bind_null (listType arguments)
 
   { /* sql_bind_null */
@@ -192,6 +357,14 @@ objectType sql_bind_stri (listType arguments)
 
 
 
+objectType sql_bind_stri_array (listType arguments)
+
+  { /* sql_bind_stri_array */
+    return bindArray(arguments, STRIOBJECT);
+  } /* sql_bind_stri_array */
+
+
+
 objectType sql_bind_time (listType arguments)
 
   { /* sql_bind_time */
@@ -392,6 +565,18 @@ objectType sql_column_float (listType arguments)
 
 
 
+objectType sql_column_float_block (listType arguments)
+
+  { /* sql_column_float_block */
+    isit_sqlstmt(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    return toBlockArray(sqlColumnFloatBlock(take_sqlstmt(arg_1(arguments)),
+                                            take_int(arg_2(arguments))),
+                        FLOATOBJECT);
+  } /* sql_column_float_block */
+
+
+
 objectType sql_column_int (listType arguments)
 
   {
@@ -407,6 +592,18 @@ objectType sql_column_int (listType arguments)
 
 
 
+objectType sql_column_int_block (listType arguments)
+
+  { /* sql_column_int_block */
+    isit_sqlstmt(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    return toBlockArray(sqlColumnIntBlock(take_sqlstmt(arg_1(arguments)),
+                                          take_int(arg_2(arguments))),
+                        INTOBJECT);
+  } /* sql_column_int_block */
+
+
+
 objectType sql_column_stri (listType arguments)
 
   {
@@ -422,6 +619,18 @@ objectType sql_column_stri (listType arguments)
 
 
 
+objectType sql_column_stri_block (listType arguments)
+
+  { /* sql_column_stri_block */
+    isit_sqlstmt(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    return toBlockArray(sqlColumnStriBlock(take_sqlstmt(arg_1(arguments)),
+                                           take_int(arg_2(arguments))),
+                        STRIOBJECT);
+  } /* sql_column_stri_block */
+
+
+
 objectType sql_column_time (listType arguments)
 
   {
@@ -678,6 +887,16 @@ objectType sql_execute (listType arguments)
 
 
 
+objectType sql_execute_batch (listType arguments)
+
+  { /* sql_execute_batch */
+    isit_sqlstmt(arg_1(arguments));
+    sqlExecuteBatch(take_sqlstmt(arg_1(arguments)));
+    return SYS_EMPTY_OBJECT;
+  } /* sql_execute_batch */
+
+
+
 objectType sql_fetch (listType arguments)
 
   {
@@ -698,6 +917,18 @@ objectType sql_fetch (listType arguments)
 /**
  *  Get the current auto-commit mode for database/arg_1.
  */
+objectType sql_fetch_block (listType arguments)
+
+  { /* sql_fetch_block */
+    isit_sqlstmt(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    return bld_int_temp(
+        sqlFetchBlock(take_sqlstmt(arg_1(arguments)),
+                      take_int(arg_2(arguments))));
+  } /* sql_fetch_block */
+
+
+
 objectType sql_get_auto_commit (listType arguments)
 
   {
@@ -1015,6 +1246,54 @@ objectType sql_set_auto_commit (listType arguments)
 
 
 
+/**
+ *  Set the capacity of the prepared statement cache of database/arg_1.
+ */
+objectType sql_set_stmt_cache (listType arguments)
+
+  { /* sql_set_stmt_cache */
+    isit_database(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    sqlSetStmtCache(take_database(arg_1(arguments)),
+                    take_int(arg_2(arguments)));
+    return SYS_EMPTY_OBJECT;
+  } /* sql_set_stmt_cache */
+
+
+
+/**
+ *  Determine if the result of sqlStatement/arg_1 is streamed.
+ */
+objectType sql_set_streaming (listType arguments)
+
+  { /* sql_set_streaming */
+    isit_sqlstmt(arg_1(arguments));
+    isit_bool(arg_2(arguments));
+    sqlSetStreaming(take_sqlstmt(arg_1(arguments)),
+                    take_bool(arg_2(arguments)) == SYS_TRUE_OBJECT);
+    return SYS_EMPTY_OBJECT;
+  } /* sql_set_streaming */
+
+
+
+objectType sql_stmt_cache_hits (listType arguments)
+
+  { /* sql_stmt_cache_hits */
+    isit_database(arg_1(arguments));
+    return bld_int_temp(sqlStmtCacheHits(take_database(arg_1(arguments))));
+  } /* sql_stmt_cache_hits */
+
+
+
+objectType sql_stmt_cache_misses (listType arguments)
+
+  { /* sql_stmt_cache_misses */
+    isit_database(arg_1(arguments));
+    return bld_int_temp(sqlStmtCacheMisses(take_database(arg_1(arguments))));
+  } /* sql_stmt_cache_misses */
+
+
+
 objectType sql_stmt_column_count (listType arguments)
 
   {
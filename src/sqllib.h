@@ -31,9 +31,12 @@ objectType sql_bind_bool         (listType arguments);
 objectType sql_bind_bstri        (listType arguments);
 objectType sql_bind_duration     (listType arguments);
 objectType sql_bind_float        (listType arguments);
+objectType sql_bind_float_array  (listType arguments);
 objectType sql_bind_int          (listType arguments);
+objectType sql_bind_int_array    (listType arguments);
 objectType sql_bind_null         (listType arguments);
 objectType sql_bind_stri         (listType arguments);
+objectType sql_bind_stri_array   (listType arguments);
 objectType sql_bind_time         (listType arguments);
 objectType sql_close             (listType arguments);
 objectType sql_cmp_db            (listType arguments);
@@ -44,8 +47,11 @@ objectType sql_column_bool       (listType arguments);
 objectType sql_column_bstri      (listType arguments);
 objectType sql_column_duration   (listType arguments);
 objectType sql_column_float      (listType arguments);
+objectType sql_column_float_block (listType arguments);
 objectType sql_column_int        (listType arguments);
+objectType sql_column_int_block  (listType arguments);
 objectType sql_column_stri       (listType arguments);
+objectType sql_column_stri_block (listType arguments);
 objectType sql_column_time       (listType arguments);
 objectType sql_commit            (listType arguments);
 objectType sql_cpy_db            (listType arguments);
@@ -65,7 +71,9 @@ objectType sql_err_db_func       (listType arguments);
 objectType sql_err_lib_func      (listType arguments);
 objectType sql_err_message       (listType arguments);
 objectType sql_execute           (listType arguments);
+objectType sql_execute_batch     (listType arguments);
 objectType sql_fetch             (listType arguments);
+objectType sql_fetch_block       (listType arguments);
 objectType sql_get_auto_commit   (listType arguments);
 objectType sql_is_null           (listType arguments);
 objectType sql_ne_db             (listType arguments);
@@ -83,5 +91,9 @@ objectType sql_open_tds          (listType arguments);
 objectType sql_prepare           (listType arguments);
 objectType sql_rollback          (listType arguments);
 objectType sql_set_auto_commit   (listType arguments);
+objectType sql_set_stmt_cache    (listType arguments);
+objectType sql_set_streaming     (listType arguments);
+objectType sql_stmt_cache_hits   (listType arguments);
+objectType sql_stmt_cache_misses (listType arguments);
 objectType sql_stmt_column_count (listType arguments);
 objectType sql_stmt_column_name  (listType arguments);
@@ -70,6 +70,34 @@
 #define RESIZE_THRESHOLD 8
 #endif
 
+/* Constants of the inflate (deflate) Huffman decoder. The decoder  */
+/* stops, when less than INFLATE_INPUT_MARGIN bytes of compressed   */
+/* data follow. This way it never needs to check for the end of the */
+/* compressed data while a symbol is decoded.                       */
+#define INFLATE_MAX_CODE_LENGTH        15
+#define INFLATE_MAX_LITERAL_OR_LENGTH 288
+#define INFLATE_MAX_DISTANCE_CODES     32
+#define INFLATE_END_OF_BLOCK          256
+#define INFLATE_INPUT_MARGIN           16
+#define INFLATE_OUTPUT_CHUNK        65536
+
+
+
+/* The hash function for strings processes all characters. Long    */
+/* strings are processed in four independent lanes. This way the    */
+/* multiplications of the lanes do not wait for each other and the  */
+/* CPU (or the C compiler with vector instructions) can process     */
+/* them in parallel.                                                */
+#if INTTYPE_SIZE == 64
+#define HASH_MULTIPLIER UINT_SUFFIX(0x9e3779b97f4a7c15)
+#else
+#define HASH_MULTIPLIER UINT_SUFFIX(0x9e3779b9)
+#endif
+#define HASH_STEP(hash, ch) \
+    (((hash) << 5 ^ (hash) >> (INTTYPE_SIZE - 5) ^ (uintType) (ch)) * HASH_MULTIPLIER)
+#define HASH_LANES          4
+#define HASH_LANE_THRESHOLD 16
+
 
 
 #if HAS_WMEMCMP && WCHAR_T_SIZE == 32
@@ -147,6 +175,62 @@ static inline const strElemType *rsearch_strelem2 (const strElemType *mem,
 
 
 
+/**
+ *  Mix the bits of a hash value, such that every bit of the
+ *  result depends on every bit of the hash value.
+ */
+static inline intType finishHashCode (uintType hash)
+
+  { /* finishHashCode */
+    hash ^= hash >> (INTTYPE_SIZE / 2);
+    hash *= HASH_MULTIPLIER;
+    hash ^= hash >> (INTTYPE_SIZE / 2);
+    return (intType) hash;
+  } /* finishHashCode */
+
+
+
+/**
+ *  Compute the hash value of the characters in a strElemType buffer.
+ *  The hash value of an empty buffer is 0.
+ *  The function ustriHashCode() computes the same hash value for
+ *  a byte string with the same characters. If this function is
+ *  changed ustriHashCode() must be changed as well.
+ */
+static inline intType strelemHashCode (const strElemType *const mem,
+    const memSizeType length)
+
+  {
+    uintType hash;
+    uintType lane1;
+    uintType lane2;
+    uintType lane3;
+    memSizeType pos = 0;
+
+  /* strelemHashCode */
+    hash = (uintType) length;
+    if (length >= HASH_LANE_THRESHOLD) {
+      lane1 = hash + 1;
+      lane2 = hash + 2;
+      lane3 = hash + 3;
+      for (; pos <= length - HASH_LANES; pos += HASH_LANES) {
+        hash  = HASH_STEP(hash,  mem[pos]);
+        lane1 = HASH_STEP(lane1, mem[pos + 1]);
+        lane2 = HASH_STEP(lane2, mem[pos + 2]);
+        lane3 = HASH_STEP(lane3, mem[pos + 3]);
+      } /* for */
+      hash = HASH_STEP(hash, lane1);
+      hash = HASH_STEP(hash, lane2);
+      hash = HASH_STEP(hash, lane3);
+    } /* if */
+    for (; pos < length; pos++) {
+      hash = HASH_STEP(hash, mem[pos]);
+    } /* for */
+    return finishHashCode(hash);
+  } /* strelemHashCode */
+
+
+
 intType ustriCmpValue (const rtlValueUnion value1, const rtlValueUnion value2)
 
   {
@@ -199,7 +283,12 @@ rtlValueUnion ustriCreateValue (const rtlValueUnion source)
 intType ustriHashCode (const const_ustriType ustri)
 
   {
+    uintType hash;
+    uintType lane1;
+    uintType lane2;
+    uintType lane3;
     memSizeType length;
+    memSizeType pos = 0;
     intType hashCode;
 
   /* ustriHashCode */
@@ -210,8 +299,27 @@ intType ustriHashCode (const const_ustriType ustri)
     if (ustri == NULL || ustri[0] == '\0') {
       hashCode = 0;
     } else {
+      /* Same algorithm as strelemHashCode(), but for bytes. */
       length = strlen((const_cstriType) ustri);
-      hashCode = ustringHashCode(ustri, length);
+      hash = (uintType) length;
+      if (length >= HASH_LANE_THRESHOLD) {
+        lane1 = hash + 1;
+        lane2 = hash + 2;
+        lane3 = hash + 3;
+        for (; pos <= length - HASH_LANES; pos += HASH_LANES) {
+          hash  = HASH_STEP(hash,  ustri[pos]);
+          lane1 = HASH_STEP(lane1, ustri[pos + 1]);
+          lane2 = HASH_STEP(lane2, ustri[pos + 2]);
+          lane3 = HASH_STEP(lane3, ustri[pos + 3]);
+        } /* for */
+        hash = HASH_STEP(hash, lane1);
+        hash = HASH_STEP(hash, lane2);
+        hash = HASH_STEP(hash, lane3);
+      } /* if */
+      for (; pos < length; pos++) {
+        hash = HASH_STEP(hash, ustri[pos]);
+      } /* for */
+      hashCode = finishHashCode(hash);
     } /* if */
     logFunctionResult(printf(FMT_D "\n", hashCode););
     return hashCode;
@@ -2942,7 +3050,7 @@ boolType strGt (const const_striType stri1, const const_striType stri2)
 intType strHashCode (const const_striType stri)
 
   { /* strHashCode */
-    return hashCode(stri);
+    return strelemHashCode(stri->mem, stri->size);
   } /* strHashCode */
 
 
@@ -3191,6 +3299,346 @@ striType strHeadTemp (const striType stri, const intType stop)
 
 
 
+static const uint16Type inflateLengthBase[] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+
+static const uint8Type inflateLengthExtraBits[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+/* The distance codes 30 and 31 are only used by deflate64. */
+static const uint16Type inflateDistanceBase[] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577, 32769, 49153};
+
+static const uint8Type inflateDistanceExtraBits[] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14};
+
+
+
+/**
+ *  Check the code lengths of an inflate Huffman code.
+ *  The code length of the symbol n is the character at index n
+ *  (starting with 0) of 'codeLengths'.
+ *  @return TRUE if there are at most 'maxSymbols' code lengths
+ *          and no code length is greater than 15, FALSE otherwise.
+ */
+static boolType validInflateCodeLengths (const const_striType codeLengths,
+    const memSizeType maxSymbols)
+
+  {
+    memSizeType symbol;
+    boolType valid;
+
+  /* validInflateCodeLengths */
+    valid = codeLengths->size <= maxSymbols;
+    for (symbol = 0; valid && symbol < codeLengths->size; symbol++) {
+      valid = codeLengths->mem[symbol] <= INFLATE_MAX_CODE_LENGTH;
+    } /* for */
+    return valid;
+  } /* validInflateCodeLengths */
+
+
+
+/**
+ *  Create a lookup table to decode an inflate Huffman code.
+ *  The code length of the symbol n is the character at index n
+ *  (starting with 0) of 'codeLengths'. The table is indexed with
+ *  the next 'tableBits' bits (LSB first) of the compressed data.
+ *  An entry contains the symbol in the lower 9 bits and the code
+ *  length in the bits above. Entries of unused codes are 0.
+ *  The code lengths must have been checked with validInflateCodeLengths().
+ *  @param tableBits Destination for the maximum code length.
+ *  @return the table, or NULL if there is not enough memory.
+ */
+static uint16Type *createInflateTable (const const_striType codeLengths,
+    unsigned int *const tableBits)
+
+  {
+    unsigned int lengthCount[INFLATE_MAX_CODE_LENGTH + 1];
+    unsigned int nextCode[INFLATE_MAX_CODE_LENGTH + 1];
+    unsigned int maxLength = 0;
+    unsigned int codeLength;
+    unsigned int code;
+    unsigned int reversedCode;
+    unsigned int bitNum;
+    memSizeType symbol;
+    memSizeType tableSize;
+    memSizeType index;
+    uint16Type *table;
+
+  /* createInflateTable */
+    memset(lengthCount, 0, sizeof(lengthCount));
+    for (symbol = 0; symbol < codeLengths->size; symbol++) {
+      codeLength = (unsigned int) codeLengths->mem[symbol];
+      lengthCount[codeLength]++;
+      if (codeLength > maxLength) {
+        maxLength = codeLength;
+      } /* if */
+    } /* for */
+    tableSize = (memSizeType) 1 << maxLength;
+    if (likely(ALLOC_TABLE(table, uint16Type, tableSize))) {
+      memset(table, 0, tableSize * sizeof(uint16Type));
+      lengthCount[0] = 0;
+      code = 0;
+      for (codeLength = 1; codeLength <= maxLength; codeLength++) {
+        code = (code + lengthCount[codeLength - 1]) << 1;
+        nextCode[codeLength] = code;
+      } /* for */
+      for (symbol = 0; symbol < codeLengths->size; symbol++) {
+        codeLength = (unsigned int) codeLengths->mem[symbol];
+        if (codeLength != 0) {
+          code = nextCode[codeLength];
+          nextCode[codeLength]++;
+          reversedCode = 0;
+          for (bitNum = 0; bitNum < codeLength; bitNum++) {
+            reversedCode = (reversedCode << 1) | ((code >> bitNum) & 1);
+          } /* for */
+          for (index = reversedCode; index < tableSize;
+               index += (memSizeType) 1 << codeLength) {
+            table[index] = (uint16Type) (codeLength << 9 | (unsigned int) symbol);
+          } /* for */
+        } /* if */
+      } /* for */
+    } /* if */
+    *tableBits = maxLength;
+    return table;
+  } /* createInflateTable */
+
+
+
+/**
+ *  Decode the Huffman codes of a block of inflate (deflate) data.
+ *  The compressed data is read from 'compressed' starting at the bit
+ *  'bitPosition' (0 is the LSB of the first byte). The uncompressed
+ *  data is appended to 'uncompressed'. Literals and length/distance
+ *  pairs are decoded until the end-of-block symbol is reached, until
+ *  'uncompressed' has at least 'limit' characters or until less than
+ *  16 bytes of 'compressed' follow the current position. The
+ *  end-of-block symbol is not consumed. The caller decides with the
+ *  returned bit position and the length of 'uncompressed', which
+ *  condition terminated the decoding. The code length of the symbol
+ *  n is the character at index n (starting with 0) of
+ *  'literalOrLengthCodeLengths' respectively 'distanceCodeLengths'.
+ *  @param deflate64 TRUE if the length code 285 uses 16 extra bits.
+ *  @return the bit position after the decoded symbols.
+ *  @exception RANGE_ERROR The code lengths are illegal, the data
+ *             contains an illegal code or a distance is too far back
+ *             or a character beyond '\255;' is found in 'compressed'.
+ *  @exception MEMORY_ERROR Not enough memory to create the tables or
+ *             to enlarge 'uncompressed'.
+ */
+intType strInflateCodes (const const_striType compressed, intType bitPosition,
+    const const_striType literalOrLengthCodeLengths,
+    const const_striType distanceCodeLengths, boolType deflate64,
+    striType *const uncompressed, intType limit)
+
+  {
+    uint16Type *literalOrLengthTable = NULL;
+    uint16Type *distanceTable = NULL;
+    unsigned int literalOrLengthBits = 0;
+    unsigned int distanceBits = 0;
+    uintType literalOrLengthMask;
+    uintType distanceMask;
+    const strElemType *inMem;
+    memSizeType inSize;
+    memSizeType inPos;
+    strElemType charsRead = 0;
+    uintType bitBuffer = 0;
+    unsigned int bitCount = 0;
+    striType stri;
+    striType resized;
+    memSizeType outPos;
+    memSizeType outLimit;
+    memSizeType maxMatchLength;
+    memSizeType allocSize;
+    memSizeType growth;
+    unsigned int entry;
+    unsigned int codeLength;
+    unsigned int symbol;
+    unsigned int extraBits;
+    memSizeType length;
+    memSizeType distance;
+    errInfoType err_info = OKAY_NO_ERROR;
+
+  /* strInflateCodes */
+    logFunction(printf("strInflateCodes(\"%s\", " FMT_D ", *, *, %d, *, " FMT_D ")\n",
+                       striAsUnquotedCStri(compressed), bitPosition,
+                       deflate64, limit););
+    stri = *uncompressed;
+    inSize = compressed->size;
+    if (unlikely(bitPosition < 0 || limit < 0 ||
+                 !validInflateCodeLengths(literalOrLengthCodeLengths,
+                                          INFLATE_MAX_LITERAL_OR_LENGTH) ||
+                 !validInflateCodeLengths(distanceCodeLengths,
+                                          INFLATE_MAX_DISTANCE_CODES))) {
+      logError(printf("strInflateCodes: Illegal parameter.\n"););
+      raise_error(RANGE_ERROR);
+    } else if ((uintType) bitPosition >> 3 >= inSize ||
+               inSize - (memSizeType) ((uintType) bitPosition >> 3) < INFLATE_INPUT_MARGIN ||
+               (uintType) limit <= stri->size) {
+      /* Nothing to do. */
+    } else {
+      literalOrLengthTable = createInflateTable(literalOrLengthCodeLengths,
+                                                &literalOrLengthBits);
+      distanceTable = createInflateTable(distanceCodeLengths, &distanceBits);
+      if (unlikely(literalOrLengthTable == NULL || distanceTable == NULL)) {
+        err_info = MEMORY_ERROR;
+      } else {
+        /* A match can write up to maxMatchLength characters beyond */
+        /* the position, where the decoding loop checks the space.  */
+        maxMatchLength = deflate64 ? 65538 : 258;
+        outPos = stri->size;
+        if ((uintType) limit > MAX_STRI_LEN - maxMatchLength) {
+          outLimit = MAX_STRI_LEN - maxMatchLength;
+        } else {
+          outLimit = (memSizeType) limit;
+        } /* if */
+        allocSize = outPos + maxMatchLength;
+        literalOrLengthMask = ((uintType) 1 << literalOrLengthBits) - 1;
+        distanceMask = ((uintType) 1 << distanceBits) - 1;
+        inMem = compressed->mem;
+        inPos = (memSizeType) ((uintType) bitPosition >> 3);
+
+#define NEED_BITS(n) \
+        while (bitCount < (n)) { \
+          charsRead |= inMem[inPos]; \
+          bitBuffer |= (uintType) inMem[inPos] << bitCount; \
+          inPos++; \
+          bitCount += 8; \
+        }
+#define DROP_BITS(n) bitBuffer >>= (n); bitCount -= (n);
+
+        NEED_BITS(8);
+        DROP_BITS((unsigned int) bitPosition & 7);
+        /* The current position (in bits) is inPos * 8 - bitCount. */
+        while (outPos < outLimit &&
+               inSize - (inPos - ((bitCount + 7) >> 3)) >= INFLATE_INPUT_MARGIN) {
+          if (unlikely(outPos + maxMatchLength >= allocSize)) {
+            growth = outPos > INFLATE_OUTPUT_CHUNK ? outPos : INFLATE_OUTPUT_CHUNK;
+            if (growth > outLimit - outPos) {
+              growth = outLimit - outPos;
+            } /* if */
+            allocSize = outPos + growth + maxMatchLength;
+            GROW_STRI(resized, stri, allocSize);
+            if (unlikely(resized == NULL)) {
+              err_info = MEMORY_ERROR;
+              break;
+            } /* if */
+            stri = resized;
+#if !WITH_STRI_CAPACITY
+            stri->size = allocSize;
+#endif
+          } /* if */
+          NEED_BITS(literalOrLengthBits);
+          entry = literalOrLengthTable[bitBuffer & literalOrLengthMask];
+          codeLength = entry >> 9;
+          symbol = entry & 0x1ff;
+          if (unlikely(codeLength == 0)) {
+            err_info = RANGE_ERROR;
+            break;
+          } else if (symbol < INFLATE_END_OF_BLOCK) {
+            DROP_BITS(codeLength);
+            stri->mem[outPos] = (strElemType) symbol;
+            outPos++;
+          } else if (symbol == INFLATE_END_OF_BLOCK) {
+            break;
+          } else {
+            DROP_BITS(codeLength);
+            symbol -= INFLATE_END_OF_BLOCK + 1;
+            if (unlikely(symbol >= sizeof(inflateLengthBase) / sizeof(uint16Type))) {
+              err_info = RANGE_ERROR;
+              break;
+            } else if (symbol == 28 && deflate64) {
+              NEED_BITS(16);
+              length = 3 + (memSizeType) (bitBuffer & 0xffff);
+              DROP_BITS(16);
+            } else {
+              length = inflateLengthBase[symbol];
+              extraBits = inflateLengthExtraBits[symbol];
+              if (extraBits != 0) {
+                NEED_BITS(extraBits);
+                length += (memSizeType) (bitBuffer & (((uintType) 1 << extraBits) - 1));
+                DROP_BITS(extraBits);
+              } /* if */
+            } /* if */
+            NEED_BITS(distanceBits);
+            entry = distanceTable[bitBuffer & distanceMask];
+            codeLength = entry >> 9;
+            symbol = entry & 0x1ff;
+            if (unlikely(codeLength == 0)) {
+              err_info = RANGE_ERROR;
+              break;
+            } /* if */
+            DROP_BITS(codeLength);
+            distance = inflateDistanceBase[symbol];
+            extraBits = inflateDistanceExtraBits[symbol];
+            if (extraBits != 0) {
+              NEED_BITS(extraBits);
+              distance += (memSizeType) (bitBuffer & (((uintType) 1 << extraBits) - 1));
+              DROP_BITS(extraBits);
+            } /* if */
+            if (unlikely(distance > outPos)) {
+              err_info = RANGE_ERROR;
+              break;
+            } else if (distance >= length) {
+              memcpy(&stri->mem[outPos], &stri->mem[outPos - distance],
+                     length * sizeof(strElemType));
+              outPos += length;
+            } else {
+              /* Overlapping copy: The last 'distance' characters are repeated. */
+              for (; length != 0; length--) {
+                stri->mem[outPos] = stri->mem[outPos - distance];
+                outPos++;
+              } /* for */
+            } /* if */
+          } /* if */
+        } /* while */
+
+#undef NEED_BITS
+#undef DROP_BITS
+
+        if (unlikely(charsRead > 0xff)) {
+          logError(printf("strInflateCodes: Character beyond '\\255;' found.\n"););
+          err_info = RANGE_ERROR;
+        } /* if */
+        bitPosition = (intType) (inPos * 8 - bitCount);
+        if (stri->size != outPos) {
+#if WITH_STRI_CAPACITY
+          stri->size = outPos;
+#else
+          SHRINK_STRI(resized, stri, outPos);
+          if (likely(resized != NULL)) {
+            /* Theoretical shrinking a memory area should never fail.  */
+            /* For the strange case that it fails we keep stri intact  */
+            /* with the oversized memory usage.                        */
+            stri = resized;
+          } /* if */
+          stri->size = outPos;
+#endif
+        } /* if */
+        *uncompressed = stri;
+      } /* if */
+      if (literalOrLengthTable != NULL) {
+        FREE_TABLE(literalOrLengthTable, uint16Type,
+                   (memSizeType) 1 << literalOrLengthBits);
+      } /* if */
+      if (distanceTable != NULL) {
+        FREE_TABLE(distanceTable, uint16Type, (memSizeType) 1 << distanceBits);
+      } /* if */
+      if (unlikely(err_info != OKAY_NO_ERROR)) {
+        logError(printf("strInflateCodes: Decoding failed.\n"););
+        raise_error(err_info);
+      } /* if */
+    } /* if */
+    logFunction(printf("strInflateCodes --> " FMT_D "\n", bitPosition););
+    return bitPosition;
+  } /* strInflateCodes */
+
+
 /**
  *  Search string 'searched' in 'mainStri' at or after 'fromIndex'.
  *  The search starts at 'fromIndex' and proceeds to the right.
@@ -5242,6 +5690,8 @@ striType strToUtf8 (const const_striType stri)
     register strElemType *dest;
     register strElemType ch;
     register memSizeType pos;
+    memSizeType ascii_size;
+    memSizeType max_result_size;
     memSizeType result_size;
     striType resized_result;
     striType result;
@@ -5250,13 +5700,19 @@ striType strToUtf8 (const const_striType stri)
     logFunction(printf("strToUtf8(\"%s\")",
                        striAsUnquotedCStri(stri));
                 fflush(stdout););
-    if (unlikely(stri->size > MAX_STRI_LEN / MAX_UTF8_EXPANSION_FACTOR ||
-                 !ALLOC_STRI_SIZE_OK(result, max_utf8_size(stri->size)))) {
+    /* The ASCII characters at the beginning are copied unchanged. */
+    /* Only the rest of the string can expand to several bytes.    */
+    ascii_size = ascii_prefix_strelem(stri->mem, stri->size);
+    max_result_size = ascii_size + max_utf8_size(stri->size - ascii_size);
+    if (unlikely(stri->size - ascii_size >
+                 (MAX_STRI_LEN - ascii_size) / MAX_UTF8_EXPANSION_FACTOR ||
+                 !ALLOC_STRI_SIZE_OK(result, max_result_size))) {
       raise_error(MEMORY_ERROR);
       result = NULL;
     } else {
-      dest = result->mem;
-      for (pos = 0; pos < stri->size; pos++) {
+      memcpy(result->mem, stri->mem, ascii_size * sizeof(strElemType));
+      dest = &result->mem[ascii_size];
+      for (pos = ascii_size; pos < stri->size; pos++) {
         ch = stri->mem[pos];
         if (ch <= 0x7F) {
           *dest++ = ch;
@@ -5293,14 +5749,18 @@ striType strToUtf8 (const const_striType stri)
         } /* if */
       } /* for */
       result_size = (memSizeType) (dest - result->mem);
-      REALLOC_STRI_SIZE_SMALLER2(resized_result, result, max_utf8_size(stri->size), result_size);
-      if (unlikely(resized_result == NULL)) {
-        FREE_STRI2(result, max_utf8_size(stri->size));
-        raise_error(MEMORY_ERROR);
-        result = NULL;
-      } else {
-        result = resized_result;
+      if (result_size == max_result_size) {
         result->size = result_size;
+      } else {
+        REALLOC_STRI_SIZE_SMALLER2(resized_result, result, max_result_size, result_size);
+        if (unlikely(resized_result == NULL)) {
+          FREE_STRI2(result, max_result_size);
+          raise_error(MEMORY_ERROR);
+          result = NULL;
+        } else {
+          result = resized_result;
+          result->size = result_size;
+        } /* if */
       } /* if */
     } /* if */
     logFunctionResult(printf("\"%s\"\n", striAsUnquotedCStri(result)););
@@ -29,23 +29,6 @@
 /*                                                                  */
 /********************************************************************/
 
-/**
- *  Macro to compute the hashcode of a string.
- *  A corresponding macro is inlined by the compiler. If this macro
- *  is changed the code in the compiler must be changed as well.
- */
-#define hashCode(stri) (intType) ((stri)->size == 0 ? 0 : \
-                                     ((stri)->mem[0] << 5 ^ \
-                                      (stri)->mem[(stri)->size >> 1] << 3 ^ \
-                                      (stri)->mem[(stri)->size - 1] << 1 ^ \
-                                      (stri)->size))
-
-#define ustringHashCode(ustri, length) (intType) ((uintType) ((ustri)[0]) << 5 ^ \
-                                                  (uintType) ((ustri)[(length) >> 1]) << 3 ^ \
-                                                  (uintType) ((ustri)[(length) - 1]) << 1 ^ \
-                                                  (length));
-
-
 void toLower (const strElemType *const source, memSizeType length,
     strElemType *const dest);
 void toUpper (const strElemType *const source, memSizeType length,
@@ -88,6 +71,10 @@ void strHeadSlice (const const_striType stri, const intType stop, striType slice
 striType strHead (const const_striType stri, const intType stop);
 striType strHeadAssign (const striType stri, const intType stop);
 striType strHeadTemp (const striType stri, const intType stop);
+intType strInflateCodes (const const_striType compressed, intType bitPosition,
+    const const_striType literalOrLengthCodeLengths,
+    const const_striType distanceCodeLengths, boolType deflate64,
+    striType *const uncompressed, intType limit);
 intType strIPos (const const_striType mainStri, const const_striType searched,
     const intType fromIndex);
 boolType strLe (const const_striType stri1, const const_striType stri2);
@@ -51,6 +51,9 @@
 #define DO_INIT
 #include "striutl.h"
 
+/* A machine word where the highest bit of every byte is set. */
+#define ASCII_WORD_MASK (((~(uintType) 0) / 0xFF) * 0x80)
+
 
 const const_cstriType stri_escape_sequence[] = {
     "\\0;",  "\\1;",  "\\2;",  "\\3;",  "\\4;",
@@ -685,6 +688,72 @@ const strElemType *memchr_strelem (register const strElemType *mem,
 
 
 
+/**
+ *  Determine the number of ASCII characters at the start of 'mem'.
+ *  Four characters are checked at once.
+ *  @param mem Array with UTF-32 encoded characters.
+ *  @param len Number of UTF-32 characters in 'mem'.
+ *  @return the number of ASCII characters at the start of 'mem'.
+ */
+memSizeType ascii_prefix_strelem (const strElemType *mem, memSizeType len)
+
+  {
+    memSizeType pos = 0;
+
+  /* ascii_prefix_strelem */
+    while (len - pos >= 4 &&
+           (mem[pos] | mem[pos + 1] | mem[pos + 2] | mem[pos + 3]) <= 0x7F) {
+      pos += 4;
+    } /* while */
+    while (pos < len && mem[pos] <= 0x7F) {
+      pos++;
+    } /* while */
+    return pos;
+  } /* ascii_prefix_strelem */
+
+
+
+/**
+ *  Check if the bytes of a machine word at 'ustri' are all ASCII.
+ *  The word is read with memcpy(), so 'ustri' needs no alignment.
+ */
+static inline boolType isAsciiWord (const const_ustriType ustri)
+
+  {
+    uintType word;
+
+  /* isAsciiWord */
+    memcpy(&word, ustri, sizeof(uintType));
+    return (word & ASCII_WORD_MASK) == 0;
+  } /* isAsciiWord */
+
+
+
+/**
+ *  Determine the number of ASCII bytes at the start of 'ustri'.
+ *  A machine word of bytes is checked at once.
+ *  @param ustri Byte string to be examined.
+ *  @param len Number of bytes in 'ustri'.
+ *  @return the number of ASCII bytes at the start of 'ustri'.
+ */
+static inline memSizeType ascii_prefix_ustri (const const_ustriType ustri,
+    memSizeType len)
+
+  {
+    memSizeType pos = 0;
+
+  /* ascii_prefix_ustri */
+    while (len - pos >= sizeof(uintType) && isAsciiWord(&ustri[pos])) {
+      pos += sizeof(uintType);
+    } /* while */
+    while (pos < len && ustri[pos] <= 0x7F) {
+      pos++;
+    } /* while */
+    return pos;
+  } /* ascii_prefix_ustri */
+
+
+
 #if STACK_LIKE_ALLOC_FOR_OS_STRI
 os_striType heapAllocOsStri (memSizeType len)
 
@@ -755,10 +824,16 @@ memSizeType stri8_to_stri (strElemType *const dest_stri,
     memSizeType *const dest_len, const strElemType *stri8, memSizeType len)
 
   {
+    memSizeType ascii_size;
     strElemType *stri;
 
   /* stri8_to_stri */
-    stri = dest_stri;
+    /* Leading ASCII characters are copied as one block. */
+    ascii_size = ascii_prefix_strelem(stri8, len);
+    memcpy(dest_stri, stri8, ascii_size * sizeof(strElemType));
+    stri = &dest_stri[ascii_size];
+    stri8 += ascii_size;
+    len -= ascii_size;
     for (; len > 0; len--) {
       if (*stri8 <= 0x7F) {
         *stri++ = (strElemType) *stri8++;
@@ -850,10 +925,17 @@ memSizeType utf8_to_stri (strElemType *const dest_stri,
     memSizeType *const dest_len, const_ustriType ustri, memSizeType len)
 
   {
+    memSizeType ascii_size;
     strElemType *stri;
 
   /* utf8_to_stri */
-    stri = dest_stri;
+    /* Much text is pure ASCII. Leading ASCII bytes are */
+    /* widened as one block, without decoding each byte. */
+    ascii_size = ascii_prefix_ustri(ustri, len);
+    memcpy_to_strelem(dest_stri, ustri, ascii_size);
+    stri = &dest_stri[ascii_size];
+    ustri += ascii_size;
+    len -= ascii_size;
     for (; len > 0; len--) {
       if (*ustri <= 0x7F) {
         *stri++ = (strElemType) *ustri++;
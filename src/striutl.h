@@ -214,6 +214,7 @@ void memset_to_strelem (register strElemType *const dest,
 boolType memcpy_from_strelem (register const ustriType dest,
                               register const strElemType *const src,
                               memSizeType len);
+memSizeType ascii_prefix_strelem (const strElemType *mem, memSizeType len);
 #if HAS_WMEMCHR && WCHAR_T_SIZE == 32
 #define memchr_strelem(mem, ch, len) \
     (const strElemType *) wmemchr((const wchar_t *) mem, (wchar_t) ch, (size_t) len)
@@ -874,7 +874,7 @@ objectType str_hashcode (listType arguments)
                 printf(")\n"););
     isit_stri(arg_1(arguments));
     stri = take_stri(arg_1(arguments));
-    return bld_int_temp(hashCode(stri));
+    return bld_int_temp(strHashCode(stri));
   } /* str_hashcode */
 
 
@@ -978,6 +978,44 @@ objectType str_idx (listType arguments)
 
 
 
+/**
+ *  Decode the Huffman codes of a block of inflate (deflate) data.
+ *  The uncompressed data is appended to the variable 'uncompressed'.
+ *  @return the bit position after the decoded symbols.
+ *  @exception RANGE_ERROR The compressed data or a code length
+ *             is illegal.
+ *  @exception MEMORY_ERROR Not enough memory.
+ */
+objectType str_inflate_codes (listType arguments)
+
+  {
+    objectType str_variable;
+    striType uncompressed;
+    intType bitPosition;
+
+  /* str_inflate_codes */
+    isit_stri(arg_1(arguments));
+    isit_int(arg_2(arguments));
+    isit_stri(arg_3(arguments));
+    isit_stri(arg_4(arguments));
+    isit_bool(arg_5(arguments));
+    str_variable = arg_6(arguments);
+    isit_stri(str_variable);
+    is_variable(str_variable);
+    isit_int(arg_7(arguments));
+    uncompressed = take_stri(str_variable);
+    bitPosition = strInflateCodes(take_stri(arg_1(arguments)),
+                                  take_int(arg_2(arguments)),
+                                  take_stri(arg_3(arguments)),
+                                  take_stri(arg_4(arguments)),
+                                  take_bool(arg_5(arguments)) == SYS_TRUE_OBJECT,
+                                  &uncompressed, take_int(arg_7(arguments)));
+    str_variable->value.striValue = uncompressed;
+    return bld_int_temp(bitPosition);
+  } /* str_inflate_codes */
+
+
+
 /**
  *  Search string 'searched' in 'mainStri' at or after 'fromIndex'.
  *  The search starts at 'fromIndex' and proceeds to the right.
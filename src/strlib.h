@@ -46,6 +46,7 @@ objectType str_gt            (listType arguments);
 objectType str_hashcode      (listType arguments);
 objectType str_head          (listType arguments);
 objectType str_idx           (listType arguments);
+objectType str_inflate_codes (listType arguments);
 objectType str_ipos          (listType arguments);
 objectType str_le            (listType arguments);
 objectType str_literal       (listType arguments);
@@ -0,0 +1,812 @@
+/********************************************************************/
+/*                                                                  */
+/*  s7   Seed7 interpreter                                          */
+/*  Copyright (C) 1990 - 2026  Thomas Mertes                        */
+/*                                                                  */
+/*  This program is free software; you can redistribute it and/or   */
+/*  modify it under the terms of the GNU General Public License as  */
+/*  published by the Free Software Foundation; either version 2 of  */
+/*  the License, or (at your option) any later version.             */
+/*                                                                  */
+/*  This program is distributed in the hope that it will be useful, */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of  */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the   */
+/*  GNU General Public License for more details.                    */
+/*                                                                  */
+/*  You should have received a copy of the GNU General Public       */
+/*  License along with this program; if not, write to the           */
+/*  Free Software Foundation, Inc., 51 Franklin Street,             */
+/*  Fifth Floor, Boston, MA  02110-1301, USA.                       */
+/*                                                                  */
+/*  Module: Interpreter                                             */
+/*  File: seed7/src/thrcode.c                                       */
+/*  Changes: 2026  Thomas Mertes                                    */
+/*  Content: Lower block bodies to threaded code and execute it.    */
+/*                                                                  */
+/*  The body of a block is a tree of call objects. The tree walker  */
+/*  in exec.c visits this tree recursively and decides for every    */
+/*  node what to do with it. When the interpreter is started with   */
+/*  the option -b the body of a block is lowered to a linear        */
+/*  sequence of instructions, when the block is executed first.     */
+/*  The instructions refer directly to the actions, functions,      */
+/*  parameters and local variables used. The evaluated arguments   */
+/*  are kept on a stack, which is an argument frame (see exec.c).   */
+/*  The arguments of an action are therefore already in place when */
+/*  the action is called. The statements if, while, repeat and the  */
+/*  integer for-loops are lowered to jumps. Everything else is      */
+/*  left to the tree walker.                                        */
+/*                                                                  */
+/********************************************************************/
+
+#define LOG_FUNCTIONS 0
+#define VERBOSE_EXCEPTIONS 0
+
+#include "version.h"
+
+#include "stdlib.h"
+#include "stdio.h"
+#include "string.h"
+
+#include "common.h"
+#include "data.h"
+#include "heaputl.h"
+#include "flistutl.h"
+#include "syvarutl.h"
+#include "traceutl.h"
+#include "objutl.h"
+#include "runerr.h"
+#include "exec.h"
+#include "prclib.h"
+
+#undef EXTERN
+#define EXTERN
+#include "thrcode.h"
+
+
+#define INITIAL_CODE_CAPACITY 64
+#define MAX_ACTION_PARAMS     32
+#define MAX_CONTROL_PARAMS    10
+#define MAX_LOOP_LEVEL        16
+#define SIZ_CODE(size)        (sizeof(codeRecord) + ((size) - 1) * sizeof(instrRecord))
+
+typedef enum {
+    OP_PUSH,             /* Push object.                                */
+    OP_PUSH_VAR,         /* Push value of parameter or local variable.  */
+    OP_CALL,             /* Push result of exec_call(object).           */
+    OP_LAMBDA,           /* Call function with num_args stack values.   */
+    OP_ACTION,           /* Call action with num_args stack values.     */
+    OP_END_ACTION,       /* Replace num_args stack values by empty.     */
+    OP_POP,              /* Remove the result of a statement.           */
+    OP_JUMP,             /* Continue at jump.                           */
+    OP_JUMP_FALSE,       /* Pop condition and continue at jump if FALSE.*/
+    OP_FOR_TO,           /* Start upward for-loop, jump if it is empty. */
+    OP_FOR_TO_NEXT,      /* Increment and continue at jump if in range. */
+    OP_FOR_DOWNTO,       /* Start downward for-loop, jump if it is empty.*/
+    OP_FOR_DOWNTO_NEXT,  /* Decrement and continue at jump if in range. */
+    OP_RETURN            /* Return the value on the stack.              */
+  } opcodeType;
+
+typedef struct {
+    opcodeType opcode;
+    unsigned int num_args;
+    memSizeType jump;
+    objectType object;
+    objectType act_object;
+  } instrRecord, *instrType;
+
+typedef const instrRecord *const_instrType;
+
+typedef struct codeStruct {
+    memSizeType size;
+    memSizeType stack_size;
+    instrRecord instr[1];
+  } codeRecord;
+
+typedef const struct codeStruct *const_codeType;
+
+typedef struct {
+    instrType instr;
+    memSizeType size;
+    memSizeType capacity;
+    memSizeType depth;
+    memSizeType max_depth;
+    unsigned int loop_level;
+    boolType okay;
+  } buildRecord, *buildType;
+
+static void lower_call (buildType build, objectType call_object);
+
+
+
+static memSizeType emit (buildType build, opcodeType opcode,
+    unsigned int num_args, objectType object, objectType act_object)
+
+  {
+    instrType resized_instr;
+    memSizeType position;
+
+  /* emit */
+    if (build->size == build->capacity && build->okay) {
+      resized_instr = REALLOC_HEAP(build->instr, instrType,
+                                   2 * build->capacity * sizeof(instrRecord));
+      if (unlikely(resized_instr == NULL)) {
+        build->okay = FALSE;
+      } else {
+        build->instr = resized_instr;
+        build->capacity *= 2;
+      } /* if */
+    } /* if */
+    position = build->size;
+    if (build->okay) {
+      build->instr[position].opcode = opcode;
+      build->instr[position].num_args = num_args;
+      build->instr[position].jump = 0;
+      build->instr[position].object = object;
+      build->instr[position].act_object = act_object;
+      build->size++;
+    } /* if */
+    return position;
+  } /* emit */
+
+
+
+static inline void set_jump (buildType build, memSizeType position,
+    memSizeType target)
+
+  { /* set_jump */
+    if (build->okay) {
+      build->instr[position].jump = target;
+    } /* if */
+  } /* set_jump */
+
+
+
+static inline void push_depth (buildType build)
+
+  { /* push_depth */
+    build->depth++;
+    if (build->depth > build->max_depth) {
+      build->max_depth = build->depth;
+    } /* if */
+  } /* push_depth */
+
+
+
+/**
+ *  Lower a parameter, which is evaluated with exec_object().
+ */
+static void lower_param (buildType build, objectType param)
+
+  { /* lower_param */
+    switch (CATEGORY_OF_OBJ(param)) {
+      case CALLOBJECT:
+        lower_call(build, param);
+        break;
+      case VALUEPARAMOBJECT:
+      case REFPARAMOBJECT:
+      case RESULTOBJECT:
+      case LOCALVOBJECT:
+        emit(build, OP_PUSH_VAR, 0, param, NULL);
+        push_depth(build);
+        break;
+      default:
+        emit(build, OP_PUSH, 0, param, NULL);
+        push_depth(build);
+        break;
+    } /* switch */
+  } /* lower_param */
+
+
+
+/**
+ *  Lower a call-by-name statement, whose result is not used.
+ */
+static void lower_statement (buildType build, objectType statement)
+
+  { /* lower_statement */
+    lower_call(build, statement);
+    emit(build, OP_POP, 0, NULL, NULL);
+    build->depth--;
+  } /* lower_statement */
+
+
+
+/**
+ *  Determine if 'param' can be used as condition of a loop.
+ *  A call-by-name condition is a match object. A condition of the
+ *  type 'ref boolean' is evaluated again and again as well. This is
+ *  only possible for variables and constants, but not for calls.
+ */
+static boolType is_loop_condition (objectType param)
+
+  { /* is_loop_condition */
+    switch (CATEGORY_OF_OBJ(param)) {
+      case MATCHOBJECT:
+      case VALUEPARAMOBJECT:
+      case REFPARAMOBJECT:
+      case RESULTOBJECT:
+      case LOCALVOBJECT:
+      case CONSTENUMOBJECT:
+      case VARENUMOBJECT:
+      case ENUMLITERALOBJECT:
+        return TRUE;
+      default:
+        return FALSE;
+    } /* switch */
+  } /* is_loop_condition */
+
+
+
+static void lower_condition (buildType build, objectType param)
+
+  { /* lower_condition */
+    if (CATEGORY_OF_OBJ(param) == MATCHOBJECT) {
+      lower_call(build, param);
+    } else {
+      lower_param(build, param);
+    } /* if */
+  } /* lower_condition */
+
+
+
+/**
+ *  Lower if, while, repeat and the integer for-loops to jumps.
+ *  The conditions and statements, which are call-by-name parameters,
+ *  are lowered to inline code. This is only possible, when they are
+ *  match objects. The remaining parameters must not need an evaluation.
+ *  @return TRUE if the call was lowered, FALSE otherwise.
+ */
+static boolType lower_control (buildType build, objectType call_object,
+    objectType act_object, const_listType params, memSizeType num_params)
+
+  {
+    actType action;
+    objectType param[MAX_CONTROL_PARAMS];
+    unsigned int used;
+    unsigned int by_name;
+    unsigned int condition;
+    unsigned int pos;
+    memSizeType loop_pos;
+    memSizeType jump_pos;
+    memSizeType jump_pos2;
+    boolType lowered = TRUE;
+
+  /* lower_control */
+    action = act_object->value.actValue;
+    if (action == prc_while && num_params >= 4) {
+      used = 0x0a;
+      by_name = 0x08;
+      condition = 0x02;
+    } else if (action == prc_repeat && num_params >= 4) {
+      used = 0x0a;
+      by_name = 0x02;
+      condition = 0x08;
+    } else if (action == prc_if && num_params >= 4) {
+      used = 0x0a;
+      by_name = 0x08;
+      condition = 0x00;
+    } else if (action == prc_if_elsif && num_params >= 5) {
+      used = 0x1a;
+      by_name = 0x18;
+      condition = 0x00;
+    } else if ((action == prc_for_to || action == prc_for_downto) &&
+               num_params >= 8 && build->loop_level < MAX_LOOP_LEVEL) {
+      used = 0xaa;
+      by_name = 0x80;
+      condition = 0x00;
+    } else if (action == prc_semicolon && num_params == 3) {
+      used = 0x05;
+      by_name = 0x00;
+      condition = 0x00;
+    } else {
+      return FALSE;
+    } /* if */
+    if (num_params > MAX_CONTROL_PARAMS) {
+      return FALSE;
+    } /* if */
+    for (pos = 0; pos < num_params; pos++) {
+      param[pos] = params->obj;
+      if (by_name & (1U << pos)) {
+        if (CATEGORY_OF_OBJ(param[pos]) != MATCHOBJECT) {
+          return FALSE;
+        } /* if */
+      } else if (condition & (1U << pos)) {
+        if (!is_loop_condition(param[pos])) {
+          return FALSE;
+        } /* if */
+      } else if (!(used & (1U << pos)) &&
+                 CATEGORY_OF_OBJ(param[pos]) == CALLOBJECT) {
+        return FALSE;
+      } /* if */
+      params = params->next;
+    } /* for */
+    if (action == prc_while) {
+      loop_pos = build->size;
+      lower_condition(build, param[1]);
+      jump_pos = emit(build, OP_JUMP_FALSE, 0, call_object, NULL);
+      build->depth--;
+      lower_statement(build, param[3]);
+      set_jump(build, emit(build, OP_JUMP, 0, NULL, NULL), loop_pos);
+      set_jump(build, jump_pos, build->size);
+      emit(build, OP_PUSH, 0, SYS_EMPTY_OBJECT, NULL);
+      push_depth(build);
+    } else if (action == prc_repeat) {
+      loop_pos = build->size;
+      lower_statement(build, param[1]);
+      lower_condition(build, param[3]);
+      set_jump(build, emit(build, OP_JUMP_FALSE, 0, call_object, NULL), loop_pos);
+      build->depth--;
+      emit(build, OP_PUSH, 0, SYS_EMPTY_OBJECT, NULL);
+      push_depth(build);
+    } else if (action == prc_if) {
+      lower_param(build, param[1]);
+      jump_pos = emit(build, OP_JUMP_FALSE, 0, call_object, NULL);
+      build->depth--;
+      lower_statement(build, param[3]);
+      set_jump(build, jump_pos, build->size);
+      emit(build, OP_PUSH, 0, SYS_EMPTY_OBJECT, NULL);
+      push_depth(build);
+    } else if (action == prc_if_elsif) {
+      lower_param(build, param[1]);
+      jump_pos = emit(build, OP_JUMP_FALSE, 0, call_object, NULL);
+      build->depth--;
+      lower_statement(build, param[3]);
+      jump_pos2 = emit(build, OP_JUMP, 0, NULL, NULL);
+      set_jump(build, jump_pos, build->size);
+      lower_statement(build, param[4]);
+      set_jump(build, jump_pos2, build->size);
+      emit(build, OP_PUSH, 0, SYS_EMPTY_OBJECT, NULL);
+      push_depth(build);
+    } else if (action == prc_for_to || action == prc_for_downto) {
+      lower_param(build, param[1]);
+      lower_param(build, param[3]);
+      lower_param(build, param[5]);
+      jump_pos = emit(build, action == prc_for_to ? OP_FOR_TO : OP_FOR_DOWNTO,
+                      build->loop_level, call_object, act_object);
+      loop_pos = build->size;
+      build->loop_level++;
+      lower_statement(build, param[7]);
+      build->loop_level--;
+      set_jump(build, emit(build, action == prc_for_to ?
+                           OP_FOR_TO_NEXT : OP_FOR_DOWNTO_NEXT,
+                           build->loop_level, call_object, act_object),
+               loop_pos);
+      set_jump(build, jump_pos, build->size);
+      emit(build, OP_END_ACTION, 3, call_object, act_object);
+      build->depth -= 2;
+    } else if (action == prc_semicolon) {
+      lower_param(build, param[0]);
+      lower_param(build, param[2]);
+      emit(build, OP_END_ACTION, 2, call_object, act_object);
+      build->depth--;
+    } else {
+      lowered = FALSE;
+    } /* if */
+    return lowered;
+  } /* lower_control */
+
+
+
+/**
+ *  Lower a call object or match object. The code leaves the result
+ *  of the call on the stack. Calls of actions and functions evaluate
+ *  their parameters on the stack. Other calls are left to exec_call().
+ */
+static void lower_call (buildType build, objectType call_object)
+
+  {
+    objectType subroutine_object;
+    listType actual_parameters;
+    const_listType param_elem;
+    memSizeType num_params = 0;
+
+  /* lower_call */
+    subroutine_object = call_object->value.listValue->obj;
+    actual_parameters = call_object->value.listValue->next;
+    for (param_elem = actual_parameters; param_elem != NULL;
+         param_elem = param_elem->next) {
+      num_params++;
+    } /* for */
+    if (CATEGORY_OF_OBJ(subroutine_object) == ACTOBJECT &&
+        num_params <= MAX_ACTION_PARAMS) {
+      if (!lower_control(build, call_object, subroutine_object,
+                         actual_parameters, num_params)) {
+        for (param_elem = actual_parameters; param_elem != NULL;
+             param_elem = param_elem->next) {
+          lower_param(build, param_elem->obj);
+        } /* for */
+        emit(build, OP_ACTION, (unsigned int) num_params,
+             call_object, subroutine_object);
+        build->depth -= num_params;
+        push_depth(build);
+      } /* if */
+    } else if (CATEGORY_OF_OBJ(subroutine_object) == BLOCKOBJECT &&
+               num_params <= MAX_ACTION_PARAMS) {
+      for (param_elem = actual_parameters; param_elem != NULL;
+           param_elem = param_elem->next) {
+        lower_param(build, param_elem->obj);
+      } /* for */
+      emit(build, OP_LAMBDA, (unsigned int) num_params,
+           call_object, subroutine_object);
+      build->depth -= num_params;
+      push_depth(build);
+    } else {
+      emit(build, OP_CALL, 0, call_object, NULL);
+      push_depth(build);
+    } /* if */
+  } /* lower_call */
+
+
+
+static codeType lower_block (const_blockType block)
+
+  {
+    buildRecord build;
+    codeType code = NULL;
+
+  /* lower_block */
+    logFunction(printf("lower_block(" FMT_U_MEM ")\n", (memSizeType) block););
+    build.size = 0;
+    build.capacity = INITIAL_CODE_CAPACITY;
+    build.depth = 0;
+    build.max_depth = 0;
+    build.loop_level = 0;
+    if (block->body != NULL &&
+        ALLOC_HEAP(build.instr, instrType,
+                   INITIAL_CODE_CAPACITY * sizeof(instrRecord))) {
+      build.okay = TRUE;
+      lower_call(&build, block->body);
+      emit(&build, OP_RETURN, 0, NULL, NULL);
+      if (build.okay &&
+          ALLOC_HEAP(code, codeType, SIZ_CODE(build.size))) {
+        code->size = build.size;
+        code->stack_size = build.max_depth;
+        memcpy(code->instr, build.instr, build.size * sizeof(instrRecord));
+      } /* if */
+      FREE_HEAP(build.instr, build.capacity * sizeof(instrRecord));
+    } /* if */
+    logFunction(printf("lower_block(" FMT_U_MEM ") --> " FMT_U_MEM "\n",
+                       (memSizeType) block, (memSizeType) code););
+    return code;
+  } /* lower_block */
+
+
+
+/**
+ *  Call the action of a for-loop with all its parameters.
+ *  This is done when the checks of OP_FOR_TO or OP_FOR_DOWNTO fail.
+ *  The action raises the same exception as the tree walker would.
+ *  @param values The evaluated variable and limits of the for-loop.
+ */
+static objectType exec_for_action (const_instrType instr,
+    const_listType values)
+
+  {
+    const_listType param_elem;
+    memSizeType num_params = 0;
+    memSizeType pos;
+    listType arguments;
+    objectType result;
+
+  /* exec_for_action */
+    for (param_elem = instr->object->value.listValue->next; param_elem != NULL;
+         param_elem = param_elem->next) {
+      num_params++;
+    } /* for */
+    if (unlikely((arguments = push_arg_frame(num_params)) == NULL)) {
+      result = raise_exception(SYS_MEM_EXCEPTION);
+    } else {
+      param_elem = instr->object->value.listValue->next;
+      for (pos = 0; pos < num_params; pos++) {
+        if (pos == 1 || pos == 3 || pos == 5) {
+          arguments[pos].obj = values[pos >> 1].obj;
+        } else {
+          arguments[pos].obj = exec_object(param_elem->obj);
+        } /* if */
+        arguments[pos].next = &arguments[pos + 1];
+        param_elem = param_elem->next;
+      } /* for */
+      arguments[num_params - 1].next = NULL;
+      curr_exec_object = instr->object;
+      curr_argument_list = arguments;
+      result = (*(instr->act_object->value.actValue))(arguments);
+      pop_arg_frame(arguments);
+    } /* if */
+    return result;
+  } /* exec_for_action */
+
+
+
+#if LABELS_AS_VALUES_OK
+#define INSTRUCTION(opcode,label) case opcode: label:
+#define NEXT_INSTRUCTION          goto *dispatch_table[pc->opcode]
+#else
+#define INSTRUCTION(opcode,label) case opcode:
+#define NEXT_INSTRUCTION          continue
+#endif
+
+
+
+static objectType exec_code (const_codeType code)
+
+  {
+#if LABELS_AS_VALUES_OK
+    static const void *const dispatch_table[] = {
+        &&op_push, &&op_push_var, &&op_call, &&op_lambda, &&op_action,
+        &&op_end_action, &&op_pop, &&op_jump, &&op_jump_false,
+        &&op_for_to, &&op_for_to_next, &&op_for_downto,
+        &&op_for_downto_next, &&op_return
+      };
+#endif
+    listType stack;
+    register listType sp;
+    register const_instrType pc;
+    register listType arguments;
+    objectType object;
+    objectType result;
+    objectType cond;
+    uint32Type temp_bits;
+    unsigned int pos;
+    intType loop_limit[MAX_LOOP_LEVEL];
+
+  /* exec_code */
+    logFunction(printf("exec_code(" FMT_U_MEM ")\n", (memSizeType) code););
+    if (unlikely((stack = push_arg_frame(code->stack_size)) == NULL)) {
+      return raise_exception(SYS_MEM_EXCEPTION);
+    } /* if */
+    sp = stack;
+    pc = code->instr;
+    for (;;) {
+      switch (pc->opcode) {
+        INSTRUCTION(OP_PUSH, op_push)
+          sp->obj = pc->object;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_PUSH_VAR, op_push_var)
+          object = pc->object->value.objValue;
+          sp->obj = object != NULL ? object : pc->object;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_CALL, op_call)
+          result = exec_call(pc->object);
+          if (unlikely(fail_flag)) {
+            goto unwind;
+          } /* if */
+          sp->obj = result;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_LAMBDA, op_lambda)
+          arguments = sp - pc->num_args;
+          if (pc->num_args != 0) {
+            sp[-1].next = NULL;
+          } /* if */
+          result = exec_lambda(pc->act_object->value.blockValue,
+                               pc->object->value.listValue->next,
+                               pc->num_args != 0 ? arguments : NULL,
+                               pc->object);
+          sp = arguments;
+          if (unlikely(fail_flag)) {
+            goto unwind;
+          } /* if */
+          sp->obj = result;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_ACTION, op_action)
+          temp_bits = 0;
+          if (pc->num_args != 0) {
+            arguments = sp - pc->num_args;
+            sp[-1].next = NULL;
+            for (pos = 0; pos < pc->num_args; pos++) {
+              if (arguments[pos].obj != NULL &&
+                  TEMP_OBJECT(arguments[pos].obj)) {
+                temp_bits |= (uint32Type) 1 << pos;
+              } /* if */
+            } /* for */
+          } else {
+            arguments = NULL;
+          } /* if */
+          curr_exec_object = pc->object;
+          curr_argument_list = arguments;
+          if (unlikely(interrupt_flag)) {
+            if (!fail_flag) {
+              show_signal();
+            } /* if */
+            if (fail_flag) {
+              goto unwind;
+            } /* if */
+          } /* if */
+          result = (*(pc->act_object->value.actValue))(arguments);
+          if (result != NULL && result->type_of == NULL) {
+            result->type_of = pc->act_object->type_of->result_type;
+          } /* if */
+          if (arguments != NULL) {
+            sp = arguments;
+            while (temp_bits != 0) {
+              if (temp_bits & 1 && arguments->obj != NULL &&
+                  TEMP_OBJECT(arguments->obj)) {
+                dump_any_temp(arguments->obj);
+              } /* if */
+              arguments++;
+              temp_bits >>= 1;
+            } /* while */
+          } /* if */
+          if (unlikely(fail_flag)) {
+            goto unwind;
+          } /* if */
+          sp->obj = result;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_END_ACTION, op_end_action)
+          if (unlikely(interrupt_flag)) {
+            if (!fail_flag) {
+              curr_exec_object = pc->object;
+              curr_argument_list = NULL;
+              show_signal();
+            } /* if */
+            if (fail_flag) {
+              goto unwind;
+            } /* if */
+          } /* if */
+          for (pos = pc->num_args; pos != 0; pos--) {
+            sp--;
+            if (sp->obj != NULL && TEMP_OBJECT(sp->obj)) {
+              dump_any_temp(sp->obj);
+            } /* if */
+          } /* for */
+          sp->obj = SYS_EMPTY_OBJECT;
+          sp->next = &sp[1];
+          sp++;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_POP, op_pop)
+          sp--;
+          pc++;
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_JUMP, op_jump)
+          pc = &code->instr[pc->jump];
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_JUMP_FALSE, op_jump_false)
+          sp--;
+          object = sp->obj;
+          cond = take_bool(object);
+          if (TEMP_OBJECT(object) &&
+              (CATEGORY_OF_OBJ(object) == CONSTENUMOBJECT ||
+               CATEGORY_OF_OBJ(object) == VARENUMOBJECT)) {
+            FREE_OBJECT(object);
+          } /* if */
+          if (cond == SYS_FALSE_OBJECT) {
+            pc = &code->instr[pc->jump];
+          } else if (likely(cond == SYS_TRUE_OBJECT)) {
+            pc++;
+          } else {
+            curr_exec_object = pc->object;
+            category_required(ENUMLITERALOBJECT, cond);
+            goto unwind;
+          } /* if */
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_FOR_TO, op_for_to)
+          object = sp[-3].obj;
+          if (unlikely(!VAR_OBJECT(object) ||
+                       CATEGORY_OF_OBJ(object) != INTOBJECT ||
+                       CATEGORY_OF_OBJ(sp[-2].obj) != INTOBJECT ||
+                       CATEGORY_OF_OBJ(sp[-1].obj) != INTOBJECT ||
+                       sp[-1].obj->value.intValue == INTTYPE_MAX)) {
+            exec_for_action(pc, &sp[-3]);
+            if (unlikely(fail_flag)) {
+              goto unwind;
+            } /* if */
+            pc = &code->instr[pc->jump];
+          } else {
+            loop_limit[pc->num_args] = sp[-1].obj->value.intValue;
+            object->value.intValue = sp[-2].obj->value.intValue;
+            if (object->value.intValue <= loop_limit[pc->num_args]) {
+              pc++;
+            } else {
+              pc = &code->instr[pc->jump];
+            } /* if */
+          } /* if */
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_FOR_TO_NEXT, op_for_to_next)
+          object = sp[-3].obj;
+          object->value.intValue++;
+          if (object->value.intValue <= loop_limit[pc->num_args]) {
+            pc = &code->instr[pc->jump];
+          } else {
+            pc++;
+          } /* if */
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_FOR_DOWNTO, op_for_downto)
+          object = sp[-3].obj;
+          if (unlikely(!VAR_OBJECT(object) ||
+                       CATEGORY_OF_OBJ(object) != INTOBJECT ||
+                       CATEGORY_OF_OBJ(sp[-2].obj) != INTOBJECT ||
+                       CATEGORY_OF_OBJ(sp[-1].obj) != INTOBJECT ||
+                       sp[-1].obj->value.intValue == INTTYPE_MIN)) {
+            exec_for_action(pc, &sp[-3]);
+            if (unlikely(fail_flag)) {
+              goto unwind;
+            } /* if */
+            pc = &code->instr[pc->jump];
+          } else {
+            loop_limit[pc->num_args] = sp[-1].obj->value.intValue;
+            object->value.intValue = sp[-2].obj->value.intValue;
+            if (object->value.intValue >= loop_limit[pc->num_args]) {
+              pc++;
+            } else {
+              pc = &code->instr[pc->jump];
+            } /* if */
+          } /* if */
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_FOR_DOWNTO_NEXT, op_for_downto_next)
+          object = sp[-3].obj;
+          object->value.intValue--;
+          if (object->value.intValue >= loop_limit[pc->num_args]) {
+            pc = &code->instr[pc->jump];
+          } else {
+            pc++;
+          } /* if */
+          NEXT_INSTRUCTION;
+        INSTRUCTION(OP_RETURN, op_return)
+          result = stack->obj;
+          pop_arg_frame(stack);
+          logFunction(printf("exec_code(" FMT_U_MEM ") --> ",
+                             (memSizeType) code);
+                      trace1(result);
+                      printf("\n"););
+          return result;
+      } /* switch */
+    } /* for */
+
+  unwind:
+    /* An exception was raised. The arguments of the pending actions */
+    /* are released, like the tree walker does in dump_arg_list().   */
+    while (sp != stack) {
+      sp--;
+      if (sp->obj != NULL && TEMP_OBJECT(sp->obj)) {
+        dump_any_temp(sp->obj);
+      } /* if */
+    } /* while */
+    pop_arg_frame(stack);
+    logFunction(printf("exec_code(" FMT_U_MEM ") fail_flag=%d -->\n",
+                       (memSizeType) code, fail_flag););
+    return fail_value;
+  } /* exec_code */
+
+
+
+/**
+ *  Execute the body of 'block' as threaded code.
+ *  The body is lowered to threaded code, when it is executed first.
+ *  If there is not enough memory for the code the body is executed
+ *  with the tree walker.
+ *  @return the result of the body.
+ */
+objectType exec_block_code (blockType block)
+
+  { /* exec_block_code */
+    if (unlikely(block->code == NULL)) {
+      block->code = lower_block(block);
+      if (block->code == NULL) {
+        return exec_call(block->body);
+      } /* if */
+    } /* if */
+    return exec_code(block->code);
+  } /* exec_block_code */
+
+
+
+void free_code (codeType code)
+
+  { /* free_code */
+    FREE_HEAP(code, SIZ_CODE(code->size));
+  } /* free_code */
@@ -391,6 +391,7 @@ void prot_set (const_setType setValue)
     intType position;
     bitSetType bitset_elem;
     unsigned int bit_index;
+    intType last_elem;
     boolType first_elem;
 
   /* prot_set */
@@ -401,6 +402,17 @@ void prot_set (const_setType setValue)
       prot_int(setValue->max_position);
       prot_cstri("]{");
       first_elem = TRUE;
+      if (isSparseSet(setValue) && !setIsEmpty(setValue)) {
+        /* The loop below is skipped for a sparse set. */
+        position = setMin(setValue);
+        last_elem = setMax(setValue);
+        prot_int(position);
+        while (position != last_elem) {
+          position = setNext(setValue, position);
+          prot_cstri(", ");
+          prot_int(position);
+        } /* while */
+      } /* if */
       for (position = setValue->min_position; position <= setValue->max_position; position++) {
         bitset_elem = setValue->bitset[position - setValue->min_position];
         if (bitset_elem != 0) {